@@ -0,0 +1,44 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "BatchVerification.h"
+
+using namespace std;
+using namespace ecc;
+
+BatchWeights::BatchWeights(const vector<uint8_t>& transcript, const HashFunction& hash) : _hash(hash), _seed(hash(transcript))
+{
+}
+
+vector<uint8_t> BatchWeights::Get(size_t index) const
+{
+    vector<uint8_t> weightInput(_seed);
+    weightInput.push_back(static_cast<uint8_t>(index >> 24));
+    weightInput.push_back(static_cast<uint8_t>(index >> 16));
+    weightInput.push_back(static_cast<uint8_t>(index >> 8));
+    weightInput.push_back(static_cast<uint8_t>(index));
+    
+    vector<uint8_t> weight = _hash(weightInput);
+    weight.resize(BATCH_WEIGHT_SIZE);
+    return weight;
+}
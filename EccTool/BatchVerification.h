@@ -0,0 +1,88 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__BatchVerification__
+#define __EccTool__BatchVerification__
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+using namespace std;
+
+// The parts shared by the batch verification of Schnorr and Ed25519 signatures (see Schnorr::VerifyBatch()
+//  and Ed25519::VerifyBatch()). Both check a group of signatures through one random linear combination of
+//  their verification equations, and find the invalid signatures of a group which fails by bisection.
+namespace ecc
+{
+    // The size of the weights of the linear combination. 128 bits make the chance that an invalid group
+    //  passes negligible.
+    const size_t BATCH_WEIGHT_SIZE = 16;
+    
+    // Derives the weights of the linear combination for one group of signatures.
+    class BatchWeights
+    {
+    public:
+        typedef function<vector<uint8_t>(const vector<uint8_t>&)> HashFunction;
+        
+        // Seeds the weights with hash(transcript). The transcript must cover every signature of the group
+        //  along with its key and message (e.g. through the challenge), so that the weights can't be known
+        //  before the signatures are chosen.
+        BatchWeights(const vector<uint8_t>& transcript, const HashFunction& hash);
+        
+        // Returns the weight of the signature at the given position of the group: the first
+        //  BATCH_WEIGHT_SIZE bytes of hash(seed || index), with the index as 4 big-endian bytes.
+        vector<uint8_t> Get(size_t index) const;
+        
+    private:
+        HashFunction _hash;
+        vector<uint8_t> _seed;
+    };
+    
+    // Sets the result of every signature of the group (by its index member) which is valid. checkGroup is
+    //  the combined check of a group. A group which fails it is split in half until the invalid signatures
+    //  are isolated, whose results are left unset.
+    template<typename PreparedSignature>
+    void VerifyBatchGroup(const vector<const PreparedSignature*>& group,
+        const function<bool(const vector<const PreparedSignature*>&)>& checkGroup, vector<bool>& results)
+    {
+        if(group.empty())
+            return;
+        
+        if(checkGroup(group))
+        {
+            for(auto signature : group)
+                results[signature->index] = true;
+            return;
+        }
+        
+        if(group.size() == 1)
+            return;
+        
+        size_t half = group.size() / 2;
+        VerifyBatchGroup(vector<const PreparedSignature*>(group.begin(), group.begin() + half), checkGroup, results);
+        VerifyBatchGroup(vector<const PreparedSignature*>(group.begin() + half, group.end()), checkGroup, results);
+    }
+}
+
+#endif /* defined(__EccTool__BatchVerification__) */
@@ -0,0 +1,470 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <cstring>
+#include "BinaryFieldElement.h"
+
+// Carry-less multiplication (PCLMULQDQ) is used on x86 processors which support it, found by a
+//  runtime check, and a portable implementation elsewhere.
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <wmmintrin.h>
+#define ECC_CARRYLESS_MULTIPLY
+#define ECC_CARRYLESS_MULTIPLY_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#include <wmmintrin.h>
+#define ECC_CARRYLESS_MULTIPLY
+#define ECC_CARRYLESS_MULTIPLY_TARGET __attribute__((target("pclmul,sse2")))
+#endif
+
+using namespace std;
+
+namespace
+{
+    // Returns whether the processor supports PCLMULQDQ (CPUID function 1, bit 1 of ECX).
+    bool DetectCarrylessMultiply()
+    {
+#if defined(ECC_CARRYLESS_MULTIPLY) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        return ((info[2] & (1 << 1)) != 0);
+#elif defined(ECC_CARRYLESS_MULTIPLY)
+        unsigned int eax, ebx, ecx, edx;
+        if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+            return false;
+        return ((ecx & (1 << 1)) != 0);
+#else
+        return false;
+#endif
+    }
+    
+#if defined(ECC_CARRYLESS_MULTIPLY)
+    // Multiplies two 64-bit polynomials with a single PCLMULQDQ instruction.
+    ECC_CARRYLESS_MULTIPLY_TARGET
+    void MultiplyWordWithInstruction(uint64_t a, uint64_t b, uint64_t& low, uint64_t& high)
+    {
+        __m128i product = _mm_clmulepi64_si128(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&a)),
+                                               _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&b)), 0x00);
+        
+        uint64_t result[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result), product);
+        low = result[0];
+        high = result[1];
+    }
+#endif
+    
+    // Multiplies two 64-bit polynomials with a 4-bit window over a (found here: Guide to Elliptic Curve
+    //  Cryptography, Hankerson, Menezes, Vanstone, Algorithm 2.36). The table holds the 16 multiples of
+    //  the low 61 bits of b so that they fit in a word, and the top 3 bits of b are added separately.
+    void MultiplyWordPortable(uint64_t a, uint64_t b, uint64_t& low, uint64_t& high)
+    {
+        uint64_t table[16];
+        uint64_t b61 = b & 0x1FFFFFFFFFFFFFFFull;
+        table[0] = 0;
+        table[1] = b61;
+        for(size_t i = 2; i < 16; i += 2)
+        {
+            table[i] = table[i / 2] << 1;
+            table[i + 1] = table[i] ^ b61;
+        }
+        
+        low = 0;
+        high = 0;
+        for(int shift = 60; shift >= 0; shift -= 4)
+        {
+            high = (high << 4) | (low >> 60);
+            low = (low << 4) ^ table[(a >> shift) & 0xF];
+        }
+        
+        for(int bit = 61; bit < 64; bit++)
+        {
+            if((b >> bit) & 1)
+            {
+                low ^= a << bit;
+                high ^= a >> (64 - bit);
+            }
+        }
+    }
+    
+    // Spreads the bits of a nibble into the even bits of a byte, which squares it as a polynomial.
+    const uint8_t SQUARED_NIBBLES[16] = {
+        0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15,
+        0x40, 0x41, 0x44, 0x45, 0x50, 0x51, 0x54, 0x55
+    };
+    
+    // Spreads the bits of a 32-bit half word into the even bits of a word.
+    uint64_t SquareHalfWord(uint32_t half)
+    {
+        uint64_t result = 0;
+        for(int nibble = 7; nibble >= 0; --nibble)
+            result = (result << 8) | SQUARED_NIBBLES[(half >> (4 * nibble)) & 0xF];
+        
+        return result;
+    }
+    
+    // Adds (exclusive or) word shifted left by the given number of bits into the polynomial.
+    void AddShiftedWord(uint64_t* polynomial, size_t bitOffset, uint64_t word)
+    {
+        size_t index = bitOffset / 64;
+        size_t shift = bitOffset % 64;
+        polynomial[index] ^= word << shift;
+        if(shift != 0)
+            polynomial[index + 1] ^= word >> (64 - shift);
+    }
+}
+
+// BinaryField
+
+BinaryField::BinaryField(const BigInteger& polynomial)
+    : _m(0), _wordCount(0)
+{
+    if((polynomial <= 0) || !polynomial.GetBitAt(0))
+        throw invalid_argument("The reduction polynomial must have a constant term.");
+    
+    _m = polynomial.GetMostSignificantBitIndex();
+    _wordCount = (_m + 63) / 64;
+    if((_m < 64) || (_wordCount > MAX_WORD_COUNT))
+        throw invalid_argument("Unsupported binary field size.");
+    
+    for(size_t term = _m - 1; term > 0; --term)
+    {
+        if(polynomial.GetBitAt(term))
+        {
+            if(term > _m - 64)
+                throw invalid_argument("Unsupported reduction polynomial.");
+            
+            _lowTerms.push_back(term);
+        }
+    }
+    
+    _lowTerms.push_back(0);
+}
+
+size_t BinaryField::GetDegree() const
+{
+    return _m;
+}
+
+size_t BinaryField::GetWordCount() const
+{
+    return _wordCount;
+}
+
+void BinaryField::Reduce(uint64_t* polynomial) const
+{
+    // Since z^m = z^k1 + ... + z^kr + 1 (mod f), the bits of a word at z^(64i) above z^m are cleared and added
+    //  back at z^(64i - m) times each low term (found here: Guide to Elliptic Curve Cryptography, Hankerson,
+    //  Menezes, Vanstone, Section 2.3.5). As every middle term is at least 64 below m, the words are only added
+    //  to lower words, so a single pass from the top word down reduces the polynomial.
+    size_t topWord = _m / 64;
+    for(size_t i = (2 * _wordCount) - 1; i > topWord; --i)
+    {
+        uint64_t word = polynomial[i];
+        if(word == 0)
+            continue;
+        
+        polynomial[i] = 0;
+        for(size_t term : _lowTerms)
+            AddShiftedWord(polynomial, (64 * i) - _m + term, word);
+    }
+    
+    // Finally reduce the bits at and above z^m in the top word of the result.
+    size_t shift = _m % 64;
+    uint64_t word = polynomial[topWord] >> shift;
+    if(word != 0)
+    {
+        polynomial[topWord] &= (uint64_t(1) << shift) - 1;
+        for(size_t term : _lowTerms)
+            AddShiftedWord(polynomial, term, word);
+    }
+}
+
+bool BinaryField::operator==(const BinaryField& other) const
+{
+    return (_m == other._m) && (_lowTerms == other._lowTerms);
+}
+
+bool BinaryField::operator!=(const BinaryField& other) const
+{
+    return !(*this == other);
+}
+
+// BinaryFieldElement
+
+const bool BinaryFieldElement::_hasCarrylessMultiply = DetectCarrylessMultiply();
+
+BinaryFieldElement BinaryFieldElement::MakeZero(shared_ptr<const BinaryField> field)
+{
+    return BinaryFieldElement(move(field));
+}
+
+BinaryFieldElement BinaryFieldElement::MakeOne(shared_ptr<const BinaryField> field)
+{
+    BinaryFieldElement one(move(field));
+    one._words[0] = 1;
+    
+    return one;
+}
+
+bool BinaryFieldElement::IsCarrylessMultiplySupported()
+{
+    return _hasCarrylessMultiply;
+}
+
+BinaryFieldElement::BinaryFieldElement(shared_ptr<const BinaryField> field)
+    : _field(move(field))
+{
+    if(!_field)
+        throw invalid_argument("The field must not be null.");
+    
+    memset(_words, 0, sizeof(_words));
+}
+
+BinaryFieldElement::BinaryFieldElement(const BigInteger& number, shared_ptr<const BinaryField> field)
+    : _field(move(field))
+{
+    if(!_field)
+        throw invalid_argument("The field must not be null.");
+    
+    if((number < 0) || (number.GetBitSize() > _field->GetDegree()))
+        throw invalid_argument("The number is not an element of the field.");
+    
+    memset(_words, 0, sizeof(_words));
+    
+    // The magnitude is big-endian, the words are least significant first.
+    const vector<uint8_t>& bytes = number.GetMagnitudeBytes();
+    for(size_t i = 0; i < bytes.size(); i++)
+    {
+        size_t bytePosition = bytes.size() - 1 - i;
+        _words[bytePosition / 8] |= static_cast<uint64_t>(bytes[i]) << (8 * (bytePosition % 8));
+    }
+}
+
+void BinaryFieldElement::MultiplyPolynomials(const uint64_t* a, const uint64_t* b, size_t wordCount, uint64_t* product)
+{
+    memset(product, 0, 2 * wordCount * sizeof(uint64_t));
+    
+    for(size_t i = 0; i < wordCount; i++)
+    {
+        for(size_t j = 0; j < wordCount; j++)
+        {
+            uint64_t low;
+            uint64_t high;
+#if defined(ECC_CARRYLESS_MULTIPLY)
+            if(_hasCarrylessMultiply)
+                MultiplyWordWithInstruction(a[i], b[j], low, high);
+            else
+#endif
+                MultiplyWordPortable(a[i], b[j], low, high);
+            
+            product[i + j] ^= low;
+            product[i + j + 1] ^= high;
+        }
+    }
+}
+
+void BinaryFieldElement::SquarePolynomial(const uint64_t* a, size_t wordCount, uint64_t* product)
+{
+    for(size_t i = 0; i < wordCount; i++)
+    {
+        product[2 * i] = SquareHalfWord(static_cast<uint32_t>(a[i]));
+        product[(2 * i) + 1] = SquareHalfWord(static_cast<uint32_t>(a[i] >> 32));
+    }
+}
+
+BinaryFieldElement& BinaryFieldElement::operator+=(const BinaryFieldElement& other)
+{
+    for(size_t i = 0; i < BinaryField::MAX_WORD_COUNT; i++)
+        _words[i] ^= other._words[i];
+    
+    return *this;
+}
+
+BinaryFieldElement& BinaryFieldElement::operator*=(const BinaryFieldElement& other)
+{
+    uint64_t product[2 * BinaryField::MAX_WORD_COUNT];
+    size_t wordCount = _field->GetWordCount();
+    
+    MultiplyPolynomials(_words, other._words, wordCount, product);
+    _field->Reduce(product);
+    memcpy(_words, product, wordCount * sizeof(uint64_t));
+    
+    return *this;
+}
+
+BinaryFieldElement& BinaryFieldElement::operator/=(const BinaryFieldElement& other)
+{
+    return (*this *= other.GetInverse());
+}
+
+BinaryFieldElement& BinaryFieldElement::Square()
+{
+    uint64_t product[2 * BinaryField::MAX_WORD_COUNT];
+    size_t wordCount = _field->GetWordCount();
+    
+    SquarePolynomial(_words, wordCount, product);
+    _field->Reduce(product);
+    memcpy(_words, product, wordCount * sizeof(uint64_t));
+    
+    return *this;
+}
+
+BinaryFieldElement BinaryFieldElement::GetSquare() const
+{
+    BinaryFieldElement copy(*this);
+    copy.Square();
+    
+    return copy;
+}
+
+BinaryFieldElement& BinaryFieldElement::Invert()
+{
+    if(IsZero())
+        throw invalid_argument("Zero has no multiplicative inverse.");
+    
+    // Itoh-Tsujii inversion: a^-1 = a^(2^m - 2) = (a^(2^(m-1) - 1))^2. With beta(k) = a^(2^k - 1), the
+    //  addition chain beta(2k) = beta(k)^(2^k) * beta(k) and beta(k + 1) = beta(k)^2 * a walks the bits of
+    //  m - 1, which takes about m squarings and log2(m) multiplications instead of a division per bit.
+    size_t exponent = _field->GetDegree() - 1;
+    int topBit = 0;
+    while((exponent >> (topBit + 1)) != 0)
+        topBit++;
+    
+    const BinaryFieldElement a(*this);
+    size_t k = 1;
+    for(int bit = topBit - 1; bit >= 0; --bit)
+    {
+        BinaryFieldElement beta(*this);
+        for(size_t i = 0; i < k; i++)
+            beta.Square();
+        
+        *this *= beta;
+        k *= 2;
+        
+        if((exponent >> bit) & 1)
+        {
+            Square();
+            *this *= a;
+            k++;
+        }
+    }
+    
+    return Square();
+}
+
+BinaryFieldElement BinaryFieldElement::GetInverse() const
+{
+    BinaryFieldElement copy(*this);
+    copy.Invert();
+    
+    return copy;
+}
+
+bool BinaryFieldElement::IsZero() const
+{
+    for(size_t i = 0; i < BinaryField::MAX_WORD_COUNT; i++)
+    {
+        if(_words[i] != 0)
+            return false;
+    }
+    
+    return true;
+}
+
+bool BinaryFieldElement::operator==(const BinaryFieldElement& other) const
+{
+    return (memcmp(_words, other._words, sizeof(_words)) == 0) && (*_field == *other._field);
+}
+
+bool BinaryFieldElement::operator!=(const BinaryFieldElement& other) const
+{
+    return !(*this == other);
+}
+
+const shared_ptr<const BinaryField>& BinaryFieldElement::GetField() const
+{
+    return _field;
+}
+
+BigInteger BinaryFieldElement::GetRawInteger() const
+{
+    return BigInteger(GetBytes());
+}
+
+string BinaryFieldElement::ToString() const
+{
+    stringstream stream;
+    stream << hex << setfill('0');
+    
+    vector<uint8_t> bytes = GetBytes();
+    for(uint8_t byte : bytes)
+        stream << setw(2) << static_cast<unsigned int>(byte);
+    
+    return stream.str();
+}
+
+vector<uint8_t> BinaryFieldElement::GetBytes() const
+{
+    size_t byteSize = GetByteSize();
+    vector<uint8_t> bytes(byteSize);
+    for(size_t i = 0; i < byteSize; i++)
+    {
+        size_t bytePosition = byteSize - 1 - i;
+        bytes[i] = static_cast<uint8_t>(_words[bytePosition / 8] >> (8 * (bytePosition % 8)));
+    }
+    
+    return bytes;
+}
+
+size_t BinaryFieldElement::GetByteSize() const
+{
+    return (_field->GetDegree() + 7) / 8;
+}
+
+BinaryFieldElement operator+(BinaryFieldElement lhs, const BinaryFieldElement& rhs)
+{
+    lhs += rhs;
+    return lhs;
+}
+
+BinaryFieldElement operator*(BinaryFieldElement lhs, const BinaryFieldElement& rhs)
+{
+    lhs *= rhs;
+    return lhs;
+}
+
+BinaryFieldElement operator/(BinaryFieldElement lhs, const BinaryFieldElement& rhs)
+{
+    lhs /= rhs;
+    return lhs;
+}
+
+ostream& operator<<(ostream& os, const BinaryFieldElement& element)
+{
+    os << element.ToString();
+    return os;
+}
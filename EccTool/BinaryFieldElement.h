@@ -0,0 +1,150 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__BinaryFieldElement__
+#define __EccTool__BinaryFieldElement__
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "BigInteger.h"
+
+using namespace std;
+
+// BinaryField defines a binary field GF(2^m) by its irreducible reduction polynomial
+//  f(z) = z^m + z^k1 + ... + z^kr + 1. The standard curves use a trinomial or a pentanomial.
+class BinaryField
+{
+private:
+    size_t _m;
+    size_t _wordCount;
+    
+    // The exponents of the terms of f(z) below z^m, including the constant term.
+    vector<size_t> _lowTerms;
+    
+public:
+    // The largest supported field has 9 64-bit words (m = 571).
+    static const size_t MAX_WORD_COUNT = 9;
+    
+    // Creates the field from its reduction polynomial, given as a number whose set bits are the terms of
+    //  f(z). For the word-wise reduction every middle term must be at least 64 below m.
+    explicit BinaryField(const BigInteger& polynomial);
+    
+    // Returns the degree m of the field.
+    size_t GetDegree() const;
+    
+    // Returns the number of 64-bit words used to store an element.
+    size_t GetWordCount() const;
+    
+    // Reduces a polynomial of 2 * GetWordCount() words (least significant word first) modulo f(z) in place.
+    void Reduce(uint64_t* polynomial) const;
+    
+    // Two fields are equal if they have the same reduction polynomial.
+    bool operator==(const BinaryField& other) const;
+    bool operator!=(const BinaryField& other) const;
+};
+
+// BinaryFieldElement represents a polynomial in a binary field GF(2^m) and defines the arithmetic
+//  operations on these elements. Addition is exclusive or, so every element is its own additive inverse.
+class BinaryFieldElement
+{
+private:
+    // The coefficients of the polynomial, least significant word first.
+    uint64_t _words[BinaryField::MAX_WORD_COUNT];
+    shared_ptr<const BinaryField> _field;
+    
+    // Whether the processor supports the carry-less multiplication instruction (PCLMULQDQ).
+    static const bool _hasCarrylessMultiply;
+    
+    // Creates the zero element of the given field.
+    explicit BinaryFieldElement(shared_ptr<const BinaryField> field);
+    
+    // Multiplies two polynomials of wordCount words into a product of 2 * wordCount words.
+    static void MultiplyPolynomials(const uint64_t* a, const uint64_t* b, size_t wordCount, uint64_t* product);
+    
+    // Squares a polynomial of wordCount words into a product of 2 * wordCount words.
+    static void SquarePolynomial(const uint64_t* a, size_t wordCount, uint64_t* product);
+    
+public:
+    // Creates the elements 0 and 1 of the given field.
+    static BinaryFieldElement MakeZero(shared_ptr<const BinaryField> field);
+    static BinaryFieldElement MakeOne(shared_ptr<const BinaryField> field);
+    
+    // Returns whether multiplication uses the carry-less multiplication instruction of the processor
+    //  instead of the portable implementation.
+    static bool IsCarrylessMultiplySupported();
+    
+    // Creates an element from the polynomial whose coefficients are the bits of number. The number must
+    //  be non-negative and of degree less than m.
+    BinaryFieldElement(const BigInteger& number, shared_ptr<const BinaryField> field);
+    
+    // Arithmetic operations in GF(2^m).
+    BinaryFieldElement& operator+=(const BinaryFieldElement& other);
+    BinaryFieldElement& operator*=(const BinaryFieldElement& other);
+    BinaryFieldElement& operator/=(const BinaryFieldElement& other);
+    
+    // Functions to square this element. Squaring is linear in GF(2^m) and much cheaper than a multiplication.
+    BinaryFieldElement& Square();
+    BinaryFieldElement GetSquare() const;
+    
+    // Functions to find the multiplicative inverse of this (non-zero) element.
+    BinaryFieldElement& Invert();
+    BinaryFieldElement GetInverse() const;
+    
+    // Returns whether this is the zero element.
+    bool IsZero() const;
+    
+    // Comparison operators.
+    bool operator==(const BinaryFieldElement& other) const;
+    bool operator!=(const BinaryFieldElement& other) const;
+    
+    // Returns the field of this element.
+    const shared_ptr<const BinaryField>& GetField() const;
+    
+    // Returns the polynomial as a BigInteger whose bits are its coefficients.
+    BigInteger GetRawInteger() const;
+    
+    // Gets a string representation of this field element.
+    string ToString() const;
+    
+    // Returns this field element as bytes. The array is sized to hold m bits, and prepended with zeros.
+    vector<uint8_t> GetBytes() const;
+    
+    // Returns the number of bytes it takes to serialize an element of the field.
+    size_t GetByteSize() const;
+};
+
+// Binary '+' operator implemented as a free function by convention.
+BinaryFieldElement operator+(BinaryFieldElement lhs, const BinaryFieldElement& rhs);
+
+// Binary '*' operator implemented as a free function by convention.
+BinaryFieldElement operator*(BinaryFieldElement lhs, const BinaryFieldElement& rhs);
+
+// Binary '/' operator implemented as a free function by convention.
+BinaryFieldElement operator/(BinaryFieldElement lhs, const BinaryFieldElement& rhs);
+
+// Streaming operator used for printing object to stream.
+ostream& operator<<(ostream& os, const BinaryFieldElement& element);
+
+#endif /* defined(__EccTool__BinaryFieldElement__) */
@@ -0,0 +1,216 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "ChaCha20Drbg.h"
+#include "NativeCrypto.h"
+#include "Utilities.h"
+
+using namespace std;
+
+namespace
+{
+    inline uint32_t RotateLeft(uint32_t value, int count)
+    {
+        return (value << count) | (value >> (32 - count));
+    }
+    
+    inline void QuarterRound(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d)
+    {
+        a += b; d ^= a; d = RotateLeft(d, 16);
+        c += d; b ^= c; b = RotateLeft(b, 12);
+        a += b; d ^= a; d = RotateLeft(d, 8);
+        c += d; b ^= c; b = RotateLeft(b, 7);
+    }
+    
+    // Computes the 64-byte ChaCha20 block for the given key and counter with a zero nonce (RFC 8439,
+    //  Section 2.3). The nonce is not needed since every key is only used for a single refill.
+    void ComputeBlock(const uint32_t key[8], uint32_t counter, uint8_t output[64])
+    {
+        uint32_t initial[16] = { 0x61707865, 0x3320646E, 0x79622D32, 0x6B206574,
+            key[0], key[1], key[2], key[3], key[4], key[5], key[6], key[7], counter, 0, 0, 0 };
+        uint32_t state[16];
+        copy(initial, initial + 16, state);
+        
+        for(int i = 0; i < 10; i++)
+        {
+            QuarterRound(state[0], state[4], state[8], state[12]);
+            QuarterRound(state[1], state[5], state[9], state[13]);
+            QuarterRound(state[2], state[6], state[10], state[14]);
+            QuarterRound(state[3], state[7], state[11], state[15]);
+            QuarterRound(state[0], state[5], state[10], state[15]);
+            QuarterRound(state[1], state[6], state[11], state[12]);
+            QuarterRound(state[2], state[7], state[8], state[13]);
+            QuarterRound(state[3], state[4], state[9], state[14]);
+        }
+        
+        for(int i = 0; i < 16; i++)
+        {
+            uint32_t word = state[i] + initial[i];
+            output[4 * i] = static_cast<uint8_t>(word);
+            output[(4 * i) + 1] = static_cast<uint8_t>(word >> 8);
+            output[(4 * i) + 2] = static_cast<uint8_t>(word >> 16);
+            output[(4 * i) + 3] = static_cast<uint8_t>(word >> 24);
+        }
+    }
+}
+
+ChaCha20Drbg& ChaCha20Drbg::GetThreadInstance()
+{
+#if defined(_MSC_VER) && (_MSC_VER < 1900)
+    // Visual Studio 2013 and earlier only support thread-local storage for plain data, so each thread's
+    //  generator is allocated on first use and kept until the process exits.
+    static __declspec(thread) ChaCha20Drbg* instance = nullptr;
+    if(instance == nullptr)
+        instance = new ChaCha20Drbg();
+    
+    return *instance;
+#else
+    static thread_local ChaCha20Drbg instance;
+    return instance;
+#endif
+}
+
+ChaCha20Drbg::ChaCha20Drbg() : _position(BUFFER_SIZE), _outputSinceReseed(0), _isReseeded(true), _processId(utilities::GetCurrentProcessId())
+{
+    fill(_key, _key + (KEY_SIZE / 4), 0);
+    MixIntoKey(NativeCrypto::GenerateRandomBytes(KEY_SIZE));
+}
+
+ChaCha20Drbg::ChaCha20Drbg(const vector<uint8_t>& seed) : _position(BUFFER_SIZE), _outputSinceReseed(0), _isReseeded(false), _processId(0)
+{
+    if(seed.size() != KEY_SIZE)
+        throw invalid_argument("Seed must be 32 bytes.");
+    
+    fill(_key, _key + (KEY_SIZE / 4), 0);
+    MixIntoKey(seed);
+}
+
+ChaCha20Drbg::~ChaCha20Drbg()
+{
+    // Leave no key or unused output behind in freed memory.
+    volatile uint8_t* buffer = _buffer;
+    for(size_t i = 0; i < BUFFER_SIZE; i++)
+        buffer[i] = 0;
+    
+    volatile uint32_t* key = _key;
+    for(size_t i = 0; i < (KEY_SIZE / 4); i++)
+        key[i] = 0;
+}
+
+void ChaCha20Drbg::MixIntoKey(const vector<uint8_t>& bytes)
+{
+    for(size_t i = 0; i < KEY_SIZE; i++)
+        _key[i / 4] ^= static_cast<uint32_t>(bytes[i]) << (8 * (i % 4));
+}
+
+void ChaCha20Drbg::Refill()
+{
+    if(_isReseeded && (_outputSinceReseed >= RESEED_INTERVAL))
+    {
+        MixIntoKey(NativeCrypto::GenerateRandomBytes(KEY_SIZE));
+        _outputSinceReseed = 0;
+    }
+    
+    for(uint32_t block = 0; block < BLOCK_COUNT; block++)
+        ComputeBlock(_key, block, _buffer + (block * BLOCK_SIZE));
+    
+    // The first bytes become the next key (fast key erasure), and are never output.
+    for(size_t i = 0; i < KEY_SIZE; i++)
+    {
+        if((i % 4) == 0)
+            _key[i / 4] = 0;
+        _key[i / 4] |= static_cast<uint32_t>(_buffer[i]) << (8 * (i % 4));
+    }
+    
+    memset(_buffer, 0, KEY_SIZE);
+    _position = KEY_SIZE;
+}
+
+void ChaCha20Drbg::Generate(uint8_t* output, size_t size)
+{
+    // A child process created by fork() starts with a copy of this generator, and would repeat the
+    //  parent's output (and with it the parent's nonces). Discard the buffered key stream and reseed.
+    if(_isReseeded)
+    {
+        long processId = utilities::GetCurrentProcessId();
+        if(processId != _processId)
+        {
+            memset(_buffer, 0, BUFFER_SIZE);
+            _position = BUFFER_SIZE;
+            MixIntoKey(NativeCrypto::GenerateRandomBytes(KEY_SIZE));
+            _outputSinceReseed = 0;
+            _processId = processId;
+        }
+    }
+    
+    while(size > 0)
+    {
+        if(_position == BUFFER_SIZE)
+            Refill();
+        
+        // Hand out the buffered bytes and erase them.
+        size_t copySize = min(size, BUFFER_SIZE - _position);
+        memcpy(output, _buffer + _position, copySize);
+        memset(_buffer + _position, 0, copySize);
+        
+        _position += copySize;
+        _outputSinceReseed += copySize;
+        output += copySize;
+        size -= copySize;
+    }
+}
+
+vector<uint8_t> ChaCha20Drbg::GenerateBytes(size_t size)
+{
+    vector<uint8_t> bytes(size);
+    if(size > 0)
+        Generate(bytes.data(), size);
+    
+    return bytes;
+}
+
+BigInteger ChaCha20Drbg::GenerateIntegerBelow(const BigInteger& max)
+{
+    if(max <= BigInteger(1u))
+        throw invalid_argument("Maximum must be greater than one.");
+    
+    // Candidates have the bit length of max - 1, so at least half of them are in range.
+    size_t bitCount = (max - BigInteger(1u)).GetBitSize();
+    size_t byteCount = (bitCount + 7) / 8;
+    uint8_t topByteMask = static_cast<uint8_t>(0xFF >> ((8 * byteCount) - bitCount));
+    
+    const BigInteger zero;
+    vector<uint8_t> bytes(byteCount);
+    while(true)
+    {
+        Generate(bytes.data(), byteCount);
+        bytes[0] &= topByteMask;
+        
+        BigInteger candidate(bytes);
+        if((candidate > zero) && (candidate < max))
+            return candidate;
+    }
+}
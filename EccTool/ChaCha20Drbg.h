@@ -0,0 +1,106 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__ChaCha20Drbg__
+#define __EccTool__ChaCha20Drbg__
+
+#include <cstdint>
+#include <vector>
+#include "BigInteger.h"
+
+using namespace std;
+
+// A deterministic random bit generator which expands a 32-byte key with the ChaCha20 block function
+//  (RFC 8439), seeded from the operating system (see NativeCrypto::GenerateRandomBytes()).
+//
+// Output is produced in bulk: each refill computes BLOCK_COUNT blocks of key stream, the first 32 bytes of
+//  which replace the key (so earlier output cannot be recovered from the state) and the rest is handed out
+//  and erased as it is consumed. Fresh operating system randomness is mixed into the key after every
+//  RESEED_INTERVAL bytes of output, and whenever the generator finds itself in a new process (after fork()).
+//
+// An instance is not thread-safe; GetThreadInstance() returns a separate instance for every thread, so
+//  threads never contend for the generator.
+class ChaCha20Drbg
+{
+public:
+    // The size of the key, and of seeds.
+    static const size_t KEY_SIZE = 32;
+    
+    // The number of 64-byte blocks computed per refill of the buffer.
+    static const size_t BLOCK_COUNT = 16;
+    
+    // The number of bytes output between two reseeds from the operating system.
+    static const uint64_t RESEED_INTERVAL = 1 << 20;
+    
+    // Returns the generator of the calling thread, seeded from the operating system on first use.
+    static ChaCha20Drbg& GetThreadInstance();
+    
+    // Creates a generator seeded from the operating system.
+    ChaCha20Drbg();
+    
+    // Creates a generator with the given KEY_SIZE-byte seed, which is never reseeded. It returns the same
+    //  output for the same seed, and is meant for tests only.
+    explicit ChaCha20Drbg(const vector<uint8_t>& seed);
+    
+    ~ChaCha20Drbg();
+    
+    // Fills the buffer with size random bytes.
+    void Generate(uint8_t* output, size_t size);
+    
+    // Returns size random bytes.
+    vector<uint8_t> GenerateBytes(size_t size);
+    
+    // Returns a uniformly distributed integer in the range 0 < generated < max, drawn by rejection sampling
+    //  of numbers with as many bits as max - 1 (which needs fewer than two draws on average).
+    BigInteger GenerateIntegerBelow(const BigInteger& max);
+    
+private:
+    static const size_t BLOCK_SIZE = 64;
+    static const size_t BUFFER_SIZE = BLOCK_COUNT * BLOCK_SIZE;
+    
+    // The key as eight little-endian words.
+    uint32_t _key[KEY_SIZE / 4];
+    
+    // The key stream of the last refill, and the position of the first byte not handed out yet.
+    uint8_t _buffer[BUFFER_SIZE];
+    size_t _position;
+    
+    // The number of bytes output since the last reseed, and whether to reseed at all.
+    uint64_t _outputSinceReseed;
+    bool _isReseeded;
+    
+    // The process the generator was last seeded in.
+    long _processId;
+    
+    // Copies would repeat the output of the original, so generators are not copyable.
+    ChaCha20Drbg(const ChaCha20Drbg&);
+    ChaCha20Drbg& operator=(const ChaCha20Drbg&);
+    
+    // Replaces the key by the key XOR the given bytes.
+    void MixIntoKey(const vector<uint8_t>& bytes);
+    
+    // Computes the next BLOCK_COUNT blocks of key stream into the buffer and replaces the key.
+    void Refill();
+};
+
+#endif /* defined(__EccTool__ChaCha20Drbg__) */
@@ -0,0 +1,190 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "CurveContext.h"
+#include "DefinedCurveDomainParameters.h"
+#include "Ed25519.h"
+#include "PrecomputedTableFile.h"
+#include "X25519.h"
+
+using namespace std;
+
+mutex CurveContext::_registryMutex;
+unordered_map<string, shared_ptr<const CurveContext>> CurveContext::_registry;
+string CurveContext::_tableDirectory;
+
+CurveContext::CurveContext(const EllipticCurve& curve) : _curve(new EllipticCurve(curve))
+{
+}
+
+CurveContext::CurveContext(const KoblitzCurve& curve) : _binaryCurve(new KoblitzCurve(curve))
+{
+}
+
+CurveContext::CurveContext(const string& name) : _name(name)
+{
+}
+
+vector<string> CurveContext::GetSupportedCurveNames()
+{
+    vector<string> names = GetSupportedCurves();
+    names.push_back(X25519::CURVE_NAME);
+    names.push_back(Ed25519::CURVE_NAME);
+    
+    vector<string> binaryCurves = GetSupportedBinaryCurves();
+    names.insert(names.end(), binaryCurves.begin(), binaryCurves.end());
+    
+    return names;
+}
+
+shared_ptr<const CurveContext> CurveContext::GetByName(const string& name)
+{
+    string tableDirectory;
+    {
+        lock_guard<mutex> lock(_registryMutex);
+        
+        auto found = _registry.find(name);
+        if(found != _registry.end())
+            return found->second;
+        
+        tableDirectory = _tableDirectory;
+    }
+    
+    // Curve25519 and edwards25519 have no domain parameters, their contexts only mark keys for X25519 and
+    //  Ed25519. The binary curves have their own arithmetic (see KoblitzCurve.h), and their NIST names are
+    //  resolved by GetBinaryCurveByName().
+    const char* const encodedKeyCurves[][2] = {
+        { X25519::CURVE_NAME, X25519::CURVE_ALIAS },
+        { Ed25519::CURVE_NAME, Ed25519::CURVE_ALIAS }
+    };
+    string canonicalName;
+    for(const auto& curveNames : encodedKeyCurves)
+    {
+        if((name == curveNames[0]) || (name == curveNames[1]))
+            canonicalName = curveNames[0];
+    }
+    
+    bool isEncodedKeyCurve = !canonicalName.empty();
+    bool isBinary = !isEncodedKeyCurve && IsBinaryCurveName(name);
+    if(isBinary)
+        canonicalName = GetBinaryCurveByName(name).name;
+    else if(!isEncodedKeyCurve)
+        canonicalName = GetCurveByName(name).name;
+    
+    // The context may already exist under the curve's canonical name if it was requested by an alias before.
+    {
+        lock_guard<mutex> lock(_registryMutex);
+        
+        auto found = _registry.find(canonicalName);
+        if(found != _registry.end())
+        {
+            _registry[name] = found->second;
+            return found->second;
+        }
+    }
+    
+    // Build the context without holding the lock, since building a curve validates its parameters and loads
+    //  (or builds and stores) its base point table, which would hold up the lookups of every other curve.
+    //  Threads asking for the same curve meanwhile build their own context, and the first one registered is
+    //  the one kept.
+    shared_ptr<const CurveContext> context;
+    if(isEncodedKeyCurve)
+        context = shared_ptr<const CurveContext>(new CurveContext(canonicalName));
+    else if(isBinary)
+        context = shared_ptr<const CurveContext>(new CurveContext(KoblitzCurve(GetBinaryCurveByName(name))));
+    else
+    {
+        EllipticCurve curve(GetCurveByName(name));
+        if(!tableDirectory.empty())
+            PrecomputedTableFile::LoadBasePointTable(tableDirectory, curve);
+        
+        context = shared_ptr<const CurveContext>(new CurveContext(curve));
+    }
+    
+    lock_guard<mutex> lock(_registryMutex);
+    
+    auto found = _registry.find(canonicalName);
+    if(found != _registry.end())
+        context = found->second;
+    else
+        _registry[canonicalName] = context;
+    _registry[name] = context;
+    
+    return context;
+}
+
+void CurveContext::SetTableDirectory(const string& directory)
+{
+    lock_guard<mutex> lock(_registryMutex);
+    _tableDirectory = directory;
+}
+
+shared_ptr<const CurveContext> CurveContext::Create(const EllipticCurve& curve)
+{
+    return shared_ptr<const CurveContext>(new CurveContext(curve));
+}
+
+string CurveContext::GetName() const
+{
+    if(_curve)
+        return _curve->GetCurveName();
+    if(_binaryCurve)
+        return _binaryCurve->GetName();
+    
+    return _name;
+}
+
+bool CurveContext::IsX25519() const
+{
+    return !_curve && (_name == X25519::CURVE_NAME);
+}
+
+bool CurveContext::IsEd25519() const
+{
+    return !_curve && (_name == Ed25519::CURVE_NAME);
+}
+
+bool CurveContext::IsBinary() const
+{
+    return static_cast<bool>(_binaryCurve);
+}
+
+const EllipticCurve& CurveContext::GetCurve() const
+{
+    if(IsX25519())
+        throw invalid_argument("Curve25519 keys can only be used to encrypt and decrypt (X25519).");
+    if(IsEd25519())
+        throw invalid_argument("Ed25519 keys can only be used to sign and verify.");
+    if(IsBinary())
+        throw invalid_argument("Binary curve keys can only be used to sign and verify (ECDSA).");
+    
+    return *_curve;
+}
+
+const KoblitzCurve& CurveContext::GetBinaryCurve() const
+{
+    if(!IsBinary())
+        throw invalid_argument(GetName() + " is not a binary curve.");
+    
+    return *_binaryCurve;
+}
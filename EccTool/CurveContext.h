@@ -0,0 +1,108 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__CurveContext__
+#define __EccTool__CurveContext__
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "EccDefs.h"
+#include "EllipticCurve.h"
+#include "KoblitzCurve.h"
+
+using namespace std;
+using namespace ecc;
+
+// An immutable curve shared by all algs using it. The contexts of the defined curves are interned:
+//  each is built once per process on first use, and its precomputed tables (which the curve builds
+//  lazily) are then shared by every alg and key on that curve.
+//
+// Besides the short Weierstrass curves of GetSupportedCurves(), a context can be for Curve25519 or
+//  edwards25519, whose keys are used with X25519 (see X25519.h) or Ed25519 (see Ed25519.h) rather than with
+//  an EllipticCurve. The binary Koblitz curves of GetSupportedBinaryCurves() have a KoblitzCurve instead,
+//  and their keys are only used with ECDSA.
+class CurveContext
+{
+public:
+    // Returns the names of all curves which have a context: the curves of GetSupportedCurves(), followed
+    //  by Curve25519, edwards25519 and the curves of GetSupportedBinaryCurves().
+    static vector<string> GetSupportedCurveNames();
+    
+    // Returns the shared context of the defined curve with the given name (see GetSupportedCurveNames()),
+    //  building it on first use. Throws invalid_argument if the curve is not supported. Thread-safe: a curve
+    //  being built does not hold up lookups of the others.
+    static shared_ptr<const CurveContext> GetByName(const string& name);
+    
+    // Sets the directory in which the base point tables of the defined curves are stored (see
+    //  PrecomputedTableFile). Contexts created afterwards load their table from there, or build and store
+    //  it if there is no usable table yet. An empty directory (the default) disables table files.
+    static void SetTableDirectory(const string& directory);
+    
+    // Creates a context for a curve which is not interned, such as one with custom parameters.
+    static shared_ptr<const CurveContext> Create(const EllipticCurve& curve);
+    
+    // Returns the name of the curve of this context.
+    string GetName() const;
+    
+    // Returns whether this is the context of Curve25519.
+    bool IsX25519() const;
+    
+    // Returns whether this is the context of edwards25519 (used with Ed25519).
+    bool IsEd25519() const;
+    
+    // Returns whether this is the context of a binary Koblitz curve.
+    bool IsBinary() const;
+    
+    // Returns the curve of this context. Throws invalid_argument for Curve25519, edwards25519 and the
+    //  binary curves.
+    const EllipticCurve& GetCurve() const;
+    
+    // Returns the binary curve of this context. Throws invalid_argument for the other curves.
+    const KoblitzCurve& GetBinaryCurve() const;
+    
+private:
+    explicit CurveContext(const EllipticCurve& curve);
+    explicit CurveContext(const KoblitzCurve& curve);
+    
+    // Creates the context of Curve25519 or edwards25519, given its name.
+    explicit CurveContext(const string& name);
+    
+    // The curve, or null for Curve25519, edwards25519 and the binary curves.
+    unique_ptr<const EllipticCurve> _curve;
+    
+    // The binary curve, or null for all others.
+    unique_ptr<const KoblitzCurve> _binaryCurve;
+    
+    // The name of Curve25519 or edwards25519.
+    string _name;
+    
+    // The interned contexts by curve name. Aliases (such as "P-256" for "secp256r1") map to the
+    //  same context.
+    static mutex _registryMutex;
+    static unordered_map<string, shared_ptr<const CurveContext>> _registry;
+    static string _tableDirectory;
+};
+
+#endif /* defined(__EccTool__CurveContext__) */
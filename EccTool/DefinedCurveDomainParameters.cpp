@@ -32,29 +32,131 @@ using namespace ecc;
 // The following are a few sets of standard curve parameters.
 // Curve definition found here: http://www.secg.org/collateral/sec2_final.pdf
 
+namespace
+{
+    // The table of supported curves, each listed under its SEC 2 name.
+    struct DefinedCurve
+    {
+        const char* name;
+        DomainParameters (*getParameters)();
+    };
+    
+    const DefinedCurve DEFINED_CURVES[] = {
+        { "secp112r1", GetSecp112r1Curve },
+        { "secp256k1", GetSecp256k1Curve },
+        { "secp224r1", GetNistP224Curve },
+        { "secp256r1", GetNistP256Curve },
+        { "secp384r1", GetNistP384Curve },
+        { "secp521r1", GetNistP521Curve }
+    };
+    
+    // The NIST names of the NIST curves. They are accepted by GetCurveByName() but not listed by
+    //  GetSupportedCurves(), so that every curve is listed once.
+    const char* const CURVE_ALIASES[][2] = {
+        { "P-224", "secp224r1" },
+        { "P-256", "secp256r1" },
+        { "P-384", "secp384r1" },
+        { "P-521", "secp521r1" }
+    };
+    
+    // The table of supported binary curves, each listed under its SEC 2 name.
+    struct DefinedBinaryCurve
+    {
+        const char* name;
+        BinaryDomainParameters (*getParameters)();
+    };
+    
+    const DefinedBinaryCurve DEFINED_BINARY_CURVES[] = {
+        { "sect163k1", GetSect163k1Curve },
+        { "sect233k1", GetSect233k1Curve },
+        { "sect283k1", GetSect283k1Curve }
+    };
+    
+    // The NIST names of the binary curves, accepted by GetBinaryCurveByName() like CURVE_ALIASES.
+    const char* const BINARY_CURVE_ALIASES[][2] = {
+        { "K-163", "sect163k1" },
+        { "K-233", "sect233k1" },
+        { "K-283", "sect283k1" }
+    };
+}
+
 const vector<string> ecc::GetSupportedCurves()
 {
     vector<string> curves;
     
     // Add all supported curves by name.
-    curves.push_back("secp112r1");
-    curves.push_back("secp256k1");
+    for(const DefinedCurve& curve : DEFINED_CURVES)
+        curves.push_back(curve.name);
     
     return curves;
 }
 
 const DomainParameters ecc::GetCurveByName(const string& name)
 {
-    if(name == "secp256k1")
-        return GetSecp256k1Curve();
-    if(name == "secp112r1")
-        return GetSecp112r1Curve();
+    string canonicalName = name;
+    for(const auto& alias : CURVE_ALIASES)
+    {
+        if(name == alias[0])
+            canonicalName = alias[1];
+    }
+    
+    for(const DefinedCurve& curve : DEFINED_CURVES)
+    {
+        if(canonicalName == curve.name)
+            return curve.getParameters();
+    }
     
     throw invalid_argument("Unsupported curve: " + name);
 }
 
+const vector<string> ecc::GetSupportedBinaryCurves()
+{
+    vector<string> curves;
+    for(const DefinedBinaryCurve& curve : DEFINED_BINARY_CURVES)
+        curves.push_back(curve.name);
+    
+    return curves;
+}
+
+const BinaryDomainParameters ecc::GetBinaryCurveByName(const string& name)
+{
+    string canonicalName = name;
+    for(const auto& alias : BINARY_CURVE_ALIASES)
+    {
+        if(name == alias[0])
+            canonicalName = alias[1];
+    }
+    
+    for(const DefinedBinaryCurve& curve : DEFINED_BINARY_CURVES)
+    {
+        if(canonicalName == curve.name)
+            return curve.getParameters();
+    }
+    
+    throw invalid_argument("Unsupported binary curve: " + name);
+}
+
+bool ecc::IsBinaryCurveName(const string& name)
+{
+    for(const auto& alias : BINARY_CURVE_ALIASES)
+    {
+        if(name == alias[0])
+            return true;
+    }
+    
+    for(const DefinedBinaryCurve& curve : DEFINED_BINARY_CURVES)
+    {
+        if(name == curve.name)
+            return true;
+    }
+    
+    return false;
+}
+
 DomainParameters ecc::GetSecp256k1Curve()
 {
+    // Since p = 1 (mod 3) and a = 0, this curve has the endomorphism (x, y) -> (beta * x, y) where beta
+    //  is a cube root of unity mod p. The endomorphism constants are those used by libsecp256k1.
     DomainParameters params = {
         "secp256k1",
         "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE FFFFFC2F", //p
@@ -62,7 +164,13 @@ DomainParameters ecc::GetSecp256k1Curve()
         "00000000 00000000 00000000 00000000 00000000 00000000 00000000 00000007", //b
         "04 79BE667E F9DCBBAC 55A06295 CE870B07 029BFCDB 2DCE28D9 59F2815B 16F81798 483ADA77 26A3C465 5DA4FBFC 0E1108A8 FD17B448 A6855419 9C47D08F FB10D4B8", //G (uncompressed)
         "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE BAAEDCE6 AF48A03B BFD25E8C D0364141", //n
-        "01" //h
+        "01", //h
+        "7AE96A2B 657C0710 6E64479E AC3434E9 9CF04975 12F58995 C1396C28 719501EE", //beta
+        "5363AD4C C05C30E0 A5261C02 8812645A 122E22EA 20816678 DF02967C 1B23BD72", //lambda
+        "3086D221 A7D46BCD E86C90E4 9284EB15", //a1
+        "-E4437ED6 010E8828 6F547FA9 0ABFE4C3", //b1
+        "01 14CA50F7 A8E2F3F6 57C1108D 9D44CFD8", //a2
+        "3086D221 A7D46BCD E86C90E4 9284EB15" //b2
     };
     
     return params;
@@ -77,7 +185,148 @@ DomainParameters ecc::GetSecp112r1Curve()
         "659E F8BA0439 16EEDE89 11702B22", //b
         "04 09487239 995A5EE7 6B55F9C2 F098A89C E5AF8724 C0A23E0E 0FF77500", //G (uncompressed)
         "DB7C 2ABF62E3 5E7628DF AC6561C5", //n
-        "01" //h
+        "01", //h
+        "", //beta
+        "", //lambda
+        "", //a1
+        "", //b1
+        "", //a2
+        "" //b2
+    };
+    
+    return params;
+}
+
+// The NIST curves (found here: FIPS 186-4, Appendix D.1.2). Their primes are generalized Mersenne numbers
+//  for which FieldElement uses a fast reduction (see FieldReduction.h).
+
+DomainParameters ecc::GetNistP224Curve()
+{
+    DomainParameters params = {
+        "secp224r1", //name
+        "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF 00000000 00000000 00000001", //p
+        "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE FFFFFFFF FFFFFFFF FFFFFFFE", //a
+        "B4050A85 0C04B3AB F5413256 5044B0B7 D7BFD8BA 270B3943 2355FFB4", //b
+        "04 B70E0CBD 6BB4BF7F 321390B9 4A03C1D3 56C21122 343280D6 115C1D21 BD376388 B5F723FB 4C22DFE6 CD4375A0 5A074764 44D58199 85007E34", //G (uncompressed)
+        "FFFFFFFF FFFFFFFF FFFFFFFF FFFF16A2 E0B8F03E 13DD2945 5C5C2A3D", //n
+        "01", //h
+        "", //beta
+        "", //lambda
+        "", //a1
+        "", //b1
+        "", //a2
+        "" //b2
+    };
+    
+    return params;
+}
+
+DomainParameters ecc::GetNistP256Curve()
+{
+    DomainParameters params = {
+        "secp256r1", //name
+        "FFFFFFFF 00000001 00000000 00000000 00000000 FFFFFFFF FFFFFFFF FFFFFFFF", //p
+        "FFFFFFFF 00000001 00000000 00000000 00000000 FFFFFFFF FFFFFFFF FFFFFFFC", //a
+        "5AC635D8 AA3A93E7 B3EBBD55 769886BC 651D06B0 CC53B0F6 3BCE3C3E 27D2604B", //b
+        "04 6B17D1F2 E12C4247 F8BCE6E5 63A440F2 77037D81 2DEB33A0 F4A13945 D898C296 4FE342E2 FE1A7F9B 8EE7EB4A 7C0F9E16 2BCE3357 6B315ECE CBB64068 37BF51F5", //G (uncompressed)
+        "FFFFFFFF 00000000 FFFFFFFF FFFFFFFF BCE6FAAD A7179E84 F3B9CAC2 FC632551", //n
+        "01", //h
+        "", //beta
+        "", //lambda
+        "", //a1
+        "", //b1
+        "", //a2
+        "" //b2
+    };
+    
+    return params;
+}
+
+DomainParameters ecc::GetNistP384Curve()
+{
+    DomainParameters params = {
+        "secp384r1", //name
+        "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE FFFFFFFF 00000000 00000000 FFFFFFFF", //p
+        "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE FFFFFFFF 00000000 00000000 FFFFFFFC", //a
+        "B3312FA7 E23EE7E4 988E056B E3F82D19 181D9C6E FE814112 0314088F 5013875A C656398D 8A2ED19D 2A85C8ED D3EC2AEF", //b
+        "04 AA87CA22 BE8B0537 8EB1C71E F320AD74 6E1D3B62 8BA79B98 59F741E0 82542A38 5502F25D BF55296C 3A545E38 72760AB7 3617DE4A 96262C6F 5D9E98BF 9292DC29 F8F41DBD 289A147C E9DA3113 B5F0B8C0 0A60B1CE 1D7E819D 7A431D7C 90EA0E5F", //G (uncompressed)
+        "FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF C7634D81 F4372DDF 581A0DB2 48B0A77A ECEC196A CCC52973", //n
+        "01", //h
+        "", //beta
+        "", //lambda
+        "", //a1
+        "", //b1
+        "", //a2
+        "" //b2
+    };
+    
+    return params;
+}
+
+DomainParameters ecc::GetNistP521Curve()
+{
+    DomainParameters params = {
+        "secp521r1", //name
+        "01FF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF", //p
+        "01FF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFC", //a
+        "0051 953EB961 8E1C9A1F 929A21A0 B68540EE A2DA725B 99B315F3 B8B48991 8EF109E1 56193951 EC7E937B 1652C0BD 3BB1BF07 3573DF88 3D2C34F1 EF451FD4 6B503F00", //b
+        "04 00C6 858E06B7 0404E9CD 9E3ECB66 2395B442 9C648139 053FB521 F828AF60 6B4D3DBA A14B5E77 EFE75928 FE1DC127 A2FFA8DE 3348B3C1 856A429B F97E7E31 C2E5BD66 0118 39296A78 9A3BC004 5C8A5FB4 2C7D1BD9 98F54449 579B4468 17AFBD17 273E662C 97EE7299 5EF42640 C550B901 3FAD0761 353C7086 A272C240 88BE9476 9FD16650", //G (uncompressed)
+        "01FF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFA 51868783 BF2F966B 7FCC0148 F709A5D0 3BB5C9B8 899C47AE BB6FB71E 91386409", //n
+        "01", //h
+        "", //beta
+        "", //lambda
+        "", //a1
+        "", //b1
+        "", //a2
+        "" //b2
+    };
+    
+    return params;
+}
+
+BinaryDomainParameters ecc::GetSect163k1Curve()
+{
+    // f(z) = z^163 + z^7 + z^6 + z^3 + 1
+    BinaryDomainParameters params = {
+        "sect163k1", //name
+        "08 00000000 00000000 00000000 00000000 000000C9", //f
+        "00 00000000 00000000 00000000 00000000 00000001", //a
+        "00 00000000 00000000 00000000 00000000 00000001", //b
+        "04 02 FE13C053 7BBC11AC AA07D793 DE4E6D5E 5C94EEE8 02 89070FB0 5D38FF58 321F2E80 0536D538 CCDAA3D9", //G (uncompressed)
+        "04 00000000 00000000 00020108 A2E0CC0D 99F8A5EF", //n
+        "02" //h
+    };
+    
+    return params;
+}
+
+BinaryDomainParameters ecc::GetSect233k1Curve()
+{
+    // f(z) = z^233 + z^74 + 1
+    BinaryDomainParameters params = {
+        "sect233k1", //name
+        "0200 00000000 00000000 00000000 00000000 00000400 00000000 00000001", //f
+        "0000 00000000 00000000 00000000 00000000 00000000 00000000 00000000", //a
+        "0000 00000000 00000000 00000000 00000000 00000000 00000000 00000001", //b
+        "04 0172 32BA853A 7E731AF1 29F22FF4 149563A4 19C26BF5 0A4C9D6E EFAD6126 01DB 537DECE8 19B7F70F 555A67C4 27A8CD9B F18AEB9B 56E0C110 56FAE6A3", //G (uncompressed)
+        "80 00000000 00000000 00000000 00069D5B B915BCD4 6EFB1AD5 F173ABDF", //n
+        "04" //h
+    };
+    
+    return params;
+}
+
+BinaryDomainParameters ecc::GetSect283k1Curve()
+{
+    // f(z) = z^283 + z^12 + z^7 + z^5 + 1
+    BinaryDomainParameters params = {
+        "sect283k1", //name
+        "08000000 00000000 00000000 00000000 00000000 00000000 00000000 00000000 000010A1", //f
+        "00000000 00000000 00000000 00000000 00000000 00000000 00000000 00000000 00000000", //a
+        "00000000 00000000 00000000 00000000 00000000 00000000 00000000 00000000 00000001", //b
+        "04 0503213F 78CA4488 3F1A3B81 62F188E5 53CD265F 23C1567A 16876913 B0C2AC24 58492836 01CCDA38 0F1C9E31 8D90F95D 07E5426F E87E45C0 E8184698 E4596236 4E341161 77DD2259", //G (uncompressed)
+        "01FFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFE9AE 2ED07577 265DFF7F 94451E06 1E163C61", //n
+        "04" //h
     };
     
     return params;
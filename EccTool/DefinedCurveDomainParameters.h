@@ -29,10 +29,10 @@
 
 namespace ecc
 {
-    // Returns a list of supported curve names.
+    // Returns a list of supported curve names (the canonical SEC 2 name of each curve).
     const vector<string> GetSupportedCurves();
     
-    // Returns the specified curve parameters.
+    // Returns the specified curve parameters. The NIST curves can also be named P-224, P-256, P-384 and P-521.
     const DomainParameters GetCurveByName(const string& name);
     
     // Gets the Secp256k1 curve parameters (this is the curve used by Bitcoin).
@@ -40,6 +40,36 @@ namespace ecc
     
     // Gets the Secp112r1 curve parameters.
     DomainParameters GetSecp112r1Curve();
+    
+    // Gets the NIST P-224 (secp224r1) curve parameters.
+    DomainParameters GetNistP224Curve();
+    
+    // Gets the NIST P-256 (secp256r1, prime256v1) curve parameters.
+    DomainParameters GetNistP256Curve();
+    
+    // Gets the NIST P-384 (secp384r1) curve parameters.
+    DomainParameters GetNistP384Curve();
+    
+    // Gets the NIST P-521 (secp521r1) curve parameters.
+    DomainParameters GetNistP521Curve();
+    
+    // Returns a list of supported binary curve names (the SEC 2 name of each curve).
+    const vector<string> GetSupportedBinaryCurves();
+    
+    // Returns the specified binary curve parameters. The curves can also be named K-163, K-233 and K-283.
+    const BinaryDomainParameters GetBinaryCurveByName(const string& name);
+    
+    // Returns whether GetBinaryCurveByName() accepts the name.
+    bool IsBinaryCurveName(const string& name);
+    
+    // Gets the Koblitz curve sect163k1 (NIST K-163) parameters.
+    BinaryDomainParameters GetSect163k1Curve();
+    
+    // Gets the Koblitz curve sect233k1 (NIST K-233) parameters.
+    BinaryDomainParameters GetSect233k1Curve();
+    
+    // Gets the Koblitz curve sect283k1 (NIST K-283) parameters.
+    BinaryDomainParameters GetSect283k1Curve();
 }
 
 #endif
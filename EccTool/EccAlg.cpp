@@ -24,26 +24,54 @@
 #include "EccAlg.h"
 #include "Point.h"
 #include "NativeCrypto.h"
+#include "Ed25519.h"
+#include "Schnorr.h"
+#include "X25519.h"
+#include "ChaCha20Drbg.h"
+#include "WorkerPool.h"
 #include <sstream>
-#include <ctime>
 #include <cassert>
+#include <algorithm>
+#include <map>
+#include <thread>
 
-EccAlg::EccAlg(const EllipticCurve& curve) : _curve(curve)
+const size_t EccAlg::SHARED_SECRET_SIZE = 32;
+
+EccAlg::EccAlg(const EllipticCurve& curve) : _curveContext(CurveContext::Create(curve)), _hasPrivateKey(false), _publicKeyTableCache(PublicKeyTableCache::GetSharedInstance()), _operationThreadCount(1)
+{
+}
+
+EccAlg::EccAlg(shared_ptr<const CurveContext> curveContext) : _curveContext(move(curveContext)), _hasPrivateKey(false), _publicKeyTableCache(PublicKeyTableCache::GetSharedInstance()), _operationThreadCount(1)
 {
-    srand(static_cast<unsigned int>(time(nullptr)));
+    if(!_curveContext)
+        throw invalid_argument("Curve context must not be null.");
 }
 
 void EccAlg::GenerateKeys()
 {
+    InvalidateSharedSecrets();
+    
+    // A Curve25519 or Ed25519 private key is any 32 bytes (X25519 clamps it, Ed25519 hashes it), a binary
+    //  curve private key is a scalar below the base point order.
+    if(HasEncodedKeys())
+    {
+        if(_curveContext->IsBinary())
+            _encodedPrivateKey = GenerateRandomPositiveIntegerLessThan(_curveContext->GetBinaryCurve().GetOrder()).GetMagnitudeBytes();
+        else
+            _encodedPrivateKey = GenerateRandomBytes(X25519::KEY_SIZE);
+        _encodedPublicKey = GetEncodedPublicKey(_encodedPrivateKey);
+        _hasPrivateKey = true;
+        return;
+    }
+    
     // Generate a random private key appropriate for this curve.
-    BigInteger privateKey = GenerateRandomPositiveIntegerLessThan(_curve.GetBasePointOrder());
+    BigInteger privateKey = GenerateRandomPositiveIntegerLessThan(GetCurve().GetBasePointOrder());
     
     // Generate the public key point matching the private key starting from the base point.
-    const Point& basePoint = _curve.GetBasePoint();
-    Point publicKey = _curve.MultiplyPointOnCurveWithScalar(basePoint, privateKey);
+    Point publicKey = GetCurve().MultiplyBasePointWithScalar(privateKey, _operationThreadCount);
     
     // Validate public key point.
-    if(!_curve.CheckPointOnCurve(publicKey))
+    if(!GetCurve().CheckPointOnCurve(publicKey))
         throw runtime_error("Generated public key not on curve.");
     
     // All successful, set the public and private keys.
@@ -52,46 +80,68 @@ void EccAlg::GenerateKeys()
     _hasPrivateKey = true;
 }
 
-BigInteger EccAlg::GenerateRandomPositiveIntegerLessThan(const BigInteger& max)
+vector<EccAlg> EccAlg::GenerateKeyBatch(const EllipticCurve& curve, size_t count)
 {
-    // Determine the maximum number of random bits we need.
-    size_t maxRandomBitsNeeded = max.GetMostSignificantBitIndex();
-    
-    BigInteger k; // This will be the private key.
-    
-    // NOTE: This is not a secure implementation of an RNG.
-    // TODO: Refactor to use system-specific random number generation
-    //  primitives.
-    for(size_t i = 0; i <= maxRandomBitsNeeded; i++)
-    {
-        k <<= 1;
-        if((rand() % 2) != 0)
-            k.SetBitAt(0);
-    }
-    
-    // Ensure that the resulting random integer k < n.
-    //  If k >= n, unset the MSB, this should result in an integer of the appropriate size.
-    if(k >= max)
-        k.ClearBitAt(k.GetMostSignificantBitIndex());
-    
-    if(k >= max || k <= 0)
+    vector<BigInteger> privateKeys;
+    privateKeys.reserve(count);
+    for(size_t i = 0; i < count; i++)
+        privateKeys.push_back(GenerateRandomPositiveIntegerLessThan(curve.GetBasePointOrder()));
+    
+    // All public keys share a single field inversion when converted to affine coordinates.
+    vector<Point> publicKeys = curve.MultiplyBasePointWithScalars(privateKeys);
+    
+    // All algs share a single copy of the curve.
+    auto curveContext = CurveContext::Create(curve);
+    vector<EccAlg> algs;
+    algs.reserve(count);
+    for(size_t i = 0; i < count; i++)
     {
-        stringstream ss;
-        ss << "Number in invalid range generated. Required: < " << max << ", Actual: " << k;
-        throw runtime_error(ss.str());
+        if(!curve.CheckPointOnCurve(publicKeys[i]))
+            throw runtime_error("Generated public key not on curve.");
+        
+        EccAlg alg(curveContext);
+        alg._publicKey = move(publicKeys[i]);
+        alg._privateKey = move(privateKeys[i]);
+        alg._hasPrivateKey = true;
+        algs.push_back(move(alg));
     }
     
-    return k;
+    return algs;
+}
+
+BigInteger EccAlg::GenerateRandomPositiveIntegerLessThan(const BigInteger& max)
+{
+    // Every thread draws from its own generator, so concurrent key generation, signing, and encryption
+    //  never contend for it.
+    return ChaCha20Drbg::GetThreadInstance().GenerateIntegerBelow(max);
+}
+
+vector<uint8_t> EccAlg::GenerateRandomBytes(size_t size)
+{
+    return ChaCha20Drbg::GetThreadInstance().GenerateBytes(size);
 }
 
 void EccAlg::SetKey(const vector<uint8_t> publicKey, const vector<uint8_t> privateKey)
 {
+    InvalidateSharedSecrets();
+    
+    if(HasEncodedKeys())
+    {
+        if((!_curveContext->IsBinary() && (publicKey.size() != X25519::KEY_SIZE)) || (GetEncodedPublicKey(privateKey) != publicKey))
+            throw invalid_argument("Pub/Priv key-pair invalid.");
+        
+        _encodedPublicKey = publicKey;
+        _encodedPrivateKey = privateKey;
+        _hasPrivateKey = true;
+        return;
+    }
+    
     // Make both key values usable.
-    Point publicKeyPoint = _curve.MakePointOnCurve(publicKey);
+    Point publicKeyPoint = GetCurve().MakePointOnCurve(publicKey);
     BigInteger privateKeyValue = BigInteger(privateKey);
     
     // Validate key-pair to ensure that PubKey == G*PrivKey
-    if(_curve.MultiplyPointOnCurveWithScalar(_curve.GetBasePoint(), privateKeyValue) != publicKeyPoint)
+    if(GetCurve().MultiplyBasePointWithScalar(privateKeyValue) != publicKeyPoint)
         throw invalid_argument("Pub/Priv key-pair invalid.");
     
     // Set the keys in the algorithm.
@@ -102,8 +152,29 @@ void EccAlg::SetKey(const vector<uint8_t> publicKey, const vector<uint8_t> priva
 
 void EccAlg::SetKey(const vector<uint8_t> publicKey)
 {
+    InvalidateSharedSecrets();
+    
+    if(HasEncodedKeys())
+    {
+        // Verify() multiplies a binary curve public key with the tau-adic NAF, which is only correct for the
+        //  points of the subgroup generated by G.
+        if(_curveContext->IsBinary())
+        {
+            const KoblitzCurve& curve = _curveContext->GetBinaryCurve();
+            if(!curve.IsInSubgroup(curve.ParsePoint(publicKey)))
+                throw invalid_argument("Public key is not in the subgroup of the base point.");
+        }
+        else if(publicKey.size() != X25519::KEY_SIZE)
+            throw invalid_argument(GetCurveName() + " keys must be 32 bytes.");
+        
+        _encodedPublicKey = publicKey;
+        _encodedPrivateKey.clear();
+        _hasPrivateKey = false;
+        return;
+    }
+    
     // Make the public key value usable.
-    Point publicKeyPoint = _curve.MakePointOnCurve(publicKey);
+    Point publicKeyPoint = GetCurve().MakePointOnCurve(publicKey);
     
     swap(_publicKey, publicKeyPoint);
     _privateKey = 0;
@@ -112,18 +183,33 @@ void EccAlg::SetKey(const vector<uint8_t> publicKey)
 
 const vector<uint8_t> EccAlg::GetPublicKey() const
 {
+    if(HasEncodedKeys())
+        return _encodedPublicKey;
+    
     return _publicKey.Serialize();
 }
 
 const vector<uint8_t> EccAlg::GetPrivateKey() const
 {
     EnsurePrivateKeyAvailable();
+    if(HasEncodedKeys())
+        return _encodedPrivateKey;
+    
     return _privateKey.GetMagnitudeBytes();
 }
 
 const string EccAlg::KeysToString(bool includePrivate) const
 {
     stringstream ss;
+    if(HasEncodedKeys())
+    {
+        ss << "Public: " << _encodedPublicKey;
+        if(includePrivate)
+            ss << endl << "Private: " << _encodedPrivateKey;
+        
+        return ss.str();
+    }
+    
     ss << "Public: " << _publicKey.Serialize();
     
     if(includePrivate)
@@ -134,7 +220,27 @@ const string EccAlg::KeysToString(bool includePrivate) const
 
 string EccAlg::GetCurveName() const
 {
-    return _curve.GetCurveName();
+    return _curveContext->GetName();
+}
+
+const EllipticCurve& EccAlg::GetCurve() const
+{
+    return _curveContext->GetCurve();
+}
+
+bool EccAlg::HasEncodedKeys() const
+{
+    return _curveContext->IsX25519() || _curveContext->IsEd25519() || _curveContext->IsBinary();
+}
+
+vector<uint8_t> EccAlg::GetEncodedPublicKey(const vector<uint8_t>& privateKey) const
+{
+    if(_curveContext->IsEd25519())
+        return Ed25519::GetPublicKey(privateKey);
+    if(_curveContext->IsBinary())
+        return _curveContext->GetBinaryCurve().MultiplyBasePoint(BigInteger(privateKey)).Serialize();
+    
+    return X25519::ScalarMultiplyBase(privateKey);
 }
 
 void EccAlg::EnsurePrivateKeyAvailable() const
@@ -148,6 +254,107 @@ bool EccAlg::HasPrivateKey() const
     return _hasPrivateKey;
 }
 
+void EccAlg::SetPublicKeyTableCache(shared_ptr<PublicKeyTableCache> cache)
+{
+    _publicKeyTableCache = move(cache);
+}
+
+void EccAlg::SetOperationThreadCount(unsigned int threadCount)
+{
+    _operationThreadCount = threadCount;
+}
+
+unsigned int EccAlg::GetOperationThreadCount() const
+{
+    return _operationThreadCount;
+}
+
+void EccAlg::SetEphemeralKeyPool(shared_ptr<EphemeralKeyPool> pool)
+{
+    if(pool && (pool->GetCurve().GetCurveName() != GetCurveName()))
+        throw invalid_argument("Ephemeral key pool is for another curve.");
+    
+    _ephemeralKeyPool = move(pool);
+}
+
+const shared_ptr<EphemeralKeyPool>& EccAlg::GetEphemeralKeyPool() const
+{
+    return _ephemeralKeyPool;
+}
+
+EphemeralKeyPool::EphemeralKey EccAlg::TakeEphemeralKey(bool needsInverse) const
+{
+    if(_ephemeralKeyPool)
+        return _ephemeralKeyPool->Take();
+    
+    EphemeralKeyPool::EphemeralKey key;
+    key.k = GenerateRandomPositiveIntegerLessThan(GetCurve().GetBasePointOrder());
+    key.R = GetCurve().MultiplyBasePointWithScalar(key.k, _operationThreadCount);
+    if(needsInverse)
+        key.inverseK = FieldElement(key.k, GetCurve().GetBasePointOrder()).GetInverse().GetRawInteger();
+    
+    return key;
+}
+
+void EccAlg::SetSharedSecretCache(shared_ptr<SharedSecretCache> cache)
+{
+    _sharedSecretCache = move(cache);
+}
+
+const shared_ptr<SharedSecretCache>& EccAlg::GetSharedSecretCache() const
+{
+    return _sharedSecretCache;
+}
+
+void EccAlg::InvalidateSharedSecrets()
+{
+    if(_sharedSecretCache && _hasPrivateKey)
+        _sharedSecretCache->Invalidate(GetCurveName(), GetPublicKey());
+}
+
+vector<uint8_t> EccAlg::ComputeSharedSecret(const vector<uint8_t>& peerPublicKey) const
+{
+    EnsurePrivateKeyAvailable();
+    if(_curveContext->IsEd25519())
+        throw invalid_argument("Key agreement is not supported on edwards25519.");
+    
+    // A cached secret was derived from a peer key which passed the checks below.
+    vector<uint8_t> secret;
+    if(_sharedSecretCache && _sharedSecretCache->Lookup(GetCurveName(), GetPublicKey(), peerPublicKey, secret))
+        return secret;
+    
+    // The shared value Z is the x-coordinate of privateKey * peerPublicKey, padded to the field size.
+    vector<uint8_t> Z;
+    if(_curveContext->IsX25519())
+    {
+        if(peerPublicKey.size() != X25519::KEY_SIZE)
+            throw invalid_argument("Peer public key must be 32 bytes.");
+        
+        Z = X25519::ComputeSharedSecret(_encodedPrivateKey, peerPublicKey);
+    }
+    else
+    {
+        Point S = GetCurve().MultiplyPointOnCurveWithScalar(GetCurve().MakePointOnCurve(peerPublicKey), _privateKey);
+        if(S.IsPointAtInfinity())
+            throw invalid_argument("Peer public key gives the point at infinity.");
+        
+        Z = S.x.GetBytes();
+    }
+    
+    // ANSI X9.63 key derivation (SEC 1, Section 3.6.1) with a single block and no shared info:
+    //  key = SHA-256(Z || 00000001).
+    Z.push_back(0);
+    Z.push_back(0);
+    Z.push_back(0);
+    Z.push_back(1);
+    secret = NativeCrypto::HashData(Z);
+    
+    if(_sharedSecretCache)
+        _sharedSecretCache->Insert(GetCurveName(), GetPublicKey(), peerPublicKey, secret);
+    
+    return secret;
+}
+
 vector<uint8_t> Xor(const vector<uint8_t>& lhs, const vector<uint8_t>& rhs)
 {
     if(lhs.size() != rhs.size())
@@ -162,6 +369,9 @@ vector<uint8_t> Xor(const vector<uint8_t>& lhs, const vector<uint8_t>& rhs)
 
 vector<uint8_t> EccAlg::Encrypt(const vector<uint8_t>& plaintext) const
 {
+    if(_curveContext->IsX25519())
+        return EncryptWithX25519(plaintext);
+    
     // The following process is derived from the SEC 1: Elliptic Curve Cryptography spec
     //  found here: http://www.secg.org/collateral/sec1_final.pdf (Section 5.1.3)
     
@@ -176,9 +386,9 @@ vector<uint8_t> EccAlg::Encrypt(const vector<uint8_t>& plaintext) const
     // R is a "tag" value that will allow the recipient to derive the
     // shared secret.
     
-    BigInteger r = GenerateRandomPositiveIntegerLessThan(_curve.GetBasePointOrder());
-    Point S = _curve.MultiplyPointOnCurveWithScalar(_publicKey, r);
-    auto R = _curve.MultiplyPointOnCurveWithScalar(_curve.GetBasePoint(), r).Serialize(); // We only need this serialized.
+    auto ephemeralKey = TakeEphemeralKey(false);
+    Point S = GetCurve().MultiplyPointOnCurveWithScalar(_publicKey, ephemeralKey.k);
+    auto R = ephemeralKey.R.Serialize(); // We only need this serialized.
     
     // Use the shared secret S to derive a key. Note: normally, some additional
     // shared information would be used as the "salt" value here. However, in this
@@ -208,6 +418,9 @@ vector<uint8_t> EccAlg::Encrypt(const vector<uint8_t>& plaintext) const
 vector<uint8_t> EccAlg::Decrypt(const vector<uint8_t>& ciphertext) const
 {
     EnsurePrivateKeyAvailable();
+    if(_curveContext->IsX25519())
+        return DecryptWithX25519(ciphertext);
+    
     // The following process is derived from the SEC 1: Elliptic Curve Cryptography spec
     //  found here: http://www.secg.org/collateral/sec1_final.pdf (Section 5.1.4)
     
@@ -219,7 +432,7 @@ vector<uint8_t> EccAlg::Decrypt(const vector<uint8_t>& ciphertext) const
     
     // First, parse out the point. It is encoded according to the curve, and thus can be parsed.
     // The Parse routine ignores any additional data appended after the point.
-    Point R = _curve.MakePointOnCurve(ciphertext);
+    Point R = GetCurve().MakePointOnCurve(ciphertext);
     
     // The encrypted message is the remaining portion of the buffer that does not contian the point.
     vector<uint8_t> encryptedMessage(ciphertext.begin() + R.ComputeUncompressedSize(), ciphertext.end());
@@ -233,7 +446,9 @@ vector<uint8_t> EccAlg::Decrypt(const vector<uint8_t>& ciphertext) const
     //             = (G * privKey) * r  [by substitution of pubKey]
     //             = (G * r) * privKey  [by rearanging the mulptilcands)
     //             = R * privKey        [by substitution of G * r]
-    Point S = _curve.MultiplyPointOnCurveWithScalar(R, _privateKey);
+    //
+    // The ladder performs the same work for every bit of the private key.
+    Point S = GetCurve().MultiplyPointOnCurveWithScalar(R, _privateKey, COZ_MONTGOMERY_LADDER);
     
     // Use the shared secret S to derive a key. Note: normally, some additional
     // shared information would be used as the "salt" value here. However, in this
@@ -248,9 +463,98 @@ vector<uint8_t> EccAlg::Decrypt(const vector<uint8_t>& ciphertext) const
     return plaintext;
 }
 
+vector<vector<uint8_t>> EccAlg::DecryptBatch(const vector<vector<uint8_t>>& ciphertexts) const
+{
+    EnsurePrivateKeyAvailable();
+    
+    vector<vector<uint8_t>> plaintexts;
+    plaintexts.reserve(ciphertexts.size());
+    if(_curveContext->IsX25519())
+    {
+        for(const vector<uint8_t>& ciphertext : ciphertexts)
+            plaintexts.push_back(DecryptWithX25519(ciphertext));
+        return plaintexts;
+    }
+    
+    // Each ciphertext is decrypted as in Decrypt(), except that all of the shared secrets S = R * privateKey
+    //  are computed by a single call, which recodes the private key once and shares one field inversion.
+    vector<Point> tags;
+    tags.reserve(ciphertexts.size());
+    for(const vector<uint8_t>& ciphertext : ciphertexts)
+        tags.push_back(GetCurve().MakePointOnCurve(ciphertext));
+    
+    vector<Point> sharedSecrets = GetCurve().MultiplyManyPointsSameScalar(tags, _privateKey);
+    for(size_t i = 0; i < ciphertexts.size(); i++)
+    {
+        vector<uint8_t> encryptedMessage(ciphertexts[i].begin() + tags[i].ComputeUncompressedSize(), ciphertexts[i].end());
+        const Point& S = sharedSecrets[i];
+        auto encryptionKey = NativeCrypto::DeriveKey(S.x.GetRawInteger().GetMagnitudeBytes(), S.y.GetRawInteger().GetMagnitudeBytes(), encryptedMessage.size());
+        plaintexts.push_back(Xor(encryptedMessage, encryptionKey));
+    }
+    
+    return plaintexts;
+}
+
+vector<uint8_t> EccAlg::EncryptWithX25519(const vector<uint8_t>& plaintext) const
+{
+    // The same scheme as above, with a random ephemeral key r, the tag R = X25519(r, 9) and the shared
+    //  secret S = X25519(r, publicKey). Only u-coordinates exist here, so S is the password and R the salt
+    //  of the key derivation.
+    vector<uint8_t> r = GenerateRandomBytes(X25519::KEY_SIZE);
+    vector<uint8_t> S = X25519::ComputeSharedSecret(r, _encodedPublicKey);
+    vector<uint8_t> R = X25519::ScalarMultiplyBase(r);
+    
+    vector<uint8_t> encryptionKey = NativeCrypto::DeriveKey(S, R, plaintext.size());
+    auto encryptedMessage = Xor(plaintext, encryptionKey);
+    
+    // R || encryptedMessage
+    vector<uint8_t> ciphertext(move(R));
+    ciphertext.insert(ciphertext.end(), encryptedMessage.begin(), encryptedMessage.end());
+    
+    return ciphertext;
+}
+
+vector<uint8_t> EccAlg::DecryptWithX25519(const vector<uint8_t>& ciphertext) const
+{
+    if(ciphertext.size() < X25519::KEY_SIZE)
+        throw invalid_argument("Ciphertext too small to hold the tag.");
+    
+    // S = X25519(privateKey, R) = X25519(r, publicKey)
+    vector<uint8_t> R(ciphertext.begin(), ciphertext.begin() + X25519::KEY_SIZE);
+    vector<uint8_t> encryptedMessage(ciphertext.begin() + X25519::KEY_SIZE, ciphertext.end());
+    vector<uint8_t> S = X25519::ComputeSharedSecret(_encodedPrivateKey, R);
+    
+    auto encryptionKey = NativeCrypto::DeriveKey(S, R, encryptedMessage.size());
+    return Xor(encryptedMessage, encryptionKey);
+}
+
 vector<uint8_t> EccAlg::Sign(const vector<uint8_t>& message) const
 {
     EnsurePrivateKeyAvailable();
+    if(_curveContext->IsEd25519())
+        return Ed25519::Sign(_encodedPrivateKey, message);
+    if(_curveContext->IsBinary())
+        return SignWithBinaryEcdsa(message);
+    
+    uint8_t recoveryId;
+    return SignWithEcdsa(message, recoveryId);
+}
+
+vector<uint8_t> EccAlg::SignRecoverable(const vector<uint8_t>& message) const
+{
+    EnsurePrivateKeyAvailable();
+    if(HasEncodedKeys())
+        throw invalid_argument("Recoverable signatures are only supported on short Weierstrass curves.");
+    
+    uint8_t recoveryId;
+    vector<uint8_t> signature = SignWithEcdsa(message, recoveryId);
+    signature.push_back(recoveryId);
+    
+    return signature;
+}
+
+vector<uint8_t> EccAlg::SignWithEcdsa(const vector<uint8_t>& message, uint8_t& recoveryId) const
+{
     // Compute a hash of the message and select the left-most n bits,
     // where n is the bitlength of the curve order. Store these bits
     // in the integer z.
@@ -259,17 +563,18 @@ vector<uint8_t> EccAlg::Sign(const vector<uint8_t>& message) const
     // Select the bits by determining how many bits must must be removed
     // and shifting the integer z right to remove the right-most bits.
     BigInteger z(hash);
-    size_t Ln = min(_curve.GetBasePointOrder().GetBitSize(), z.GetBitSize());
+    size_t Ln = min(GetCurve().GetBasePointOrder().GetBitSize(), z.GetBitSize());
     unsigned int bitsToRemove = static_cast<unsigned int>(z.GetBitSize() - Ln);
     z >>= bitsToRemove;
     
-    // Generate an ephemeral keypair, k (private key) and Pk (public key).
-    auto k = GenerateRandomPositiveIntegerLessThan(_curve.GetBasePointOrder());
-    auto R = _curve.MultiplyPointOnCurveWithScalar(_curve.GetBasePoint(), k);
+    // Generate an ephemeral keypair, k (private key) and Pk (public key), along with the inverse of k,
+    //  or take a precomputed one from the pool.
+    auto ephemeralKey = TakeEphemeralKey(true);
+    const Point& R = ephemeralKey.R;
     
     // Calculate an integer r by taking the x-value of the previously generated
     // point mod the base point order. If zero, generate a new k and start again.
-    auto n = make_shared<BigInteger>(_curve.GetBasePointOrder());
+    auto n = make_shared<BigInteger>(GetCurve().GetBasePointOrder());
     auto r = FieldElement::MakeElement(R.x, n);//FieldElement(Pk.x.GetRawInteger() % *n, n);
     
     // TODO: Refactor into loop to repeat in the case that r == 0.
@@ -277,20 +582,151 @@ vector<uint8_t> EccAlg::Sign(const vector<uint8_t>& message) const
     
     // Calculate an integer s by adding z to the multiplication of the private key with s,
     // then dividing this by the ephemral private key, mod n.
-    auto fieldElementK = FieldElement::MakeElement(k, n);
-    auto s = ((FieldElement::MakeElement(z, n) + FieldElement::MakeElement(_privateKey, n) * r)) / fieldElementK;
+    auto inverseK = FieldElement(ephemeralKey.inverseK, n);
+    auto s = ((FieldElement::MakeElement(z, n) + FieldElement::MakeElement(_privateKey, n) * r)) * inverseK;
     
     // TODO: Refactor into loop to repeat in the case that s == 0.
     assert(s != 0);
     
+    // R is identified among the points with an x-coordinate of r (mod n) by the parity of its y-coordinate
+    //  and by how many times n was subtracted from its x-coordinate to get r.
+    unsigned int overflowCount = 0;
+    for(BigInteger x = R.x.GetRawInteger(); x >= *n; x -= *n)
+        overflowCount++;
+    recoveryId = static_cast<uint8_t>((2 * overflowCount) + (R.y.GetRawInteger().GetBitAt(0) ? 1 : 0));
+    
     auto signature = Point(r, s);
     return signature.Serialize();
 }
 
+vector<vector<uint8_t>> EccAlg::SignBatch(const vector<vector<uint8_t>>& messages) const
+{
+    EnsurePrivateKeyAvailable();
+    
+    vector<vector<uint8_t>> signatures;
+    signatures.reserve(messages.size());
+    if(_curveContext->IsEd25519() || _curveContext->IsBinary())
+    {
+        for(const vector<uint8_t>& message : messages)
+            signatures.push_back(Sign(message));
+        
+        return signatures;
+    }
+    
+    const EllipticCurve& curve = GetCurve();
+    auto n = make_shared<BigInteger>(curve.GetBasePointOrder());
+    size_t Ln = n->GetBitSize();
+    
+    // Draw all ephemeral keys up front, then hash the messages on the operation threads. Task t hashes
+    //  the messages t, t + threadCount, t + 2 * threadCount, ...
+    vector<BigInteger> kValues;
+    kValues.reserve(messages.size());
+    for(size_t i = 0; i < messages.size(); i++)
+        kValues.push_back(GenerateRandomPositiveIntegerLessThan(*n));
+    
+    unsigned int threadCount = _operationThreadCount;
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(max(min(static_cast<size_t>(threadCount), messages.size()), static_cast<size_t>(1)));
+    
+    vector<BigInteger> zValues(messages.size());
+    auto hashMessages = [&](unsigned int firstMessage)
+    {
+        for(size_t i = firstMessage; i < messages.size(); i += threadCount)
+        {
+            // Select the left-most n bits of the hash of the message (see Sign()).
+            BigInteger z(NativeCrypto::HashData(messages[i]));
+            if(z.GetBitSize() > Ln)
+                z >>= static_cast<unsigned int>(z.GetBitSize() - Ln);
+            zValues[i] = move(z);
+        }
+    };
+    
+    WorkerPool::GetSharedInstance().Run(threadCount, hashMessages);
+    
+    // All R = k * G share a single field inversion, and all k a single inversion mod n.
+    vector<Point> RValues = curve.MultiplyBasePointWithScalars(kValues, _operationThreadCount);
+    
+    vector<FieldElement> inverseKValues;
+    inverseKValues.reserve(kValues.size());
+    for(const BigInteger& k : kValues)
+        inverseKValues.push_back(FieldElement(k, n));
+    FieldElement::InvertBatch(inverseKValues);
+    
+    auto privateKey = FieldElement::MakeElement(_privateKey, n);
+    for(size_t i = 0; i < messages.size(); i++)
+    {
+        auto z = FieldElement::MakeElement(zValues[i], n);
+        auto r = FieldElement::MakeElement(RValues[i].x, n);
+        auto s = (z + privateKey * r) * inverseKValues[i];
+        
+        // If r or s is zero, the message is signed again with a new k of its own (see SignWithBinaryEcdsa()).
+        while(r == 0 || s == 0)
+        {
+            BigInteger k = GenerateRandomPositiveIntegerLessThan(*n);
+            Point R = curve.MultiplyBasePointWithScalar(k);
+            r = FieldElement::MakeElement(R.x, n);
+            s = (z + privateKey * r) * FieldElement(k, n).GetInverse();
+        }
+        
+        signatures.push_back(Point(r, s).Serialize());
+    }
+    
+    return signatures;
+}
+
+vector<uint8_t> EccAlg::RecoverPublicKey(const vector<uint8_t>& message, const vector<uint8_t>& signature) const
+{
+    if(HasEncodedKeys())
+        throw invalid_argument("Recoverable signatures are only supported on short Weierstrass curves.");
+    if(signature.empty())
+        throw invalid_argument("Recoverable signature is empty.");
+    
+    // The signature is a regular signature (see Verify()) followed by the recovery id.
+    auto n = make_shared<BigInteger>(GetCurve().GetBasePointOrder());
+    uint8_t recoveryId = signature.back();
+    Point signaturePoint = Point::Parse(vector<uint8_t>(signature.begin(), signature.end() - 1), 0, n);
+    const FieldElement& r = signaturePoint.x;
+    const FieldElement& s = signaturePoint.y;
+    if(r.GetRawInteger() <= 0 || r.GetRawInteger() >= *n || s.GetRawInteger() <= 0 || s.GetRawInteger() >= *n)
+        throw invalid_argument("Signature values out of range.");
+    
+    // Rebuild R from r and the recovery id (see SignWithEcdsa()), which takes a square root.
+    BigInteger x = r.GetRawInteger();
+    for(unsigned int i = 0; i < static_cast<unsigned int>(recoveryId / 2); i++)
+        x += *n;
+    Point R;
+    if(!GetCurve().TryMakePointFromX(x, (recoveryId % 2) != 0, R))
+        throw invalid_argument("Signature does not match a point on the curve.");
+    
+    // Select the left-most n bits of the hash of the message (see Sign()).
+    BigInteger z(NativeCrypto::HashData(message));
+    size_t Ln = n->GetBitSize();
+    if(z.GetBitSize() > Ln)
+        z >>= static_cast<unsigned int>(z.GetBitSize() - Ln);
+    
+    // Since s * k = z + r * privateKey (mod n), the public key is
+    //  Q = r^-1 * (s * R - z * G) = (-z * r^-1) * G + (s * r^-1) * R,
+    //  which is computed with one double scalar multiplication.
+    FieldElement inverseR = r.GetInverse();
+    FieldElement u1 = -(FieldElement::MakeElement(z, n) * inverseR);
+    FieldElement u2 = s * inverseR;
+    Point Q = GetCurve().MultiplyDoubleScalar(u1.GetRawInteger(), GetCurve().GetBasePoint(), u2.GetRawInteger(), R, _operationThreadCount);
+    if(Q.IsPointAtInfinity())
+        throw invalid_argument("Signature does not match a public key.");
+    
+    return Q.Serialize();
+}
+
 bool EccAlg::Verify(const vector<uint8_t>& message, const vector<uint8_t>& signature) const
 {
+    if(_curveContext->IsEd25519())
+        return Ed25519::Verify(_encodedPublicKey, message, signature);
+    if(_curveContext->IsBinary())
+        return VerifyWithBinaryEcdsa(message, signature);
+    
     // The point is in the field of the curve's base point order domain parameter.
-    auto n = make_shared<BigInteger>(_curve.GetBasePointOrder());
+    auto n = make_shared<BigInteger>(GetCurve().GetBasePointOrder());
     
     // The signature is encoded as a point. Parse it (catching any exceptions).
     Point signaturePoint;
@@ -333,7 +769,7 @@ bool EccAlg::Verify(const vector<uint8_t>& message, const vector<uint8_t>& signa
     // Select the bits by determining how many bits must must be removed
     // and shifting the integer z right to remove the right-most bits.
     BigInteger z(hash);
-    size_t Ln = min(_curve.GetBasePointOrder().GetBitSize(), z.GetBitSize());
+    size_t Ln = min(GetCurve().GetBasePointOrder().GetBitSize(), z.GetBitSize());
     unsigned int bitsToRemove = static_cast<unsigned int>(z.GetBitSize() - Ln);
     z >>= bitsToRemove;
 
@@ -347,10 +783,8 @@ bool EccAlg::Verify(const vector<uint8_t>& message, const vector<uint8_t>& signa
     
     // Calculate the check point by adding the multiplication of u1 and the curve generator point
     // to the multiplication of u2 and the alg's public key. Expression: (G * u1) + (pubKey * u2).
-    auto firstAddend = _curve.MultiplyPointOnCurveWithScalar(_curve.GetBasePoint(), u1.GetRawInteger());
-    auto secondAddend = _curve.MultiplyPointOnCurveWithScalar(_publicKey, u2.GetRawInteger());
-    auto checkPoint = _curve.AddPointsOnCurve(firstAddend, secondAddend);
-    
+    // Both multiplications share a single chain of point doublings.
+    //
     // Working backwards to show why this works:
     //  checkPoint = (G * u1) + (pubKey * u2)
     //             = (G * z * w) + (pubKey * r * w)         [by substituting u1 and u2 with their components]
@@ -369,19 +803,211 @@ bool EccAlg::Verify(const vector<uint8_t>& message, const vector<uint8_t>& signa
     // During the signature creation process, r is calculated as exactly this. Which is why ECDSA works.
     
     
-    // The signature is valid if r is equivalent to checkPoint:x (mod n).
-    return r == FieldElement::MakeElement(checkPoint.x.GetRawInteger(), n);
+    // The signature is valid if r is equivalent to checkPoint:x (mod n). The check point is left in
+    // projective coordinates for this comparison, which avoids a field inversion.
+    //
+    // Once a public key has been used often enough the cache holds a comb table for it, and both
+    // multiplications are done with comb tables like a multiplication of G alone.
+    auto publicKeyTable = _publicKeyTableCache ? _publicKeyTableCache->Lookup(GetCurve(), _publicKey) : nullptr;
+    if(publicKeyTable)
+        return GetCurve().DoubleScalarProductXEquals(u1.GetRawInteger(), u2.GetRawInteger(), *publicKeyTable, r.GetRawInteger(), _operationThreadCount);
+    
+    return GetCurve().DoubleScalarProductXEquals(u1.GetRawInteger(), GetCurve().GetBasePoint(), u2.GetRawInteger(), _publicKey, r.GetRawInteger(), _operationThreadCount);
 }
 
+vector<bool> EccAlg::VerifyBatch(const vector<SignedMessage>& signedMessages) const
+{
+    if(_curveContext->IsEd25519())
+        return Ed25519::VerifyBatch(signedMessages);
+    if(_curveContext->IsBinary())
+        throw invalid_argument("Batch verification is not supported on the binary curves.");
+    
+    // Each signature is checked on its own as in Verify(), so an invalid one never affects the others.
+    //  The checks are not combined into one multi-scalar multiplication as Ed25519::VerifyBatch() does:
+    //  a signature only carries the x-coordinate of R, and lifting R with a square root costs as much as
+    //  combining saves. What the batch shares is the work around the checks.
+    const EllipticCurve& curve = GetCurve();
+    auto n = make_shared<BigInteger>(curve.GetBasePointOrder());
+    size_t Ln = n->GetBitSize();
+    
+    // Parse the signatures and public keys, leaving the items which fail to parse invalid. A public key
+    //  given with several items is only parsed once.
+    vector<size_t> indices;
+    vector<FieldElement> rValues;
+    vector<FieldElement> inverseSValues;
+    vector<const Point*> publicKeys;
+    map<vector<uint8_t>, Point> parsedPublicKeys;
+    for(size_t i = 0; i < signedMessages.size(); i++)
+    {
+        const SignedMessage& signedMessage = signedMessages[i];
+        Point signaturePoint;
+        const Point* publicKey;
+        try
+        {
+            signaturePoint = Point::Parse(signedMessage.signature, 0, n);
+            
+            auto parsedPublicKey = parsedPublicKeys.find(signedMessage.publicKey);
+            if(parsedPublicKey == parsedPublicKeys.end())
+                parsedPublicKey = parsedPublicKeys.insert(make_pair(signedMessage.publicKey, curve.MakePointOnCurve(signedMessage.publicKey))).first;
+            publicKey = &parsedPublicKey->second;
+        }
+        catch(exception& ex)
+        {
+            // We only want to output a message here in in debug mode.
+            utilities::DebugLog(string("Error parsing signed message: ").append(ex.what()));
+            continue;
+        }
+        
+        // Both r and s must be in the range of (0,n) (exclusive).
+        const BigInteger& r = signaturePoint.x.GetRawInteger();
+        const BigInteger& s = signaturePoint.y.GetRawInteger();
+        if(r <= 0 || r >= *n || s <= 0 || s >= *n)
+        {
+            // We only want to output a message here in in debug mode.
+            utilities::DebugLog("Signature invalid - r or s out of range.");
+            continue;
+        }
+        
+        indices.push_back(i);
+        rValues.push_back(signaturePoint.x);
+        inverseSValues.push_back(signaturePoint.y);
+        publicKeys.push_back(publicKey);
+    }
+    
+    // All w = s^-1 share a single inversion mod n.
+    FieldElement::InvertBatch(inverseSValues);
+    
+    // Hash the messages and check the signatures on the operation threads, each check on one thread. Task t
+    //  checks the signatures t, t + threadCount, t + 2 * threadCount, ... The results are kept as bytes
+    //  until all tasks are done, since the elements of a vector<bool> cannot be written concurrently.
+    unsigned int threadCount = _operationThreadCount;
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(max(min(static_cast<size_t>(threadCount), indices.size()), static_cast<size_t>(1)));
+    
+    vector<uint8_t> valid(indices.size(), 0);
+    auto verifySignatures = [&](unsigned int firstSignature)
+    {
+        for(size_t i = firstSignature; i < indices.size(); i += threadCount)
+        {
+            // Select the left-most n bits of the hash of the message (see Verify()).
+            BigInteger z(NativeCrypto::HashData(signedMessages[indices[i]].message));
+            if(z.GetBitSize() > Ln)
+                z >>= static_cast<unsigned int>(z.GetBitSize() - Ln);
+            
+            auto u1 = FieldElement::MakeElement(z, n) * inverseSValues[i];
+            auto u2 = rValues[i] * inverseSValues[i];
+            
+            // Keys which recur often enough across batches get a comb table from the cache (see Verify()).
+            auto publicKeyTable = _publicKeyTableCache ? _publicKeyTableCache->Lookup(curve, *publicKeys[i]) : nullptr;
+            bool isValid = publicKeyTable ?
+                curve.DoubleScalarProductXEquals(u1.GetRawInteger(), u2.GetRawInteger(), *publicKeyTable, rValues[i].GetRawInteger()) :
+                curve.DoubleScalarProductXEquals(u1.GetRawInteger(), curve.GetBasePoint(), u2.GetRawInteger(), *publicKeys[i], rValues[i].GetRawInteger());
+            valid[i] = isValid ? 1 : 0;
+        }
+    };
+    
+    WorkerPool::GetSharedInstance().Run(threadCount, verifySignatures);
+    
+    vector<bool> results(signedMessages.size(), false);
+    for(size_t i = 0; i < indices.size(); i++)
+        results[indices[i]] = valid[i] != 0;
+    
+    return results;
+}
 
+vector<uint8_t> EccAlg::SignWithBinaryEcdsa(const vector<uint8_t>& message) const
+{
+    // ECDSA as in SignWithEcdsa(), with R on the binary curve. The bits of the x-coordinate of R, a
+    //  polynomial, are taken as an integer before reducing it mod n (SEC 1, Section 2.3.9).
+    const KoblitzCurve& curve = _curveContext->GetBinaryCurve();
+    auto n = make_shared<BigInteger>(curve.GetOrder());
+    
+    // Select the left-most n bits of the hash of the message (see Sign()).
+    BigInteger z(NativeCrypto::HashData(message));
+    size_t Ln = n->GetBitSize();
+    if(z.GetBitSize() > Ln)
+        z >>= static_cast<unsigned int>(z.GetBitSize() - Ln);
+    
+    auto privateKey = FieldElement::MakeElement(BigInteger(_encodedPrivateKey), n);
+    for(;;)
+    {
+        BigInteger k = GenerateRandomPositiveIntegerLessThan(*n);
+        BinaryPoint R = curve.MultiplyBasePoint(k);
+        auto r = FieldElement::MakeElement(R.x.GetRawInteger(), n);
+        if(r == 0)
+            continue;
+        
+        auto s = (FieldElement::MakeElement(z, n) + privateKey * r) * FieldElement(k, n).GetInverse();
+        if(s == 0)
+            continue;
+        
+        return Point(r, s).Serialize();
+    }
+}
 
+bool EccAlg::VerifyWithBinaryEcdsa(const vector<uint8_t>& message, const vector<uint8_t>& signature) const
+{
+    const KoblitzCurve& curve = _curveContext->GetBinaryCurve();
+    auto n = make_shared<BigInteger>(curve.GetOrder());
+    
+    Point signaturePoint;
+    try
+    {
+        signaturePoint = Point::Parse(signature, 0, n);
+    }
+    catch(exception& ex)
+    {
+        utilities::DebugLog(string("Error parsing signature point: ").append(ex.what()));
+        return false;
+    }
+    
+    const FieldElement& r = signaturePoint.x;
+    const FieldElement& s = signaturePoint.y;
+    if(r.GetRawInteger() <= 0 || r.GetRawInteger() >= *n || s.GetRawInteger() <= 0 || s.GetRawInteger() >= *n)
+    {
+        utilities::DebugLog("Signature invalid - r or s out of range.");
+        return false;
+    }
+    
+    // Select the left-most n bits of the hash of the message (see Sign()).
+    BigInteger z(NativeCrypto::HashData(message));
+    size_t Ln = n->GetBitSize();
+    if(z.GetBitSize() > Ln)
+        z >>= static_cast<unsigned int>(z.GetBitSize() - Ln);
+    
+    // The signature is valid if r is the x-coordinate (mod n) of (G * u1) + (pubKey * u2) (see Verify()).
+    //  SetKey() made sure that the public key is in the subgroup of G, where Multiply() applies.
+    auto w = s.GetInverse();
+    auto u1 = FieldElement::MakeElement(z, n) * w;
+    auto u2 = r * w;
+    BinaryPoint checkPoint = curve.Add(curve.MultiplyBasePoint(u1.GetRawInteger()), curve.Multiply(u2.GetRawInteger(), curve.ParsePoint(_encodedPublicKey)));
+    if(checkPoint.IsPointAtInfinity())
+        return false;
+    
+    return FieldElement::MakeElement(checkPoint.x.GetRawInteger(), n) == r;
+}
 
+vector<uint8_t> EccAlg::GetSchnorrPublicKey() const
+{
+    if(GetCurveName() != Schnorr::CURVE_NAME)
+        throw invalid_argument("Schnorr signatures are only supported on secp256k1.");
+    
+    return _publicKey.x.GetBytes();
+}
 
+vector<uint8_t> EccAlg::SignSchnorr(const vector<uint8_t>& message) const
+{
+    EnsurePrivateKeyAvailable();
+    return Schnorr::Sign(GetCurve(), _privateKey, message, GenerateRandomBytes(Schnorr::AUX_RANDOM_SIZE));
+}
 
+bool EccAlg::VerifySchnorr(const vector<uint8_t>& message, const vector<uint8_t>& signature) const
+{
+    return Schnorr::Verify(GetCurve(), _publicKey.x.GetBytes(), message, signature);
+}
 
-
-
-
-
-
-
+vector<bool> EccAlg::VerifySchnorrBatch(const vector<SignedMessage>& signedMessages) const
+{
+    return Schnorr::VerifyBatch(GetCurve(), signedMessages);
+}
@@ -52,6 +52,42 @@ namespace ecc
         
         // The cofactor of the curve.
         const string h;
+        
+        // Optional parameters of an efficiently computable endomorphism phi(x, y) = (beta * x, y) = lambda * (x, y)
+        //  which allows scalars to be split into two half-sized scalars (GLV decomposition). Left empty for
+        //  curves without such an endomorphism.
+        const string beta;
+        const string lambda;
+        
+        // The short lattice basis vectors (a1, b1) and (a2, b2), with a + b * lambda = 0 (mod n), used to
+        //  split scalars for the endomorphism.
+        const string a1;
+        const string b1;
+        const string a2;
+        const string b2;
+    };
+    
+    // Defines the parameters of a binary elliptic curve: y^2 + xy = x^3 + ax^2 + b over the field GF(2^m).
+    struct BinaryDomainParameters
+    {
+        // The name of this set of domain parameters.
+        const string name;
+        
+        // The irreducible polynomial f(z) of degree m which defines the field GF(2^m), with one bit per term.
+        const string f;
+        
+        // The two coefficients which define the curve:
+        const string a;
+        const string b;
+        
+        // The Generator or Base Point
+        const string G;
+        
+        // The order of the curve generator point G.
+        const string n;
+        
+        // The cofactor of the curve.
+        const string h;
     };
 }
 
@@ -0,0 +1,336 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <algorithm>
+#include <stdexcept>
+#include "Ed25519.h"
+#include "BatchVerification.h"
+#include "NativeCrypto.h"
+
+using namespace std;
+
+const char* const Ed25519::CURVE_NAME = "ed25519";
+const char* const Ed25519::CURVE_ALIAS = "Ed25519";
+
+namespace
+{
+    // The order L as little-endian bytes.
+    const uint8_t ORDER_BYTES[] = {
+        0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    
+    // Scalars are reduced in radix 2^21 with signed limbs, as in the Ed25519 reference implementation:
+    //  since 2^252 = -(L - 2^252) mod L, a limb at position i >= 12 is folded into positions i - 12 to i - 7
+    //  by multiplying it with the digits of -(L - 2^252) below. This is far cheaper than BigInteger's
+    //  general division, which would otherwise dominate the cost of signing and batch verification.
+    const int LIMB_BITS = 21;
+    const int64_t LIMB_MASK = (int64_t(1) << LIMB_BITS) - 1;
+    const size_t SCALAR_LIMB_COUNT = 12;
+    const int64_t FOLD[] = { 666643, 470296, 654183, -997805, 136657, -683901 };
+    
+    void EnsureKeySize(const vector<uint8_t>& key)
+    {
+        if(key.size() != Ed25519::KEY_SIZE)
+            throw invalid_argument("Ed25519 keys must be 32 bytes.");
+    }
+    
+    // Splits a little-endian number into 21-bit limbs, with at least the given number of limbs.
+    vector<int64_t> ToLimbs(const vector<uint8_t>& bytes, size_t minimumLimbCount = 0)
+    {
+        size_t limbCount = max((8 * bytes.size() + LIMB_BITS - 1) / LIMB_BITS, minimumLimbCount);
+        vector<int64_t> limbs(limbCount);
+        for(size_t bit = 0; bit < 8 * bytes.size(); bit++)
+        {
+            if((bytes[bit / 8] >> (bit % 8)) & 1)
+                limbs[bit / LIMB_BITS] |= int64_t(1) << (bit % LIMB_BITS);
+        }
+        
+        return limbs;
+    }
+    
+    // Carries limbs[0] to limbs[count - 2] into the next limb, leaving each in [-2^20, 2^20).
+    void CarrySigned(vector<int64_t>& limbs, size_t count)
+    {
+        for(size_t i = 0; i + 1 < count; i++)
+        {
+            int64_t carry = (limbs[i] + (int64_t(1) << (LIMB_BITS - 1))) >> LIMB_BITS;
+            limbs[i + 1] += carry;
+            limbs[i] -= carry << LIMB_BITS;
+        }
+    }
+    
+    // Reduces the number in the limbs mod L, returning 32 little-endian bytes.
+    vector<uint8_t> ReduceLimbs(vector<int64_t> limbs)
+    {
+        limbs.resize(max(limbs.size(), SCALAR_LIMB_COUNT + 1));
+        
+        // Fold the limbs from the top down, carrying before each fold so that the products can't overflow.
+        for(size_t top = limbs.size() - 1; top >= SCALAR_LIMB_COUNT; --top)
+        {
+            CarrySigned(limbs, top + 1);
+            for(size_t j = 0; j < 6; j++)
+                limbs[top - SCALAR_LIMB_COUNT + j] += limbs[top] * FOLD[j];
+            limbs[top] = 0;
+        }
+        
+        // The last folds can carry into limb 12 again, but less each time.
+        for(;;)
+        {
+            CarrySigned(limbs, SCALAR_LIMB_COUNT + 1);
+            if(limbs[SCALAR_LIMB_COUNT] == 0)
+                break;
+            
+            for(size_t j = 0; j < 6; j++)
+                limbs[j] += limbs[SCALAR_LIMB_COUNT] * FOLD[j];
+            limbs[SCALAR_LIMB_COUNT] = 0;
+        }
+        
+        // The number is now in (-2^251, 2^251), with limb 12 zero. Add L (whose top bit is in limb 12) if it
+        //  is negative, then carry into unsigned limbs.
+        limbs.resize(SCALAR_LIMB_COUNT + 1);
+        bool isNegative = false;
+        for(size_t i = SCALAR_LIMB_COUNT; i-- > 0; )
+        {
+            if(limbs[i] != 0)
+            {
+                isNegative = (limbs[i] < 0);
+                break;
+            }
+        }
+        if(isNegative)
+        {
+            vector<int64_t> order = ToLimbs(vector<uint8_t>(ORDER_BYTES, ORDER_BYTES + 32));
+            for(size_t i = 0; i < limbs.size(); i++)
+                limbs[i] += order[i];
+        }
+        for(size_t i = 0; i + 1 < limbs.size(); i++)
+        {
+            limbs[i + 1] += limbs[i] >> LIMB_BITS;
+            limbs[i] &= LIMB_MASK;
+        }
+        
+        vector<uint8_t> bytes(32);
+        uint64_t accumulator = 0;
+        int accumulatedBits = 0;
+        size_t position = 0;
+        for(size_t i = 0; i < limbs.size(); i++)
+        {
+            accumulator |= static_cast<uint64_t>(limbs[i]) << accumulatedBits;
+            accumulatedBits += LIMB_BITS;
+            for(; accumulatedBits >= 8 && position < bytes.size(); accumulatedBits -= 8, accumulator >>= 8)
+                bytes[position++] = static_cast<uint8_t>(accumulator);
+        }
+        for(; position < bytes.size(); accumulator >>= 8)
+            bytes[position++] = static_cast<uint8_t>(accumulator);
+        
+        return bytes;
+    }
+    
+    // Returns a * b + c mod L for numbers of up to 32 bytes.
+    vector<uint8_t> MultiplyAddScalars(const vector<uint8_t>& a, const vector<uint8_t>& b, const vector<uint8_t>& c)
+    {
+        vector<int64_t> aLimbs = ToLimbs(a);
+        vector<int64_t> bLimbs = ToLimbs(b);
+        vector<int64_t> product = ToLimbs(c, aLimbs.size() + bLimbs.size());
+        for(size_t i = 0; i < aLimbs.size(); i++)
+        {
+            for(size_t j = 0; j < bLimbs.size(); j++)
+                product[i + j] += aLimbs[i] * bLimbs[j];
+        }
+        
+        return ReduceLimbs(product);
+    }
+    
+    // Returns -a mod L.
+    vector<uint8_t> NegateScalar(const vector<uint8_t>& a)
+    {
+        vector<int64_t> limbs = ToLimbs(a);
+        for(size_t i = 0; i < limbs.size(); i++)
+            limbs[i] = -limbs[i];
+        
+        return ReduceLimbs(limbs);
+    }
+    
+    // Returns true if the 32-byte little-endian number is below L.
+    bool IsBelowOrder(const vector<uint8_t>& scalar)
+    {
+        for(size_t i = 32; i-- > 0; )
+        {
+            if(scalar[i] != ORDER_BYTES[i])
+                return (scalar[i] < ORDER_BYTES[i]);
+        }
+        
+        return false;
+    }
+    
+    vector<uint8_t> Concatenate(const vector<uint8_t>& a, const vector<uint8_t>& b, const vector<uint8_t>& c)
+    {
+        vector<uint8_t> result(a);
+        result.insert(result.end(), b.begin(), b.end());
+        result.insert(result.end(), c.begin(), c.end());
+        return result;
+    }
+    
+    // Reduces a SHA-512 hash, read as a little-endian number, mod L.
+    vector<uint8_t> HashToScalar(const vector<uint8_t>& data)
+    {
+        return ReduceLimbs(ToLimbs(NativeCrypto::HashDataWithSha512(data)));
+    }
+    
+    // Splits SHA-512(privateKey) into the clamped secret scalar and the prefix used to derive nonces.
+    void ExpandPrivateKey(const vector<uint8_t>& privateKey, vector<uint8_t>& scalar, vector<uint8_t>& prefix)
+    {
+        EnsureKeySize(privateKey);
+        
+        vector<uint8_t> hash = NativeCrypto::HashDataWithSha512(privateKey);
+        scalar.assign(hash.begin(), hash.begin() + 32);
+        prefix.assign(hash.begin() + 32, hash.end());
+        
+        scalar[0] &= 0xF8;
+        scalar[31] &= 0x7F;
+        scalar[31] |= 0x40;
+    }
+}
+
+vector<uint8_t> Ed25519::GetPublicKey(const vector<uint8_t>& privateKey)
+{
+    vector<uint8_t> scalar, prefix;
+    ExpandPrivateKey(privateKey, scalar, prefix);
+    
+    return EdwardsPoint::MultiplyBasePoint(scalar).Encode();
+}
+
+vector<uint8_t> Ed25519::Sign(const vector<uint8_t>& privateKey, const vector<uint8_t>& message)
+{
+    vector<uint8_t> scalar, prefix;
+    ExpandPrivateKey(privateKey, scalar, prefix);
+    vector<uint8_t> publicKey = EdwardsPoint::MultiplyBasePoint(scalar).Encode();
+    
+    // r = SHA-512(prefix || message) mod L, R = r * G, k = SHA-512(R || A || message) mod L and
+    //  S = r + k * a mod L.
+    vector<uint8_t> prefixedMessage(prefix);
+    prefixedMessage.insert(prefixedMessage.end(), message.begin(), message.end());
+    vector<uint8_t> r = HashToScalar(prefixedMessage);
+    
+    vector<uint8_t> signature = EdwardsPoint::MultiplyBasePoint(r).Encode();
+    vector<uint8_t> k = HashToScalar(Concatenate(signature, publicKey, message));
+    vector<uint8_t> S = MultiplyAddScalars(k, scalar, r);
+    
+    signature.insert(signature.end(), S.begin(), S.end());
+    return signature;
+}
+
+bool Ed25519::TryPrepareSignature(const vector<uint8_t>& publicKey, const vector<uint8_t>& message,
+    const vector<uint8_t>& signature, PreparedSignature& prepared)
+{
+    if(signature.size() != SIGNATURE_SIZE)
+        return false;
+    
+    vector<uint8_t> encodedR(signature.begin(), signature.begin() + 32);
+    if(!EdwardsPoint::TryDecode(publicKey, prepared.publicKey) || !EdwardsPoint::TryDecode(encodedR, prepared.R))
+        return false;
+    
+    prepared.S.assign(signature.begin() + 32, signature.end());
+    if(!IsBelowOrder(prepared.S))
+        return false;
+    
+    prepared.k = HashToScalar(Concatenate(encodedR, publicKey, message));
+    prepared.signature = signature;
+    return true;
+}
+
+bool Ed25519::Verify(const vector<uint8_t>& publicKey, const vector<uint8_t>& message, const vector<uint8_t>& signature)
+{
+    PreparedSignature prepared;
+    if(!TryPrepareSignature(publicKey, message, signature, prepared))
+        return false;
+    
+    // S * G + (-k mod L) * A - R. Reducing -k mod L only adds a multiple of L, and so at most a point of small
+    //  order, which the cofactor removes.
+    vector<vector<uint8_t>> scalars;
+    scalars.push_back(prepared.S);
+    scalars.push_back(NegateScalar(prepared.k));
+    
+    vector<EdwardsPoint> points;
+    points.push_back(EdwardsPoint::GetBasePoint());
+    points.push_back(prepared.publicKey);
+    
+    EdwardsPoint check = EdwardsPoint::MultiplyScalars(scalars, points) - prepared.R;
+    return check.MultiplyByCofactor().IsNeutralElement();
+}
+
+bool Ed25519::CheckBatchGroup(const vector<const PreparedSignature*>& group)
+{
+    // k covers the key and message of each signature.
+    vector<uint8_t> transcript;
+    for(auto signature : group)
+    {
+        transcript.insert(transcript.end(), signature->signature.begin(), signature->signature.end());
+        transcript.insert(transcript.end(), signature->k.begin(), signature->k.end());
+    }
+    ecc::BatchWeights weights(transcript, NativeCrypto::HashDataWithSha512);
+    
+    // sum(z_i * S_i) * G + sum(z_i * k_i * (-A_i)) + sum(z_i * (-R_i)), with the weights read as little-endian
+    //  scalars.
+    vector<vector<uint8_t>> scalars(1);
+    vector<EdwardsPoint> points(1, EdwardsPoint::GetBasePoint());
+    vector<uint8_t> baseScalar(32);
+    for(size_t i = 0; i < group.size(); i++)
+    {
+        vector<uint8_t> z = weights.Get(i);
+        
+        baseScalar = MultiplyAddScalars(z, group[i]->S, baseScalar);
+        scalars.push_back(MultiplyAddScalars(z, group[i]->k, vector<uint8_t>()));
+        points.push_back(-group[i]->publicKey);
+        
+        z.resize(32);
+        scalars.push_back(z);
+        points.push_back(-group[i]->R);
+    }
+    scalars[0] = baseScalar;
+    
+    return EdwardsPoint::MultiplyScalars(scalars, points).MultiplyByCofactor().IsNeutralElement();
+}
+
+vector<bool> Ed25519::VerifyBatch(const vector<SignedMessage>& signedMessages)
+{
+    vector<bool> results(signedMessages.size(), false);
+    
+    vector<PreparedSignature> prepared;
+    prepared.reserve(signedMessages.size());
+    for(size_t i = 0; i < signedMessages.size(); i++)
+    {
+        PreparedSignature signature;
+        signature.index = i;
+        if(TryPrepareSignature(signedMessages[i].publicKey, signedMessages[i].message, signedMessages[i].signature, signature))
+            prepared.push_back(signature);
+    }
+    
+    vector<const PreparedSignature*> group;
+    for(const auto& signature : prepared)
+        group.push_back(&signature);
+    
+    ecc::VerifyBatchGroup<PreparedSignature>(group, CheckBatchGroup, results);
+    return results;
+}
@@ -0,0 +1,94 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__Ed25519__
+#define __EccTool__Ed25519__
+
+#include <cstdint>
+#include <vector>
+#include "EdwardsPoint.h"
+#include "SignedMessage.h"
+
+using namespace std;
+
+// Ed25519 implements the EdDSA signature scheme on edwards25519 with SHA-512 (as specified by RFC 8032,
+//  Section 5.1), see EdwardsPoint.
+//
+// A private key is a random 32-byte seed, a public key is an encoded point (32 bytes), and a signature is an
+//  encoded point R followed by a scalar S in little-endian (64 bytes). Scalars are reduced mod the order
+//  L = 2^252 + 27742317777372353535851937790883648493 of the base point. Verification is cofactored: it checks
+//  8 * (S * G - k * A - R) against the neutral element, which agrees with the batch check below.
+class Ed25519
+{
+private:
+    // A signature decoded for verification, where k = SHA-512(R || A || message) mod L.
+    struct PreparedSignature
+    {
+        size_t index;
+        EdwardsPoint publicKey;
+        EdwardsPoint R;
+        vector<uint8_t> S;
+        vector<uint8_t> k;
+        vector<uint8_t> signature;
+    };
+    
+    // Decodes the public key and signature and computes k. Returns false if either is malformed or S is
+    //  not below L.
+    static bool TryPrepareSignature(const vector<uint8_t>& publicKey, const vector<uint8_t>& message,
+        const vector<uint8_t>& signature, PreparedSignature& prepared);
+    
+    // Returns whether 8 * sum(z_i * (S_i * G - k_i * A_i - R_i)) is the neutral element for weights z_i from
+    //  BatchWeights, computed with a single multi-scalar multiplication.
+    static bool CheckBatchGroup(const vector<const PreparedSignature*>& group);
+    
+public:
+    // The name of the curve in key files and the curve list, and an alias for it.
+    static const char* const CURVE_NAME;
+    static const char* const CURVE_ALIAS;
+    
+    // The size of private and public keys.
+    static const size_t KEY_SIZE = 32;
+    
+    // The size of signatures.
+    static const size_t SIGNATURE_SIZE = 64;
+    
+    // Returns the public key of a private key: the base point multiplied by the clamped first half of
+    //  SHA-512(privateKey).
+    static vector<uint8_t> GetPublicKey(const vector<uint8_t>& privateKey);
+    
+    // Signs the message. Signatures are deterministic: the nonce is derived from the private key and
+    //  message.
+    static vector<uint8_t> Sign(const vector<uint8_t>& privateKey, const vector<uint8_t>& message);
+    
+    // Verifies the signature of the message with the public key.
+    static bool Verify(const vector<uint8_t>& publicKey, const vector<uint8_t>& message, const vector<uint8_t>& signature);
+    
+    // Verifies each of the given signed messages with the public key given along with it, returning
+    //  whether each signature is valid. All signatures are checked together through one random linear
+    //  combination of their verification equations (found here: High-speed high-security signatures,
+    //  Bernstein, Duif, Lange, Schwabe, Yang, Section 5), which costs far less than one multiplication per
+    //  signature.
+    static vector<bool> VerifyBatch(const vector<SignedMessage>& signedMessages);
+};
+
+#endif /* defined(__EccTool__Ed25519__) */
@@ -0,0 +1,477 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <stdexcept>
+#include "EdwardsPoint.h"
+
+using namespace std;
+
+once_flag EdwardsPoint::_baseTableFlag;
+EdwardsPoint EdwardsPoint::_basePoint;
+vector<EdwardsPoint::CachedPoint> EdwardsPoint::_baseTable;
+
+namespace
+{
+    // The curve constant d = -121665 / 121666, 2d and sqrt(-1) = 2^((p - 1) / 4), as little-endian bytes.
+    const uint8_t D_BYTES[] = {
+        0xA3, 0x78, 0x59, 0x13, 0xCA, 0x4D, 0xEB, 0x75, 0xAB, 0xD8, 0x41, 0x41, 0x4D, 0x0A, 0x70, 0x00,
+        0x98, 0xE8, 0x79, 0x77, 0x79, 0x40, 0xC7, 0x8C, 0x73, 0xFE, 0x6F, 0x2B, 0xEE, 0x6C, 0x03, 0x52
+    };
+    const uint8_t D2_BYTES[] = {
+        0x59, 0xF1, 0xB2, 0x26, 0x94, 0x9B, 0xD6, 0xEB, 0x56, 0xB1, 0x83, 0x82, 0x9A, 0x14, 0xE0, 0x00,
+        0x30, 0xD1, 0xF3, 0xEE, 0xF2, 0x80, 0x8E, 0x19, 0xE7, 0xFC, 0xDF, 0x56, 0xDC, 0xD9, 0x06, 0x24
+    };
+    const uint8_t SQRT_MINUS_ONE_BYTES[] = {
+        0xB0, 0xA0, 0x0E, 0x4A, 0x27, 0x1B, 0xEE, 0xC4, 0x78, 0xE4, 0x2F, 0xAD, 0x06, 0x18, 0x43, 0x2F,
+        0xA7, 0xD7, 0xFB, 0x3D, 0x99, 0x00, 0x4D, 0x2B, 0x0B, 0xDF, 0xC1, 0x4F, 0x80, 0x24, 0x83, 0x2B
+    };
+    
+    // The encoding of the base point: y = 4/5, with x positive.
+    const uint8_t BASE_POINT_BYTES[] = {
+        0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+    };
+    
+    FieldElement25519 MakeConstant(const uint8_t* bytes)
+    {
+        return FieldElement25519::FromBytes(vector<uint8_t>(bytes, bytes + FieldElement25519::BYTE_SIZE));
+    }
+    
+    const FieldElement25519 D = MakeConstant(D_BYTES);
+    const FieldElement25519 D2 = MakeConstant(D2_BYTES);
+    const FieldElement25519 SQRT_MINUS_ONE = MakeConstant(SQRT_MINUS_ONE_BYTES);
+    
+    // The number of odd multiples kept for each point by MultiplyScalars(): 1, 3, ..., 15 times the point.
+    const size_t ODD_MULTIPLE_COUNT = 8;
+    
+    void EnsureScalarSize(const vector<uint8_t>& scalar)
+    {
+        if(scalar.size() != 32 || (scalar[31] & 0x80) != 0)
+            throw invalid_argument("Edwards curve scalars must be 32 bytes and below 2^255.");
+    }
+    
+    // Returns 1 if a == b and 0 otherwise, without branching.
+    uint64_t IsEqual(uint64_t a, uint64_t b)
+    {
+        return ((a ^ b) - 1) >> 63;
+    }
+    
+    // Recodes the scalar into 64 digits e[i] in [-8, 8] with scalar = sum(e[i] * 16^i).
+    vector<int8_t> ComputeSignedRadix16Digits(const vector<uint8_t>& scalar)
+    {
+        vector<int8_t> digits(64);
+        for(size_t i = 0; i < 32; i++)
+        {
+            digits[2 * i] = scalar[i] & 15;
+            digits[2 * i + 1] = scalar[i] >> 4;
+        }
+        
+        // Each digit above 7 borrows 16 from the next one. The last digit stays at most 8 since the scalar
+        //  is below 2^255.
+        int8_t carry = 0;
+        for(size_t i = 0; i < 63; i++)
+        {
+            digits[i] += carry;
+            carry = (digits[i] + 8) >> 4;
+            digits[i] -= carry << 4;
+        }
+        digits[63] += carry;
+        
+        return digits;
+    }
+    
+    // Recodes the scalar into 256 digits, each zero or odd in [-15, 15], with scalar = sum(e[i] * 2^i). Going
+    //  up from the lowest bit, each nonzero digit absorbs the bits of the next 6 positions as long as it stays
+    //  in range, so nonzero digits are usually 5 or more positions apart.
+    vector<int8_t> ComputeSlidingWindowDigits(const vector<uint8_t>& scalar)
+    {
+        vector<int8_t> digits(256);
+        for(size_t i = 0; i < 256; i++)
+            digits[i] = (scalar[i / 8] >> (i % 8)) & 1;
+        
+        for(size_t i = 0; i < 256; i++)
+        {
+            if(digits[i] == 0)
+                continue;
+            
+            for(size_t b = 1; b <= 6 && i + b < 256; b++)
+            {
+                if(digits[i + b] == 0)
+                    continue;
+                
+                int shifted = digits[i + b] << b;
+                if(digits[i] + shifted <= 15)
+                {
+                    digits[i] += static_cast<int8_t>(shifted);
+                    digits[i + b] = 0;
+                }
+                else if(digits[i] - shifted >= -15)
+                {
+                    // Subtract here and carry the difference into the next zero bit above. The carry can't
+                    //  run past the top since the scalar is below 2^255.
+                    digits[i] -= static_cast<int8_t>(shifted);
+                    for(size_t k = i + b; k < 256; k++)
+                    {
+                        if(digits[k] == 0)
+                        {
+                            digits[k] = 1;
+                            break;
+                        }
+                        digits[k] = 0;
+                    }
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+        
+        return digits;
+    }
+}
+
+EdwardsPoint::EdwardsPoint() : _X(0), _Y(1), _Z(1), _T(0)
+{
+}
+
+void EdwardsPoint::BuildBaseTable()
+{
+    if(!TryDecode(vector<uint8_t>(BASE_POINT_BYTES, BASE_POINT_BYTES + ENCODED_SIZE), _basePoint))
+        throw runtime_error("Unable to decode the Ed25519 base point.");
+    
+    vector<CachedPoint> table;
+    table.reserve(64 * 8);
+    
+    EdwardsPoint rowBase = _basePoint;
+    for(size_t i = 0; i < 64; i++)
+    {
+        EdwardsPoint multiple = rowBase;
+        for(size_t j = 1; j <= 8; j++)
+        {
+            table.push_back(multiple.ToCached());
+            multiple += rowBase;
+        }
+        
+        rowBase.Double().Double().Double().Double();
+    }
+    
+    _baseTable.swap(table);
+}
+
+const EdwardsPoint& EdwardsPoint::GetBasePoint()
+{
+    call_once(_baseTableFlag, &EdwardsPoint::BuildBaseTable);
+    return _basePoint;
+}
+
+bool EdwardsPoint::TryDecode(const vector<uint8_t>& encoded, EdwardsPoint& point)
+{
+    if(encoded.size() != ENCODED_SIZE)
+        return false;
+    
+    vector<uint8_t> yBytes = encoded;
+    bool xIsNegative = (yBytes[31] & 0x80) != 0;
+    yBytes[31] &= 0x7F;
+    
+    FieldElement25519 y = FieldElement25519::FromBytes(yBytes);
+    if(y.GetBytes() != yBytes)
+        return false;
+    
+    // x^2 = u / v with u = y^2 - 1 and v = d y^2 + 1. Its candidate square root is
+    //  x = u v^3 (u v^7)^((p - 5) / 8), which is correct if v x^2 = u, and must be multiplied by sqrt(-1)
+    //  if v x^2 = -u. Otherwise u / v is not a square.
+    FieldElement25519 y2 = y;
+    y2.Square();
+    FieldElement25519 u = y2 - FieldElement25519(1);
+    FieldElement25519 v = D * y2 + FieldElement25519(1);
+    
+    FieldElement25519 v3 = v;
+    v3.Square();
+    v3 *= v;
+    FieldElement25519 uv3 = u * v3;
+    
+    FieldElement25519 uv7 = v3;
+    uv7.Square();
+    uv7 *= v;
+    uv7 *= u;
+    FieldElement25519 x = uv3 * uv7.GetPowerPMinus5Over8();
+    
+    FieldElement25519 vx2 = x;
+    vx2.Square();
+    vx2 *= v;
+    if(vx2 != u)
+    {
+        if(vx2 != -u)
+            return false;
+        
+        x *= SQRT_MINUS_ONE;
+    }
+    
+    if(x.IsZero() && xIsNegative)
+        return false;
+    if(x.IsNegative() != xIsNegative)
+        x = -x;
+    
+    point._X = x;
+    point._Y = y;
+    point._Z = FieldElement25519(1);
+    point._T = x * y;
+    return true;
+}
+
+vector<uint8_t> EdwardsPoint::Encode() const
+{
+    FieldElement25519 zInverse = _Z.GetInverse();
+    FieldElement25519 x = _X * zInverse;
+    FieldElement25519 y = _Y * zInverse;
+    
+    vector<uint8_t> encoded = y.GetBytes();
+    if(x.IsNegative())
+        encoded[31] |= 0x80;
+    
+    return encoded;
+}
+
+EdwardsPoint::CachedPoint EdwardsPoint::ToCached() const
+{
+    CachedPoint cached;
+    cached.yPlusX = _Y + _X;
+    cached.yMinusX = _Y - _X;
+    cached.z2 = _Z + _Z;
+    cached.t2d = _T * D2;
+    return cached;
+}
+
+void EdwardsPoint::Add(const CachedPoint& other)
+{
+    // The unified addition for a = -1 (found here: https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3),
+    //  with the other point's terms already prepared.
+    FieldElement25519 A = (_Y - _X) * other.yMinusX;
+    FieldElement25519 B = (_Y + _X) * other.yPlusX;
+    FieldElement25519 C = _T * other.t2d;
+    FieldElement25519 D = _Z * other.z2;
+    FieldElement25519 E = B - A;
+    FieldElement25519 F = D - C;
+    FieldElement25519 G = D + C;
+    FieldElement25519 H = B + A;
+    
+    _X = E * F;
+    _Y = G * H;
+    _T = E * H;
+    _Z = F * G;
+}
+
+void EdwardsPoint::Subtract(const CachedPoint& other)
+{
+    // As Add(), for the negated point (-x, y): Y + X and Y - X trade places and the sign of T flips.
+    FieldElement25519 A = (_Y - _X) * other.yPlusX;
+    FieldElement25519 B = (_Y + _X) * other.yMinusX;
+    FieldElement25519 C = _T * other.t2d;
+    FieldElement25519 D = _Z * other.z2;
+    FieldElement25519 E = B - A;
+    FieldElement25519 F = D + C;
+    FieldElement25519 G = D - C;
+    FieldElement25519 H = B + A;
+    
+    _X = E * F;
+    _Y = G * H;
+    _T = E * H;
+    _Z = F * G;
+}
+
+EdwardsPoint& EdwardsPoint::operator+=(const EdwardsPoint& other)
+{
+    Add(other.ToCached());
+    return *this;
+}
+
+EdwardsPoint& EdwardsPoint::operator-=(const EdwardsPoint& other)
+{
+    Subtract(other.ToCached());
+    return *this;
+}
+
+EdwardsPoint EdwardsPoint::operator-() const
+{
+    EdwardsPoint negated = *this;
+    negated._X = -_X;
+    negated._T = -_T;
+    return negated;
+}
+
+EdwardsPoint& EdwardsPoint::Double()
+{
+    // Doubling for a = -1 (found here: RFC 8032, Section 5.1.4), which does not need T.
+    FieldElement25519 A = _X;
+    A.Square();
+    FieldElement25519 B = _Y;
+    B.Square();
+    FieldElement25519 C = _Z;
+    C.Square();
+    C += C;
+    FieldElement25519 H = A + B;
+    FieldElement25519 sum = _X + _Y;
+    sum.Square();
+    FieldElement25519 E = H - sum;
+    FieldElement25519 G = A - B;
+    FieldElement25519 F = C + G;
+    
+    _X = E * F;
+    _Y = G * H;
+    _T = E * H;
+    _Z = F * G;
+    return *this;
+}
+
+EdwardsPoint EdwardsPoint::MultiplyByCofactor() const
+{
+    EdwardsPoint result = *this;
+    result.Double().Double().Double();
+    return result;
+}
+
+bool EdwardsPoint::IsNeutralElement() const
+{
+    return (_X.IsZero() && _Y == _Z);
+}
+
+bool EdwardsPoint::operator==(const EdwardsPoint& other) const
+{
+    return (_X * other._Z == other._X * _Z) && (_Y * other._Z == other._Y * _Z);
+}
+
+bool EdwardsPoint::operator!=(const EdwardsPoint& other) const
+{
+    return !(*this == other);
+}
+
+EdwardsPoint::CachedPoint EdwardsPoint::SelectBaseTableEntry(size_t row, int8_t digit)
+{
+    int64_t signedDigit = digit;
+    uint64_t isNegative = static_cast<uint64_t>(signedDigit) >> 63;
+    uint64_t magnitude = static_cast<uint64_t>(signedDigit - 2 * (-static_cast<int64_t>(isNegative) & signedDigit));
+    
+    // Start with the neutral element, for digit 0.
+    CachedPoint selected;
+    selected.yPlusX = FieldElement25519(1);
+    selected.yMinusX = FieldElement25519(1);
+    selected.z2 = FieldElement25519(2);
+    selected.t2d = FieldElement25519(0);
+    
+    const CachedPoint* entries = &_baseTable[row * 8];
+    for(uint64_t j = 1; j <= 8; j++)
+    {
+        uint64_t isSelected = IsEqual(magnitude, j);
+        selected.yPlusX.ConditionalMove(entries[j - 1].yPlusX, isSelected);
+        selected.yMinusX.ConditionalMove(entries[j - 1].yMinusX, isSelected);
+        selected.z2.ConditionalMove(entries[j - 1].z2, isSelected);
+        selected.t2d.ConditionalMove(entries[j - 1].t2d, isSelected);
+    }
+    
+    FieldElement25519::ConditionalSwap(selected.yPlusX, selected.yMinusX, isNegative);
+    selected.t2d.ConditionalMove(-selected.t2d, isNegative);
+    return selected;
+}
+
+EdwardsPoint EdwardsPoint::MultiplyBasePoint(const vector<uint8_t>& scalar)
+{
+    EnsureScalarSize(scalar);
+    GetBasePoint();
+    
+    vector<int8_t> digits = ComputeSignedRadix16Digits(scalar);
+    
+    EdwardsPoint result;
+    for(size_t i = 0; i < digits.size(); i++)
+        result.Add(SelectBaseTableEntry(i, digits[i]));
+    
+    return result;
+}
+
+EdwardsPoint EdwardsPoint::MultiplyScalars(const vector<vector<uint8_t>>& scalars, const vector<EdwardsPoint>& points)
+{
+    if(scalars.size() != points.size())
+        throw invalid_argument("The number of scalars and points must match.");
+    
+    // Recode every scalar and prepare the odd multiples of every point.
+    vector<vector<int8_t>> digits;
+    vector<CachedPoint> oddMultiples;
+    digits.reserve(scalars.size());
+    oddMultiples.reserve(points.size() * ODD_MULTIPLE_COUNT);
+    for(size_t i = 0; i < scalars.size(); i++)
+    {
+        EnsureScalarSize(scalars[i]);
+        digits.push_back(ComputeSlidingWindowDigits(scalars[i]));
+        
+        EdwardsPoint twice = points[i];
+        twice.Double();
+        CachedPoint twiceCached = twice.ToCached();
+        
+        EdwardsPoint multiple = points[i];
+        for(size_t j = 0; j < ODD_MULTIPLE_COUNT; j++)
+        {
+            oddMultiples.push_back(multiple.ToCached());
+            multiple.Add(twiceCached);
+        }
+    }
+    
+    // Skip the leading positions at which every digit is zero.
+    int top = 255;
+    for(; top >= 0; --top)
+    {
+        bool hasDigit = false;
+        for(size_t i = 0; i < digits.size() && !hasDigit; i++)
+            hasDigit = (digits[i][top] != 0);
+        if(hasDigit)
+            break;
+    }
+    
+    EdwardsPoint result;
+    for(int bit = top; bit >= 0; --bit)
+    {
+        result.Double();
+        
+        for(size_t i = 0; i < digits.size(); i++)
+        {
+            int8_t digit = digits[i][bit];
+            if(digit > 0)
+                result.Add(oddMultiples[i * ODD_MULTIPLE_COUNT + digit / 2]);
+            else if(digit < 0)
+                result.Subtract(oddMultiples[i * ODD_MULTIPLE_COUNT + (-digit) / 2]);
+        }
+    }
+    
+    return result;
+}
+
+EdwardsPoint operator+(EdwardsPoint lhs, const EdwardsPoint& rhs)
+{
+    lhs += rhs;
+    return lhs;
+}
+
+EdwardsPoint operator-(EdwardsPoint lhs, const EdwardsPoint& rhs)
+{
+    lhs -= rhs;
+    return lhs;
+}
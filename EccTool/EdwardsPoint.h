@@ -0,0 +1,127 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__EdwardsPoint__
+#define __EccTool__EdwardsPoint__
+
+#include <mutex>
+#include <vector>
+#include "FieldElement25519.h"
+
+using namespace std;
+
+// EdwardsPoint is a point on the twisted Edwards curve edwards25519: -x^2 + y^2 = 1 + d x^2 y^2 over the
+//  field of p = 2^255 - 19 (as specified by RFC 8032), which is birationally equivalent to Curve25519.
+//
+// Points are kept in extended coordinates (X : Y : Z : T) with x = X/Z, y = Y/Z and x * y = T/Z (found here:
+//  Twisted Edwards Curves Revisited, Hisil, Wong, Carter, Dawson). The addition formulas are complete, so
+//  neither the neutral element (0, 1) nor doubling through addition need special cases, and no inversion is
+//  needed until the point is encoded.
+//
+// Scalars are given as 32 little-endian bytes and must be below 2^255.
+class EdwardsPoint
+{
+private:
+    FieldElement25519 _X;
+    FieldElement25519 _Y;
+    FieldElement25519 _Z;
+    FieldElement25519 _T;
+    
+    // A point prepared for being added: (Y + X, Y - X, 2Z, 2dT), which saves the additions and
+    //  multiplications by constants the addition formulas would otherwise do for it each time.
+    struct CachedPoint
+    {
+        FieldElement25519 yPlusX;
+        FieldElement25519 yMinusX;
+        FieldElement25519 z2;
+        FieldElement25519 t2d;
+    };
+    
+    CachedPoint ToCached() const;
+    
+    // Adds or subtracts a prepared point.
+    void Add(const CachedPoint& other);
+    void Subtract(const CachedPoint& other);
+    
+    // Returns the entry of the base point table row for the signed digit in [-8, 8], that is
+    //  digit * 16^row * G, reading every entry of the row so that the time taken does not depend on it.
+    static CachedPoint SelectBaseTableEntry(size_t row, int8_t digit);
+    
+    // The base point, and the table of j * 16^i * G for i < 64 and 1 <= j <= 8 (row i holding the 8
+    //  multiples of 16^i * G), built on first use.
+    static once_flag _baseTableFlag;
+    static EdwardsPoint _basePoint;
+    static vector<CachedPoint> _baseTable;
+    static void BuildBaseTable();
+    
+public:
+    // The size of an encoded point.
+    static const size_t ENCODED_SIZE = 32;
+    
+    // Creates the neutral element (0, 1).
+    EdwardsPoint();
+    
+    // Returns the base point G of Ed25519 (with y = 4/5 and positive x).
+    static const EdwardsPoint& GetBasePoint();
+    
+    // Decodes a point from its 32-byte encoding: y in little-endian with the sign (low bit) of x in the top
+    //  bit. Returns false if y is not fully reduced or there is no point with that y and sign, as required by
+    //  RFC 8032, Section 5.1.3.
+    static bool TryDecode(const vector<uint8_t>& encoded, EdwardsPoint& point);
+    
+    // Encodes this point as 32 bytes (see TryDecode()).
+    vector<uint8_t> Encode() const;
+    
+    // Group operations.
+    EdwardsPoint& operator+=(const EdwardsPoint& other);
+    EdwardsPoint& operator-=(const EdwardsPoint& other);
+    EdwardsPoint operator-() const;
+    EdwardsPoint& Double();
+    
+    // Returns 8 times this point, which clears any component of small order.
+    EdwardsPoint MultiplyByCofactor() const;
+    
+    // Returns true if this is the neutral element.
+    bool IsNeutralElement() const;
+    
+    // Comparison operators (of the affine points).
+    bool operator==(const EdwardsPoint& other) const;
+    bool operator!=(const EdwardsPoint& other) const;
+    
+    // Multiplies the base point by the scalar in constant time, adding one entry of each row of the base
+    //  point table for the 64 signed radix-16 digits of the scalar (so no doublings are needed).
+    static EdwardsPoint MultiplyBasePoint(const vector<uint8_t>& scalar);
+    
+    // Computes the sum of scalars[i] * points[i] (multi-scalar multiplication), sharing the doublings between
+    //  all the points (Straus' method) with a sliding window of odd digits up to 15 for each scalar. Takes
+    //  variable time, so it must only be used with public scalars, e.g. for verification.
+    static EdwardsPoint MultiplyScalars(const vector<vector<uint8_t>>& scalars, const vector<EdwardsPoint>& points);
+};
+
+// Binary '+' operator implemented as a free function by convention.
+EdwardsPoint operator+(EdwardsPoint lhs, const EdwardsPoint& rhs);
+
+// Binary '-' operator implemented as a free function by convention.
+EdwardsPoint operator-(EdwardsPoint lhs, const EdwardsPoint& rhs);
+
+#endif /* defined(__EccTool__EdwardsPoint__) */
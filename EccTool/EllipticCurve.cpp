@@ -25,22 +25,33 @@
 #include "EccDefs.h"
 #include "FieldElement.h"
 #include "Utilities.h"
+#include "EmbeddedTables.h"
+#include "WorkerPool.h"
 #include <string>
 #include <exception>
 #include <iostream>
 #include <algorithm>
+#include <mutex>
+#include <thread>
 
 using namespace std;
 using namespace ecc;
 
 const Point EllipticCurve::PointAtInfinity = Point::MakePointAtInfinity();
+const unsigned int EllipticCurve::MIN_WNAF_WIDTH = 2;
+const unsigned int EllipticCurve::MAX_WNAF_WIDTH = 8;
+const CombParameters EllipticCurve::DEFAULT_COMB_PARAMETERS = { 5, 4 };
+const unsigned int EllipticCurve::BASE_POINT_WNAF_WIDTH = 6;
+const size_t EllipticCurve::MIN_PIPPENGER_POINTS = 48;
+const size_t EllipticCurve::MIN_LOCKSTEP_POINTS = 32;
 const char* EllipticCurve::COMPRESSED_GENERATOR_FLAG = "02";
 const char* EllipticCurve::UNCOMPRESSED_GENERATOR_FLAG = "04";
 
 EllipticCurve::EllipticCurve(DomainParameters params) 
 	: _p(make_shared<BigInteger>(params.p)), 
-	_a(params.a, _p), 
-	_b(params.b, _p), 
+	_reduction(ecc::FindFastReduction(*_p)), 
+	_a(params.a, _p, _reduction), 
+	_b(params.b, _p, _reduction), 
 	_G(Point::Parse(utilities::HexStringToBytes(params.G), 0, _p)), 
 	_n(params.n), 
 	_h(params.h), 
@@ -49,6 +60,26 @@ EllipticCurve::EllipticCurve(DomainParameters params)
     // Validate that the base point G is on the curve.
     if(!CheckPointOnCurve(_G))
         throw invalid_argument("Invalid curve parameters: Generator point not on curve.");
+    
+    _aIsZero = (_a == 0);
+    _aIsMinusThree = ((_a + FieldElement(3, _p, _reduction)) == 0);
+    
+    // The endomorphism (x, y) -> (beta * x, y) only exists on curves with a = 0, and the scalar
+    //  decomposition assumes every point on the curve is a multiple of G.
+    if(!params.beta.empty())
+    {
+        BigInteger betaValue(params.beta);
+        if(!_aIsZero || _h != 1 || betaValue >= *_p)
+            throw invalid_argument("Invalid curve parameters: Endomorphism does not apply to curve.");
+        
+        FieldElement beta(move(betaValue), _p, _reduction);
+        if((beta * beta * beta) != FieldElement(1, _p, _reduction))
+            throw invalid_argument("Invalid curve parameters: Endomorphism does not apply to curve.");
+        
+        _endomorphism = make_shared<Endomorphism>(move(beta), BigInteger(params.lambda), BigInteger(params.a1), BigInteger(params.b1), BigInteger(params.a2), BigInteger(params.b2));
+    }
+    
+    SetBasePointCombParameters(DEFAULT_COMB_PARAMETERS);
 }
 
 Point EllipticCurve::PointAdd(const Point& P, const Point& Q) const
@@ -86,8 +117,8 @@ Point EllipticCurve::PointDouble(const Point& P) const
     //  All calculations are done mod p (where p is the finite field of the curve) using the
     //      <operation>InFiniteField() functions.
     
-    FieldElement s = ((FieldElement(3, _p) * (P.x * P.x)) + _a) / (FieldElement(2, _p) * P.y);
-    FieldElement Rx = (s * s) - (FieldElement(2, _p) * P.x);
+    FieldElement s = ((FieldElement(3, _p, _reduction) * (P.x * P.x)) + _a) / (FieldElement(2, _p, _reduction) * P.y);
+    FieldElement Rx = (s * s) - (FieldElement(2, _p, _reduction) * P.x);
     FieldElement Ry = (s * (P.x - Rx)) - P.y;
     
     return Point(move(Rx), move(Ry));
@@ -124,39 +155,1726 @@ Point EllipticCurve::AddPointsOnCurve(const Point& rhs, const Point& lhs) const
 //  are undefined otherwise).
 Point EllipticCurve::MultiplyPointOnCurveWithScalar(const Point& point, const BigInteger& scalar) const
 {
-    // Multiplies according the the below algorithm (found here: http://www-ma2.upc.es/~cripto/Q2-06-07/ECC_eng.pdf):
-    //function multiplyByScalar(point A, scalar k)
-    //    N = A
-    //    R = O    // Point at infinity
-    //    r = <Most Significat Bit b of k | b != 0>
-    //    Iterate k from r to 0 (current bit designated by i) {
-    //        R = R + R
-    //        if (bit_is_set(i)) {
-    //            R = R + P
+    // Multiples of the base point can use the precomputed comb table.
+    if(point == _G)
+        return MultiplyBasePointWithScalar(scalar);
+    
+    return MultiplyPointOnCurveWithScalar(point, scalar, GetDefaultWNafWidth(scalar.GetBitSize()));
+}
+
+Point EllipticCurve::MultiplyPointOnCurveWithScalar(const Point& point, const BigInteger& scalar, unsigned int windowWidth) const
+{
+    // Multiplies with the width-w NAF method (found here: Guide to Elliptic Curve Cryptography,
+    //  Hankerson, Menezes, Vanstone, Algorithm 3.36):
+    //function multiplyByScalar(point P, scalar k, width w)
+    //    Compute NAFw(k) = (k[l-1], ..., k[1], k[0])
+    //    Compute Pi = iP for i in {1, 3, 5, ..., 2^(w-1) - 1}
+    //    Q = O    // Point at infinity
+    //    Iterate i from l-1 to 0 {
+    //        Q = 2Q
+    //        if (k[i] > 0) Q = Q + P(k[i])
+    //        if (k[i] < 0) Q = Q - P(-k[i])
+    //    }
+    //    output Q
+    //
+    // Plain double-and-add (binary) multiplication performs an addition for every set bit of
+    //  the scalar, that is once every two bits on average. The width-w NAF recoding guarantees that
+    //  of any w consecutive digits at most one is non-zero, which reduces this to once every (w + 1)
+    //  bits at the cost of a small table of precomputed odd multiples. Negative digits are free
+    //  since negating a point on the curve is a single field subtraction.
+    return ToAffine(MultiplyJacobian(point, scalar, windowWidth));
+}
+
+Point EllipticCurve::MultiplyPointOnCurveWithScalar(const Point& point, const BigInteger& scalar, ScalarMultiplicationMethod method) const
+{
+    if(method == COZ_MONTGOMERY_LADDER)
+    {
+        // Points and scalars for which the ladder hits an exceptional case (only possible when the
+        //  scalar is close to a multiple of the order of the point) use the default method.
+        Point product = PointAtInfinity;
+        if(MultiplyCoZLadder(point, scalar, product))
+            return product;
+    }
+    
+    return MultiplyPointOnCurveWithScalar(point, scalar, GetDefaultWNafWidth(scalar.GetBitSize()));
+}
+
+bool EllipticCurve::MultiplyCoZLadder(const Point& point, const BigInteger& scalar, Point& product) const
+{
+    // Multiplies with the co-Z Montgomery ladder (found here: Fast and Regular Algorithms for Scalar
+    //  Multiplication over Elliptic Curves, Rivain, Algorithm 9, after Goundar, Joye, Miyaji):
+    //function multiplyByScalar(point P, scalar k)
+    //    (R1, R0) = (2P, P)    // Sharing the same Z
+    //    Iterate i from l-2 to 0 {
+    //        b = k[i]
+    //        (R[1-b], R[b]) = (R[b] + R[1-b], R[b] - R[1-b])
+    //        (R[b], R[1-b]) = (R[1-b] + R[b], R[1-b])
+    //    }
+    //    output R0
+    //
+    // The ladder keeps R1 - R0 = P, and every bit costs one addition and one conjugate addition no matter
+    //  its value. Both points always share the same Z coordinate, which makes the additions cheaper and
+    //  means Z never has to be computed: after the final conjugate addition R[b] = (+/-)P, and comparing
+    //  it with the known affine coordinates of P gives 1/Z with a single inversion.
+    if(point == PointAtInfinity || scalar == 0)
+    {
+        product = PointAtInfinity;
+        return true;
+    }
+    
+    size_t bitSize = scalar.GetBitSize();
+    if(bitSize == 1)
+    {
+        product = point;
+        return true;
+    }
+    
+    vector<uint8_t> bits(bitSize);
+    for(size_t i = 0; i < bitSize; i++)
+        bits[i] = scalar.GetBitAt(i) ? 1 : 0;
+    
+    // (The outputs start as copies of the coordinates of P, since elements can't be made without a field.)
+    FieldElement X = point.x;
+    FieldElement Y = point.y;
+    FieldElement inverseZNumerator = point.x;
+    FieldElement inverseZDenominator = point.x;
+    if(!RunCoZLadder(point, bits, X, Y, inverseZNumerator, inverseZDenominator))
+        return false;
+    
+    FieldElement inverseZ = inverseZNumerator / inverseZDenominator;
+    FieldElement inverseZSquared = inverseZ * inverseZ;
+    product = Point(X * inverseZSquared, Y * inverseZSquared * inverseZ);
+    return true;
+}
+
+bool EllipticCurve::RunCoZLadder(const Point& point, const vector<uint8_t>& bits, FieldElement& X0, FieldElement& Y0, FieldElement& inverseZNumerator, FieldElement& inverseZDenominator) const
+{
+    // See MultiplyCoZLadder() for a description of the algorithm.
+    FieldElement X[2] = { point.x, point.x };
+    FieldElement Y[2] = { point.y, point.y };
+    if(!CoZInitialDouble(point, X[0], Y[0], X[1], Y[1]))
+        return false;
+    
+    for(size_t i = bits.size() - 2; i > 0; i--)
+    {
+        int b = bits[i];
+        if(!CoZAddConjugate(X[b], Y[b], X[1 - b], Y[1 - b]) || !CoZAdd(X[1 - b], Y[1 - b], X[b], Y[b]))
+            return false;
+    }
+    
+    int b = bits[0];
+    if(!CoZAddConjugate(X[b], Y[b], X[1 - b], Y[1 - b]))
+        return false;
+    
+    // R[b] = (+/-)P, so (for the Z of the final addition) 1/Z = (X[b] * y) / (x * Y[b] * (X1 - X0)).
+    inverseZDenominator = point.x * Y[b] * (X[1] - X[0]);
+    if(inverseZDenominator == 0)
+        return false;
+    inverseZNumerator = X[b] * point.y;
+    
+    if(!CoZAdd(X[1 - b], Y[1 - b], X[b], Y[b]))
+        return false;
+    
+    X0 = move(X[0]);
+    Y0 = move(Y[0]);
+    return true;
+}
+
+vector<Point> EllipticCurve::MultiplyManyPointsSameScalar(const vector<Point>& points, const BigInteger& scalar) const
+{
+    if(scalar == 0)
+        return vector<Point>(points.size(), PointAtInfinity);
+    
+    if(points.size() < MIN_LOCKSTEP_POINTS)
+        return MultiplyCoZLadders(points, scalar);
+    
+    return MultiplyInLockstep(points, scalar);
+}
+
+vector<Point> EllipticCurve::MultiplyCoZLadders(const vector<Point>& points, const BigInteger& scalar) const
+{
+    // Every point runs the co-Z ladder of MultiplyCoZLadder() through the same sequence of steps, so the
+    //  bits of the scalar are read once for all of them. Each ladder ends with 1/Z as a fraction, and the
+    //  denominators of all of them are inverted together with a single field inversion
+    //  (see FieldElement::InvertBatch()) rather than one per point.
+    vector<Point> products(points.size(), PointAtInfinity);
+    size_t bitSize = scalar.GetBitSize();
+    vector<uint8_t> bits(bitSize);
+    for(size_t i = 0; i < bitSize; i++)
+        bits[i] = scalar.GetBitAt(i) ? 1 : 0;
+    
+    vector<size_t> ladderIndices;
+    vector<FieldElement> X;
+    vector<FieldElement> Y;
+    vector<FieldElement> inverseZNumerators;
+    vector<FieldElement> inverseZDenominators;
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        const Point& point = points[i];
+        if(point == PointAtInfinity)
+            continue;
+        
+        if(bitSize == 1)
+        {
+            products[i] = point;
+            continue;
+        }
+        
+        // Points for which the ladder hits an exceptional case use the default method, as with
+        //  MultiplyPointOnCurveWithScalar().
+        FieldElement x = point.x;
+        FieldElement y = point.y;
+        FieldElement inverseZNumerator = point.x;
+        FieldElement inverseZDenominator = point.x;
+        if(!RunCoZLadder(point, bits, x, y, inverseZNumerator, inverseZDenominator))
+        {
+            products[i] = MultiplyPointOnCurveWithScalar(point, scalar, GetDefaultWNafWidth(bitSize));
+            continue;
+        }
+        
+        ladderIndices.push_back(i);
+        X.push_back(move(x));
+        Y.push_back(move(y));
+        inverseZNumerators.push_back(move(inverseZNumerator));
+        inverseZDenominators.push_back(move(inverseZDenominator));
+    }
+    
+    FieldElement::InvertBatch(inverseZDenominators);
+    for(size_t j = 0; j < ladderIndices.size(); j++)
+    {
+        FieldElement inverseZ = inverseZNumerators[j] * inverseZDenominators[j];
+        FieldElement inverseZSquared = inverseZ * inverseZ;
+        products[ladderIndices[j]] = Point(X[j] * inverseZSquared, Y[j] * inverseZSquared * inverseZ);
+    }
+    
+    return products;
+}
+
+vector<Point> EllipticCurve::MultiplyInLockstep(const vector<Point>& points, const BigInteger& scalar) const
+{
+    // Multiplies all points together with a regular signed fixed window (found here: Highly Regular m-ary
+    //  Powering Ladders, Joye, Tunstall), in affine coordinates:
+    //function multiplyByScalar(point P, odd scalar k, width w)
+    //    Recode k = sum(d[i] * 2^(w*i)) with every digit odd and |d[i]| < 2^w
+    //    Compute Pi = iP for i in {1, 3, 5, ..., 2^w - 1}
+    //    Q = P(d[l-1])
+    //    Iterate i from l-2 to 0 {
+    //        Q = 2^w * Q
+    //        Q = Q + P(d[i])    // P(-j) = -P(j)
+    //    }
+    //    output Q
+    //
+    // Since no digit is zero every point goes through the same sequence of doublings and additions no matter
+    //  the scalar (an even scalar is handled as (k - 1) * P + P). All points take each step together, and
+    //  the inverses that step needs for the affine formulas are computed with a single field inversion (see
+    //  FieldElement::InvertBatch()), which only costs three field multiplications per point on top of that
+    //  inversion. An affine doubling or addition is then cheaper than its Jacobian counterpart, and the
+    //  products need no conversion at the end.
+    vector<Point> products(points.size(), PointAtInfinity);
+    
+    // Recode the scalar once for all points.
+    const unsigned int windowWidth = (scalar.GetBitSize() > 300) ? 5 : 4;
+    const BigInteger windowSize(1u << windowWidth);
+    bool isEven = !scalar.GetBitAt(0);
+    BigInteger k = isEven ? scalar - BigInteger(1) : scalar;
+    vector<int> digits;
+    while(k > windowSize)
+    {
+        int digit = 0;
+        for(unsigned int j = 0; j <= windowWidth; j++)
+        {
+            if(k.GetBitAt(j))
+                digit += (1 << j);
+        }
+        digit -= (1 << windowWidth);
+        digits.push_back(digit);
+        
+        k = (digit < 0) ? k + BigInteger(static_cast<unsigned int>(-digit)) : k - BigInteger(static_cast<unsigned int>(digit));
+        k >>= windowWidth;
+    }
+    int topDigit = 0;
+    for(unsigned int j = 0; j < windowWidth; j++)
+    {
+        if(k.GetBitAt(j))
+            topDigit += (1 << j);
+    }
+    
+    // Points at infinity are left out, as are points which hit an exceptional case (see AddInLockstep()),
+    //  which are multiplied on their own at the end.
+    vector<Point> base;
+    vector<size_t> indices;
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        if(!points[i].IsPointAtInfinity())
+        {
+            base.push_back(points[i]);
+            indices.push_back(i);
+        }
+    }
+    vector<bool> failed(base.size(), false);
+    
+    // The odd multiples of every point: table[m][j] = (2m + 1) * P_j.
+    const size_t tableSize = static_cast<size_t>(1) << (windowWidth - 1);
+    vector<vector<Point>> table(1, base);
+    vector<Point> doubled(base);
+    DoubleInLockstep(doubled, failed);
+    for(size_t m = 1; m < tableSize; m++)
+    {
+        table.push_back(table[m - 1]);
+        AddInLockstep(table[m], doubled, failed);
+    }
+    
+    vector<Point> accumulators = table[(topDigit - 1) / 2];
+    vector<Point> addends;
+    for(int i = static_cast<int>(digits.size()) - 1; i >= 0; i--)
+    {
+        for(unsigned int j = 0; j < windowWidth; j++)
+            DoubleInLockstep(accumulators, failed);
+        
+        const vector<Point>& multiples = table[(abs(digits[i]) - 1) / 2];
+        if(digits[i] > 0)
+        {
+            AddInLockstep(accumulators, multiples, failed);
+        }
+        else
+        {
+            addends.clear();
+            for(const Point& multiple : multiples)
+                addends.push_back(Point(multiple.x, -multiple.y));
+            AddInLockstep(accumulators, addends, failed);
+        }
+    }
+    if(isEven)
+        AddInLockstep(accumulators, base, failed);
+    
+    for(size_t j = 0; j < base.size(); j++)
+        products[indices[j]] = failed[j] ? MultiplyPointOnCurveWithScalar(base[j], scalar, COZ_MONTGOMERY_LADDER) : accumulators[j];
+    
+    return products;
+}
+
+void EllipticCurve::DoubleInLockstep(vector<Point>& points, vector<bool>& failed) const
+{
+    // 2P = (L^2 - 2x, L * (x - (L^2 - 2x)) - y), where L = (3x^2 + a) / 2y.
+    vector<FieldElement> denominators;
+    denominators.reserve(points.size());
+    for(size_t j = 0; j < points.size(); j++)
+    {
+        if(!failed[j] && points[j].y == 0)
+            failed[j] = true;
+        if(!failed[j])
+            denominators.push_back(points[j].y + points[j].y);
+    }
+    FieldElement::InvertBatch(denominators);
+    
+    size_t inverseIndex = 0;
+    for(size_t j = 0; j < points.size(); j++)
+    {
+        if(failed[j])
+            continue;
+        
+        Point& point = points[j];
+        FieldElement xSquared = point.x * point.x;
+        FieldElement slope = (xSquared + xSquared + xSquared + _a) * denominators[inverseIndex++];
+        FieldElement x = (slope * slope) - point.x - point.x;
+        point.y = (slope * (point.x - x)) - point.y;
+        point.x = move(x);
+    }
+}
+
+void EllipticCurve::AddInLockstep(vector<Point>& points, const vector<Point>& addends, vector<bool>& failed) const
+{
+    // P + Q = (L^2 - x1 - x2, L * (x1 - (L^2 - x1 - x2)) - y1), where L = (y2 - y1) / (x2 - x1).
+    vector<FieldElement> denominators;
+    denominators.reserve(points.size());
+    for(size_t j = 0; j < points.size(); j++)
+    {
+        if(!failed[j] && points[j].x == addends[j].x)
+            failed[j] = true;
+        if(!failed[j])
+            denominators.push_back(addends[j].x - points[j].x);
+    }
+    FieldElement::InvertBatch(denominators);
+    
+    size_t inverseIndex = 0;
+    for(size_t j = 0; j < points.size(); j++)
+    {
+        if(failed[j])
+            continue;
+        
+        Point& point = points[j];
+        FieldElement slope = (addends[j].y - point.y) * denominators[inverseIndex++];
+        FieldElement x = (slope * slope) - point.x - addends[j].x;
+        point.y = (slope * (point.x - x)) - point.y;
+        point.x = move(x);
+    }
+}
+
+bool EllipticCurve::CoZAdd(FieldElement& X1, FieldElement& Y1, FieldElement& X2, FieldElement& Y2) const
+{
+    // Co-Z addition with update (XYCZ-ADD, found here: Co-Z Addition Formulae and Binary Ladders on
+    //  Elliptic Curves, Goundar, Joye, Miyaji):
+    //  A = (X2 - X1)^2, B = X1 * A, C = X2 * A, D = (Y2 - Y1)^2
+    //  (P + Q):X = D - B - C
+    //  (P + Q):Y = (Y2 - Y1) * (B - (P + Q):X) - Y1 * (C - B)
+    //  P = (B, Y1 * (C - B))    // P with the new Z = Z * (X2 - X1)
+    FieldElement dX = X2 - X1;
+    if(dX == 0)
+        return false;
+    
+    FieldElement A = dX * dX;
+    FieldElement B = X1 * A;
+    FieldElement C = X2 * A;
+    FieldElement dY = Y2 - Y1;
+    FieldElement E = Y1 * (C - B);
+    
+    FieldElement Rx = (dY * dY) - B - C;
+    Y2 = (dY * (B - Rx)) - E;
+    X2 = move(Rx);
+    X1 = move(B);
+    Y1 = move(E);
+    
+    return true;
+}
+
+bool EllipticCurve::CoZAddConjugate(FieldElement& X1, FieldElement& Y1, FieldElement& X2, FieldElement& Y2) const
+{
+    // Conjugate co-Z addition (XYCZ-ADDC). Like CoZAdd(), with P - Q sharing all intermediate values
+    //  except the slope (Q negated means Y2 - Y1 becomes -(Y1 + Y2)):
+    //  F = (Y1 + Y2)^2
+    //  (P - Q):X = F - B - C
+    //  (P - Q):Y = (Y1 + Y2) * ((P - Q):X - B) - Y1 * (C - B)
+    FieldElement dX = X2 - X1;
+    if(dX == 0)
+        return false;
+    
+    FieldElement A = dX * dX;
+    FieldElement B = X1 * A;
+    FieldElement C = X2 * A;
+    FieldElement dY = Y2 - Y1;
+    FieldElement sY = Y1 + Y2;
+    FieldElement E = Y1 * (C - B);
+    
+    FieldElement Sx = (dY * dY) - B - C;
+    FieldElement Sy = (dY * (B - Sx)) - E;
+    FieldElement Dx = (sY * sY) - B - C;
+    FieldElement Dy = (sY * (Dx - B)) - E;
+    
+    X1 = move(Dx);
+    Y1 = move(Dy);
+    X2 = move(Sx);
+    Y2 = move(Sy);
+    
+    return true;
+}
+
+bool EllipticCurve::CoZInitialDouble(const Point& point, FieldElement& X1, FieldElement& Y1, FieldElement& X2, FieldElement& Y2) const
+{
+    // Doubles the affine point P (Z = 1) in Jacobian coordinates. The result has Z = 2y, with which
+    //  P itself is (x * (2y)^2, y * (2y)^3) = (S, 8y^4):
+    //  S = 4xy^2, M = 3x^2 + a
+    //  2P:X = M^2 - 2S
+    //  2P:Y = M * (S - 2P:X) - 8y^4
+    if(point.y == 0)
+        return false;
+    
+    FieldElement ySquared = point.y * point.y;
+    FieldElement S = FieldElement(4, _p, _reduction) * point.x * ySquared;
+    FieldElement M = (FieldElement(3, _p, _reduction) * (point.x * point.x)) + _a;
+    FieldElement L = FieldElement(8, _p, _reduction) * (ySquared * ySquared);
+    
+    X2 = (M * M) - (FieldElement(2, _p, _reduction) * S);
+    Y2 = (M * (S - X2)) - L;
+    X1 = move(S);
+    Y1 = move(L);
+    
+    return true;
+}
+
+JacobianPoint EllipticCurve::MultiplyJacobian(const Point& point, const BigInteger& scalar, unsigned int windowWidth) const
+{
+    // See MultiplyPointOnCurveWithScalar() for a description of the algorithm. The product is
+    //  accumulated in Jacobian coordinates with mixed additions of the affine odd multiples.
+    vector<Point> oddMultiples = ComputeOddMultiples(point, static_cast<size_t>(1) << (windowWidth - 2));
+    vector<Point> endomorphismOddMultiples;
+    if(_endomorphism)
+        endomorphismOddMultiples = ApplyEndomorphism(oddMultiples);
+    
+    vector<InterleavedTerm> terms;
+    AppendScalarTerms(scalar, windowWidth, oddMultiples, endomorphismOddMultiples, terms);
+    
+    return MultiplyInterleaved(terms);
+}
+
+Point EllipticCurve::MultiplyBasePointWithScalar(const BigInteger& scalar, unsigned int threadCount) const
+{
+    // Multiplies with the Lim-Lee fixed-base comb method (found here: Guide to Elliptic Curve Cryptography,
+    //  Hankerson, Menezes, Vanstone, Algorithm 3.45 and the notes following it).
+    //
+    // The bits of k are written as a matrix of h rows (teeth) of a bits each, so that bit (t * a + c) of k is
+    //  the c-th bit of row t. Each row is further split into v blocks of b bits (the spacing). Reading one
+    //  bit from the same column of every row yields an h-bit index into a table of sums of the powers of two
+    //  of G at those rows:
+    //function multiplyBaseByScalar(scalar k)
+    //    Q = O    // Point at infinity
+    //    Iterate j from b-1 to 0 {
+    //        Q = 2Q
+    //        Iterate s from 0 to v-1 {
+    //            i = (k[(h-1)a + sb + j], ..., k[a + sb + j], k[sb + j])
+    //            Q = Q + T[s][i]    // T[s][i] = 2^(sb) * (i[h-1] * 2^((h-1)a) + ... + i[0] * 2^0) * G
     //        }
     //    }
-    //    output R
+    //    output Q
+    //
+    // Since G never changes the table is built once and every multiplication then needs only b - 1
+    //  doublings instead of one per bit of the scalar.
     
-    // This algorithm is significantly more efficient than repeated addition because of the huge size
-    // of some of these numbers.
+    return ToAffine(MultiplyBasePointJacobian(scalar, threadCount));
+}
 
-    Point product = EllipticCurve::PointAtInfinity;
-    Point n = point;
+JacobianPoint EllipticCurve::MultiplyBasePointJacobian(const BigInteger& scalar, unsigned int threadCount) const
+{
+    // See MultiplyBasePointWithScalar() for a description of the algorithm.
     
-    // Find first non-zero bit starting at the MSB of the scalar.
-    int i = static_cast<int>(scalar.GetMostSignificantBitIndex());
+    // G has order n so the scalar can be reduced to fit the comb.
+    BigInteger k = (scalar >= _n) ? (scalar % _n) : scalar;
+    if(k == 0)
+        return MakeJacobianPointAtInfinity();
     
-    // Do the addition based on the above algorithm.
-    for(; i >= 0; i--)
+    return MultiplyFixedPointsJacobian(vector<const FixedPointTable*>(1, &GetBasePointTable().comb), vector<BigInteger>(1, move(k)), threadCount);
+}
+
+JacobianPoint EllipticCurve::MultiplyFixedPointsJacobian(const vector<const FixedPointTable*>& tables, const vector<BigInteger>& scalars, unsigned int threadCount) const
+{
+    // Each product is computed as in MultiplyBasePointWithScalar(), all sharing the doublings of the
+    //  table with the largest spacing. Scalars must already be reduced mod n.
+    //
+    // Each block covers its own segment of every row of the scalar, so the sums of different blocks are
+    //  independent of each other. Task t adds the blocks t, t + threadCount, t + 2 * threadCount, ...
+    //  of every table, which costs each task the full (short) chain of doublings but only its share of
+    //  the additions, and the partial sums are added up at the end.
+    
+    // Unpack the scalars into their individual bits (reading them through GetBitAt for each column is
+    //  significantly slower).
+    vector<vector<uint8_t>> bits(tables.size());
+    int maxSpacing = 0;
+    size_t maxBlockCount = 0;
+    for(size_t m = 0; m < tables.size(); m++)
     {
-        product = AddPointsOnCurve(product, product);
-        if(scalar.GetBitAt(i))
-            product = AddPointsOnCurve(product, point);
+        const FixedPointTable& table = *tables[m];
+        bits[m].assign(table.parameters.teeth * table.rowSize, 0);
+        size_t bitSize = scalars[m].GetBitSize();
+        for(size_t i = 0; i < bitSize; i++)
+            bits[m][i] = scalars[m].GetBitAt(i) ? 1 : 0;
+        
+        maxSpacing = max(maxSpacing, static_cast<int>(table.parameters.spacing));
+        maxBlockCount = max(maxBlockCount, table.blockCount);
+    }
+    
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(max(min(static_cast<size_t>(threadCount), maxBlockCount), static_cast<size_t>(1)));
+    
+    auto sumBlocks = [&](unsigned int firstBlock) -> JacobianPoint
+    {
+        JacobianPoint product = MakeJacobianPointAtInfinity();
+        for(int j = maxSpacing - 1; j >= 0; j--)
+        {
+            product = JacobianDouble(product);
+            
+            for(size_t m = 0; m < tables.size(); m++)
+            {
+                const FixedPointTable& table = *tables[m];
+                const unsigned int teeth = table.parameters.teeth;
+                const size_t spacing = table.parameters.spacing;
+                const size_t entriesPerBlock = (static_cast<size_t>(1) << teeth) - 1;
+                if(j >= static_cast<int>(spacing))
+                    continue;
+                
+                for(size_t s = firstBlock; s < table.blockCount; s += threadCount)
+                {
+                    // The last block in a row may be partially filled.
+                    size_t column = (s * spacing) + j;
+                    if(column >= table.rowSize)
+                        continue;
+                    
+                    size_t index = 0;
+                    for(unsigned int t = 0; t < teeth; t++)
+                    {
+                        if(bits[m][(t * table.rowSize) + column])
+                            index |= (static_cast<size_t>(1) << t);
+                    }
+                    
+                    if(index != 0)
+                        product = JacobianAddAffine(product, table.points[(s * entriesPerBlock) + (index - 1)]);
+                }
+            }
+        }
+        
+        return product;
+    };
+    
+    if(threadCount == 1)
+        return sumBlocks(0);
+    
+    vector<function<JacobianPoint()>> partialSums;
+    for(unsigned int t = 0; t < threadCount; t++)
+        partialSums.push_back([&sumBlocks, t]() { return sumBlocks(t); });
+    
+    return SumProductsInParallel(partialSums, threadCount);
+}
+
+vector<Point> EllipticCurve::MultiplyBasePointWithScalars(const vector<BigInteger>& scalars, unsigned int threadCount) const
+{
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(max(min(static_cast<size_t>(threadCount), scalars.size()), static_cast<size_t>(1)));
+    
+    // Task t computes the t-th contiguous share of the products. Large shares walk their combs in
+    //  lockstep, smaller ones leave each product in Jacobian coordinates and all of them are normalized at
+    //  once.
+    size_t shareSize = (scalars.size() + threadCount - 1) / threadCount;
+    bool usesLockstep = (shareSize >= MIN_LOCKSTEP_POINTS);
+    vector<Point> products(usesLockstep ? scalars.size() : 0);
+    vector<JacobianPoint> jacobianProducts(usesLockstep ? 0 : scalars.size(), MakeJacobianPointAtInfinity());
+    auto computeShare = [&](unsigned int share)
+    {
+        size_t begin = min(share * shareSize, scalars.size());
+        size_t end = min(begin + shareSize, scalars.size());
+        if(usesLockstep)
+        {
+            vector<Point> shareProducts = MultiplyBasePointInLockstep(vector<BigInteger>(scalars.begin() + begin, scalars.begin() + end));
+            move(shareProducts.begin(), shareProducts.end(), products.begin() + begin);
+        }
+        else
+        {
+            for(size_t i = begin; i < end; i++)
+                jacobianProducts[i] = MultiplyBasePointJacobian(scalars[i]);
+        }
+    };
+    
+    WorkerPool::GetSharedInstance().Run(threadCount, computeShare);
+    
+    return usesLockstep ? products : NormalizeBatch(jacobianProducts);
+}
+
+vector<Point> EllipticCurve::MultiplyBasePointInLockstep(const vector<BigInteger>& scalars) const
+{
+    // Every product takes the same steps as in MultiplyFixedPointsJacobian(): a doubling per column and an
+    //  addition of a table point per block. Products still at infinity take the table point as it is, and
+    //  products for which a step hits an exceptional case (see AddInLockstep()) are computed on their own.
+    const FixedPointTable& table = GetBasePointTable().comb;
+    const unsigned int teeth = table.parameters.teeth;
+    const size_t spacing = table.parameters.spacing;
+    const size_t entriesPerBlock = (static_cast<size_t>(1) << teeth) - 1;
+    
+    vector<vector<uint8_t>> bits(scalars.size());
+    for(size_t i = 0; i < scalars.size(); i++)
+    {
+        BigInteger k = (scalars[i] >= _n) ? (scalars[i] % _n) : scalars[i];
+        bits[i].assign(teeth * table.rowSize, 0);
+        size_t bitSize = k.GetBitSize();
+        for(size_t b = 0; b < bitSize; b++)
+            bits[i][b] = k.GetBitAt(b) ? 1 : 0;
+    }
+    
+    vector<Point> products(scalars.size(), PointAtInfinity);
+    vector<bool> failed(scalars.size(), false);
+    vector<bool> skipped;
+    vector<Point> addends(scalars.size());
+    for(int j = static_cast<int>(spacing) - 1; j >= 0; j--)
+    {
+        if(j != static_cast<int>(spacing) - 1)
+        {
+            skipped = failed;
+            for(size_t i = 0; i < products.size(); i++)
+            {
+                if(products[i].IsPointAtInfinity())
+                    skipped[i] = true;
+            }
+            
+            DoubleInLockstep(products, skipped);
+            for(size_t i = 0; i < products.size(); i++)
+            {
+                if(skipped[i] && !products[i].IsPointAtInfinity())
+                    failed[i] = true;
+            }
+        }
+        
+        for(size_t s = 0; s < table.blockCount; s++)
+        {
+            // The last block in a row may be partially filled.
+            size_t column = (s * spacing) + j;
+            if(column >= table.rowSize)
+                continue;
+            
+            skipped = failed;
+            for(size_t i = 0; i < products.size(); i++)
+            {
+                if(failed[i])
+                    continue;
+                
+                size_t index = 0;
+                for(unsigned int t = 0; t < teeth; t++)
+                {
+                    if(bits[i][(t * table.rowSize) + column])
+                        index |= (static_cast<size_t>(1) << t);
+                }
+                
+                if(index == 0)
+                {
+                    skipped[i] = true;
+                }
+                else if(products[i].IsPointAtInfinity())
+                {
+                    products[i] = table.points[(s * entriesPerBlock) + (index - 1)];
+                    skipped[i] = true;
+                }
+                else
+                {
+                    addends[i] = table.points[(s * entriesPerBlock) + (index - 1)];
+                }
+            }
+            
+            vector<bool> wasSkipped = skipped;
+            AddInLockstep(products, addends, skipped);
+            for(size_t i = 0; i < products.size(); i++)
+            {
+                if(skipped[i] && !wasSkipped[i])
+                    failed[i] = true;
+            }
+        }
+    }
+    
+    for(size_t i = 0; i < products.size(); i++)
+    {
+        if(failed[i])
+            products[i] = MultiplyBasePointWithScalar(scalars[i]);
+    }
+    
+    return products;
+}
+
+void EllipticCurve::SetBasePointCombParameters(CombParameters parameters)
+{
+    // Replace (rather than modify) the table so that copies of the curve sharing the
+    //  previous table are unaffected.
+    auto table = make_shared<BasePointTable>();
+    InitializeFixedPointTable(parameters, table->comb);
+    
+    _basePointTable = table;
+}
+
+void EllipticCurve::SetBasePointCombTable(const FixedPointTable& table)
+{
+    // Check the shape of the table against its parameters, and that it was built for G (the first entry
+    //  of a comb table is the point itself).
+    FixedPointTable expectedShape;
+    InitializeFixedPointTable(table.parameters, expectedShape);
+    if(table.points.size() != ((static_cast<size_t>(1) << table.parameters.teeth) - 1) * expectedShape.blockCount)
+        throw invalid_argument("Number of comb table points does not match the comb parameters.");
+    if(table.points[0] != _G)
+        throw invalid_argument("Comb table was not built for the base point.");
+    
+    auto basePointTable = make_shared<BasePointTable>();
+    basePointTable->comb = table;
+    
+    _basePointTable = basePointTable;
+}
+
+const FixedPointTable& EllipticCurve::GetBasePointCombTable() const
+{
+    return GetBasePointTable().comb;
+}
+
+vector<uint8_t> EllipticCurve::SerializeFixedPointTable(const FixedPointTable& table) const
+{
+    const size_t recordSize = 1 + (2 * _p->GetMagnitudeByteSize());
+    vector<uint8_t> serializedPoints(recordSize * table.points.size(), 0);
+    for(size_t i = 0; i < table.points.size(); i++)
+    {
+        if(table.points[i].IsPointAtInfinity())
+            continue;
+        
+        vector<uint8_t> serializedPoint = table.points[i].Serialize();
+        copy(serializedPoint.begin(), serializedPoint.end(), serializedPoints.begin() + (i * recordSize));
+    }
+    
+    return serializedPoints;
+}
+
+shared_ptr<const FixedPointTable> EllipticCurve::MakeFixedPointTable(CombParameters parameters, const vector<uint8_t>& serializedPoints) const
+{
+    auto table = ParseFixedPointTable(parameters, serializedPoints);
+    if(!CheckFixedPointTable(*table))
+        throw invalid_argument("Comb table points are not the multiples of its point.");
+    
+    return table;
+}
+
+shared_ptr<FixedPointTable> EllipticCurve::ParseFixedPointTable(CombParameters parameters, const vector<uint8_t>& serializedPoints) const
+{
+    auto table = make_shared<FixedPointTable>();
+    InitializeFixedPointTable(parameters, *table);
+    
+    const size_t recordSize = 1 + (2 * _p->GetMagnitudeByteSize());
+    const size_t pointCount = ((static_cast<size_t>(1) << parameters.teeth) - 1) * table->blockCount;
+    if(serializedPoints.size() != pointCount * recordSize)
+        throw invalid_argument("Number of comb table points does not match the comb parameters.");
+    
+    table->points.reserve(pointCount);
+    for(size_t i = 0; i < pointCount; i++)
+    {
+        if(serializedPoints[i * recordSize] == 0)
+            table->points.push_back(PointAtInfinity);
+        else
+        {
+            Point point = Point::Parse(serializedPoints, i * recordSize, _p);
+            if(!CheckPointOnCurve(point))
+                throw invalid_argument("Comb table point is not on the curve.");
+            
+            table->points.push_back(move(point));
+        }
+    }
+    
+    return table;
+}
+
+void EllipticCurve::InitializeFixedPointTable(CombParameters parameters, FixedPointTable& table) const
+{
+    if(parameters.teeth < 1 || parameters.teeth > 8 || parameters.spacing < 1)
+        throw invalid_argument("Invalid comb parameters.");
+    
+    table.parameters = parameters;
+    table.rowSize = (_n.GetBitSize() + parameters.teeth - 1) / parameters.teeth;
+    table.blockCount = (table.rowSize + parameters.spacing - 1) / parameters.spacing;
+}
+
+shared_ptr<const FixedPointTable> EllipticCurve::PrecomputeFixedPointTable(const Point& point, CombParameters parameters) const
+{
+    auto table = make_shared<FixedPointTable>();
+    InitializeFixedPointTable(parameters, *table);
+    BuildFixedPointTable(point, *table);
+    
+    return table;
+}
+
+const EllipticCurve::BasePointTable& EllipticCurve::GetBasePointTable() const
+{
+    // Only the first caller builds the table, any concurrent callers wait for it to complete.
+    BasePointTable& table = *_basePointTable;
+    call_once(table.buildFlag, [this, &table]() { BuildBasePointTable(table); });
+    
+    return table;
+}
+
+void EllipticCurve::BuildBasePointTable(BasePointTable& table) const
+{
+    // The comb table is already filled in if it was set with SetBasePointCombTable(). Otherwise it is taken
+    //  from the tables compiled into the binary if there is one for this curve, which saves all of the
+    //  point arithmetic of building it.
+    if(table.comb.points.empty())
+    {
+        if(!LoadEmbeddedBasePointTable(table.comb))
+            BuildFixedPointTable(_G, table.comb);
+    }
+    table.oddMultiples = ComputeOddMultiples(_G, static_cast<size_t>(1) << (BASE_POINT_WNAF_WIDTH - 2));
+    if(_endomorphism)
+        table.endomorphismOddMultiples = ApplyEndomorphism(table.oddMultiples);
+}
+
+bool EllipticCurve::LoadEmbeddedBasePointTable(FixedPointTable& table) const
+{
+    const EmbeddedTable* embeddedTable = FindEmbeddedBasePointTable(_curveName);
+    if(embeddedTable == nullptr ||
+       embeddedTable->parameters.teeth != table.parameters.teeth ||
+       embeddedTable->parameters.spacing != table.parameters.spacing)
+        return false;
+    
+    // A custom curve may have been given the name of a defined curve, so check that the table matches. The
+    //  table is part of the binary, so unlike a table file it need not be checked for forged points.
+    vector<uint8_t> serializedPoints(embeddedTable->serializedPoints, embeddedTable->serializedPoints + embeddedTable->size);
+    shared_ptr<const FixedPointTable> embeddedPoints;
+    try
+    {
+        embeddedPoints = ParseFixedPointTable(table.parameters, serializedPoints);
+    }
+    catch(const invalid_argument&)
+    {
+        return false;
+    }
+    if(embeddedPoints->points[0] != _G)
+        return false;
+    
+    table = *embeddedPoints;
+    return true;
+}
+
+void EllipticCurve::BuildFixedPointTable(const Point& point, FixedPointTable& table) const
+{
+    const unsigned int teeth = table.parameters.teeth;
+    const size_t spacing = table.parameters.spacing;
+    const size_t entriesPerBlock = (static_cast<size_t>(1) << teeth) - 1;
+    
+    // First compute the basis points 2^(t * rowSize + s * spacing) * P for every row t and block s by
+    //  repeatedly doubling P. The doublings are done in Jacobian coordinates and the basis is
+    //  normalized with a single inversion.
+    vector<JacobianPoint> jacobianBasis(teeth * table.blockCount, MakeJacobianPointAtInfinity());
+    JacobianPoint current = ToJacobian(point);
+    size_t totalBits = teeth * table.rowSize;
+    for(size_t bit = 0; bit < totalBits; bit++)
+    {
+        size_t row = bit / table.rowSize;
+        size_t column = bit % table.rowSize;
+        if((column % spacing) == 0)
+            jacobianBasis[(row * table.blockCount) + (column / spacing)] = current;
+        
+        current = JacobianDouble(current);
+    }
+    vector<Point> basis = NormalizeBatch(jacobianBasis);
+    
+    // Each table entry is then the entry without its highest bit plus the basis point for that bit.
+    //  Again all entries are kept in Jacobian coordinates until the whole table is normalized at once.
+    vector<JacobianPoint> jacobianPoints;
+    jacobianPoints.reserve(entriesPerBlock * table.blockCount);
+    for(size_t s = 0; s < table.blockCount; s++)
+    {
+        size_t blockBegin = jacobianPoints.size();
+        for(size_t index = 1; index <= entriesPerBlock; index++)
+        {
+            unsigned int highestBit = 0;
+            while((index >> (highestBit + 1)) != 0)
+                highestBit++;
+            
+            const Point& basisPoint = basis[(highestBit * table.blockCount) + s];
+            size_t remainder = index ^ (static_cast<size_t>(1) << highestBit);
+            if(remainder == 0)
+                jacobianPoints.push_back(ToJacobian(basisPoint));
+            else
+                jacobianPoints.push_back(JacobianAddAffine(jacobianPoints[blockBegin + (remainder - 1)], basisPoint));
+        }
+    }
+    
+    table.points = NormalizeBatch(jacobianPoints);
+}
+
+bool EllipticCurve::CheckFixedPointTable(const FixedPointTable& table) const
+{
+    const unsigned int teeth = table.parameters.teeth;
+    const size_t spacing = table.parameters.spacing;
+    const size_t entriesPerBlock = (static_cast<size_t>(1) << teeth) - 1;
+    if(table.points.empty() || table.points[0].IsPointAtInfinity())
+        return false;
+    
+    // The entry for bit t of block s must be 2^(t * rowSize + s * spacing) * P (see BuildFixedPointTable()).
+    //  Doubling P in Jacobian coordinates, each is compared with (X, Y, Z) as x * Z^2 == X and y * Z^3 == Y.
+    JacobianPoint current = ToJacobian(table.points[0]);
+    size_t totalBits = teeth * table.rowSize;
+    for(size_t bit = 0; bit < totalBits; bit++)
+    {
+        size_t row = bit / table.rowSize;
+        size_t column = bit % table.rowSize;
+        if((column % spacing) == 0)
+        {
+            const Point& basisPoint = table.points[((column / spacing) * entriesPerBlock) + ((static_cast<size_t>(1) << row) - 1)];
+            if(current.IsPointAtInfinity() || basisPoint.IsPointAtInfinity())
+            {
+                if(current.IsPointAtInfinity() != basisPoint.IsPointAtInfinity())
+                    return false;
+            }
+            else
+            {
+                FieldElement zSquared = current.z * current.z;
+                if((basisPoint.x * zSquared) != current.x || (basisPoint.y * zSquared * current.z) != current.y)
+                    return false;
+            }
+        }
+        
+        current = JacobianDouble(current);
+    }
+    
+    // Every other entry C must be A + B for the entry A without its highest bit and the basis point B of
+    //  that bit. For A != +-B the chord through A and B with slope m = dy / dx meets the curve in -C, so
+    //  x_C = m^2 - x_A - x_B and y_C = m * (x_A - x_C) - y_A, which is checked with both sides multiplied
+    //  by dx^2 and dx. The rare other cases are checked with an addition.
+    for(size_t s = 0; s < table.blockCount; s++)
+    {
+        const size_t blockBegin = s * entriesPerBlock;
+        for(size_t index = 3; index <= entriesPerBlock; index++)
+        {
+            unsigned int highestBit = 0;
+            while((index >> (highestBit + 1)) != 0)
+                highestBit++;
+            
+            size_t remainder = index ^ (static_cast<size_t>(1) << highestBit);
+            if(remainder == 0)
+                continue;
+            
+            const Point& A = table.points[blockBegin + (remainder - 1)];
+            const Point& B = table.points[blockBegin + ((static_cast<size_t>(1) << highestBit) - 1)];
+            const Point& C = table.points[blockBegin + (index - 1)];
+            if(A.IsPointAtInfinity() || B.IsPointAtInfinity() || C.IsPointAtInfinity() || A.x == B.x)
+            {
+                if(ToAffine(JacobianAddAffine(ToJacobian(A), B)) != C)
+                    return false;
+                continue;
+            }
+            
+            FieldElement dx = B.x - A.x;
+            FieldElement dy = B.y - A.y;
+            if((dy * dy) != ((C.x + A.x + B.x) * (dx * dx)) || ((C.y + A.y) * dx) != (dy * (A.x - C.x)))
+                return false;
+        }
+    }
+    
+    return true;
+}
+
+vector<int8_t> EllipticCurve::ComputeWidthNaf(const BigInteger& scalar, unsigned int windowWidth)
+{
+    if(windowWidth < MIN_WNAF_WIDTH || windowWidth > MAX_WNAF_WIDTH)
+        throw invalid_argument("Unsupported width-w NAF window width.");
+    if(scalar < 0)
+        throw invalid_argument("Width-w NAF recoding requires a non-negative scalar.");
+    
+    // Recodes according to the following algorithm (Guide to Elliptic Curve Cryptography, Algorithm 3.35):
+    //    i = 0
+    //    while (k >= 1) {
+    //        if (k is odd) {
+    //            k[i] = k mods 2^w     // The signed residue in the range [-2^(w-1), 2^(w-1)).
+    //            k = k - k[i]
+    //        } else {
+    //            k[i] = 0
+    //        }
+    //        k = k / 2
+    //        i = i + 1
+    //    }
+    // Subtracting the signed residue clears the low w bits of k, which is what guarantees the
+    //  run of zero digits following each non-zero digit.
+    const int windowModulus = 1 << windowWidth;
+    const int halfWindowModulus = windowModulus >> 1;
+    
+    vector<int8_t> naf;
+    naf.reserve(scalar.GetBitSize() + 1);
+    
+    BigInteger k = scalar;
+    while(k > 0)
+    {
+        int digit = 0;
+        if(k.GetBitAt(0))
+        {
+            // Read the low w bits (some may be beyond the most significant bit of k).
+            size_t bitSize = k.GetBitSize();
+            for(unsigned int bit = 0; bit < windowWidth && bit < bitSize; bit++)
+            {
+                if(k.GetBitAt(bit))
+                    digit |= (1 << bit);
+            }
+            
+            if(digit >= halfWindowModulus)
+                digit -= windowModulus;
+            
+            k -= digit;
+        }
+        
+        naf.push_back(static_cast<int8_t>(digit));
+        k >>= 1;
+    }
+    
+    return naf;
+}
+
+unsigned int EllipticCurve::GetDefaultWNafWidth(size_t scalarBitSize)
+{
+    // Balances the cost of building the table of 2^(w-2) odd multiples against the roughly
+    //  bits / (w + 1) additions made while multiplying.
+    if(scalarBitSize >= 192)
+        return 5;
+    return 4;
+}
+
+vector<Point> EllipticCurve::ComputeOddMultiples(const Point& point, size_t count) const
+{
+    // The table holds {P, 3P, 5P, ...}, each entry is computed by adding 2P to the previous one.
+    //  The sums are computed in Jacobian coordinates and normalized together, so that the
+    //  whole table costs two field inversions (one for 2P).
+    if(count <= 1)
+        return vector<Point>(1, point);
+    
+    Point doubledPoint = AddPointsOnCurve(point, point);
+    vector<JacobianPoint> oddMultiples;
+    oddMultiples.reserve(count);
+    oddMultiples.push_back(ToJacobian(point));
+    for(size_t i = 1; i < count; i++)
+        oddMultiples.push_back(JacobianAddAffine(oddMultiples[i - 1], doubledPoint));
+    
+    return NormalizeBatch(oddMultiples);
+}
+
+Point EllipticCurve::MultiplyDoubleScalar(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, unsigned int threadCount) const
+{
+    return ToAffine(MultiplyDoubleScalarJacobian(u1, P1, u2, P2, threadCount));
+}
+
+JacobianPoint EllipticCurve::MultiplyDoubleScalarJacobian(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, unsigned int threadCount) const
+{
+    if(threadCount != 1)
+        return MultiplyDoubleScalarInParallel(u1, P1, u2, P2, threadCount);
+    
+    // Computes u1 * P1 + u2 * P2 with interleaved width-w NAFs (found here: Guide to Elliptic Curve
+    //  Cryptography, Hankerson, Menezes, Vanstone, Algorithm 3.51):
+    //function multiplyDoubleScalar(scalar u1, point P1, scalar u2, point P2)
+    //    Compute NAFw(u1) and NAFw(u2), padded to the same length l
+    //    Compute the odd multiples of P1 and P2
+    //    Q = O    // Point at infinity
+    //    Iterate i from l-1 to 0 {
+    //        Q = 2Q
+    //        if (u1[i] != 0) Q = Q + u1[i] * P1
+    //        if (u2[i] != 0) Q = Q + u2[i] * P2
+    //    }
+    //    output Q
+    //
+    // Computing both products separately costs two full chains of doublings. Interleaving them shares a
+    //  single chain, so the sum costs little more than the most expensive of the two multiplications.
+    // The odd multiples of G are precomputed, so a wider window is used whenever one of the points is G.
+    //
+    // On curves with an endomorphism both scalars are split in half (see DecomposeScalar()), which
+    //  turns the sum into one of four half-length terms and halves the number of doublings again.
+    vector<Point> computedOddMultiples[2];
+    vector<Point> computedEndomorphismOddMultiples[2];
+    vector<InterleavedTerm> terms;
+    
+    const BigInteger* scalars[] = { &u1, &u2 };
+    const Point* points[] = { &P1, &P2 };
+    for(int j = 0; j < 2; j++)
+    {
+        // Scalars are reduced mod n like for any other multiplication of G.
+        const Point& point = *points[j];
+        if(point == _G)
+        {
+            const BigInteger& scalar = *scalars[j];
+            const BasePointTable& table = GetBasePointTable();
+            AppendScalarTerms((scalar >= _n) ? (scalar % _n) : scalar, BASE_POINT_WNAF_WIDTH, table.oddMultiples, table.endomorphismOddMultiples, terms);
+        }
+        else
+        {
+            unsigned int windowWidth = GetDefaultWNafWidth(scalars[j]->GetBitSize());
+            computedOddMultiples[j] = ComputeOddMultiples(point, static_cast<size_t>(1) << (windowWidth - 2));
+            if(_endomorphism)
+                computedEndomorphismOddMultiples[j] = ApplyEndomorphism(computedOddMultiples[j]);
+            
+            AppendScalarTerms(*scalars[j], windowWidth, computedOddMultiples[j], computedEndomorphismOddMultiples[j], terms);
+        }
+    }
+    
+    return MultiplyInterleaved(terms);
+}
+
+JacobianPoint EllipticCurve::MultiplyInterleaved(const vector<InterleavedTerm>& terms) const
+{
+    // See MultiplyDoubleScalar() for a description of the algorithm, which extends to any number of terms.
+    size_t length = 0;
+    for(const InterleavedTerm& term : terms)
+        length = max(length, term.naf.size());
+    
+    JacobianPoint product = MakeJacobianPointAtInfinity();
+    for(int i = static_cast<int>(length) - 1; i >= 0; i--)
+    {
+        product = JacobianDouble(product);
+        
+        for(const InterleavedTerm& term : terms)
+        {
+            if(i < static_cast<int>(term.naf.size()) && term.naf[i] != 0)
+                product = AddSignedOddMultiple(product, *term.oddMultiples, term.naf[i]);
+        }
     }
     
     return product;
 }
 
+void EllipticCurve::AppendScalarTerms(const BigInteger& scalar, unsigned int windowWidth, const vector<Point>& oddMultiples, const vector<Point>& endomorphismOddMultiples, vector<InterleavedTerm>& terms) const
+{
+    if(!_endomorphism)
+    {
+        InterleavedTerm term;
+        term.naf = ComputeWidthNaf(scalar, windowWidth);
+        term.oddMultiples = &oddMultiples;
+        terms.push_back(move(term));
+        return;
+    }
+    
+    // k * P = k1 * P + k2 * phi(P). The halves may be negative, in which case the NAF of their absolute
+    //  value is negated (negating every digit negates the represented value).
+    pair<BigInteger, BigInteger> halves = DecomposeScalar(scalar);
+    const BigInteger* halfScalars[] = { &halves.first, &halves.second };
+    const vector<Point>* halfOddMultiples[] = { &oddMultiples, &endomorphismOddMultiples };
+    for(int j = 0; j < 2; j++)
+    {
+        InterleavedTerm term;
+        term.naf = ComputeWidthNaf(abs(*halfScalars[j]), windowWidth);
+        term.oddMultiples = halfOddMultiples[j];
+        if(*halfScalars[j] < 0)
+        {
+            for(int8_t& digit : term.naf)
+                digit = -digit;
+        }
+        
+        terms.push_back(move(term));
+    }
+}
+
+vector<Point> EllipticCurve::ApplyEndomorphism(const vector<Point>& points) const
+{
+    // phi(x, y) = (beta * x, y), so mapping a table costs a single field multiplication per entry.
+    vector<Point> mappedPoints;
+    mappedPoints.reserve(points.size());
+    for(const Point& point : points)
+        mappedPoints.push_back(Point(_endomorphism->beta * point.x, point.y));
+    
+    return mappedPoints;
+}
+
+bool EllipticCurve::HasEndomorphism() const
+{
+    return (_endomorphism != nullptr);
+}
+
+pair<BigInteger, BigInteger> EllipticCurve::DecomposeScalar(const BigInteger& scalar) const
+{
+    // Decomposes the scalar with the GLV method (found here: Guide to Elliptic Curve Cryptography,
+    //  Hankerson, Menezes, Vanstone, Algorithm 3.74):
+    //function decomposeScalar(scalar k)
+    //    c1 = round(b2 * k / n)
+    //    c2 = round(-b1 * k / n)
+    //    k1 = k - c1 * a1 - c2 * a2
+    //    k2 = -c1 * b1 - c2 * b2
+    //    output (k1, k2)
+    //
+    // Where (a1, b1) and (a2, b2) are short vectors of the lattice {(x, y) : x + y * lambda = 0 (mod n)},
+    //  so that (k1, k2) is the difference between (k, 0) and a nearby lattice point.
+    if(!_endomorphism)
+        throw runtime_error("Curve has no endomorphism.");
+    
+    const Endomorphism& endomorphism = *_endomorphism;
+    BigInteger k = (scalar >= _n) ? (scalar % _n) : scalar;
+    
+    // Division truncates the magnitude, so round by adding n / 2 to the magnitude of the numerator.
+    BigInteger halfN = _n;
+    halfN >>= 1;
+    auto roundedDivide = [this, &halfN](const BigInteger& numerator) -> BigInteger
+    {
+        BigInteger quotient = (abs(numerator) + halfN) / _n;
+        return (numerator < 0) ? -quotient : quotient;
+    };
+    
+    BigInteger c1 = roundedDivide(endomorphism.b2 * k);
+    BigInteger c2 = roundedDivide(-endomorphism.b1 * k);
+    
+    BigInteger k1 = k - (c1 * endomorphism.a1) - (c2 * endomorphism.a2);
+    BigInteger k2 = -(c1 * endomorphism.b1) - (c2 * endomorphism.b2);
+    
+    return make_pair(move(k1), move(k2));
+}
+
+JacobianPoint EllipticCurve::MultiplyDoubleScalarInParallel(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, unsigned int threadCount) const
+{
+    // Computing the products on separate threads gives up the shared chain of doublings, so each is
+    //  computed the way which needs the fewest doublings: multiples of G with the comb table (which needs
+    //  only a few), and other points with the width-w NAF method (with both halves of the scalar
+    //  interleaved on curves with an endomorphism). With threads to spare the halves of a product are
+    //  computed on their own threads as well, sharing the table of odd multiples computed up front.
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    
+    // The base point table is built before any task is run.
+    GetBasePointTable();
+    
+    const BigInteger* scalars[] = { &u1, &u2 };
+    const Point* points[] = { &P1, &P2 };
+    size_t splitCount = (P1 == _G) ? 1 : 2;
+    splitCount += (P2 == _G) ? 1 : 2;
+    bool splitHalves = _endomorphism && (threadCount >= splitCount);
+    
+    vector<Point> oddMultiples[2];
+    vector<Point> endomorphismOddMultiples[2];
+    vector<InterleavedTerm> terms;
+    terms.reserve(4);
+    
+    vector<function<JacobianPoint()>> products;
+    for(int j = 0; j < 2; j++)
+    {
+        const BigInteger& scalar = *scalars[j];
+        const Point& point = *points[j];
+        if(point == _G)
+        {
+            products.push_back([this, &scalar]() { return MultiplyBasePointJacobian(scalar); });
+        }
+        else if(!splitHalves)
+        {
+            products.push_back([this, &point, &scalar]()
+            {
+                return MultiplyJacobian(point, scalar, GetDefaultWNafWidth(scalar.GetBitSize()));
+            });
+        }
+        else
+        {
+            // Each half-length term k1 * P and k2 * phi(P) is a product of its own.
+            unsigned int windowWidth = GetDefaultWNafWidth(scalar.GetBitSize());
+            oddMultiples[j] = ComputeOddMultiples(point, static_cast<size_t>(1) << (windowWidth - 2));
+            endomorphismOddMultiples[j] = ApplyEndomorphism(oddMultiples[j]);
+            
+            size_t firstTerm = terms.size();
+            AppendScalarTerms(scalar, windowWidth, oddMultiples[j], endomorphismOddMultiples[j], terms);
+            for(size_t i = firstTerm; i < terms.size(); i++)
+            {
+                const InterleavedTerm* term = &terms[i];
+                products.push_back([this, term]() { return MultiplyInterleaved(vector<InterleavedTerm>(1, *term)); });
+            }
+        }
+    }
+    
+    return SumProductsInParallel(products, threadCount);
+}
+
+JacobianPoint EllipticCurve::SumProductsInParallel(const vector<function<JacobianPoint()>>& products, unsigned int threadCount) const
+{
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(max(min(static_cast<size_t>(threadCount), products.size()), static_cast<size_t>(1)));
+    
+    // Task t computes the products t, t + threadCount, t + 2 * threadCount, ...
+    vector<JacobianPoint> sums(threadCount, MakeJacobianPointAtInfinity());
+    auto computeProducts = [&](unsigned int firstProduct)
+    {
+        for(size_t i = firstProduct; i < products.size(); i += threadCount)
+            sums[firstProduct] = JacobianAdd(sums[firstProduct], products[i]());
+    };
+    
+    WorkerPool::GetSharedInstance().Run(threadCount, computeProducts);
+    
+    JacobianPoint sum = sums[0];
+    for(unsigned int t = 1; t < threadCount; t++)
+        sum = JacobianAdd(sum, sums[t]);
+    
+    return sum;
+}
+
+bool EllipticCurve::DoubleScalarProductXEquals(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, const BigInteger& x, unsigned int threadCount) const
+{
+    return JacobianXEqualsModOrder(MultiplyDoubleScalarJacobian(u1, P1, u2, P2, threadCount), x);
+}
+
+Point EllipticCurve::MultiplyFixedPointWithScalar(const FixedPointTable& table, const BigInteger& scalar, unsigned int threadCount) const
+{
+    BigInteger k = (scalar >= _n) ? (scalar % _n) : scalar;
+    return ToAffine(MultiplyFixedPointsJacobian(vector<const FixedPointTable*>(1, &table), vector<BigInteger>(1, move(k)), threadCount));
+}
+
+Point EllipticCurve::MultiplyDoubleScalar(const BigInteger& u1, const BigInteger& u2, const FixedPointTable& P2Table, unsigned int threadCount) const
+{
+    vector<const FixedPointTable*> tables;
+    tables.push_back(&GetBasePointTable().comb);
+    tables.push_back(&P2Table);
+    
+    vector<BigInteger> scalars;
+    scalars.push_back((u1 >= _n) ? (u1 % _n) : u1);
+    scalars.push_back((u2 >= _n) ? (u2 % _n) : u2);
+    
+    return ToAffine(MultiplyFixedPointsJacobian(tables, scalars, threadCount));
+}
+
+bool EllipticCurve::DoubleScalarProductXEquals(const BigInteger& u1, const BigInteger& u2, const FixedPointTable& P2Table, const BigInteger& x, unsigned int threadCount) const
+{
+    vector<const FixedPointTable*> tables;
+    tables.push_back(&GetBasePointTable().comb);
+    tables.push_back(&P2Table);
+    
+    vector<BigInteger> scalars;
+    scalars.push_back((u1 >= _n) ? (u1 % _n) : u1);
+    scalars.push_back((u2 >= _n) ? (u2 % _n) : u2);
+    
+    return JacobianXEqualsModOrder(MultiplyFixedPointsJacobian(tables, scalars, threadCount), x);
+}
+
+Point EllipticCurve::MultiScalarMultiply(const vector<BigInteger>& scalars, const vector<Point>& points, unsigned int threadCount) const
+{
+    // Multiplies with Pippenger's bucket method:
+    //function multiScalarMultiply(scalars k[1..N], points P[1..N], width c)
+    //    Q = O    // Point at infinity
+    //    Iterate windows w from the most significant to the least significant {
+    //        Q = 2^c * Q
+    //        B[1..2^(c-1)] = O
+    //        Iterate i from 1 to N {
+    //            d = the signed c-bit digit of k[i] in window w
+    //            if (d > 0) B[d] = B[d] + P[i]
+    //            if (d < 0) B[-d] = B[-d] - P[i]
+    //        }
+    //        Q = Q + (B[1] + 2 * B[2] + ... + 2^(c-1) * B[2^(c-1)])
+    //    }
+    //    output Q
+    //
+    // The weighted bucket sum is computed with two running sums (S = B[j] + ... + B[2^(c-1)] for j
+    //  descending, and the total of all the S), so each window costs N + 2^c additions no matter how
+    //  large the scalars are. With c close to log2(N) the whole sum costs about b * N / log2(N) additions
+    //  for b-bit scalars, rather than the b * N / (w + 1) additions of interleaved width-w NAFs. The
+    //  digits are signed (in the range [-2^(c-1), 2^(c-1)]) since negating a point is free, which halves
+    //  the number of buckets. The windows are independent of each other, so they are computed on
+    //  separate threads.
+    if(scalars.size() != points.size())
+        throw invalid_argument("The number of scalars and points must match.");
+    
+    if(scalars.size() < MIN_PIPPENGER_POINTS)
+    {
+        // For only a few points the buckets cost more than they save, so use interleaved width-w NAFs
+        //  (Strauss' method, see MultiplyDoubleScalar()).
+        const unsigned int windowWidth = 4;
+        vector<vector<Point>> oddMultiples(points.size());
+        vector<vector<Point>> endomorphismOddMultiples(points.size());
+        vector<InterleavedTerm> terms;
+        for(size_t i = 0; i < points.size(); i++)
+        {
+            oddMultiples[i] = ComputeOddMultiples(points[i], static_cast<size_t>(1) << (windowWidth - 2));
+            if(_endomorphism)
+                endomorphismOddMultiples[i] = ApplyEndomorphism(oddMultiples[i]);
+            
+            AppendScalarTerms(scalars[i], windowWidth, oddMultiples[i], endomorphismOddMultiples[i], terms);
+        }
+        
+        return ToAffine(MultiplyInterleaved(terms));
+    }
+    
+    // On curves with an endomorphism every term k * P is split into k1 * P + k2 * phi(P) (see
+    //  DecomposeScalar()), which doubles the number of terms but halves the size of the scalars.
+    //  Negative halves are made positive by negating their point.
+    vector<BigInteger> splitScalars;
+    vector<Point> splitPoints;
+    if(_endomorphism)
+    {
+        splitScalars.reserve(2 * scalars.size());
+        splitPoints.reserve(2 * points.size());
+        for(size_t i = 0; i < scalars.size(); i++)
+        {
+            pair<BigInteger, BigInteger> halves = DecomposeScalar(scalars[i]);
+            Point mappedPoint = points[i].IsPointAtInfinity() ? points[i] : Point(_endomorphism->beta * points[i].x, points[i].y);
+            
+            splitScalars.push_back(abs(halves.first));
+            splitPoints.push_back((halves.first < 0) ? InvertPoint(points[i]) : points[i]);
+            splitScalars.push_back(abs(halves.second));
+            splitPoints.push_back((halves.second < 0) ? InvertPoint(mappedPoint) : mappedPoint);
+        }
+    }
+    const vector<BigInteger>& termScalars = _endomorphism ? splitScalars : scalars;
+    const vector<Point>& termPoints = _endomorphism ? splitPoints : points;
+    
+    size_t maxBitSize = 0;
+    for(const BigInteger& scalar : termScalars)
+        maxBitSize = max(maxBitSize, scalar.GetBitSize());
+    if(maxBitSize == 0)
+        return PointAtInfinity;
+    
+    // Recode the scalars into signed digits, least significant first. A digit larger than 2^(c-1) is
+    //  replaced by (digit - 2^c), carrying one into the next window, so one extra window may be needed.
+    const unsigned int windowWidth = GetPippengerWindowWidth(termPoints.size(), maxBitSize);
+    const size_t windowCount = (maxBitSize / windowWidth) + 1;
+    const int32_t half = static_cast<int32_t>(1) << (windowWidth - 1);
+    vector<vector<int32_t>> digits(termScalars.size(), vector<int32_t>(windowCount, 0));
+    for(size_t i = 0; i < termScalars.size(); i++)
+    {
+        const BigInteger& scalar = termScalars[i];
+        size_t bitSize = scalar.GetBitSize();
+        int32_t carry = 0;
+        for(size_t w = 0; w < windowCount; w++)
+        {
+            int32_t digit = carry;
+            for(unsigned int j = 0; j < windowWidth && ((w * windowWidth) + j) < bitSize; j++)
+            {
+                if(scalar.GetBitAt((w * windowWidth) + j))
+                    digit += (static_cast<int32_t>(1) << j);
+            }
+            
+            carry = (digit > half) ? 1 : 0;
+            digits[i][w] = digit - (carry << windowWidth);
+        }
+    }
+    
+    if(threadCount == 0)
+        threadCount = max(thread::hardware_concurrency(), 1u);
+    threadCount = static_cast<unsigned int>(min(static_cast<size_t>(threadCount), windowCount));
+    
+    // Task t computes the windows t, t + threadCount, t + 2 * threadCount, ...
+    vector<JacobianPoint> windowSums(windowCount, MakeJacobianPointAtInfinity());
+    auto computeWindows = [&](unsigned int firstWindow)
+    {
+        for(size_t w = firstWindow; w < windowCount; w += threadCount)
+            windowSums[w] = MultiplyPippengerWindow(digits, termPoints, w, windowWidth);
+    };
+    
+    WorkerPool::GetSharedInstance().Run(threadCount, computeWindows);
+    
+    // Combine the windows, most significant first.
+    JacobianPoint product = MakeJacobianPointAtInfinity();
+    for(int w = static_cast<int>(windowCount) - 1; w >= 0; w--)
+    {
+        for(unsigned int i = 0; i < windowWidth; i++)
+            product = JacobianDouble(product);
+        
+        product = JacobianAdd(product, windowSums[w]);
+    }
+    
+    return ToAffine(product);
+}
+
+JacobianPoint EllipticCurve::MultiplyPippengerWindow(const vector<vector<int32_t>>& digits, const vector<Point>& points, size_t window, unsigned int windowWidth) const
+{
+    // See MultiScalarMultiply() for a description of the algorithm.
+    vector<JacobianPoint> buckets(static_cast<size_t>(1) << (windowWidth - 1), MakeJacobianPointAtInfinity());
+    for(size_t i = 0; i < points.size(); i++)
+    {
+        int32_t digit = digits[i][window];
+        if(digit > 0)
+            buckets[digit - 1] = JacobianAddAffine(buckets[digit - 1], points[i]);
+        else if(digit < 0)
+            buckets[-digit - 1] = JacobianAddAffine(buckets[-digit - 1], InvertPoint(points[i]));
+    }
+    
+    JacobianPoint runningSum = MakeJacobianPointAtInfinity();
+    JacobianPoint windowSum = MakeJacobianPointAtInfinity();
+    for(int d = static_cast<int>(buckets.size()) - 1; d >= 0; d--)
+    {
+        runningSum = JacobianAdd(runningSum, buckets[d]);
+        windowSum = JacobianAdd(windowSum, runningSum);
+    }
+    
+    return windowSum;
+}
+
+unsigned int EllipticCurve::GetPippengerWindowWidth(size_t pointCount, size_t scalarBitSize)
+{
+    // Each of the (b / c + 1) windows costs about N additions into the buckets and 2^c additions to
+    //  sum them up.
+    unsigned int bestWidth = 2;
+    size_t bestCost = 0;
+    for(unsigned int width = 2; width <= 16; width++)
+    {
+        size_t windowCount = (scalarBitSize / width) + 1;
+        size_t cost = windowCount * (pointCount + (static_cast<size_t>(1) << width));
+        if(width == 2 || cost < bestCost)
+        {
+            bestWidth = width;
+            bestCost = cost;
+        }
+    }
+    
+    return bestWidth;
+}
+
+bool EllipticCurve::JacobianXEqualsModOrder(const JacobianPoint& product, const BigInteger& x) const
+{
+    if(product.IsPointAtInfinity())
+        return false;
+    
+    // The affine x-coordinate of the product is X / Z^2, so rather than inverting Z check whether
+    //  x * Z^2 == X (mod p). Since the affine coordinate was reduced mod n to produce x, any of the
+    //  values x, x + n, x + 2n, ... which are less than p may be the actual coordinate. (For most
+    //  curves n is close to p and there are at most two candidates.)
+    FieldElement zSquared = product.z * product.z;
+    for(BigInteger candidate = x; candidate < *_p; candidate += _n)
+    {
+        if((FieldElement(candidate, _p, _reduction) * zSquared) == product.x)
+            return true;
+    }
+    
+    return false;
+}
+
+JacobianPoint EllipticCurve::MakeJacobianPointAtInfinity() const
+{
+    return JacobianPoint(FieldElement(1, _p, _reduction), FieldElement(1, _p, _reduction), FieldElement(0, _p, _reduction));
+}
+
+JacobianPoint EllipticCurve::ToJacobian(const Point& point) const
+{
+    if(point.IsPointAtInfinity())
+        return MakeJacobianPointAtInfinity();
+    
+    return JacobianPoint(point.x, point.y, FieldElement(1, _p, _reduction));
+}
+
+Point EllipticCurve::ToAffine(const JacobianPoint& point) const
+{
+    // The affine point is (X/Z^2, Y/Z^3), which requires a single inversion.
+    if(point.IsPointAtInfinity())
+        return PointAtInfinity;
+    
+    FieldElement zInverse = point.z.GetInverse();
+    FieldElement zInverseSquared = zInverse * zInverse;
+    
+    return Point(point.x * zInverseSquared, point.y * zInverseSquared * zInverse);
+}
+
+vector<Point> EllipticCurve::NormalizeBatch(const vector<JacobianPoint>& points) const
+{
+    // Converting a point to affine needs the inverse of its z-coordinate. All inverses are computed
+    //  together with a single field inversion (see FieldElement::InvertBatch()), skipping the points
+    //  at infinity which have no inverse.
+    vector<FieldElement> zInverses;
+    zInverses.reserve(points.size());
+    for(const JacobianPoint& point : points)
+    {
+        if(!point.IsPointAtInfinity())
+            zInverses.push_back(point.z);
+    }
+    FieldElement::InvertBatch(zInverses);
+    
+    vector<Point> affinePoints;
+    affinePoints.reserve(points.size());
+    size_t inverseIndex = 0;
+    for(const JacobianPoint& point : points)
+    {
+        if(point.IsPointAtInfinity())
+        {
+            affinePoints.push_back(PointAtInfinity);
+            continue;
+        }
+        
+        const FieldElement& zInverse = zInverses[inverseIndex++];
+        FieldElement zInverseSquared = zInverse * zInverse;
+        affinePoints.push_back(Point(point.x * zInverseSquared, point.y * zInverseSquared * zInverse));
+    }
+    
+    return affinePoints;
+}
+
+JacobianPoint EllipticCurve::JacobianDouble(const JacobianPoint& P) const
+{
+    // Compute the formula for point doubling in Jacobian coordinates (found here:
+    //  http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#doubling-dbl-2007-bl):
+    //  S = 4 * X * Y^2
+    //  M = 3 * X^2 + a * Z^4
+    //  r:X = M^2 - 2S
+    //  r:Y = M(S - r:X) - 8 * Y^4
+    //  r:Z = 2 * Y * Z
+    // When a == -3, M can be computed as 3(X - Z^2)(X + Z^2) and when a == 0, M is simply 3 * X^2.
+    //  Multiplication by small constants is done with additions.
+    if(P.IsPointAtInfinity() || P.y == 0)
+        return MakeJacobianPointAtInfinity();
+    
+    FieldElement ySquared = P.y * P.y;
+    FieldElement S = P.x * ySquared;
+    S += S;
+    S += S;
+    
+    FieldElement M(0, _p, _reduction);
+    if(_aIsMinusThree)
+    {
+        FieldElement zSquared = P.z * P.z;
+        M = (P.x - zSquared) * (P.x + zSquared);
+        M = M + M + M;
+    }
+    else
+    {
+        FieldElement xSquared = P.x * P.x;
+        M = xSquared + xSquared + xSquared;
+        if(!_aIsZero)
+        {
+            FieldElement zSquared = P.z * P.z;
+            M += _a * zSquared * zSquared;
+        }
+    }
+    
+    FieldElement yFourthTimesEight = ySquared * ySquared;
+    yFourthTimesEight += yFourthTimesEight;
+    yFourthTimesEight += yFourthTimesEight;
+    yFourthTimesEight += yFourthTimesEight;
+    
+    FieldElement Rx = (M * M) - S - S;
+    FieldElement Ry = (M * (S - Rx)) - yFourthTimesEight;
+    FieldElement Rz = P.y * P.z;
+    Rz += Rz;
+    
+    return JacobianPoint(move(Rx), move(Ry), move(Rz));
+}
+
+JacobianPoint EllipticCurve::JacobianAdd(const JacobianPoint& P, const JacobianPoint& Q) const
+{
+    // Compute the formula for point addition in Jacobian coordinates (found here:
+    //  http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-add-2007-bl without
+    //  the squaring tricks):
+    //  U1 = P:X * Q:Z^2,   U2 = Q:X * P:Z^2
+    //  S1 = P:Y * Q:Z^3,   S2 = Q:Y * P:Z^3
+    //  H = U2 - U1,        r = S2 - S1
+    //  r:X = r^2 - H^3 - 2 * U1 * H^2
+    //  r:Y = r(U1 * H^2 - r:X) - S1 * H^3
+    //  r:Z = P:Z * Q:Z * H
+    // If H == 0 the points have the same affine x-coordinate and are either equal (r == 0) or
+    //  inverses of each other.
+    if(P.IsPointAtInfinity())
+        return Q;
+    if(Q.IsPointAtInfinity())
+        return P;
+    
+    FieldElement pzSquared = P.z * P.z;
+    FieldElement qzSquared = Q.z * Q.z;
+    FieldElement U1 = P.x * qzSquared;
+    FieldElement U2 = Q.x * pzSquared;
+    FieldElement S1 = P.y * qzSquared * Q.z;
+    FieldElement S2 = Q.y * pzSquared * P.z;
+    
+    FieldElement H = U2 - U1;
+    FieldElement r = S2 - S1;
+    if(H == 0)
+        return (r == 0) ? JacobianDouble(P) : MakeJacobianPointAtInfinity();
+    
+    FieldElement hSquared = H * H;
+    FieldElement hCubed = hSquared * H;
+    FieldElement V = U1 * hSquared;
+    
+    FieldElement Rx = (r * r) - hCubed - V - V;
+    FieldElement Ry = (r * (V - Rx)) - (S1 * hCubed);
+    FieldElement Rz = P.z * Q.z * H;
+    
+    return JacobianPoint(move(Rx), move(Ry), move(Rz));
+}
+
+JacobianPoint EllipticCurve::JacobianAddAffine(const JacobianPoint& P, const Point& Q) const
+{
+    // Mixed addition: identical to JacobianAdd() with Q:Z == 1, which saves several multiplications
+    //  (found here: http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html#addition-madd-2007-bl).
+    if(Q.IsPointAtInfinity())
+        return P;
+    if(P.IsPointAtInfinity())
+        return ToJacobian(Q);
+    
+    FieldElement pzSquared = P.z * P.z;
+    FieldElement U2 = Q.x * pzSquared;
+    FieldElement S2 = Q.y * pzSquared * P.z;
+    
+    FieldElement H = U2 - P.x;
+    FieldElement r = S2 - P.y;
+    if(H == 0)
+        return (r == 0) ? JacobianDouble(P) : MakeJacobianPointAtInfinity();
+    
+    FieldElement hSquared = H * H;
+    FieldElement hCubed = hSquared * H;
+    FieldElement V = P.x * hSquared;
+    
+    FieldElement Rx = (r * r) - hCubed - V - V;
+    FieldElement Ry = (r * (V - Rx)) - (P.y * hCubed);
+    FieldElement Rz = P.z * H;
+    
+    return JacobianPoint(move(Rx), move(Ry), move(Rz));
+}
+
+JacobianPoint EllipticCurve::AddSignedOddMultiple(const JacobianPoint& point, const vector<Point>& oddMultiples, int digit) const
+{
+    // The table holds {P, 3P, 5P, ...}, so |digit| * P is found at index (|digit| - 1) / 2. Negative
+    //  digits add the inverse of the entry.
+    if(digit > 0)
+        return JacobianAddAffine(point, oddMultiples[(digit - 1) / 2]);
+    
+    return JacobianAddAffine(point, InvertPoint(oddMultiples[(-digit - 1) / 2]));
+}
+
 bool EllipticCurve::CheckPointOnCurve(const Point& point) const
 {
     // For the point (x,y) to be on the curve, the x and y coordinates must satisfy the curve equation:
@@ -171,7 +1889,7 @@ bool EllipticCurve::CheckPointOnCurve(const Point& point) const
 
 Point EllipticCurve::MakePointOnCurve(BigInteger&& x, BigInteger&& y) const
 {
-    Point point(FieldElement(move(x), _p), FieldElement(move(y), _p));
+    Point point(FieldElement(move(x), _p, _reduction), FieldElement(move(y), _p, _reduction));
     
     // Test to ensure that the point is on the curve.
     if(!CheckPointOnCurve(point))
@@ -180,6 +1898,30 @@ Point EllipticCurve::MakePointOnCurve(BigInteger&& x, BigInteger&& y) const
     return point;
 }
 
+bool EllipticCurve::TryMakePointFromX(const BigInteger& x, bool isYOdd, Point& point) const
+{
+    if(x < 0 || x >= *_p)
+        return false;
+    
+    // y^2 = x^3 + ax + b has either no solution or the two solutions y and p - y, one of which is odd.
+    FieldElement fieldX(x, _p, _reduction);
+    FieldElement ySquared = (fieldX * fieldX * fieldX) + (_a * fieldX) + _b;
+    FieldElement y(0, _p, _reduction);
+    if(!ySquared.TryGetSquareRoot(y))
+        return false;
+    
+    bool yIsOdd = (y != 0) && y.GetRawInteger().GetBitAt(0);
+    if(yIsOdd != isYOdd)
+    {
+        if(y == 0)
+            return false;
+        y = -y;
+    }
+    
+    point = Point(move(fieldX), move(y));
+    return true;
+}
+
 Point EllipticCurve::MakePointOnCurve(const vector<uint8_t>& serializedPoint) const
 {
     Point point = Point::Parse(serializedPoint, 0, _p);
@@ -204,4 +1946,19 @@ const BigInteger& EllipticCurve::GetBasePointOrder() const
 string EllipticCurve::GetCurveName() const
 {
     return _curveName;
+}
+
+vector<uint8_t> EllipticCurve::SerializeDomainParameters() const
+{
+    vector<uint8_t> values[] = { _p->GetMagnitudeBytes(), _a.GetBytes(), _b.GetBytes(), _G.x.GetBytes(), _G.y.GetBytes(), _n.GetMagnitudeBytes() };
+    
+    vector<uint8_t> serializedParameters;
+    for(const vector<uint8_t>& value : values)
+    {
+        serializedParameters.push_back(static_cast<uint8_t>(value.size() >> 8));
+        serializedParameters.push_back(static_cast<uint8_t>(value.size()));
+        serializedParameters.insert(serializedParameters.end(), value.begin(), value.end());
+    }
+    
+    return serializedParameters;
 }
\ No newline at end of file
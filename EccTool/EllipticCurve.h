@@ -26,7 +26,10 @@
 
 #include <iostream>
 #include <string>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include "BigInteger.h"
 #include "EccDefs.h"
 #include "Point.h"
@@ -36,6 +39,41 @@ using namespace ecc;
 
 //BigInteger ModularMultiply(BigInteger& rhs)
 
+// Describes the shape of the fixed-base comb table used to multiply the base point G.
+//  The scalar bits are laid out as a matrix with "teeth" rows. Each comb column is split into
+//  blocks of "spacing" bits, and a table of 2^teeth - 1 points is stored for each block.
+//  Multiplication then costs (spacing - 1) doublings, so a spacing of 1 is doubling-free
+//  at the cost of the largest table.
+struct CombParameters
+{
+    unsigned int teeth;
+    unsigned int spacing;
+};
+
+// A fixed-base comb table for a point: block s holds, at index (i - 1), the sum of
+//  2^(k * rowSize + s * spacing) * P for every bit k set in i. Tables are built by
+//  EllipticCurve::PrecomputeFixedPointTable() and may only be used with the curve which built them.
+struct FixedPointTable
+{
+    CombParameters parameters;
+    
+    // The number of bits in a row of the scalar matrix and the number of blocks per row.
+    size_t rowSize;
+    size_t blockCount;
+    
+    vector<Point> points;
+};
+
+// The algorithms available for multiplying an arbitrary point with a scalar.
+//  WIDTH_NAF: width-w NAF double-and-add (with the endomorphism if the curve has one). The fastest.
+//  COZ_MONTGOMERY_LADDER: co-Z Montgomery ladder. Performs the same operations for every bit of the
+//      scalar and needs no precomputed table.
+enum ScalarMultiplicationMethod
+{
+    WIDTH_NAF,
+    COZ_MONTGOMERY_LADDER
+};
+
 class EllipticCurve
 {
     // --
@@ -49,6 +87,9 @@ private:
     // The field Fp over which the equation operates.
     shared_ptr<BigInteger> _p;
     
+    // The fast reduction routine for p (see FieldReduction.h), resolved once for all elements of the curve.
+    ecc::FieldReduction _reduction;
+    
     // The coefficients which define the curve.
     FieldElement _a;
     FieldElement _b;
@@ -65,16 +106,178 @@ private:
     // Name of the curve.
     string _curveName;
     
+    // Whether the coefficient a is 0 or -3 (mod p). Both allow for cheaper point doubling.
+    bool _aIsZero;
+    bool _aIsMinusThree;
+    
+    // The endomorphism phi(x, y) = (beta * x, y) = lambda * (x, y) and the lattice basis used to
+    //  decompose scalars for it. Null if the curve has no such endomorphism.
+    struct Endomorphism
+    {
+        Endomorphism(FieldElement beta, BigInteger lambda, BigInteger a1, BigInteger b1, BigInteger a2, BigInteger b2)
+            : beta(move(beta)), lambda(move(lambda)), a1(move(a1)), b1(move(b1)), a2(move(a2)), b2(move(b2))
+        {
+        }
+        
+        FieldElement beta;
+        BigInteger lambda;
+        BigInteger a1;
+        BigInteger b1;
+        BigInteger a2;
+        BigInteger b2;
+    };
+    shared_ptr<const Endomorphism> _endomorphism;
+    
+    // The lazily built fixed-base comb table for G. It is shared between copies of the curve
+    //  so that it is only ever built once.
+    struct BasePointTable
+    {
+        FixedPointTable comb;
+        
+        // The odd multiples of G used when G is one of the points of a double scalar multiplication,
+        //  and their images under the endomorphism (if the curve has one).
+        vector<Point> oddMultiples;
+        vector<Point> endomorphismOddMultiples;
+        
+        once_flag buildFlag;
+    };
+    shared_ptr<BasePointTable> _basePointTable;
+    
+    // Returns the base point comb table, building it on first use.
+    const BasePointTable& GetBasePointTable() const;
+    void BuildBasePointTable(BasePointTable& table) const;
+    
+    // Sizes the comb table for the order of G, and fills it in with the multiples of the given point.
+    void InitializeFixedPointTable(CombParameters parameters, FixedPointTable& table) const;
+    void BuildFixedPointTable(const Point& point, FixedPointTable& table) const;
+    
+    // Returns whether the table has the structure BuildFixedPointTable() gives it for its first entry P:
+    //  the entry for a single bit is the multiple of P that bit stands for, and every other entry is the sum
+    //  of the entries of its bits. Each sum is checked against its affine points without an inversion, but
+    //  the single bit entries take the same chain of doublings. With parsing, loading a checked table costs
+    //  about two thirds of building it.
+    bool CheckFixedPointTable(const FixedPointTable& table) const;
+    
+    // Creates a comb table from its serialized points as MakeFixedPointTable() does, without checking that
+    //  they are multiples of the first one.
+    shared_ptr<FixedPointTable> ParseFixedPointTable(CombParameters parameters, const vector<uint8_t>& serializedPoints) const;
+    
+    // Fills in the base point comb table from the tables compiled into the binary (see EmbeddedTables.h).
+    //  Returns false if there is no embedded table for this curve and the table's parameters.
+    bool LoadEmbeddedBasePointTable(FixedPointTable& table) const;
+    
     // Internal functions to compute the addition of two points for
     //  a) A + B = C (when A and B are distinct), and
     //  b) A + A = C (when A is added to itself)
     Point PointAdd(const Point& rhs, const Point& lhs) const;
     Point PointDouble(const Point& point) const;
     
+    // Computes the table of odd multiples {P, 3P, 5P, ..., (2*count - 1)P} of the given point
+    //  used by the width-w NAF scalar multiplication.
+    vector<Point> ComputeOddMultiples(const Point& point, size_t count) const;
+    
+    // Internal functions for points in Jacobian coordinates. Unlike their affine counterparts
+    //  these handle the point at infinity, doubling and inverse points themselves.
+    JacobianPoint MakeJacobianPointAtInfinity() const;
+    JacobianPoint ToJacobian(const Point& point) const;
+    Point ToAffine(const JacobianPoint& point) const;
+    JacobianPoint JacobianDouble(const JacobianPoint& point) const;
+    JacobianPoint JacobianAdd(const JacobianPoint& lhs, const JacobianPoint& rhs) const;
+    JacobianPoint JacobianAddAffine(const JacobianPoint& lhs, const Point& rhs) const;
+    
+    // Adds the signed odd multiple digit * P, found in the table of odd multiples of P, to the given point.
+    JacobianPoint AddSignedOddMultiple(const JacobianPoint& point, const vector<Point>& oddMultiples, int digit) const;
+    
+    // One term k * P of an interleaved multiplication: the width-w NAF of k and the odd multiples of P.
+    struct InterleavedTerm
+    {
+        vector<int8_t> naf;
+        const vector<Point>* oddMultiples;
+    };
+    
+    // Computes the sum of all terms with a single shared chain of doublings.
+    JacobianPoint MultiplyInterleaved(const vector<InterleavedTerm>& terms) const;
+    
+    // Appends the terms for k * P to the list of terms. If the curve has an endomorphism the scalar is
+    //  decomposed into k1 * P + k2 * phi(P), using the given table of odd multiples of phi(P).
+    void AppendScalarTerms(const BigInteger& scalar, unsigned int windowWidth, const vector<Point>& oddMultiples, const vector<Point>& endomorphismOddMultiples, vector<InterleavedTerm>& terms) const;
+    
+    // Applies the endomorphism to every point in the list.
+    vector<Point> ApplyEndomorphism(const vector<Point>& points) const;
+    
+    // Internal functions for pairs of points sharing the same (implicit) Z coordinate in Jacobian coordinates.
+    //  Only X and Y are kept. All return false, leaving their arguments undefined, in exceptional cases
+    //  (when the points are equal or inverses of each other, or the result would be the point at infinity).
+    //  a) (P, Q) -> (P, P + Q) in place,
+    //  b) (P, Q) -> (P - Q, P + Q) in place, and
+    //  c) affine P -> (P, 2P).
+    bool CoZAdd(FieldElement& X1, FieldElement& Y1, FieldElement& X2, FieldElement& Y2) const;
+    bool CoZAddConjugate(FieldElement& X1, FieldElement& Y1, FieldElement& X2, FieldElement& Y2) const;
+    bool CoZInitialDouble(const Point& point, FieldElement& X1, FieldElement& Y1, FieldElement& X2, FieldElement& Y2) const;
+    
+    // Multiplies with the co-Z Montgomery ladder. Returns false in exceptional cases (see above).
+    bool MultiplyCoZLadder(const Point& point, const BigInteger& scalar, Point& product) const;
+    
+    // Runs the co-Z ladder for the bits of a scalar of at least two bits (least significant first), leaving
+    //  the Jacobian coordinates of the product and its 1/Z as a fraction, so that the caller can invert the
+    //  denominator. Returns false in exceptional cases (see above).
+    bool RunCoZLadder(const Point& point, const vector<uint8_t>& bits, FieldElement& X0, FieldElement& Y0, FieldElement& inverseZNumerator, FieldElement& inverseZDenominator) const;
+    
+    // The two ways MultiplyManyPointsSameScalar() multiplies the points with a non-zero scalar: a co-Z ladder
+    //  for each point with a shared final inversion, or all points in lockstep in affine coordinates.
+    vector<Point> MultiplyCoZLadders(const vector<Point>& points, const BigInteger& scalar) const;
+    vector<Point> MultiplyInLockstep(const vector<Point>& points, const BigInteger& scalar) const;
+    
+    // Multiplies the base point with each of the given scalars by walking the comb of
+    //  MultiplyBasePointWithScalar() for all of them together in affine coordinates, with every doubling and
+    //  block addition sharing a single field inversion across the scalars.
+    vector<Point> MultiplyBasePointInLockstep(const vector<BigInteger>& scalars) const;
+    
+    // Doubles each point, or adds its addend to it, in affine coordinates with a single field inversion
+    //  for all of them. Points which are marked as failed are skipped. Points for which the step hits an
+    //  exceptional case (a result or input at infinity, or an addition of a point to itself) are marked
+    //  as failed and left unchanged.
+    void DoubleInLockstep(vector<Point>& points, vector<bool>& failed) const;
+    void AddInLockstep(vector<Point>& points, const vector<Point>& addends, vector<bool>& failed) const;
+    
+    // Scalar multiplication routines which leave their result in Jacobian coordinates.
+    JacobianPoint MultiplyJacobian(const Point& point, const BigInteger& scalar, unsigned int windowWidth) const;
+    JacobianPoint MultiplyBasePointJacobian(const BigInteger& scalar, unsigned int threadCount = 1) const;
+    JacobianPoint MultiplyFixedPointsJacobian(const vector<const FixedPointTable*>& tables, const vector<BigInteger>& scalars, unsigned int threadCount = 1) const;
+    JacobianPoint MultiplyDoubleScalarJacobian(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, unsigned int threadCount = 1) const;
+    
+    // Computes u1 * P1 + u2 * P2 as independent products on up to threadCount threads (see MultiplyDoubleScalar()).
+    JacobianPoint MultiplyDoubleScalarInParallel(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, unsigned int threadCount) const;
+    
+    // Runs the given products as up to threadCount tasks of the shared WorkerPool (0 uses one task per
+    //  hardware thread), the calling thread running the first, and returns their sum. Task t runs the
+    //  products i with t = (i mod threadCount).
+    JacobianPoint SumProductsInParallel(const vector<function<JacobianPoint()>>& products, unsigned int threadCount) const;
+    
+    // Computes the sum of the products of the points with the signed digits of their scalars in the given
+    //  window only (using buckets, see MultiScalarMultiply()). Digits are given least significant first.
+    JacobianPoint MultiplyPippengerWindow(const vector<vector<int32_t>>& digits, const vector<Point>& points, size_t window, unsigned int windowWidth) const;
+    
+    // Returns the Pippenger window width with the lowest cost for the given number of points and scalar size.
+    static unsigned int GetPippengerWindowWidth(size_t pointCount, size_t scalarBitSize);
+    
+    // Returns whether the affine x-coordinate of the given point, reduced modulo the order n, equals x.
+    bool JacobianXEqualsModOrder(const JacobianPoint& point, const BigInteger& x) const;
+    
 public:
     // Point at infinity.
     static const Point PointAtInfinity;
     
+    // The smallest and largest supported window widths for width-w NAF scalar multiplication.
+    static const unsigned int MIN_WNAF_WIDTH;
+    static const unsigned int MAX_WNAF_WIDTH;
+    
+    // The comb parameters used for the base point table unless others are set.
+    static const CombParameters DEFAULT_COMB_PARAMETERS;
+    
+    // The window width of the precomputed odd multiples of G used for double scalar multiplication.
+    static const unsigned int BASE_POINT_WNAF_WIDTH;
+    
     // Initializes a curve with the supplied parameters.
     EllipticCurve(DomainParameters params);
     
@@ -85,15 +288,139 @@ public:
     Point InvertPoint(const Point& point) const;
     
     // Multiplies the given point on the curve with the given scalar. Point must be on the curve (result
-    //  are undefined otherwise).
+    //  are undefined otherwise). The window width is selected based on the size of the scalar.
     Point MultiplyPointOnCurveWithScalar(const Point& point, const BigInteger& scalar) const;
     
+    // Multiplies the given point on the curve with the given scalar using a width-w NAF with the given
+    //  window width (in the range [MIN_WNAF_WIDTH, MAX_WNAF_WIDTH]). Point must be on the curve (results
+    //  are undefined otherwise).
+    Point MultiplyPointOnCurveWithScalar(const Point& point, const BigInteger& scalar, unsigned int windowWidth) const;
+    
+    // Multiplies the given point on the curve with the given non-negative scalar using the given method.
+    //  Point must be on the curve (results are undefined otherwise).
+    Point MultiplyPointOnCurveWithScalar(const Point& point, const BigInteger& scalar, ScalarMultiplicationMethod method) const;
+    
+    // The number of points from which MultiplyManyPointsSameScalar() multiplies all points in lockstep
+    //  rather than with a ladder each, and the number of scalars per thread from which
+    //  MultiplyBasePointWithScalars() walks their combs in lockstep.
+    static const size_t MIN_LOCKSTEP_POINTS;
+    
+    // Multiplies each of the given points with the same non-negative scalar. Like the co-Z ladder (see
+    //  MultiplyPointOnCurveWithScalar()), every point goes through the same sequence of operations no matter
+    //  the scalar, which is recoded only once for all of them. Small batches run a ladder for each point
+    //  and share the final field inversion. Larger batches move all points through a regular signed window
+    //  method in lockstep in affine coordinates, sharing one field inversion per step, which makes each
+    //  product considerably cheaper. Points must be on the curve (results are undefined otherwise).
+    vector<Point> MultiplyManyPointsSameScalar(const vector<Point>& points, const BigInteger& scalar) const;
+    
+    // Multiplies the base point G with the given non-negative scalar using the fixed-base comb table.
+    //  The table is built the first time it is needed. The blocks of the comb are independent of each
+    //  other, so they can be split across up to threadCount threads (0 uses one thread per hardware
+    //  thread), which lowers the latency of a single multiplication when cores are idle. The threads are
+    //  the persistent workers of WorkerPool::GetSharedInstance(), so no thread is started per call. From
+    //  timings of the pieces on one core, two threads are estimated to bring the latency close to half;
+    //  this has not been measured on idle cores.
+    Point MultiplyBasePointWithScalar(const BigInteger& scalar, unsigned int threadCount = 1) const;
+    
+    // Multiplies the base point G with each of the given non-negative scalars. Cheaper than calling
+    //  MultiplyBasePointWithScalar() for each one, since all products share a single field inversion (or,
+    //  for large batches, each step of the comb shares one). The products are split across up to
+    //  threadCount threads (0 uses one thread per hardware thread).
+    vector<Point> MultiplyBasePointWithScalars(const vector<BigInteger>& scalars, unsigned int threadCount = 1) const;
+    
+    // Replaces the comb parameters used for base point multiplication. The table is rebuilt with
+    //  the new parameters on next use. Teeth must be in the range [1, 8] and spacing at least 1.
+    void SetBasePointCombParameters(CombParameters parameters);
+    
+    // Computes u1 * P1 + u2 * P2 with a single shared chain of doublings (Strauss-Shamir trick over
+    //  interleaved width-w NAFs). Both points must be on the curve (results are undefined otherwise).
+    //  With more than one thread (0 uses one thread per hardware thread) the two products are computed
+    //  separately on their own threads instead, and on curves with an endomorphism each product may be
+    //  split further into its two half-length terms if there are threads to spare. This does more work in
+    //  total but lowers the latency of a single call when cores are idle. From timings of the pieces on one
+    //  core, three threads are estimated to bring secp256k1 to about 0.65 of the serial latency, while
+    //  curves without an endomorphism gain little, since the doublings of u2 * P2 can't be split (a
+    //  comb table for P2 does much better, see the overloads below). These estimates are not measurements.
+    Point MultiplyDoubleScalar(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, unsigned int threadCount = 1) const;
+    
+    // Returns whether the x-coordinate of u1 * P1 + u2 * P2, reduced modulo the order n, equals x.
+    //  The comparison is done against the projective result so no field inversion is needed.
+    //  Returns false if the sum is the point at infinity. Threads are used as by MultiplyDoubleScalar().
+    bool DoubleScalarProductXEquals(const BigInteger& u1, const Point& P1, const BigInteger& u2, const Point& P2, const BigInteger& x, unsigned int threadCount = 1) const;
+    
+    // The number of points below which MultiScalarMultiply() uses interleaved width-w NAFs rather
+    //  than buckets.
+    static const size_t MIN_PIPPENGER_POINTS;
+    
+    // Computes k1 * P1 + k2 * P2 + ... + kN * PN for the given non-negative scalars and points (which must
+    //  be of the same count). All points must be on the curve (results are undefined otherwise).
+    //  Large sums may be split across up to threadCount threads (0 uses one thread per hardware thread), which
+    //  are the workers of WorkerPool::GetSharedInstance(). The default keeps the sum on the calling thread.
+    Point MultiScalarMultiply(const vector<BigInteger>& scalars, const vector<Point>& points, unsigned int threadCount = 1) const;
+    
+    // Builds a comb table for the given point with the given parameters (see SetBasePointCombParameters()),
+    //  which makes multiplying that point as fast as multiplying G. Point must be on the curve and
+    //  be a multiple of G (results are undefined otherwise).
+    shared_ptr<const FixedPointTable> PrecomputeFixedPointTable(const Point& point, CombParameters parameters = DEFAULT_COMB_PARAMETERS) const;
+    
+    // Serializes the points of a comb table as fixed size records: each point as by Point::Serialize(), or
+    //  a zero byte followed by zeros for the point at infinity.
+    vector<uint8_t> SerializeFixedPointTable(const FixedPointTable& table) const;
+    
+    // Creates a comb table from its points serialized as above, as computed by PrecomputeFixedPointTable()
+    //  with the given parameters (such as a table loaded from a file, see PrecomputedTableFile). Throws
+    //  invalid_argument if the size of the points does not match the parameters, if a point is not on the
+    //  curve, or if the points are not the multiples of the first one that the comb needs. A table which
+    //  passes is the table of its first point, so the caller only has to check that point: a forged table
+    //  of other curve points would skew every product (and leak the nonces of signatures).
+    shared_ptr<const FixedPointTable> MakeFixedPointTable(CombParameters parameters, const vector<uint8_t>& serializedPoints) const;
+    
+    // Returns the comb table of the base point G, building it on first use.
+    const FixedPointTable& GetBasePointCombTable() const;
+    
+    // Replaces the comb table of the base point with one built before, for example by a previous process
+    //  (see PrecomputedTableFile). Throws invalid_argument if the table was not built for G.
+    void SetBasePointCombTable(const FixedPointTable& table);
+    
+    // Multiplies the point of the given table with the given non-negative scalar. Threads are used as by
+    //  MultiplyBasePointWithScalar().
+    Point MultiplyFixedPointWithScalar(const FixedPointTable& table, const BigInteger& scalar, unsigned int threadCount = 1) const;
+    
+    // Computes u1 * G + u2 * P2 where P2 is the point of the given table, and compares the x-coordinate
+    //  like the overloads above. Both multiplications use their comb table and share a single chain of doublings.
+    //  The blocks of both combs are split across up to threadCount threads as by MultiplyBasePointWithScalar(),
+    //  with the same estimated latency of close to half with two threads.
+    Point MultiplyDoubleScalar(const BigInteger& u1, const BigInteger& u2, const FixedPointTable& P2Table, unsigned int threadCount = 1) const;
+    bool DoubleScalarProductXEquals(const BigInteger& u1, const BigInteger& u2, const FixedPointTable& P2Table, const BigInteger& x, unsigned int threadCount = 1) const;
+    
+    // Returns whether the curve has an endomorphism which is used to speed up scalar multiplication.
+    bool HasEndomorphism() const;
+    
+    // Splits the scalar k into (k1, k2) such that k = k1 + k2 * lambda (mod n), where k1 and k2 are
+    //  roughly half the size of n and may be negative. The curve must have an endomorphism.
+    pair<BigInteger, BigInteger> DecomposeScalar(const BigInteger& scalar) const;
+    
+    // Recodes the given non-negative scalar into its width-w non-adjacent form. Digits are returned
+    //  least significant first and are either zero or odd with an absolute value less than 2^(w-1).
+    static vector<int8_t> ComputeWidthNaf(const BigInteger& scalar, unsigned int windowWidth);
+    
+    // Returns the window width used for a scalar of the given size when none is specified.
+    static unsigned int GetDefaultWNafWidth(size_t scalarBitSize);
+    
+    // Converts the given points from Jacobian to affine coordinates with a single field inversion
+    //  (rather than one per point). Points at infinity are returned as PointAtInfinity.
+    vector<Point> NormalizeBatch(const vector<JacobianPoint>& points) const;
+    
     // Returns true|false depending on whether the given point is on the curve.
     bool CheckPointOnCurve(const Point& point) const;
     
     // Creates a point on the curve from x and y coordinates.
     Point MakePointOnCurve(BigInteger&& x, BigInteger&& y) const;
     
+    // Creates the point on the curve with the given x-coordinate and the y-coordinate of the given parity.
+    //  Returns false if there is no such point.
+    bool TryMakePointFromX(const BigInteger& x, bool isYOdd, Point& point) const;
+    
     // Creates a point on the curve from a serialized point.
     Point MakePointOnCurve(const vector<uint8_t>& serializedPoint) const;
     
@@ -105,6 +432,10 @@ public:
     
     // Gets the name of this particular curve.
     string GetCurveName() const;
+    
+    // Serializes the domain parameters p, a, b, G and n, each preceded by its size in two bytes. Unlike the
+    //  name, these identify the curve: curves created from different parameters never serialize the same.
+    vector<uint8_t> SerializeDomainParameters() const;
 };
 
 #endif /* defined(__EccTool__EllipticCurve__) */
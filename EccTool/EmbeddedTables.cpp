@@ -0,0 +1,2031 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+// Generated by tools/GenerateEmbeddedTables.cpp, do not edit.
+
+#include "EmbeddedTables.h"
+
+using namespace std;
+using namespace ecc;
+
+namespace
+{
+    const uint8_t SECP112R1_BASE_POINT_TABLE[] = {
+        0x04, 0x09, 0x48, 0x72, 0x39, 0x99, 0x5A, 0x5E, 0xE7, 0x6B, 0x55, 0xF9, 0xC2, 0xF0, 0x98, 0xA8,
+        0x9C, 0xE5, 0xAF, 0x87, 0x24, 0xC0, 0xA2, 0x3E, 0x0E, 0x0F, 0xF7, 0x75, 0x00, 0x04, 0x91, 0x78,
+        0x12, 0xCF, 0x15, 0x0B, 0xFE, 0x3F, 0xA3, 0x00, 0x9E, 0x70, 0x6D, 0xAC, 0x4A, 0xF0, 0xE7, 0x0C,
+        0x83, 0x6D, 0xB0, 0x2A, 0xC5, 0x92, 0xFE, 0x92, 0xB8, 0x8B, 0x04, 0x33, 0xE1, 0xD0, 0x12, 0x4D,
+        0xB7, 0x2B, 0x24, 0xF4, 0x3B, 0x5E, 0x46, 0x16, 0xAB, 0x56, 0x4A, 0x8E, 0x41, 0x43, 0xBF, 0x7A,
+        0x29, 0x04, 0xCC, 0xE9, 0xC1, 0x39, 0x84, 0x04, 0x0A, 0x34, 0x54, 0x53, 0xEE, 0x34, 0x53, 0x5E,
+        0x2E, 0xE2, 0x89, 0x3C, 0xF7, 0x8B, 0x52, 0xC7, 0x1A, 0x6A, 0x58, 0x7D, 0x5D, 0x91, 0x5E, 0x11,
+        0xDF, 0xB9, 0xE5, 0x4D, 0x04, 0x4F, 0x62, 0x9C, 0x5C, 0xB5, 0x50, 0x54, 0x27, 0x72, 0x69, 0x0B,
+        0x7D, 0xAC, 0xA0, 0x1D, 0x0F, 0xDA, 0x1C, 0x9E, 0xAC, 0xFA, 0x10, 0xEA, 0x90, 0x8D, 0x06, 0xE7,
+        0x18, 0x04, 0xA7, 0x4F, 0xC1, 0xD0, 0xFD, 0xBD, 0xE4, 0x72, 0x2D, 0x26, 0x63, 0xC7, 0x97, 0x3B,
+        0x82, 0xB9, 0x31, 0xD8, 0x66, 0x70, 0xC5, 0xB2, 0x0E, 0x03, 0xAD, 0x3F, 0x83, 0xAC, 0x04, 0xA5,
+        0xD6, 0x2B, 0xB3, 0xBC, 0x70, 0x9C, 0x41, 0xB9, 0x0E, 0x15, 0x2C, 0x6F, 0x65, 0x96, 0x1E, 0x53,
+        0x1A, 0x32, 0x44, 0x1D, 0xDE, 0x4F, 0xBE, 0x02, 0xB0, 0xD8, 0xF7, 0x04, 0x1A, 0xEF, 0x87, 0x03,
+        0x07, 0x91, 0x60, 0x34, 0x15, 0xFF, 0x17, 0xBA, 0x23, 0x57, 0x14, 0x61, 0x9D, 0x0D, 0x17, 0x20,
+        0xB1, 0xF7, 0xC9, 0xB1, 0xD4, 0x2C, 0x12, 0xAD, 0x04, 0x63, 0x26, 0x5B, 0x65, 0xD5, 0xB2, 0x18,
+        0x1E, 0xA0, 0x6E, 0xF1, 0xE5, 0x9C, 0x77, 0x6F, 0x18, 0x7D, 0x7A, 0xA1, 0x68, 0x93, 0xD9, 0x90,
+        0x29, 0x62, 0x58, 0x9F, 0xC4, 0x04, 0x2D, 0x99, 0xBC, 0xF6, 0x7F, 0xBB, 0xBB, 0xD2, 0xD3, 0x52,
+        0x5A, 0x58, 0x4C, 0x47, 0x16, 0x4E, 0xD2, 0x2F, 0x49, 0xD3, 0xFE, 0x9D, 0xEF, 0x54, 0x75, 0xBA,
+        0x00, 0x5D, 0x04, 0xBE, 0x8B, 0x59, 0x2F, 0xE8, 0xA2, 0x83, 0x90, 0x03, 0x05, 0x1F, 0x31, 0x09,
+        0xB3, 0xA9, 0x24, 0x52, 0x7E, 0x95, 0x0C, 0xBB, 0x07, 0x2F, 0x01, 0xB9, 0x90, 0x28, 0x9E, 0x04,
+        0xDA, 0x1F, 0xA6, 0xB2, 0x9B, 0xEB, 0xF3, 0x69, 0xEF, 0x8B, 0x40, 0x85, 0x50, 0x32, 0x7D, 0xB0,
+        0xDB, 0x74, 0x18, 0xD6, 0x5E, 0x32, 0x15, 0xDF, 0xCA, 0x36, 0xF3, 0xD3, 0x04, 0xC2, 0x68, 0x95,
+        0x1D, 0xE3, 0x5F, 0x12, 0xAA, 0x49, 0x0E, 0x1A, 0x56, 0xD3, 0x4D, 0xBD, 0x40, 0x6F, 0x0F, 0x52,
+        0x7A, 0xD0, 0xCB, 0xFB, 0x85, 0x1B, 0x5D, 0x62, 0x1F, 0x04, 0x70, 0xFE, 0x20, 0x84, 0x59, 0x1C,
+        0xA3, 0xFA, 0x2F, 0x3C, 0xE4, 0x04, 0x2B, 0x0B, 0x1E, 0x40, 0xB8, 0x87, 0x1D, 0x5A, 0xF7, 0x2B,
+        0x96, 0xA2, 0xC7, 0x4E, 0xBA, 0x0B, 0x04, 0x1C, 0x9D, 0xCC, 0x70, 0x8C, 0x0A, 0x08, 0x4E, 0xCF,
+        0x94, 0x42, 0x37, 0x8D, 0x17, 0x1D, 0xC1, 0x4E, 0xC9, 0x5C, 0xFA, 0x49, 0x9B, 0xD8, 0x22, 0x06,
+        0x99, 0xD3, 0x1A, 0x04, 0x82, 0xEB, 0x7B, 0x9D, 0xE2, 0x20, 0x5F, 0xE3, 0x3F, 0x6A, 0xAE, 0x9F,
+        0x7D, 0xDD, 0x1F, 0x56, 0x1B, 0xE1, 0x98, 0xED, 0xFF, 0xDE, 0x94, 0x21, 0x68, 0x05, 0xAE, 0x6F,
+        0x04, 0x30, 0x0E, 0x15, 0x87, 0xC3, 0xC3, 0x5D, 0xD3, 0x62, 0x26, 0x0B, 0xDC, 0x42, 0x21, 0x37,
+        0x94, 0xF6, 0x88, 0x60, 0x61, 0xC2, 0x54, 0xB3, 0x87, 0x5C, 0x50, 0x32, 0x0E, 0x04, 0x21, 0x46,
+        0x9C, 0x40, 0xB7, 0xEF, 0x3C, 0x3A, 0xD1, 0x0E, 0x12, 0xCB, 0xC3, 0xB3, 0x2E, 0xFC, 0x64, 0x12,
+        0xFE, 0x5F, 0x26, 0x65, 0x0F, 0x5F, 0x49, 0xFC, 0xF9, 0x56, 0x04, 0x64, 0xE2, 0x38, 0x59, 0xF9,
+        0x6B, 0x2F, 0xB0, 0x83, 0x12, 0xCF, 0x7C, 0x63, 0x0F, 0x2B, 0xB0, 0xF2, 0x55, 0x47, 0x5F, 0x81,
+        0x42, 0x27, 0x68, 0x43, 0x3C, 0x98, 0xC0, 0x04, 0x83, 0x3B, 0x5A, 0x7C, 0xF7, 0x50, 0xA7, 0x1D,
+        0xD8, 0x19, 0x9B, 0x8E, 0x80, 0x6D, 0x9F, 0xE4, 0xC7, 0x41, 0x41, 0xEF, 0xB6, 0xC1, 0x0D, 0x66,
+        0x73, 0x2A, 0xF2, 0x26, 0x04, 0x7B, 0xA1, 0xD5, 0xF3, 0x3A, 0x2B, 0xA3, 0xE7, 0xC5, 0x5C, 0x41,
+        0x9A, 0xE3, 0x62, 0x7E, 0x53, 0x53, 0x03, 0xFA, 0x90, 0xCA, 0x07, 0x01, 0xB2, 0x96, 0xD2, 0x2B,
+        0x54, 0x04, 0xCE, 0x53, 0xFD, 0x62, 0x41, 0x6B, 0x43, 0xBA, 0x26, 0x57, 0xB1, 0xEB, 0x5A, 0xD4,
+        0x70, 0x3D, 0x2D, 0x4B, 0x79, 0x83, 0x67, 0x9D, 0xB1, 0xC4, 0x9D, 0x73, 0xCD, 0xFC, 0x04, 0xAF,
+        0x26, 0xD6, 0x35, 0x34, 0xF6, 0xE2, 0xBD, 0xB4, 0xD9, 0x7A, 0xEA, 0x59, 0xD9, 0x82, 0xD5, 0xAC,
+        0x6E, 0xDE, 0x2B, 0xCC, 0xC4, 0x4F, 0x6F, 0x10, 0x5F, 0x2D, 0x21, 0x04, 0x03, 0x4B, 0x4F, 0x29,
+        0x9A, 0xC3, 0x05, 0x3E, 0x8E, 0xAC, 0xB1, 0x6B, 0x6D, 0x8B, 0xD9, 0xDC, 0x31, 0x9A, 0x75, 0xDF,
+        0xE8, 0x4B, 0xD7, 0x09, 0xD1, 0x72, 0xCA, 0xF5, 0x04, 0x5E, 0x3A, 0x47, 0xCF, 0xBE, 0x09, 0x67,
+        0x9A, 0x56, 0x26, 0x75, 0x4C, 0x55, 0x15, 0x74, 0xF4, 0xA4, 0x62, 0xC6, 0x90, 0xF1, 0x17, 0xBF,
+        0x11, 0x2E, 0x16, 0x8F, 0x6E, 0x04, 0x93, 0x0A, 0xDC, 0xAF, 0xF9, 0x41, 0x85, 0x8F, 0x14, 0xE5,
+        0x7F, 0xE8, 0x96, 0x79, 0xB1, 0x5F, 0xF7, 0x5D, 0x0C, 0x80, 0x8C, 0x9D, 0x43, 0x14, 0x69, 0x91,
+        0xCC, 0x78, 0x04, 0x59, 0xC9, 0x7C, 0x2E, 0x45, 0xF4, 0xC8, 0xCE, 0x6A, 0x86, 0x6E, 0x3D, 0xF9,
+        0x1F, 0x90, 0x36, 0xD6, 0xB6, 0x85, 0xAD, 0x0A, 0x3F, 0xA4, 0x41, 0xC8, 0x7C, 0xF1, 0x32, 0x04,
+        0x09, 0xF5, 0xC8, 0xAE, 0x79, 0x03, 0xFA, 0xF9, 0xD7, 0xB6, 0x1F, 0xBF, 0x36, 0x75, 0x8E, 0xFC,
+        0x13, 0x12, 0x67, 0xCD, 0x46, 0xBB, 0xCC, 0x23, 0x14, 0x30, 0xE5, 0xE6, 0x04, 0x4D, 0xE5, 0x5A,
+        0x2A, 0x08, 0x20, 0xA9, 0xDD, 0xFA, 0x8B, 0x4E, 0x9A, 0x6C, 0xDC, 0x96, 0xA9, 0x18, 0xBA, 0x63,
+        0x23, 0xEC, 0x37, 0x55, 0x21, 0xF7, 0x25, 0xCE, 0x61, 0x04, 0x5C, 0xF3, 0x01, 0xB0, 0xB4, 0x94,
+        0x4D, 0x73, 0x86, 0x1C, 0x88, 0xF9, 0xAC, 0xBE, 0x01, 0x5C, 0x34, 0x90, 0x5E, 0xA9, 0xD9, 0xF5,
+        0x1C, 0x97, 0x31, 0x67, 0x2B, 0xEA, 0x04, 0x79, 0x1A, 0x9F, 0x58, 0x7A, 0x51, 0x6A, 0xE5, 0x54,
+        0x60, 0xBD, 0x81, 0x76, 0xB3, 0x96, 0x9D, 0xE3, 0xFD, 0x44, 0x5C, 0x82, 0x8B, 0x34, 0x72, 0xF2,
+        0xD8, 0xEE, 0xDC, 0x04, 0x53, 0x56, 0x0D, 0xD0, 0xEE, 0xEF, 0xF2, 0x06, 0xD4, 0xA9, 0x30, 0x9E,
+        0xCB, 0x42, 0x87, 0xDB, 0x5E, 0x10, 0x67, 0x65, 0x16, 0xB5, 0x11, 0x0E, 0xC0, 0x2C, 0x78, 0x8A,
+        0x04, 0x1B, 0xF1, 0xDA, 0x33, 0xE2, 0x00, 0xF8, 0xEB, 0x5E, 0xF3, 0x44, 0x51, 0xC9, 0x64, 0xBF,
+        0x66, 0xFA, 0x80, 0x96, 0xEA, 0xDC, 0x3B, 0x41, 0x02, 0x16, 0x3A, 0x5D, 0x88, 0x04, 0xD4, 0x95,
+        0x2F, 0xCE, 0xF1, 0x00, 0x7C, 0xE4, 0x04, 0x8B, 0x31, 0x56, 0xB7, 0x0A, 0x83, 0xA7, 0x47, 0x64,
+        0xB9, 0x04, 0x66, 0x48, 0xCE, 0x44, 0x37, 0x43, 0x55, 0x65, 0x04, 0x62, 0x12, 0x31, 0x3B, 0xE2,
+        0x82, 0x11, 0x02, 0x0D, 0xE1, 0x3A, 0x06, 0x3C, 0xFD, 0x83, 0x39, 0x1A, 0xEB, 0xAC, 0x06, 0x74,
+        0xED, 0x6D, 0x4B, 0xE7, 0x63, 0x0F, 0x36, 0x04, 0x76, 0x4D, 0x35, 0xCC, 0x49, 0x1C, 0xB1, 0xF2,
+        0xFA, 0x23, 0xA5, 0xBE, 0x28, 0x23, 0x23, 0x22, 0x75, 0xCC, 0x07, 0xE5, 0x50, 0xBB, 0xF7, 0xE5,
+        0x7B, 0xAD, 0xED, 0xDF, 0x04, 0x17, 0x34, 0x63, 0xB2, 0x85, 0x44, 0x9A, 0x68, 0xFF, 0x80, 0xC1,
+        0x5B, 0x6C, 0x73, 0xA1, 0x35, 0x70, 0x1B, 0x21, 0xF7, 0xE7, 0xF2, 0x22, 0x12, 0xF1, 0xE3, 0x46,
+        0x89, 0x04, 0x0E, 0xE8, 0x7C, 0x30, 0x12, 0xA6, 0xEB, 0x95, 0xC1, 0x60, 0xC7, 0x40, 0xDF, 0x24,
+        0x33, 0x47, 0x07, 0xE9, 0xC4, 0x46, 0xFF, 0xED, 0xC5, 0xF4, 0xDE, 0xA0, 0x41, 0xE0, 0x04, 0x29,
+        0x5F, 0x62, 0x66, 0x1D, 0xC5, 0x51, 0xD3, 0xC4, 0x82, 0x3C, 0xD5, 0x5C, 0xE9, 0x1A, 0x62, 0x99,
+        0xA1, 0x16, 0x10, 0x39, 0x41, 0xD2, 0x68, 0x35, 0xED, 0xEB, 0xAD, 0x04, 0x72, 0xF8, 0xE2, 0x73,
+        0x2E, 0x20, 0xBF, 0x67, 0x25, 0xA3, 0x03, 0xA5, 0xD3, 0x52, 0x71, 0xB9, 0x44, 0x7F, 0xEB, 0x16,
+        0xDF, 0x73, 0x45, 0xF7, 0x8B, 0xE6, 0xE2, 0x7E, 0x04, 0x8C, 0x55, 0xC1, 0xC4, 0xEF, 0x6A, 0xE7,
+        0xE8, 0x14, 0x83, 0x37, 0xB9, 0xA5, 0x1C, 0x9A, 0x2D, 0xEB, 0x7F, 0xEA, 0x12, 0xCF, 0x3C, 0x25,
+        0xC5, 0x6B, 0x56, 0xAD, 0xCA, 0x04, 0x74, 0xAF, 0x03, 0x8F, 0xA9, 0x11, 0xA8, 0x32, 0x51, 0x8B,
+        0xFE, 0x4B, 0xF9, 0x23, 0x1C, 0x71, 0x26, 0x4B, 0x56, 0x12, 0xBD, 0xBC, 0x62, 0x71, 0xB4, 0xEB,
+        0x5B, 0x0A, 0x04, 0x57, 0x94, 0x9B, 0xA3, 0xAA, 0x12, 0xE2, 0xEC, 0x1B, 0x85, 0x30, 0x54, 0x86,
+        0xD0, 0x29, 0x56, 0x83, 0x79, 0x84, 0xB3, 0x09, 0x5D, 0x4C, 0xF4, 0xC0, 0x44, 0xCF, 0x61, 0x04,
+        0x67, 0xA8, 0x64, 0x59, 0xE9, 0xC9, 0xEC, 0xCD, 0x39, 0x0E, 0xB6, 0x1E, 0x55, 0xA0, 0xA6, 0x5D,
+        0x1E, 0xEF, 0xB4, 0x92, 0xFB, 0x52, 0x0B, 0x93, 0x5E, 0x5E, 0xAC, 0xA0, 0x04, 0x0B, 0x83, 0x35,
+        0x69, 0xA2, 0xE1, 0x1B, 0x0C, 0xB5, 0xD2, 0xED, 0xA0, 0x0C, 0xA3, 0xD2, 0x75, 0x6F, 0x19, 0xF0,
+        0x5A, 0xBC, 0x56, 0xF6, 0x98, 0xFE, 0x45, 0xD6, 0xCB, 0x04, 0x95, 0x8D, 0xD0, 0xE4, 0xD5, 0x5A,
+        0xE1, 0xBE, 0xB9, 0x75, 0xFF, 0xFD, 0xF6, 0x41, 0xA3, 0xD9, 0x2A, 0x3D, 0xA2, 0x27, 0x1B, 0x4B,
+        0x40, 0xD7, 0x51, 0x24, 0xA4, 0x37, 0x04, 0x5B, 0xEC, 0x77, 0xB3, 0x79, 0x70, 0x83, 0xE0, 0x48,
+        0x02, 0x23, 0x76, 0xAE, 0x71, 0x13, 0x37, 0xF5, 0x30, 0x0B, 0x3C, 0xEA, 0x29, 0x61, 0x81, 0xB3,
+        0x4B, 0x07, 0x00, 0x04, 0x0E, 0x3E, 0x91, 0x19, 0x0E, 0x2C, 0x56, 0x74, 0xE7, 0xC2, 0x94, 0x39,
+        0x8A, 0x62, 0x79, 0xD9, 0x5B, 0x2A, 0x54, 0x17, 0x4E, 0x3E, 0x43, 0x80, 0x52, 0xB5, 0x83, 0x0C,
+        0x04, 0x40, 0x26, 0xD5, 0x29, 0x72, 0x5A, 0xCF, 0x08, 0xF6, 0x81, 0xF3, 0xA5, 0x8C, 0x94, 0xBB,
+        0x77, 0xB3, 0x6A, 0x57, 0x8E, 0xAB, 0x5A, 0x69, 0x87, 0x3B, 0x03, 0xE7, 0xB5, 0x04, 0xC0, 0x1F,
+        0xAE, 0xC8, 0x10, 0x85, 0xF4, 0xEF, 0x2E, 0x0D, 0x8A, 0x48, 0x12, 0x9C, 0x38, 0xA1, 0x00, 0xBD,
+        0x41, 0x77, 0xE6, 0x73, 0x3F, 0xC6, 0xB4, 0x4E, 0xCE, 0x93, 0x04, 0x55, 0xC2, 0x0E, 0x25, 0xB9,
+        0xCB, 0x31, 0xFE, 0x14, 0x34, 0xA0, 0x5F, 0xFC, 0xEE, 0x8A, 0x7C, 0x07, 0x9C, 0xEC, 0xE2, 0x8F,
+        0x30, 0xFD, 0x8D, 0x94, 0x48, 0x5B, 0x03, 0x04, 0x9E, 0x78, 0x21, 0xE2, 0xBF, 0xE8, 0xC8, 0x02,
+        0x69, 0x63, 0xD2, 0xAC, 0x9B, 0x67, 0x12, 0x27, 0x8B, 0x13, 0x6B, 0x78, 0x00, 0x58, 0xDD, 0xF2,
+        0xFB, 0x84, 0x49, 0xC0, 0x04, 0x33, 0x0D, 0xF0, 0xCF, 0x18, 0x2E, 0x42, 0x3E, 0xC7, 0x82, 0x06,
+        0x41, 0x83, 0xF2, 0x64, 0xAF, 0x2B, 0x10, 0xE9, 0xDF, 0xA2, 0x18, 0xF5, 0xD6, 0x52, 0x8D, 0x99,
+        0x5C, 0x04, 0x8E, 0x37, 0x89, 0x3A, 0x7D, 0x2D, 0x25, 0x26, 0xE7, 0x0A, 0x59, 0x25, 0x45, 0xCB,
+        0x2F, 0x59, 0x7E, 0xBA, 0xBB, 0xEA, 0xE9, 0x3B, 0xB9, 0x28, 0xE8, 0x6B, 0x8D, 0x65, 0x04, 0x6A,
+        0xFC, 0xA4, 0xF8, 0xB0, 0xBE, 0x40, 0xDF, 0x72, 0x5C, 0x98, 0x90, 0x9C, 0xF2, 0x3B, 0xB2, 0x6A,
+        0xC2, 0x53, 0x08, 0xBC, 0x60, 0x51, 0xD8, 0x8D, 0x68, 0x3A, 0x52, 0x04, 0x8F, 0x62, 0x58, 0x00,
+        0x09, 0xC2, 0x8D, 0x3D, 0x97, 0xEE, 0x83, 0x18, 0xAE, 0x9C, 0x62, 0xCC, 0xDE, 0xB7, 0xB4, 0x51,
+        0xBE, 0x69, 0x84, 0xA7, 0x5F, 0x9D, 0xCD, 0x8E, 0x04, 0x74, 0x50, 0x4F, 0x8A, 0x31, 0x13, 0x64,
+        0x3D, 0xD8, 0x2A, 0x64, 0xF4, 0x94, 0x9E, 0xC2, 0x69, 0xAF, 0xA7, 0xF4, 0x85, 0x06, 0xCB, 0xBF,
+        0xF0, 0x79, 0x72, 0x07, 0xDF, 0x04, 0x8C, 0xC5, 0x09, 0x17, 0x13, 0xA6, 0x1E, 0x3F, 0xA1, 0xCC,
+        0xA4, 0x90, 0x4A, 0xE9, 0xC5, 0xFB, 0xA4, 0x89, 0xDB, 0xD0, 0x4C, 0x79, 0xBD, 0xAB, 0x2C, 0x11,
+        0x51, 0xAD, 0x04, 0xBB, 0x8C, 0x82, 0x50, 0xB2, 0xD3, 0x45, 0xA3, 0xFF, 0x42, 0x93, 0x78, 0x52,
+        0x67, 0xC3, 0x66, 0xFB, 0x80, 0x3B, 0x3A, 0xC3, 0x0D, 0x22, 0x5B, 0xB9, 0xB7, 0x47, 0xFE, 0x04,
+        0x17, 0x41, 0x12, 0x04, 0x40, 0x6E, 0xE1, 0x02, 0x86, 0x67, 0x17, 0xEF, 0x6E, 0xC8, 0x37, 0xF7,
+        0xCE, 0xCE, 0xBC, 0x66, 0xDB, 0xA9, 0x4E, 0xEF, 0x40, 0x83, 0x83, 0x0D, 0x04, 0x52, 0x05, 0xBD,
+        0x12, 0xED, 0x74, 0x92, 0xBA, 0xA8, 0x81, 0xD8, 0xB4, 0x6B, 0x81, 0x3C, 0x99, 0x37, 0xC0, 0xB2,
+        0xA5, 0x4C, 0x60, 0xA4, 0x53, 0x65, 0x77, 0xE5, 0xAC, 0x04, 0x01, 0xDA, 0x6D, 0x9C, 0xBE, 0x0A,
+        0x2A, 0xEE, 0x6A, 0xF2, 0xDF, 0x00, 0xE3, 0x39, 0x66, 0xE3, 0xB1, 0xAF, 0x3D, 0x7F, 0x83, 0x57,
+        0x49, 0x15, 0x38, 0x7B, 0x95, 0xBD, 0x04, 0x7D, 0x81, 0x81, 0xAA, 0x18, 0xBF, 0x46, 0xB1, 0x58,
+        0x9B, 0x84, 0xA1, 0xA3, 0x7A, 0x36, 0xAB, 0x5F, 0x98, 0x98, 0xF6, 0x36, 0xE8, 0xF3, 0x2F, 0x7E,
+        0x75, 0x79, 0xDD, 0x04, 0x92, 0xB6, 0x00, 0x77, 0x3A, 0xD0, 0x16, 0xEF, 0xF6, 0xC2, 0x32, 0xB0,
+        0x56, 0x2B, 0xC5, 0x13, 0x86, 0xE3, 0xE2, 0xDB, 0x06, 0x2A, 0xFC, 0x52, 0x41, 0x82, 0xBD, 0xAA,
+        0x04, 0x48, 0xCA, 0xA7, 0x1D, 0x0D, 0xE3, 0x45, 0xBF, 0x4D, 0x54, 0x80, 0x38, 0x95, 0x23, 0x14,
+        0x01, 0xCD, 0x31, 0xB4, 0xB2, 0x3E, 0xF6, 0x88, 0xAF, 0x2B, 0x60, 0x0C, 0x40, 0x04, 0x9C, 0x44,
+        0xDB, 0xFC, 0x07, 0xD3, 0xB7, 0x2B, 0x04, 0x90, 0xD2, 0x01, 0x06, 0x8D, 0x53, 0xC2, 0xE2, 0x14,
+        0xA7, 0x41, 0xC9, 0x98, 0xC0, 0xD8, 0x01, 0x06, 0x67, 0x73, 0x04, 0xBF, 0xD0, 0xF6, 0xFE, 0xAF,
+        0xA2, 0xCF, 0x6A, 0x4B, 0x73, 0xE5, 0x65, 0xDE, 0x46, 0x66, 0x61, 0x45, 0xF9, 0x82, 0xA8, 0x2B,
+        0x60, 0x41, 0xA4, 0x83, 0x00, 0x22, 0xC3, 0x04, 0x03, 0xAA, 0x20, 0x59, 0xEC, 0x77, 0x66, 0x1D,
+        0x2E, 0x7C, 0xF0, 0x18, 0x4F, 0x60, 0x7D, 0xA3, 0xC3, 0xA8, 0xA2, 0x66, 0xC4, 0xF2, 0xA0, 0x17,
+        0xBB, 0xF4, 0xA2, 0x0B, 0x04, 0x85, 0xA4, 0xD2, 0x4C, 0xE4, 0x0D, 0x0C, 0x40, 0xD1, 0xF2, 0xC6,
+        0x72, 0x85, 0x39, 0x7E, 0x18, 0xFC, 0xB2, 0x22, 0xF9, 0xBB, 0x91, 0x70, 0xF7, 0xE4, 0xEE, 0x42,
+        0xBF, 0x04, 0x98, 0x89, 0x7F, 0x38, 0xDA, 0x0C, 0x72, 0x6C, 0x5C, 0x43, 0x9C, 0x8E, 0x4B, 0xEA,
+        0x16, 0x32, 0x6A, 0xB3, 0x49, 0xE2, 0x69, 0x79, 0xD4, 0xE8, 0x49, 0xC8, 0xA7, 0x55, 0x04, 0x89,
+        0x42, 0x47, 0x81, 0xB3, 0x11, 0xAF, 0x80, 0xE3, 0xC5, 0x08, 0xAE, 0x8B, 0xBD, 0x9B, 0xE9, 0x64,
+        0xF6, 0x3A, 0x1B, 0x82, 0xB7, 0xB5, 0x1B, 0x7F, 0x5B, 0xC8, 0x50, 0x04, 0x04, 0xEA, 0x2B, 0x7B,
+        0x43, 0xBA, 0xBA, 0x86, 0xD0, 0x4A, 0xD9, 0xB3, 0x40, 0xE8, 0x1D, 0xF4, 0x42, 0x32, 0xEF, 0x59,
+        0x6C, 0x9F, 0x14, 0x4A, 0xF7, 0x71, 0xDF, 0xBF, 0x04, 0x51, 0x9D, 0x3F, 0xE8, 0x05, 0x3B, 0xDE,
+        0x68, 0xA8, 0xD0, 0x7A, 0x85, 0x00, 0x03, 0xCF, 0x8A, 0x91, 0xF8, 0x4D, 0x66, 0xA2, 0xC5, 0x18,
+        0x94, 0x48, 0x2E, 0x7E, 0x0F, 0x04, 0x9B, 0x66, 0x39, 0xCF, 0xE4, 0x3B, 0x28, 0x50, 0x9E, 0x50,
+        0x64, 0x03, 0xE7, 0x02, 0xD0, 0x11, 0xA5, 0x49, 0xDC, 0x29, 0x08, 0xC3, 0x5E, 0xB5, 0x50, 0x91,
+        0x74, 0x4D, 0x04, 0x1A, 0xA6, 0xAB, 0x31, 0x3D, 0xDE, 0x45, 0x19, 0x7D, 0x8A, 0x2E, 0xE5, 0x6C,
+        0x5C, 0x87, 0xE3, 0x6A, 0xFF, 0x96, 0x5D, 0x57, 0xAC, 0x15, 0xEB, 0x2B, 0x47, 0x39, 0x0F, 0x04,
+        0xC9, 0x4B, 0xCA, 0x34, 0x3E, 0xEB, 0x0A, 0xA5, 0xA2, 0x78, 0xE4, 0x68, 0xFE, 0x2D, 0xBF, 0xD2,
+        0xBF, 0x28, 0x4B, 0x92, 0x2A, 0x7E, 0x6B, 0xA4, 0x55, 0xFA, 0xF2, 0x62, 0x04, 0x96, 0x4E, 0x20,
+        0xAC, 0x39, 0x2E, 0xB5, 0x39, 0xD0, 0x3C, 0xE1, 0xD3, 0x73, 0x66, 0xA4, 0x08, 0xE4, 0x3E, 0x5E,
+        0x97, 0x9E, 0x12, 0x03, 0x6F, 0xDA, 0x50, 0x6F, 0xFA, 0x04, 0xC9, 0x9C, 0xFC, 0x75, 0xD2, 0xDB,
+        0x6A, 0x74, 0x2E, 0xD3, 0x62, 0x98, 0xED, 0x47, 0x3F, 0xD4, 0x85, 0x82, 0x7F, 0x2C, 0x0A, 0x63,
+        0xAA, 0xAF, 0x4A, 0xE3, 0xFD, 0x70, 0x04, 0xA9, 0x3C, 0x76, 0xD3, 0xB7, 0xCB, 0x99, 0xB7, 0x58,
+        0x32, 0x99, 0x0B, 0xD1, 0x12, 0xA6, 0xB1, 0x70, 0xC4, 0x17, 0xA8, 0xBB, 0x70, 0x7A, 0x11, 0xF5,
+        0xBB, 0xC9, 0xF6, 0x04, 0xAD, 0xFE, 0x53, 0x05, 0xF7, 0x1F, 0x25, 0x4D, 0xE4, 0xD2, 0x1A, 0x1E,
+        0x2F, 0x77, 0x50, 0x86, 0x81, 0x9E, 0xAE, 0x12, 0x19, 0x37, 0x0C, 0x0C, 0x10, 0x0B, 0x6A, 0xD9,
+        0x04, 0x59, 0xAF, 0xDA, 0x0D, 0x46, 0x30, 0x8C, 0xAD, 0x9C, 0x8A, 0xF6, 0x26, 0xFE, 0x43, 0xA3,
+        0xC2, 0x73, 0x2A, 0x39, 0xF0, 0x40, 0x9F, 0xBE, 0xF8, 0x19, 0x12, 0xA0, 0xF7, 0x04, 0x6C, 0xD2,
+        0x47, 0xF2, 0x14, 0x8A, 0xF8, 0xBB, 0xDA, 0x15, 0x02, 0x9C, 0x3D, 0xF6, 0xC3, 0xDE, 0x1B, 0x35,
+        0x20, 0x06, 0x7F, 0xBD, 0x7B, 0x3A, 0xC3, 0x82, 0xFB, 0x95, 0x04, 0x77, 0x9B, 0x93, 0x59, 0x2A,
+        0x88, 0xD4, 0xEE, 0x61, 0xDC, 0x2C, 0xD7, 0x20, 0x8D, 0x3B, 0x85, 0x5C, 0x3D, 0xC5, 0x81, 0x90,
+        0x4D, 0x96, 0x4A, 0x1D, 0xBC, 0x1D, 0xB5, 0x04, 0x00, 0x7B, 0x77, 0x04, 0xFF, 0xE4, 0x88, 0x46,
+        0x6A, 0x46, 0x4A, 0xBC, 0x09, 0xF2, 0xD8, 0xC4, 0x89, 0xC6, 0x33, 0x58, 0xAA, 0x0D, 0xAF, 0xC0,
+        0xC7, 0x3D, 0x95, 0xA6, 0x04, 0x9F, 0xA9, 0xA1, 0xBB, 0x08, 0x29, 0x4D, 0x3F, 0xF3, 0xD9, 0x0E,
+        0x02, 0x96, 0x21, 0x8B, 0x77, 0xF0, 0xA6, 0x0B, 0xA3, 0x66, 0xE2, 0xFC, 0x22, 0x9C, 0x97, 0x19,
+        0x0A, 0x04, 0x9A, 0x6D, 0x72, 0x70, 0xCF, 0x58, 0x18, 0xC2, 0x0C, 0xB6, 0x1A, 0xB6, 0x88, 0xA7,
+        0x98, 0xC7, 0x48, 0x7E, 0xFD, 0x1A, 0xD5, 0x60, 0xFE, 0xD0, 0xFE, 0x5E, 0xBF, 0xEF, 0x04, 0x3D,
+        0x65, 0xB5, 0x52, 0xBD, 0x61, 0x3C, 0x6F, 0x20, 0xF5, 0xB1, 0xB0, 0x83, 0x04, 0x79, 0x60, 0xF7,
+        0xF0, 0x4C, 0x05, 0xBC, 0x8C, 0x52, 0x47, 0x19, 0x50, 0x4D, 0xC2, 0x04, 0x8F, 0xED, 0xF9, 0x5D,
+        0x19, 0x2E, 0x2A, 0x09, 0x39, 0x6D, 0x12, 0xF4, 0xBA, 0x4A, 0x83, 0x97, 0x56, 0x2B, 0xFA, 0x2D,
+        0x9B, 0x17, 0xE2, 0x6A, 0x32, 0xB0, 0xD7, 0x37, 0x04, 0x75, 0xC7, 0x85, 0xB0, 0x96, 0x5B, 0xFF,
+        0x41, 0xAD, 0x6B, 0x6F, 0xDF, 0x84, 0xF1, 0x4C, 0x00, 0x80, 0x6E, 0xB3, 0x1B, 0x39, 0xED, 0x91,
+        0xB8, 0x3E, 0x3B, 0x10, 0x39, 0x04, 0xBC, 0xD6, 0x0C, 0x0A, 0x8A, 0x4E, 0x24, 0x23, 0x3A, 0xCA,
+        0x6D, 0xBD, 0xC2, 0x0B, 0xB4, 0x0E, 0x27, 0x1A, 0x04, 0x77, 0x5E, 0xB3, 0x4A, 0xD6, 0xFD, 0x0F,
+        0xBF, 0xC5, 0x04, 0x85, 0x22, 0x46, 0x75, 0x9A, 0xC5, 0x19, 0x7A, 0xBF, 0x6B, 0x5E, 0x9F, 0x42,
+        0x6B, 0x5E, 0xF9, 0x58, 0x86, 0x1C, 0x3C, 0x56, 0xB4, 0x43, 0xB5, 0x87, 0xA2, 0x90, 0x2A, 0x04,
+        0x98, 0xF4, 0x0C, 0x29, 0x68, 0xB2, 0xD2, 0x9B, 0x26, 0x6D, 0xA1, 0x8C, 0x98, 0x0F, 0x77, 0xB6,
+        0x30, 0x5D, 0x34, 0x9D, 0x68, 0xC7, 0x46, 0xF2, 0x69, 0x76, 0x99, 0xC6, 0x04, 0x3D, 0xD1, 0xE1,
+        0x8F, 0xFF, 0x14, 0x9E, 0xA9, 0x08, 0xCA, 0x64, 0x46, 0x3D, 0xC1, 0x76, 0x1E, 0xE4, 0x38, 0x99,
+        0x06, 0xCC, 0x14, 0xC4, 0xF9, 0x17, 0x71, 0x86, 0x27, 0x04, 0x61, 0x05, 0x3B, 0x38, 0x9F, 0x6D,
+        0xCC, 0xA4, 0x09, 0xC4, 0xCD, 0xEC, 0x9C, 0x71, 0x4B, 0xF8, 0x89, 0xFA, 0x77, 0x37, 0xB3, 0x8A,
+        0x76, 0x4D, 0xB0, 0xB4, 0x0E, 0xB6, 0x04, 0x79, 0xE5, 0x89, 0x1D, 0x49, 0x0C, 0xD0, 0xBF, 0x95,
+        0x3A, 0xB2, 0x87, 0xB6, 0xF1, 0x6F, 0x04, 0xC2, 0xBD, 0xA9, 0xE3, 0x1C, 0x86, 0xB3, 0xAF, 0xF0,
+        0xB2, 0xB1, 0x05, 0x04, 0x55, 0xF5, 0x74, 0x26, 0xB8, 0x09, 0x66, 0x52, 0xBF, 0x0A, 0x57, 0x17,
+        0x25, 0xFB, 0x57, 0x5A, 0xE3, 0x76, 0x6D, 0x6C, 0x05, 0x4D, 0xC2, 0xF8, 0x55, 0x4D, 0xCD, 0x04,
+        0x04, 0x5C, 0x84, 0x17, 0x0D, 0x18, 0x03, 0x66, 0x99, 0xA8, 0xBE, 0x22, 0x12, 0x7A, 0xA2, 0x3F,
+        0x04, 0x56, 0x8C, 0xA0, 0x24, 0x14, 0x1A, 0xEF, 0xBB, 0xDD, 0xFC, 0x7E, 0x95, 0x04, 0x56, 0xAA,
+        0x30, 0xE4, 0xD6, 0xAA, 0x8C, 0x16, 0xF2, 0xB3, 0x18, 0xC3, 0xD6, 0x78, 0x73, 0x79, 0x24, 0xAD,
+        0x86, 0x5A, 0xEE, 0x76, 0xD1, 0x25, 0x36, 0x8C, 0x46, 0xB9, 0x04, 0x1C, 0x8E, 0xDA, 0xA9, 0x20,
+        0x50, 0x60, 0x68, 0xA0, 0xDE, 0x75, 0x88, 0x05, 0x65, 0x66, 0xBA, 0xBE, 0xE1, 0x0F, 0x0F, 0x29,
+        0x0B, 0xA4, 0x16, 0x15, 0xF6, 0x1E, 0xD8, 0x04, 0x38, 0xCC, 0xB2, 0x10, 0x1C, 0x23, 0xC7, 0x44,
+        0xAF, 0x14, 0x12, 0x7A, 0x73, 0x39, 0x71, 0xAA, 0x84, 0xF3, 0x1A, 0x27, 0x79, 0xC6, 0xEC, 0xFE,
+        0xB0, 0x6A, 0xBB, 0x6C, 0x04, 0xCF, 0x12, 0x0E, 0x0B, 0x42, 0x90, 0x58, 0xDF, 0x4C, 0x6E, 0xAE,
+        0x07, 0x20, 0x82, 0xA4, 0x59, 0x2F, 0x9E, 0xE7, 0x5D, 0x53, 0xDC, 0x11, 0x9A, 0xA6, 0x4B, 0x00,
+        0x29, 0x04, 0x48, 0x94, 0xD4, 0x80, 0x31, 0xBC, 0x8C, 0xA0, 0xA5, 0xE5, 0x1E, 0xAD, 0xBC, 0x57,
+        0x76, 0x7E, 0x1A, 0x9F, 0x4B, 0xE4, 0x0C, 0xA5, 0x51, 0xDE, 0xD3, 0x38, 0xBB, 0xE9, 0x04, 0x83,
+        0xEB, 0x0C, 0x6D, 0x01, 0x35, 0x4B, 0x3F, 0xF9, 0xC6, 0xE6, 0xAD, 0xA9, 0xA2, 0x6C, 0xDD, 0xBF,
+        0x95, 0x08, 0xA2, 0x63, 0x53, 0x8C, 0x27, 0x2E, 0x4B, 0xE5, 0xF7, 0x04, 0x2F, 0x5B, 0xBD, 0x28,
+        0xD3, 0xAA, 0xDF, 0xBC, 0x73, 0xBE, 0x1E, 0x8A, 0x96, 0xFD, 0x2B, 0x81, 0x0E, 0xB3, 0x14, 0x49,
+        0x8F, 0xE8, 0xF5, 0xD6, 0x18, 0x3E, 0x0D, 0x71, 0x04, 0x28, 0xC6, 0x6F, 0x2B, 0xA9, 0x1A, 0xD2,
+        0x10, 0x09, 0x3F, 0xFB, 0xC1, 0x95, 0x51, 0x09, 0x3F, 0xEA, 0xC8, 0x85, 0x02, 0x36, 0xE7, 0x89,
+        0x3C, 0x03, 0x7E, 0xA6, 0xB3, 0x04, 0xBD, 0xCB, 0xDA, 0x66, 0x13, 0xBF, 0xAE, 0x75, 0xAC, 0x11,
+        0xD5, 0x5E, 0x26, 0x10, 0xC0, 0xC3, 0xE5, 0x8C, 0xD2, 0xCB, 0xC6, 0xEA, 0x14, 0x04, 0xEE, 0x12,
+        0x92, 0x77, 0x04, 0x45, 0xEF, 0x8B, 0x67, 0xC5, 0x83, 0x9A, 0xBA, 0x43, 0x12, 0x50, 0x12, 0xB6,
+        0x49, 0x3E, 0xE5, 0x66, 0x2D, 0x3A, 0xC9, 0x74, 0x56, 0xB2, 0x31, 0xB6, 0xDF, 0x23, 0xFB, 0x04,
+        0x30, 0x2B, 0xC2, 0x3A, 0x1B, 0x0F, 0x22, 0xFB, 0x7B, 0xF8, 0x23, 0xC4, 0xDA, 0x00, 0x5B, 0x5C,
+        0x18, 0xAA, 0x34, 0x95, 0x04, 0x9D, 0xFF, 0xFC, 0x3C, 0x28, 0x58, 0x26, 0x04, 0x26, 0xF0, 0xB2,
+        0xA7, 0xB6, 0xE1, 0x6A, 0xC9, 0x70, 0xCD, 0xED, 0x2C, 0xAE, 0xA2, 0xA5, 0x7D, 0xC8, 0x4B, 0x13,
+        0x30, 0x27, 0x47, 0xB8, 0xFD, 0x7D, 0x84, 0xB1, 0xC6, 0x04, 0x96, 0xD9, 0xD3, 0xD7, 0xA1, 0x41,
+        0xDB, 0x2B, 0xA8, 0x12, 0x5A, 0x5F, 0xDE, 0xFD, 0x0F, 0x36, 0x32, 0x44, 0x85, 0x23, 0x39, 0x91,
+        0x17, 0x77, 0x93, 0x8A, 0x86, 0xF9, 0x04, 0xDA, 0x34, 0xE4, 0xEF, 0xBF, 0x9C, 0x0A, 0xE5, 0x77,
+        0x0C, 0x33, 0x99, 0x63, 0x62, 0x2F, 0xD1, 0x62, 0x22, 0xEB, 0x92, 0xAD, 0x71, 0x0D, 0x57, 0xF8,
+        0x1E, 0x8F, 0x12, 0x04, 0x62, 0x0D, 0x32, 0xEB, 0xB3, 0x7D, 0xE7, 0xF1, 0x2D, 0xF3, 0x2B, 0x8E,
+        0x06, 0xB2, 0x58, 0x42, 0x8F, 0x97, 0xC6, 0x13, 0x8E, 0x19, 0xA9, 0x56, 0xA1, 0x99, 0x6F, 0xAA,
+        0x04, 0x2D, 0x6B, 0xBD, 0xD4, 0x20, 0x74, 0x28, 0xD6, 0x51, 0x00, 0xDD, 0xD3, 0xF8, 0x07, 0x98,
+        0x1F, 0x48, 0x6E, 0xD9, 0x4A, 0x80, 0x0F, 0x08, 0x5C, 0x78, 0x71, 0xE5, 0xF1, 0x04, 0xAF, 0xEA,
+        0x48, 0x3F, 0x6F, 0x96, 0xB4, 0x7A, 0xD3, 0x9E, 0x20, 0x02, 0xC4, 0x4E, 0x68, 0xB6, 0x8F, 0x1F,
+        0xDA, 0x5E, 0xFC, 0xEF, 0xCA, 0x67, 0xD1, 0xBA, 0x2C, 0x2B, 0x04, 0x1C, 0xE3, 0xC2, 0xB3, 0xB4,
+        0x35, 0xA0, 0xB8, 0xCA, 0x52, 0x24, 0x81, 0xBB, 0x25, 0x03, 0x2C, 0x5A, 0x22, 0x24, 0x8C, 0x95,
+        0x77, 0xD0, 0xB0, 0xA6, 0x3B, 0x3D, 0x8B, 0x04, 0x8D, 0x83, 0xB8, 0x4C, 0x1D, 0x5E, 0xF8, 0xF6,
+        0x3C, 0xA9, 0xA1, 0x5B, 0x8C, 0x7B, 0xAC, 0xEE, 0x29, 0x77, 0x0A, 0xB5, 0xA1, 0x49, 0x1A, 0xE8,
+        0x9B, 0x26, 0x11, 0xA8, 0x04, 0x13, 0x90, 0x4B, 0x69, 0x1A, 0x39, 0x5F, 0x45, 0xA4, 0x36, 0x2C,
+        0x5E, 0xDE, 0xDD, 0xAA, 0xCE, 0x46, 0x61, 0xC8, 0xE1, 0xC6, 0x62, 0x82, 0x53, 0x2F, 0x9D, 0x4D,
+        0x31, 0x04, 0x32, 0x1F, 0x32, 0x68, 0x60, 0x07, 0xD6, 0x2C, 0x3E, 0x8B, 0x1F, 0x91, 0x01, 0x6E,
+        0x67, 0x6A, 0x3C, 0x70, 0x99, 0x54, 0xEB, 0x70, 0x6B, 0xCB, 0x94, 0xA2, 0x8A, 0xC1, 0x04, 0x68,
+        0x43, 0xD7, 0xAC, 0x6C, 0xA5, 0x4F, 0x84, 0x35, 0xE7, 0x32, 0xFA, 0x10, 0xA1, 0xA9, 0xE4, 0xBB,
+        0xD7, 0xDF, 0x56, 0x33, 0x51, 0xF5, 0x1D, 0xE4, 0xC5, 0xAD, 0xC5, 0x04, 0x09, 0x3D, 0x95, 0x99,
+        0xFC, 0xC5, 0xAB, 0x9C, 0x12, 0x42, 0x1C, 0xD6, 0x47, 0x03, 0x34, 0xA1, 0x6D, 0x4A, 0x4F, 0xC0,
+        0x45, 0x91, 0xF0, 0xF2, 0x64, 0x65, 0xB4, 0xAE, 0x04, 0xB2, 0x4A, 0xF9, 0x78, 0xAA, 0xBB, 0x4C,
+        0x85, 0x57, 0x8F, 0x46, 0xD8, 0x08, 0x92, 0x9B, 0x89, 0x26, 0xE8, 0x26, 0xDA, 0x4B, 0x39, 0x00,
+        0x2D, 0x6D, 0xC6, 0xE7, 0x93, 0x04, 0xCF, 0xD1, 0x64, 0x05, 0xFF, 0xDC, 0x39, 0x90, 0x4E, 0xF1,
+        0x79, 0x0B, 0x3E, 0xF9, 0x52, 0x17, 0x49, 0x04, 0x69, 0xA7, 0xCF, 0x8B, 0xE6, 0x1A, 0xC6, 0xB4,
+        0xF3, 0xD1, 0x04, 0xA4, 0xAB, 0xFB, 0x00, 0x7D, 0xA8, 0x12, 0x72, 0x61, 0xA3, 0x9B, 0x72, 0x27,
+        0x08, 0x29, 0xDA, 0x74, 0xFB, 0xFE, 0x3F, 0xE2, 0x7A, 0xCD, 0x5C, 0x15, 0xAD, 0x84, 0xAA, 0x04,
+        0x5F, 0xEC, 0x87, 0x52, 0x66, 0x15, 0x5C, 0x6E, 0xBF, 0x0E, 0x47, 0x9B, 0xBF, 0x96, 0x55, 0x6C,
+        0x0A, 0x10, 0x95, 0xF3, 0xD6, 0x2D, 0xEE, 0x20, 0x0B, 0x9D, 0x69, 0x38, 0x04, 0xA4, 0x23, 0xB4,
+        0x21, 0xA7, 0xCA, 0x4E, 0x70, 0x7C, 0xC9, 0x8D, 0x5C, 0xA5, 0x13, 0x87, 0x35, 0xA0, 0x1E, 0x3D,
+        0xE2, 0x0C, 0xCE, 0x0B, 0xAE, 0x34, 0xAA, 0xEB, 0x27, 0x04, 0xB0, 0x01, 0x22, 0x63, 0xB0, 0xF0,
+        0x1D, 0x96, 0x4A, 0x45, 0x2C, 0xA9, 0x99, 0x53, 0x1D, 0x1D, 0x6E, 0x96, 0xC1, 0x3A, 0xFB, 0xEE,
+        0xBB, 0x7B, 0xC9, 0xC3, 0xB8, 0x5F, 0x04, 0x24, 0x36, 0x21, 0xC5, 0x5B, 0x84, 0x22, 0x46, 0x43,
+        0xE1, 0xB8, 0x6F, 0x21, 0x71, 0x9E, 0xA1, 0xC4, 0xE4, 0x26, 0xC6, 0x96, 0xE1, 0x17, 0x2A, 0xFA,
+        0xCC, 0xA5, 0x47, 0x04, 0x61, 0x6D, 0x83, 0xF0, 0x28, 0xB3, 0xF9, 0x65, 0x15, 0x4D, 0x67, 0xCA,
+        0x53, 0x14, 0x12, 0xEF, 0xEE, 0xC7, 0x9A, 0xC2, 0xD5, 0x87, 0x7F, 0xFE, 0x8A, 0x84, 0x85, 0x81,
+        0x04, 0xD9, 0xE7, 0x54, 0x28, 0x22, 0x8B, 0x2F, 0xF2, 0xA2, 0x37, 0x0F, 0x84, 0xE4, 0x1C, 0x9C,
+        0x38, 0x09, 0x2B, 0xBE, 0x17, 0x2B, 0x41, 0xA4, 0x78, 0x44, 0xA9, 0x1A, 0x21, 0x04, 0x15, 0xB6,
+        0x0F, 0xD5, 0x42, 0xB1, 0xF5, 0x67, 0x40, 0xF1, 0x54, 0x68, 0x12, 0xA9, 0xB3, 0xBB, 0xCC, 0xB1,
+        0x52, 0xF7, 0xC8, 0xA1, 0xF2, 0x82, 0x07, 0x91, 0x47, 0x8C, 0x04, 0xCB, 0xE5, 0x06, 0x10, 0x15,
+        0xD3, 0x72, 0x6C, 0x93, 0xD1, 0x81, 0x0E, 0x33, 0x7D, 0x5A, 0xC6, 0x2B, 0x57, 0x2B, 0x38, 0xFD,
+        0xF3, 0x24, 0x9E, 0x34, 0x4B, 0x95, 0x60, 0x04, 0xC6, 0xF0, 0x0E, 0x4C, 0x49, 0x3F, 0x1C, 0xA4,
+        0x26, 0xE0, 0xD4, 0x4E, 0x85, 0xD5, 0x7A, 0xE2, 0x29, 0x8F, 0xE7, 0xE6, 0xD3, 0x0C, 0xDB, 0xEF,
+        0x79, 0xDD, 0xC1, 0x71, 0x04, 0x35, 0xBB, 0x1E, 0xB4, 0x0C, 0xA5, 0xD0, 0xB7, 0x01, 0xE3, 0xE4,
+        0x10, 0x71, 0x82, 0x20, 0x28, 0xA2, 0x30, 0x5F, 0x77, 0x43, 0xD9, 0x90, 0xAA, 0xCD, 0x6B, 0xE0,
+        0xDB, 0x04, 0x77, 0x28, 0x97, 0x13, 0x91, 0x04, 0xF1, 0x58, 0xDD, 0x62, 0x1D, 0xF4, 0xE7, 0xC5,
+        0x7C, 0xFF, 0x47, 0x0A, 0x2F, 0xA5, 0x13, 0xA6, 0xD9, 0x48, 0xF0, 0xFA, 0x63, 0x52, 0x04, 0x1E,
+        0x5A, 0xD7, 0x2F, 0x02, 0x2D, 0x2E, 0xAC, 0x55, 0x1F, 0x5E, 0x64, 0x07, 0x78, 0x70, 0xB9, 0x6A,
+        0xA0, 0xC4, 0x55, 0x44, 0x71, 0x04, 0x99, 0x8C, 0xD9, 0x43, 0x00, 0x04, 0x88, 0x57, 0xF7, 0xA6,
+        0x51, 0x15, 0xD2, 0x0D, 0xEC, 0x26, 0xB1, 0x28, 0xA4, 0x3F, 0x38, 0x4A, 0x40, 0xE7, 0x9D, 0x81,
+        0x52, 0x62, 0x72, 0x74, 0xC8, 0xEE, 0x05, 0xF7, 0x04, 0xC7, 0x57, 0x78, 0xE6, 0x05, 0x9D, 0x07,
+        0xD7, 0x2B, 0xC3, 0x8D, 0xCC, 0x98, 0x12, 0x63, 0x5C, 0x67, 0x74, 0xF7, 0x2F, 0x91, 0x3B, 0xE3,
+        0x4A, 0x88, 0x94, 0x3A, 0xC3, 0x04, 0xBF, 0xB1, 0x62, 0xAE, 0xAD, 0x55, 0xA7, 0x26, 0x77, 0xB2,
+        0x12, 0x16, 0x1C, 0xAF, 0xC5, 0x8A, 0x6B, 0x75, 0x43, 0x08, 0x9B, 0x22, 0x88, 0x8A, 0xF7, 0xEE,
+        0xF6, 0x42, 0x04, 0xC5, 0xD7, 0xA3, 0x98, 0x64, 0x33, 0x5B, 0x5E, 0x61, 0x51, 0xCE, 0x61, 0x58,
+        0x6D, 0xB6, 0x2B, 0x82, 0xEB, 0xB0, 0xDD, 0x67, 0xED, 0xE2, 0xE4, 0xB5, 0xDD, 0x54, 0xC1, 0x04,
+        0xB1, 0x6C, 0x79, 0x2D, 0xD1, 0xA9, 0x55, 0x77, 0xB8, 0x3B, 0x7A, 0xBD, 0xE0, 0x0F, 0x7C, 0xAE,
+        0x35, 0x70, 0xAC, 0x17, 0x78, 0x24, 0x85, 0xB7, 0x86, 0xAF, 0xE7, 0x32, 0x04, 0x53, 0x9C, 0xB8,
+        0x86, 0xF4, 0x15, 0xC4, 0x5E, 0x63, 0x55, 0xE8, 0xA9, 0x75, 0xD1, 0xDA, 0x4C, 0x5E, 0x66, 0xB5,
+        0x46, 0x2E, 0xB4, 0x4E, 0x77, 0x64, 0x57, 0xA1, 0x81, 0x04, 0x8A, 0xBD, 0x64, 0x5E, 0x89, 0x4D,
+        0xB5, 0xD0, 0x5C, 0xF9, 0xB6, 0x6E, 0xA9, 0xF2, 0x28, 0x23, 0x1B, 0x4F, 0x5D, 0xDF, 0xEF, 0xAB,
+        0x4F, 0x20, 0x9D, 0xC9, 0x98, 0xFD, 0x04, 0x43, 0x9E, 0x3D, 0x90, 0x7E, 0x56, 0xE5, 0x45, 0x07,
+        0x77, 0x57, 0x6A, 0x3D, 0x33, 0x06, 0xB5, 0xDB, 0x7A, 0x12, 0x63, 0x59, 0xD6, 0x92, 0x7A, 0x8E,
+        0x4E, 0x52, 0x2F, 0x04, 0xCE, 0x5D, 0xE6, 0x80, 0x5C, 0x4A, 0xF1, 0x3C, 0xDE, 0x88, 0xA8, 0x2D,
+        0x2A, 0x92, 0x18, 0xBC, 0x09, 0xB0, 0x98, 0xAE, 0xE9, 0x48, 0x18, 0x0C, 0x90, 0x30, 0xEB, 0xF7,
+        0x04, 0xA3, 0x04, 0xFD, 0xD3, 0x25, 0xDB, 0x4C, 0x04, 0xDD, 0xD9, 0x8A, 0xEB, 0xA5, 0x73, 0xC2,
+        0x54, 0x11, 0xB4, 0xB0, 0xE9, 0x51, 0x67, 0x12, 0x1D, 0x72, 0xC8, 0x64, 0xAA, 0x04, 0xA5, 0x66,
+        0xD0, 0xFD, 0xC1, 0xBB, 0x0E, 0x72, 0x62, 0x76, 0x72, 0xFC, 0xEE, 0x9F, 0xA9, 0x18, 0x40, 0xC7,
+        0xFF, 0xA9, 0x3A, 0xCF, 0x23, 0x06, 0xF9, 0x44, 0xDE, 0x16, 0x04, 0xB1, 0x84, 0x86, 0x80, 0xE3,
+        0xB2, 0xF2, 0x3D, 0xCD, 0x24, 0x83, 0xAF, 0x39, 0xDC, 0x65, 0x40, 0x80, 0x9E, 0xA4, 0x30, 0xF1,
+        0xFE, 0x85, 0x47, 0x4D, 0xA5, 0x2E, 0xD4, 0x04, 0x3D, 0x19, 0x61, 0x3C, 0x8E, 0xC0, 0xAE, 0x3A,
+        0xF8, 0xB2, 0x2F, 0xB5, 0x66, 0x89, 0x62, 0x46, 0xE6, 0x30, 0x68, 0x39, 0xEE, 0x40, 0x7F, 0x7C,
+        0x63, 0x00, 0xA4, 0xC2, 0x04, 0xC8, 0xDF, 0x9E, 0x5D, 0x16, 0xAB, 0xA3, 0x5D, 0x59, 0xB6, 0x52,
+        0xF5, 0x43, 0x09, 0xBB, 0x63, 0xDC, 0xC8, 0xB1, 0x83, 0x8F, 0x9B, 0xCC, 0x40, 0x7A, 0xDC, 0xCA,
+        0x2C, 0x04, 0xB0, 0xBB, 0x94, 0xD0, 0xE8, 0xA6, 0x82, 0x02, 0x34, 0xA8, 0xD3, 0xE1, 0x56, 0x73,
+        0x0D, 0xAC, 0x08, 0x39, 0xCA, 0x62, 0x29, 0x05, 0xE8, 0x34, 0xF0, 0x78, 0x8B, 0x5C, 0x04, 0x67,
+        0x70, 0x49, 0xB2, 0x3A, 0xEB, 0xA9, 0x45, 0x73, 0xE6, 0x2C, 0xCF, 0x90, 0x79, 0xBA, 0xB3, 0x7B,
+        0x3A, 0x3F, 0x47, 0x86, 0xF4, 0x86, 0x4E, 0x9D, 0x91, 0x4E, 0x5C, 0x04, 0xB2, 0x06, 0xB5, 0xD3,
+        0x32, 0xF2, 0xD9, 0x62, 0xD1, 0x13, 0x37, 0x72, 0xD2, 0xF6, 0x12, 0x6B, 0xFB, 0x7F, 0x30, 0x94,
+        0xC8, 0x7E, 0x88, 0xB1, 0x92, 0x8D, 0xA0, 0xCF, 0x04, 0x10, 0x0C, 0x59, 0x72, 0x23, 0x31, 0x13,
+        0x79, 0x75, 0x3E, 0xF0, 0x85, 0xB7, 0x76, 0xA4, 0x51, 0xBA, 0xB4, 0x08, 0x1B, 0x48, 0xF7, 0xA5,
+        0x6A, 0x01, 0xB5, 0xDD, 0x1E, 0x04, 0x56, 0xEA, 0x2D, 0xF7, 0xBD, 0x49, 0x9A, 0x3B, 0xD6, 0x7E,
+        0x3B, 0x98, 0x1B, 0x39, 0x8B, 0xB7, 0x8A, 0x84, 0xA9, 0xCF, 0x27, 0xAB, 0x9F, 0x9C, 0x96, 0xAF,
+        0xF8, 0xAB, 0x04, 0xAB, 0xFD, 0xF3, 0x63, 0xAC, 0xF0, 0xDA, 0x39, 0x65, 0x4E, 0xD4, 0x31, 0x18,
+        0x79, 0x48, 0x52, 0xD4, 0x34, 0x2F, 0x46, 0xB2, 0x95, 0x4C, 0x6D, 0x25, 0x7B, 0x09, 0xFA, 0x04,
+        0x48, 0x51, 0xAC, 0xDF, 0x71, 0x58, 0x81, 0x3A, 0x93, 0x51, 0x92, 0x26, 0xA7, 0x49, 0x0F, 0x0C,
+        0x04, 0x91, 0xD1, 0xE9, 0x1D, 0x2B, 0x03, 0x7F, 0x66, 0xFE, 0x17, 0xC7, 0x04, 0x86, 0x47, 0x8D,
+        0x42, 0x13, 0x99, 0xD2, 0xD0, 0x88, 0xFD, 0xFF, 0xF4, 0xCF, 0x44, 0x7A, 0xB1, 0x36, 0xD8, 0x46,
+        0xC7, 0xC6, 0x22, 0x00, 0x22, 0x3B, 0xB2, 0xBF, 0xC9, 0x04, 0xB7, 0xD1, 0x20, 0xE8, 0xA9, 0x45,
+        0x70, 0x02, 0x7A, 0x8F, 0x5A, 0x85, 0xA3, 0xF1, 0xD8, 0x37, 0xF5, 0x14, 0xBD, 0xB2, 0x13, 0xD0,
+        0xC6, 0x03, 0xBB, 0xCA, 0x19, 0x5D, 0x04, 0x9D, 0xD2, 0xAF, 0xC1, 0x5F, 0x39, 0xF6, 0x93, 0x1B,
+        0x97, 0x65, 0x82, 0x99, 0xEA, 0x2C, 0xEA, 0xB9, 0x1F, 0xAE, 0x22, 0x13, 0x7C, 0xB2, 0xD7, 0x2C,
+        0x43, 0x5B, 0x44, 0x04, 0x8A, 0xD2, 0xF3, 0x28, 0x79, 0x91, 0x4B, 0x12, 0x4A, 0x51, 0x30, 0x37,
+        0x57, 0xE3, 0x30, 0x5C, 0xEC, 0xBB, 0x60, 0xE4, 0x19, 0xA2, 0xFF, 0x9E, 0xB8, 0xBE, 0x08, 0x75,
+        0x04, 0x63, 0x55, 0x87, 0xFB, 0x0F, 0xFF, 0x20, 0x82, 0x7D, 0x08, 0x2D, 0x1A, 0x1C, 0x80, 0x60,
+        0xFC, 0xB8, 0x40, 0x06, 0x93, 0xAD, 0x47, 0xEB, 0x2D, 0xDD, 0xE7, 0xE7, 0x95, 0x04, 0xCD, 0xD5,
+        0x2C, 0xEF, 0x4B, 0x5D, 0x17, 0x4E, 0xAA, 0x05, 0xA5, 0x25, 0x8B, 0x33, 0x2B, 0x7A, 0x41, 0x4B,
+        0x8B, 0xC5, 0x9A, 0x63, 0x58, 0xA6, 0xAF, 0x31, 0x7F, 0x12, 0x04, 0x85, 0x81, 0x93, 0x66, 0x07,
+        0x75, 0x55, 0xB7, 0xF0, 0x11, 0xEA, 0xF6, 0xAB, 0x61, 0xCE, 0x12, 0x71, 0xE4, 0x66, 0xB2, 0x00,
+        0x7F, 0x98, 0x6A, 0x6F, 0xF8, 0x47, 0xBA, 0x04, 0x81, 0x5B, 0x84, 0xD0, 0xBD, 0xCE, 0x96, 0xBA,
+        0x33, 0xC8, 0x24, 0xF4, 0xA5, 0xA2, 0x20, 0xC3, 0x0B, 0x82, 0x91, 0xEB, 0x3B, 0x5C, 0xCA, 0x6B,
+        0x69, 0xF8, 0xC5, 0x57, 0x04, 0xB6, 0xEF, 0x87, 0x3A, 0x50, 0x69, 0xF3, 0xE7, 0x39, 0x8D, 0x6B,
+        0x8A, 0xD2, 0x6C, 0x30, 0x84, 0xA5, 0x0F, 0x1C, 0x70, 0x18, 0x37, 0xDA, 0xB9, 0x03, 0x35, 0x57,
+        0x43, 0x04, 0xB8, 0x0D, 0x11, 0xFC, 0x1B, 0x5A, 0xA7, 0x60, 0xDC, 0xCA, 0x2E, 0x85, 0x13, 0xAD,
+        0x49, 0x47, 0xAE, 0xFC, 0x08, 0x4A, 0xBE, 0xCE, 0xFC, 0x7F, 0xF5, 0x83, 0x24, 0xF3, 0x04, 0x5D,
+        0x04, 0x1C, 0x72, 0xDE, 0xF0, 0xD3, 0xE5, 0xD2, 0x97, 0xF1, 0x26, 0x09, 0x7C, 0x4C, 0x72, 0x2A,
+        0x75, 0x74, 0x9F, 0x5C, 0xEC, 0xC6, 0xCE, 0x36, 0xBA, 0xC6, 0x67, 0x04, 0xDB, 0x44, 0xE1, 0xC4,
+        0x2F, 0xDF, 0x38, 0xA5, 0x40, 0xD4, 0xD8, 0x9E, 0x8E, 0xE4, 0x91, 0xE7, 0x26, 0x3B, 0xC3, 0x15,
+        0x63, 0xF2, 0x81, 0x9D, 0x02, 0xFF, 0xEA, 0x4C, 0x04, 0x35, 0x61, 0xDB, 0xBB, 0xC9, 0x85, 0x83,
+        0x4C, 0x0F, 0x29, 0x15, 0x27, 0xBA, 0xA2, 0x11, 0x00, 0x2E, 0x19, 0xDA, 0x4F, 0x65, 0x31, 0xC5,
+        0x4A, 0x0E, 0xD8, 0x0E, 0x1C, 0x04, 0x37, 0x8A, 0x9B, 0xAE, 0xA4, 0x49, 0x01, 0x75, 0x11, 0xE5,
+        0xF6, 0x1A, 0x6F, 0x22, 0xCB, 0xFE, 0xAA, 0x3C, 0xEE, 0xEC, 0x28, 0xA6, 0x0B, 0x2C, 0x2F, 0x0D,
+        0xF9, 0xA5, 0x04, 0x7E, 0xB8, 0x09, 0x5C, 0x90, 0x99, 0x2F, 0x6C, 0x6C, 0xBE, 0x56, 0xE6, 0xF9,
+        0x46, 0x50, 0x30, 0x93, 0xA7, 0x0F, 0x89, 0x68, 0x87, 0xC3, 0xF8, 0x5F, 0x96, 0x7D, 0x1C, 0x04,
+        0x4D, 0xD2, 0x1C, 0x69, 0x5D, 0x1A, 0xDB, 0x60, 0x8D, 0x92, 0xDE, 0xBB, 0x66, 0xD9, 0xA0, 0x04,
+        0xCE, 0x07, 0x31, 0xA1, 0x32, 0x4A, 0xBA, 0xF8, 0xAA, 0x1D, 0xE3, 0x09, 0x04, 0x46, 0xDC, 0x7D,
+        0x76, 0x21, 0x70, 0xE8, 0x36, 0xD8, 0xCF, 0xB7, 0x2A, 0x1E, 0xEB, 0x06, 0x59, 0x50, 0x5A, 0x6D,
+        0x3C, 0xB9, 0xC9, 0x19, 0x9F, 0x34, 0x90, 0x17, 0x86, 0x04, 0x6E, 0x7C, 0x40, 0xB9, 0x5F, 0x8B,
+        0x9E, 0x25, 0xF4, 0x55, 0x0F, 0xC8, 0x9C, 0x49, 0x6B, 0x8E, 0x22, 0xB7, 0xFC, 0x14, 0xD8, 0x1F,
+        0x05, 0xDD, 0x2F, 0x08, 0xD8, 0xC3, 0x04, 0xCB, 0x7B, 0x08, 0x11, 0x56, 0xE8, 0xFA, 0x2B, 0xC5,
+        0xAB, 0x5E, 0x34, 0x73, 0xCD, 0x7C, 0xFA, 0xE8, 0xD8, 0x16, 0x21, 0xCC, 0xBC, 0xE8, 0xD4, 0x20,
+        0xAF, 0x20, 0x0E, 0x04, 0x46, 0x60, 0xE7, 0x0E, 0x7E, 0xE2, 0xBE, 0xEF, 0xAD, 0x5B, 0xA1, 0xFE,
+        0xDD, 0xCE, 0x9E, 0x2B, 0x7F, 0x69, 0x37, 0xD2, 0x8D, 0x2F, 0xB1, 0xA9, 0x25, 0xBB, 0x95, 0x3E,
+        0x04, 0x4A, 0x4C, 0x3F, 0x51, 0xAD, 0xA1, 0x86, 0xA6, 0x11, 0xC6, 0x71, 0x60, 0x0C, 0x5A, 0x9F,
+        0xCB, 0xA9, 0x0F, 0x6A, 0x21, 0x23, 0xD7, 0x6B, 0xB8, 0x63, 0x78, 0xAD, 0x4C, 0x04, 0x0A, 0xFA,
+        0xA5, 0xEB, 0x7F, 0x2C, 0x2D, 0x42, 0x54, 0x83, 0x60, 0x9C, 0x76, 0xD0, 0x5C, 0x6E, 0xBE, 0xE3,
+        0x51, 0x1F, 0x57, 0xAB, 0xD6, 0x4C, 0xDE, 0xDB, 0x4C, 0x15, 0x04, 0x47, 0x89, 0x6D, 0xF9, 0x03,
+        0x25, 0xB4, 0x9F, 0x97, 0x27, 0x94, 0xA7, 0x01, 0x9B, 0x05, 0x96, 0x3B, 0x45, 0x9A, 0x8C, 0xA6,
+        0x5C, 0x64, 0x44, 0xDD, 0x86, 0x38, 0x59, 0x04, 0xC7, 0xFA, 0x84, 0x99, 0x33, 0x28, 0x97, 0x3F,
+        0x53, 0xB2, 0x42, 0x01, 0xFC, 0xE6, 0xBA, 0xB4, 0xBD, 0x75, 0xDD, 0x6F, 0xCE, 0x6E, 0x45, 0x7A,
+        0x24, 0x4E, 0xCA, 0xBC, 0x04, 0x89, 0xE0, 0xB0, 0xCA, 0x8D, 0x1F, 0x9A, 0x85, 0x16, 0x15, 0x1A,
+        0xD6, 0xC8, 0x40, 0x78, 0x1F, 0x73, 0xEA, 0xC4, 0xA8, 0x66, 0x4E, 0xA4, 0xDB, 0x37, 0x15, 0x62,
+        0x8B, 0x04, 0xDA, 0x55, 0xA8, 0xD9, 0x83, 0xD4, 0x77, 0x6F, 0xD8, 0x7F, 0x75, 0x63, 0x2D, 0x5D,
+        0x15, 0x00, 0xA9, 0xA2, 0xBB, 0xCE, 0xCD, 0xE3, 0xED, 0x66, 0x7C, 0xC1, 0xAD, 0xC0, 0x04, 0x67,
+        0xED, 0xD2, 0x6F, 0xFD, 0x35, 0x63, 0xB6, 0xD4, 0xCC, 0x3B, 0x88, 0x2C, 0x13, 0xBE, 0x6B, 0x76,
+        0x4C, 0x65, 0x2A, 0xE8, 0x74, 0xA6, 0xAC, 0x43, 0xD4, 0x82, 0x69, 0x04, 0x5F, 0x66, 0xEC, 0xC3,
+        0x58, 0x98, 0xB5, 0x78, 0x83, 0x77, 0x1C, 0x25, 0x32, 0xFE, 0x76, 0x6B, 0xD2, 0x72, 0x2C, 0xC2,
+        0x43, 0xC4, 0x17, 0xDB, 0x3C, 0x9D, 0xF7, 0x0F, 0x04, 0xDA, 0xED, 0x63, 0x4C, 0xF2, 0x75, 0xA8,
+        0x7A, 0xA7, 0x3A, 0x63, 0x94, 0xAA, 0x15, 0x0B, 0x51, 0x08, 0x6C, 0x7D, 0x52, 0xDC, 0xAD, 0xB4,
+        0xDB, 0x1A, 0x92, 0x70, 0x6A, 0x04, 0x25, 0x61, 0x8E, 0x34, 0x9C, 0x9F, 0x17, 0x63, 0xF3, 0x32,
+        0x26, 0xEB, 0x6F, 0xBB, 0x3E, 0xA8, 0xA8, 0x79, 0x06, 0xB0, 0x17, 0xB6, 0xEF, 0xDC, 0xE5, 0x9E,
+        0xE1, 0xE9
+    };
+    
+    const uint8_t SECP256K1_BASE_POINT_TABLE[] = {
+        0x04, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B,
+        0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17,
+        0x98, 0x48, 0x3A, 0xDA, 0x77, 0x26, 0xA3, 0xC4, 0x65, 0x5D, 0xA4, 0xFB, 0xFC, 0x0E, 0x11, 0x08,
+        0xA8, 0xFD, 0x17, 0xB4, 0x48, 0xA6, 0x85, 0x54, 0x19, 0x9C, 0x47, 0xD0, 0x8F, 0xFB, 0x10, 0xD4,
+        0xB8, 0x04, 0x8E, 0x7B, 0xCD, 0x0B, 0xD3, 0x59, 0x83, 0xA7, 0x71, 0x9C, 0xCA, 0x77, 0x64, 0xCA,
+        0x90, 0x67, 0x79, 0xB5, 0x3A, 0x04, 0x3A, 0x9B, 0x8B, 0xCA, 0xEF, 0xF9, 0x59, 0xF4, 0x3A, 0xD8,
+        0x60, 0x47, 0x10, 0xB7, 0x77, 0x0B, 0x2A, 0x3D, 0xA4, 0xB3, 0x94, 0x03, 0x10, 0x42, 0x0C, 0xA9,
+        0x51, 0x45, 0x79, 0xE8, 0x8E, 0x2E, 0x47, 0xFD, 0x68, 0xB3, 0xEA, 0x10, 0x04, 0x7E, 0x84, 0x60,
+        0x37, 0x2A, 0x04, 0xC0, 0xA6, 0x09, 0x72, 0x6D, 0x63, 0x28, 0xC6, 0x73, 0x92, 0xFE, 0x71, 0x01,
+        0x11, 0x0E, 0x1F, 0x78, 0x27, 0xCC, 0xD5, 0xA9, 0xB1, 0x73, 0x23, 0x74, 0x32, 0x86, 0x67, 0x1E,
+        0xD7, 0xEE, 0xE7, 0xFC, 0x24, 0xD5, 0xB7, 0xD6, 0x05, 0xC3, 0x01, 0x14, 0x5E, 0xE8, 0x0E, 0x5D,
+        0xB9, 0xBE, 0x3D, 0x8E, 0xDF, 0x3C, 0x26, 0x30, 0x3F, 0xB7, 0xE5, 0xC3, 0x75, 0x2C, 0x3E, 0xDC,
+        0x69, 0xE1, 0xCE, 0x04, 0xC7, 0x38, 0xC5, 0x6B, 0x03, 0xB2, 0xAB, 0xE1, 0xE8, 0x28, 0x1B, 0xAA,
+        0x74, 0x3F, 0x8F, 0x9A, 0x8F, 0x7C, 0xC6, 0x43, 0xDF, 0x26, 0xCB, 0xEE, 0x3A, 0xB1, 0x50, 0x24,
+        0x2B, 0xCB, 0xB8, 0x91, 0x89, 0x3F, 0xB5, 0x78, 0x95, 0x1A, 0xD2, 0x53, 0x7F, 0x71, 0x8F, 0x2E,
+        0xAC, 0xBF, 0xBB, 0xBB, 0x82, 0x31, 0x4E, 0xEF, 0x78, 0x80, 0xCF, 0xE9, 0x17, 0xE7, 0x35, 0xD9,
+        0x69, 0x9A, 0x84, 0xC3, 0x04, 0xBF, 0xC2, 0xD5, 0x55, 0xE4, 0xFF, 0xC1, 0x5C, 0x58, 0xEB, 0x23,
+        0xF6, 0x61, 0xA8, 0x46, 0x76, 0x91, 0x47, 0xA7, 0x64, 0xE5, 0xB9, 0xDA, 0x42, 0x9D, 0x39, 0xC3,
+        0xCD, 0xDC, 0x7B, 0xCF, 0x13, 0xB4, 0xA7, 0x86, 0x31, 0x55, 0x30, 0xFE, 0x36, 0xBC, 0x0A, 0xAA,
+        0x66, 0xC1, 0xBF, 0x08, 0xBE, 0x56, 0xEF, 0x4F, 0xBA, 0xDE, 0x12, 0x45, 0x64, 0x2A, 0x4A, 0x13,
+        0x24, 0x59, 0xB9, 0xBE, 0xC9, 0x04, 0x9B, 0xC2, 0x13, 0x01, 0x33, 0xE5, 0x99, 0xE0, 0x86, 0xD7,
+        0xAF, 0x29, 0x4A, 0x91, 0x07, 0x19, 0xB2, 0x0A, 0x8F, 0xF6, 0xD7, 0x3E, 0xE4, 0x4A, 0x3D, 0x67,
+        0xD1, 0x46, 0x9E, 0x41, 0xF1, 0x97, 0x9F, 0x33, 0x81, 0x2E, 0x75, 0x08, 0xC0, 0xE7, 0x6A, 0x7B,
+        0x55, 0x37, 0x7A, 0xA4, 0x9B, 0xEC, 0x0E, 0x8F, 0xDE, 0x54, 0x19, 0xC0, 0x14, 0x01, 0x10, 0xA2,
+        0x66, 0x0D, 0xEF, 0xBD, 0xE3, 0xD6, 0x04, 0x54, 0x1C, 0xCF, 0xEF, 0xA0, 0xFD, 0x5D, 0x71, 0x7C,
+        0xD0, 0x70, 0x90, 0xE4, 0xAB, 0x63, 0x20, 0x50, 0xD3, 0x57, 0xDD, 0xA4, 0x83, 0x05, 0x08, 0xBD,
+        0x42, 0x27, 0x67, 0x81, 0x18, 0xBF, 0x1D, 0xCE, 0xD8, 0x07, 0xC9, 0x55, 0xF5, 0x19, 0xA8, 0xAA,
+        0x4A, 0x3E, 0x84, 0xFB, 0x85, 0x5F, 0xF5, 0xF2, 0x51, 0x6E, 0x54, 0x88, 0x6E, 0x9F, 0x21, 0x90,
+        0x57, 0xBC, 0x09, 0xF6, 0xE4, 0x80, 0x13, 0x04, 0x4D, 0xF9, 0xC1, 0x49, 0x19, 0xCD, 0xE6, 0x1F,
+        0x6D, 0x51, 0xDF, 0xDB, 0xE5, 0xFE, 0xE5, 0xDC, 0xEE, 0xC4, 0x14, 0x3B, 0xA8, 0xD1, 0xCA, 0x88,
+        0x8E, 0x8B, 0xD3, 0x73, 0xFD, 0x05, 0x4C, 0x96, 0x00, 0x35, 0xEC, 0x51, 0x09, 0x2D, 0x87, 0x28,
+        0x05, 0x09, 0x74, 0xC2, 0x3A, 0x1D, 0x85, 0xD4, 0xB5, 0xD5, 0x06, 0xCD, 0xC2, 0x88, 0x49, 0x01,
+        0x92, 0xEB, 0xAC, 0x06, 0xCA, 0xD1, 0x0D, 0x5D, 0x04, 0x9E, 0xA4, 0x71, 0xE9, 0xC2, 0xF0, 0xBF,
+        0xE0, 0x85, 0x39, 0xC3, 0x7B, 0x66, 0xFD, 0xA6, 0x4D, 0x85, 0x04, 0xF8, 0x9B, 0x59, 0xAF, 0x30,
+        0x0D, 0x90, 0xD4, 0xA0, 0x5C, 0xD9, 0xC3, 0xB4, 0x1A, 0xC0, 0xC8, 0x68, 0xE5, 0x47, 0x1E, 0x39,
+        0x00, 0x53, 0xAA, 0xD0, 0x05, 0xF4, 0xA4, 0xA7, 0x77, 0x34, 0x66, 0x01, 0xB9, 0x0E, 0x1A, 0xF3,
+        0x14, 0x78, 0xBE, 0xF1, 0x28, 0x88, 0xB9, 0x2D, 0x14, 0x04, 0x3B, 0xB6, 0x54, 0xB0, 0x47, 0x93,
+        0x12, 0xA4, 0x37, 0x3F, 0xDD, 0xF5, 0x31, 0xA0, 0xC1, 0xB2, 0x8A, 0xC2, 0x8F, 0xC0, 0xB3, 0x9C,
+        0x65, 0xC3, 0x0A, 0x41, 0xF3, 0x08, 0xA9, 0x72, 0x06, 0x2F, 0x6C, 0x34, 0x8E, 0xA7, 0x89, 0x51,
+        0x48, 0xA6, 0x08, 0x4A, 0xC6, 0xED, 0xB4, 0xD5, 0x92, 0x15, 0x16, 0xD8, 0x65, 0x29, 0x17, 0xB9,
+        0x2C, 0xFF, 0x8B, 0x7E, 0x7A, 0x84, 0xEE, 0x38, 0xDC, 0x58, 0x04, 0x9B, 0xA0, 0xB7, 0x7D, 0xB8,
+        0x24, 0xF0, 0xB2, 0xDA, 0x71, 0x52, 0x29, 0x9B, 0xEA, 0x5F, 0xE9, 0x6E, 0xB4, 0x16, 0x55, 0x53,
+        0xA5, 0x93, 0x4F, 0x96, 0x7D, 0x8A, 0x33, 0xE0, 0xFC, 0xB9, 0xDD, 0xE1, 0x36, 0xCB, 0x59, 0x77,
+        0x5B, 0x13, 0xCD, 0x22, 0xA4, 0x1E, 0x97, 0xC7, 0x60, 0x65, 0xAC, 0x32, 0x23, 0x7A, 0xDE, 0x7C,
+        0x4D, 0x2E, 0x1D, 0xE0, 0xA2, 0x73, 0xDF, 0xB2, 0x27, 0x00, 0xC2, 0x04, 0x7A, 0x79, 0x59, 0xED,
+        0x88, 0xB5, 0x33, 0x9F, 0x7A, 0x36, 0x0F, 0xA2, 0x07, 0x69, 0x09, 0x2A, 0x85, 0x2F, 0x8C, 0x5D,
+        0x61, 0xF3, 0xC3, 0xC3, 0x5C, 0xCA, 0xD7, 0x33, 0xDE, 0x38, 0xF5, 0xA1, 0x0D, 0x6A, 0x91, 0x0E,
+        0xEE, 0xC9, 0xEE, 0x05, 0x7E, 0x15, 0x38, 0xC1, 0xF1, 0x78, 0xB1, 0x7B, 0x95, 0xA9, 0x7C, 0x26,
+        0x31, 0x2C, 0x85, 0x1D, 0xE5, 0x6B, 0x35, 0xBE, 0xE8, 0x3E, 0x93, 0x7C, 0x04, 0x15, 0x52, 0x3F,
+        0x6E, 0x58, 0x0D, 0xC7, 0x83, 0xD5, 0x84, 0x85, 0xDB, 0xD2, 0x39, 0x7B, 0x9E, 0x77, 0xE6, 0x19,
+        0x1A, 0x9F, 0x64, 0x5F, 0x87, 0xA8, 0x2A, 0x53, 0x2D, 0x9E, 0x9F, 0xBC, 0x99, 0x05, 0x04, 0xA4,
+        0x80, 0xCD, 0xF7, 0xB3, 0xA9, 0x0F, 0xB1, 0x45, 0x54, 0x45, 0x25, 0xF9, 0xF5, 0x25, 0xCC, 0x55,
+        0x3D, 0x49, 0x21, 0x4E, 0xD2, 0xFB, 0x1E, 0xC9, 0x68, 0x0B, 0x19, 0x68, 0x21, 0x04, 0x99, 0x39,
+        0x95, 0xF4, 0xCE, 0xB7, 0xAE, 0x1E, 0xDC, 0xF2, 0xA1, 0xA9, 0xB5, 0x3A, 0xB9, 0x69, 0x58, 0x53,
+        0x65, 0xE2, 0x4C, 0x5C, 0xC0, 0x67, 0x54, 0x34, 0x92, 0xFB, 0x26, 0xB3, 0x2B, 0xF1, 0xCD, 0xD3,
+        0xA2, 0x99, 0x80, 0xEB, 0xFE, 0x8C, 0x78, 0xB4, 0x0E, 0x14, 0xB4, 0xDC, 0x6D, 0xB5, 0xC8, 0x32,
+        0x0C, 0x9A, 0x04, 0x3A, 0x9B, 0x4D, 0xDA, 0xD4, 0xCD, 0x08, 0x2C, 0xA0, 0x76, 0x32, 0x04, 0x72,
+        0x4E, 0xC6, 0xB7, 0xBC, 0x05, 0x5B, 0x4F, 0x86, 0x6C, 0x5F, 0xA6, 0x15, 0xF1, 0xA2, 0xA9, 0x5D,
+        0x71, 0xC0, 0xA1, 0xB2, 0xD9, 0xAC, 0x4B, 0x45, 0x7E, 0x18, 0xAA, 0xC4, 0x88, 0x1E, 0xD4, 0x22,
+        0x78, 0x62, 0x6D, 0xB6, 0xA6, 0x6E, 0xEE, 0x42, 0x88, 0x4D, 0x32, 0xDB, 0x25, 0x3B, 0xA2, 0x5F,
+        0xEB, 0x7F, 0x82, 0x68, 0x2E, 0x48, 0x7C, 0xE2, 0xE1, 0x2A, 0x20, 0x5C, 0xF8, 0x80, 0x1D, 0x04,
+        0xFA, 0x50, 0xC0, 0xF6, 0x1D, 0x22, 0xE5, 0xF0, 0x7E, 0x3A, 0xCE, 0xBB, 0x1A, 0xA0, 0x7B, 0x12,
+        0x8D, 0x00, 0x12, 0x20, 0x9A, 0x28, 0xB9, 0x77, 0x6D, 0x76, 0xA8, 0x79, 0x31, 0x80, 0xEE, 0xF9,
+        0x6B, 0x84, 0xC6, 0x92, 0x23, 0x97, 0xEB, 0xA9, 0xB7, 0x2C, 0xD2, 0x87, 0x22, 0x81, 0xA6, 0x8A,
+        0x5E, 0x68, 0x32, 0x93, 0xA5, 0x7A, 0x21, 0x3B, 0x38, 0xCD, 0x8D, 0x7D, 0x3F, 0x4F, 0x28, 0x11,
+        0x04, 0x16, 0x21, 0xAD, 0xE8, 0x53, 0x48, 0xD4, 0x28, 0xF8, 0x88, 0xC1, 0x79, 0xC3, 0xFF, 0x9D,
+        0x0B, 0xE7, 0x9B, 0x1D, 0x21, 0x18, 0x33, 0x89, 0x1A, 0xBA, 0xEB, 0xC3, 0x58, 0x86, 0x3E, 0x4D,
+        0x1F, 0x7E, 0x3E, 0x9A, 0xD7, 0xDC, 0x6B, 0x8B, 0x71, 0x86, 0x93, 0xA4, 0x16, 0xB0, 0x4C, 0xAE,
+        0x27, 0x8A, 0xC8, 0xBC, 0x5C, 0xF2, 0x03, 0xF3, 0xD3, 0x7C, 0x17, 0x39, 0xD8, 0xCB, 0xDE, 0x7B,
+        0xF5, 0x04, 0xBE, 0x82, 0xA8, 0x7F, 0x87, 0xAC, 0x3F, 0x60, 0x19, 0x60, 0x30, 0x3E, 0x3C, 0xE8,
+        0x6E, 0xA7, 0x21, 0x15, 0xD1, 0x2A, 0xBA, 0x3F, 0x73, 0xC6, 0xC3, 0x96, 0xFA, 0xB3, 0x95, 0x8D,
+        0x74, 0x70, 0xA6, 0x23, 0x71, 0x5D, 0xD5, 0x52, 0xF9, 0xA3, 0x80, 0x50, 0x4F, 0x4B, 0x44, 0xFA,
+        0x3E, 0x96, 0x6D, 0x09, 0x25, 0xA6, 0x33, 0xA7, 0xBE, 0x96, 0x57, 0x11, 0x46, 0x95, 0xE5, 0x04,
+        0x67, 0x3B, 0x04, 0x0E, 0x1F, 0x31, 0x15, 0x23, 0xA9, 0x85, 0xBA, 0x19, 0x18, 0xFB, 0xF0, 0x2E,
+        0xE5, 0xCA, 0x03, 0x72, 0xE3, 0xE8, 0xF1, 0x32, 0x09, 0x56, 0x57, 0x82, 0xA2, 0x05, 0x59, 0xD2,
+        0x7A, 0x2D, 0xD6, 0x2D, 0xD4, 0x62, 0x11, 0xA6, 0x6B, 0x11, 0x02, 0x54, 0x41, 0xC7, 0xB0, 0x25,
+        0xDC, 0x6A, 0xDB, 0xD2, 0x89, 0x3F, 0xA3, 0xC9, 0xFC, 0x77, 0x6C, 0xD3, 0x8D, 0x6E, 0xB9, 0x86,
+        0xB1, 0xE5, 0x76, 0x04, 0xFE, 0x1C, 0xA8, 0x93, 0xC8, 0xBC, 0x08, 0x88, 0xAA, 0x37, 0x6A, 0x68,
+        0x7E, 0x4A, 0x51, 0x06, 0xB2, 0xC4, 0x04, 0x46, 0xBF, 0xFF, 0x18, 0x40, 0x9B, 0x83, 0x6C, 0x6E,
+        0xEA, 0x47, 0xF3, 0xEB, 0x25, 0x95, 0xE8, 0x86, 0xAC, 0xAB, 0xD8, 0x3E, 0x82, 0x45, 0x8D, 0x07,
+        0x43, 0xDB, 0x48, 0xA5, 0x86, 0x05, 0xA8, 0x4F, 0x3E, 0x03, 0x61, 0x9E, 0x35, 0x01, 0x71, 0xA0,
+        0x9F, 0x7C, 0xBD, 0xF6, 0x04, 0xD0, 0x4E, 0x35, 0xBE, 0x71, 0x54, 0xE4, 0x3F, 0xE7, 0xAF, 0x79,
+        0x7E, 0x25, 0x3B, 0x32, 0x5A, 0xEA, 0xC5, 0xE9, 0xC2, 0xE8, 0x45, 0xD4, 0xBD, 0xAA, 0x37, 0x7F,
+        0x20, 0xB3, 0x34, 0x7D, 0x19, 0x01, 0x79, 0xEB, 0xA5, 0xF3, 0x1C, 0xD3, 0xA4, 0x67, 0x15, 0xB8,
+        0x6F, 0x88, 0x03, 0xB6, 0x77, 0xC6, 0x49, 0x08, 0x2F, 0x1C, 0xE9, 0x49, 0x07, 0x75, 0xDD, 0xC2,
+        0xB5, 0x8F, 0xDD, 0x94, 0xB0, 0x04, 0x4C, 0x96, 0x3D, 0xF9, 0x92, 0x9C, 0x91, 0xEB, 0x07, 0xB5,
+        0x7D, 0x9F, 0x4D, 0x15, 0xB8, 0x0B, 0x46, 0xF0, 0x98, 0xD2, 0x3A, 0xB6, 0xDC, 0x53, 0x46, 0xF6,
+        0x32, 0x34, 0x2E, 0x8F, 0xDB, 0x15, 0x9B, 0xE4, 0xC8, 0x8C, 0xA3, 0x13, 0x0D, 0x78, 0xEA, 0x79,
+        0x31, 0xDC, 0xD9, 0x26, 0x9A, 0xA2, 0x52, 0x3E, 0x3F, 0xE2, 0xEB, 0x47, 0xBC, 0xDB, 0xE7, 0x9B,
+        0xE6, 0x4D, 0x94, 0x5D, 0xD3, 0x25, 0x04, 0x12, 0x93, 0xC8, 0x05, 0x16, 0xBD, 0xE3, 0xA7, 0xE7,
+        0x0A, 0x27, 0x50, 0x2B, 0x8F, 0x73, 0x23, 0x05, 0xB1, 0xF6, 0x32, 0x98, 0xF5, 0x2D, 0x02, 0xEA,
+        0x06, 0x0D, 0x89, 0x88, 0x43, 0xF9, 0x25, 0x25, 0xA1, 0xC0, 0xB8, 0xBF, 0xD4, 0xF8, 0x59, 0xAE,
+        0x14, 0x78, 0x45, 0x69, 0x4C, 0x24, 0x20, 0x5D, 0x36, 0x33, 0x3C, 0x22, 0x9C, 0xA3, 0x47, 0x2F,
+        0x5F, 0xDE, 0x3D, 0xE3, 0xF7, 0x6A, 0x0A, 0x04, 0xB9, 0xB0, 0x03, 0x84, 0x1C, 0xED, 0x5C, 0x38,
+        0xFB, 0x15, 0xF7, 0x40, 0x5D, 0x14, 0xDE, 0x5E, 0x5E, 0xC3, 0xB1, 0xAB, 0xDE, 0x5A, 0x57, 0x10,
+        0xA4, 0x1C, 0xA8, 0xFC, 0xF5, 0x23, 0xF1, 0x45, 0xFE, 0x6F, 0x7D, 0xB6, 0xE8, 0xD7, 0xB3, 0x4E,
+        0x47, 0xCF, 0x9E, 0xE4, 0xE4, 0x8C, 0x40, 0xFE, 0x98, 0x0A, 0x38, 0x6A, 0x33, 0xD0, 0x5C, 0xA3,
+        0x85, 0xB8, 0x45, 0x47, 0x6C, 0x33, 0x94, 0xC8, 0x04, 0x9B, 0x04, 0x57, 0xE6, 0x1A, 0x2A, 0x45,
+        0x70, 0x19, 0x5C, 0x33, 0x96, 0x1D, 0x0D, 0xD4, 0xFE, 0x7D, 0xC4, 0x0D, 0x14, 0xEF, 0xA1, 0x11,
+        0x5C, 0x2B, 0xB3, 0xEB, 0x03, 0x91, 0xE1, 0x88, 0x7E, 0x2B, 0x65, 0xA9, 0xE0, 0x91, 0x6B, 0x89,
+        0x1F, 0x9A, 0x1B, 0xF6, 0x66, 0xDA, 0x56, 0xEF, 0x9E, 0x43, 0x26, 0x57, 0xC9, 0xA0, 0x7C, 0xB9,
+        0x5D, 0x8D, 0x97, 0x93, 0xE9, 0x80, 0xA7, 0xB5, 0x70, 0x04, 0x37, 0x46, 0x42, 0xA9, 0xE1, 0xB2,
+        0x57, 0x1C, 0x7C, 0x8D, 0xB8, 0x28, 0x93, 0x79, 0x45, 0xF7, 0xFA, 0x46, 0xE3, 0x3A, 0xBC, 0x96,
+        0x8E, 0xCC, 0x47, 0xAB, 0x77, 0x15, 0x0F, 0xED, 0xD4, 0x37, 0xEA, 0xE7, 0xC3, 0x48, 0x81, 0xC7,
+        0xAE, 0xE9, 0x9A, 0xDA, 0xF5, 0x18, 0x84, 0xF6, 0x5C, 0x3A, 0x5F, 0xB1, 0x70, 0x2F, 0x86, 0xE3,
+        0xD9, 0x03, 0xDF, 0x83, 0x15, 0x1C, 0x8B, 0xCF, 0xB8, 0xDB, 0x04, 0x64, 0xF7, 0x51, 0xB4, 0x35,
+        0x5D, 0xCD, 0x84, 0x9F, 0xBF, 0xE4, 0x05, 0x1A, 0x6B, 0xBE, 0xCF, 0x9D, 0x94, 0x37, 0x19, 0x5F,
+        0xC1, 0xFA, 0x0A, 0x5A, 0x5E, 0x7D, 0x06, 0x9B, 0x96, 0x98, 0x91, 0x0F, 0xBB, 0x25, 0x94, 0xB7,
+        0x90, 0xB8, 0x3F, 0xB8, 0x5F, 0xE7, 0x24, 0x7E, 0x79, 0x30, 0xDB, 0xB9, 0x94, 0x1B, 0x9F, 0xC9,
+        0x88, 0x04, 0xCB, 0x59, 0x63, 0x61, 0xF2, 0xDB, 0x96, 0xEF, 0x6C, 0x04, 0x2C, 0xB6, 0xEC, 0xE5,
+        0xCA, 0xE1, 0x04, 0x52, 0x0C, 0x95, 0x8D, 0x61, 0xA1, 0x7C, 0x7D, 0xD1, 0x6B, 0x84, 0xE8, 0x15,
+        0xB4, 0xEC, 0x24, 0xA2, 0xEB, 0x62, 0xCD, 0x0A, 0x2E, 0x2F, 0x73, 0x65, 0x0D, 0x04, 0x1A, 0x6C,
+        0xAE, 0x60, 0x71, 0x68, 0xF3, 0x5F, 0x76, 0x65, 0x0D, 0xE2, 0x37, 0xE7, 0x6C, 0x77, 0x6E, 0x20,
+        0xB0, 0x6C, 0x74, 0xDD, 0x5F, 0xBD, 0x20, 0xBE, 0xC1, 0x6D, 0xF0, 0x50, 0x04, 0x07, 0x20, 0xA4,
+        0x4D, 0x97, 0xBE, 0x6F, 0x02, 0x2B, 0xE2, 0x79, 0x0D, 0x12, 0xC2, 0xC4, 0xC8, 0xE6, 0xB3, 0x95,
+        0x8D, 0x2A, 0x58, 0xA4, 0xE9, 0x57, 0x18, 0x6D, 0xC0, 0xAD, 0xEA, 0x79, 0x62, 0xC9, 0xF8, 0x28,
+        0xF5, 0xFA, 0xCA, 0xDF, 0xE7, 0x8C, 0xEF, 0x30, 0x94, 0x3D, 0xD3, 0x06, 0xA9, 0xAA, 0xE1, 0x77,
+        0xE7, 0x4A, 0xA8, 0x9B, 0xB4, 0x1F, 0xEB, 0x91, 0xA6, 0xC6, 0x71, 0x31, 0xCA, 0x04, 0x56, 0x17,
+        0x45, 0xCF, 0x86, 0xAF, 0xA6, 0x41, 0xDF, 0x88, 0xF4, 0x81, 0x51, 0x93, 0xC2, 0x4B, 0xD7, 0xD7,
+        0x3B, 0xF6, 0x54, 0x61, 0xAE, 0xB3, 0x0D, 0x3C, 0x75, 0x50, 0xD4, 0x8A, 0x3E, 0x80, 0x57, 0x48,
+        0x23, 0xCC, 0xAB, 0x15, 0xB3, 0x3F, 0xBC, 0xD7, 0x6F, 0x67, 0x34, 0x09, 0x28, 0x67, 0x84, 0x14,
+        0x27, 0x82, 0xF0, 0xE5, 0x29, 0x06, 0x5F, 0x05, 0x8B, 0xE2, 0x32, 0xD7, 0x11, 0x93, 0x04, 0x89,
+        0x2A, 0x09, 0xEC, 0x30, 0xEF, 0x21, 0x35, 0x56, 0x6B, 0x05, 0x8B, 0x22, 0x8A, 0xB1, 0x59, 0xCC,
+        0x0F, 0xC9, 0x19, 0x1D, 0x4B, 0xF2, 0xCD, 0x11, 0xF8, 0x81, 0x3E, 0xFD, 0x32, 0xE1, 0xCC, 0xAB,
+        0x3A, 0x52, 0xB1, 0x8A, 0x7F, 0x89, 0x37, 0x95, 0xBD, 0xF4, 0x9C, 0x0A, 0xCD, 0x8F, 0x4F, 0xF2,
+        0xB2, 0xF5, 0xCC, 0xF4, 0x3A, 0x18, 0xDD, 0x4C, 0x3C, 0x6C, 0x07, 0x46, 0x4A, 0x84, 0x15, 0x04,
+        0xE6, 0x0F, 0xCE, 0x93, 0xB5, 0x9E, 0x9E, 0xC5, 0x30, 0x11, 0xAA, 0xBC, 0x21, 0xC2, 0x3E, 0x97,
+        0xB2, 0xA3, 0x13, 0x69, 0xB8, 0x7A, 0x5A, 0xE9, 0xC4, 0x4E, 0xE8, 0x9E, 0x2A, 0x6D, 0xEC, 0x0A,
+        0xF7, 0xE3, 0x50, 0x73, 0x99, 0xE5, 0x95, 0x92, 0x9D, 0xB9, 0x9F, 0x34, 0xF5, 0x79, 0x37, 0x10,
+        0x12, 0x96, 0x89, 0x1E, 0x44, 0xD2, 0x3F, 0x0B, 0xE1, 0xF3, 0x2C, 0xCE, 0x69, 0x61, 0x68, 0x21,
+        0x04, 0x38, 0x5E, 0xED, 0x34, 0xC1, 0xCD, 0xFF, 0x21, 0xE6, 0xD0, 0x81, 0x86, 0x89, 0xB8, 0x1B,
+        0xDE, 0x71, 0xA7, 0xF4, 0xF1, 0x83, 0x97, 0xE6, 0x69, 0x0A, 0x84, 0x1E, 0x15, 0x99, 0xC4, 0x38,
+        0x62, 0x28, 0x3B, 0xEB, 0xC3, 0xE8, 0xEA, 0x23, 0xF5, 0x67, 0x01, 0xDE, 0x19, 0xE9, 0xEB, 0xF4,
+        0x57, 0x6B, 0x30, 0x4E, 0xEC, 0x20, 0x86, 0xDC, 0x8C, 0xC0, 0x45, 0x8F, 0xE5, 0x54, 0x2E, 0x54,
+        0x53, 0x04, 0x4A, 0x99, 0x03, 0xFF, 0xB6, 0x6B, 0xD6, 0x7A, 0xCA, 0x89, 0xAC, 0x3A, 0xF4, 0x97,
+        0xF9, 0xDF, 0x3C, 0xF6, 0xEE, 0xDA, 0xFA, 0x6E, 0xDA, 0xC0, 0x88, 0x88, 0x2C, 0x68, 0x11, 0xF5,
+        0xD1, 0x5B, 0x94, 0x34, 0xC1, 0xAD, 0x46, 0xFD, 0x1E, 0xEC, 0x7C, 0x49, 0x29, 0x74, 0x55, 0xEE,
+        0x12, 0x0B, 0x66, 0x44, 0x91, 0xF8, 0xA4, 0x7C, 0x2F, 0x8C, 0x36, 0x09, 0x7F, 0x2B, 0xA7, 0x21,
+        0x4C, 0x09, 0x04, 0xD8, 0x95, 0x62, 0x65, 0x48, 0xB6, 0x5B, 0x81, 0xE2, 0x64, 0xC7, 0x63, 0x7C,
+        0x97, 0x28, 0x77, 0xD1, 0xD7, 0x2E, 0x5F, 0x3A, 0x92, 0x50, 0x14, 0x37, 0x2E, 0x9F, 0x65, 0x88,
+        0xF6, 0xC1, 0x4B, 0xFE, 0xBF, 0xAA, 0x38, 0xF2, 0xBC, 0x7E, 0xAE, 0x72, 0x8E, 0xC6, 0x08, 0x18,
+        0xC3, 0x40, 0xEB, 0x03, 0x42, 0x8D, 0x63, 0x2B, 0xB0, 0x67, 0xE1, 0x79, 0x36, 0x3E, 0xD7, 0x5D,
+        0x7D, 0x99, 0x1F, 0x04, 0x38, 0xD1, 0xAF, 0x62, 0x6A, 0xE8, 0x56, 0xF0, 0x0D, 0x8B, 0x82, 0x3C,
+        0xA5, 0x77, 0x3C, 0x00, 0xFA, 0xA7, 0x00, 0x53, 0x1A, 0x09, 0x8C, 0x93, 0x03, 0x37, 0xE3, 0x80,
+        0xEC, 0x52, 0x3D, 0xB3, 0x0E, 0xFB, 0x2C, 0x60, 0xF6, 0x0E, 0xB6, 0xFF, 0x18, 0x19, 0xEF, 0xD6,
+        0x83, 0x8A, 0xA5, 0x82, 0x04, 0x2F, 0xEB, 0x20, 0xC5, 0xF6, 0x31, 0x7F, 0x3B, 0x80, 0xBF, 0x2F,
+        0xC5, 0xCC, 0xFF, 0xA2, 0x04, 0x26, 0xF3, 0xD2, 0x42, 0x4E, 0x29, 0xAD, 0x33, 0xCB, 0x19, 0x90,
+        0x8D, 0xF7, 0xC0, 0x66, 0x1E, 0xC7, 0xE5, 0x69, 0x84, 0x34, 0x56, 0x96, 0x12, 0xD2, 0xB8, 0xFD,
+        0x19, 0xF7, 0x08, 0x61, 0x9C, 0x22, 0x27, 0xDE, 0x2D, 0x94, 0xDD, 0x85, 0xBC, 0x48, 0xA3, 0x2A,
+        0xED, 0x84, 0x35, 0x64, 0x8E, 0xD0, 0x6B, 0xAE, 0xEC, 0x4A, 0x91, 0x18, 0x94, 0x5A, 0xEF, 0x00,
+        0xF6, 0x8C, 0x16, 0xD2, 0x0F, 0x04, 0x4C, 0xC1, 0x69, 0x58, 0xB2, 0x45, 0x4C, 0x80, 0x9C, 0xBE,
+        0x6D, 0xD1, 0x82, 0x59, 0x57, 0x49, 0x3E, 0xFD, 0x34, 0xE0, 0x39, 0x44, 0xD9, 0xBA, 0x4B, 0xF0,
+        0x22, 0x17, 0x5B, 0xCD, 0x77, 0xF4, 0x1D, 0xFE, 0x0E, 0x2D, 0xFE, 0x0B, 0x68, 0x87, 0xA1, 0xB3,
+        0xFB, 0x21, 0x8E, 0x6E, 0xA3, 0x05, 0x3D, 0x60, 0x65, 0xA3, 0xC0, 0x82, 0x0B, 0xA0, 0x57, 0x58,
+        0xCA, 0x04, 0x54, 0x94, 0xC4, 0x98, 0x04, 0x9C, 0x39, 0x19, 0xA8, 0x4A, 0x47, 0x48, 0x70, 0xFA,
+        0xED, 0x8A, 0x9C, 0x1C, 0xC6, 0x60, 0x21, 0x52, 0x34, 0x89, 0x05, 0x4D, 0x7F, 0x03, 0x08, 0xCB,
+        0xFC, 0x99, 0xC8, 0xAC, 0x1F, 0x98, 0xCD, 0xDD, 0xB8, 0x4F, 0x0F, 0x4A, 0x4D, 0xDD, 0x57, 0x58,
+        0x4F, 0x04, 0x4B, 0xF2, 0x60, 0xE6, 0x41, 0x90, 0x53, 0x26, 0xF7, 0x6C, 0x64, 0xC8, 0xE6, 0xBE,
+        0x7E, 0x5E, 0x03, 0xD4, 0xFC, 0x59, 0x9D, 0x04, 0xCF, 0xF2, 0xAA, 0xE7, 0x74, 0x1C, 0xEE, 0xD5,
+        0xF1, 0x20, 0x54, 0x6E, 0x74, 0xDD, 0x81, 0x08, 0x12, 0x54, 0xF5, 0x49, 0x21, 0x0F, 0x60, 0x24,
+        0x5E, 0x02, 0xFC, 0x28, 0xD0, 0x10, 0x8E, 0x91, 0x70, 0xE8, 0xC7, 0xD6, 0x21, 0x4F, 0x00, 0x5E,
+        0xA7, 0x03, 0xF0, 0x78, 0xD7, 0xA7, 0x76, 0x86, 0xEC, 0x39, 0x06, 0xE1, 0x9E, 0x3D, 0xD9, 0x3F,
+        0x4F, 0xA9, 0x89, 0x7D, 0xE0, 0xA9, 0x4E, 0x9D, 0x04, 0x85, 0x9C, 0x50, 0xB2, 0x4B, 0x59, 0x27,
+        0x82, 0xA9, 0x53, 0xC1, 0x89, 0x39, 0xC8, 0x1B, 0x13, 0x8B, 0xE2, 0x2B, 0x6F, 0xC0, 0x84, 0x13,
+        0x92, 0x0E, 0xF0, 0xBC, 0x66, 0x86, 0xBC, 0x3E, 0x67, 0x62, 0x7C, 0xE7, 0xA1, 0xDB, 0x67, 0x05,
+        0x1B, 0x3E, 0xAB, 0xA7, 0x4D, 0x40, 0x2A, 0x2C, 0x04, 0xD9, 0xA6, 0x56, 0x5C, 0x2C, 0x8C, 0x59,
+        0x29, 0x5A, 0x58, 0xB2, 0x5F, 0x40, 0x3C, 0xEE, 0x99, 0x04, 0x79, 0xC6, 0x42, 0x45, 0x40, 0xD0,
+        0x73, 0xFC, 0xD9, 0xEE, 0x0C, 0xE0, 0x49, 0x3A, 0x64, 0x15, 0x2F, 0x04, 0x49, 0x59, 0xE1, 0x58,
+        0xB0, 0xD7, 0x16, 0x61, 0x7D, 0x49, 0xC1, 0xB8, 0xCA, 0xD0, 0xFA, 0x9D, 0x73, 0xF0, 0x54, 0x50,
+        0x7F, 0xD0, 0xE9, 0xB4, 0xCA, 0xF4, 0x1C, 0x2C, 0x8E, 0xAC, 0x7E, 0xE6, 0x32, 0xCB, 0x33, 0x11,
+        0xFD, 0x39, 0x0E, 0xA6, 0xE2, 0xC9, 0x4B, 0xC4, 0x3E, 0x18, 0x04, 0x47, 0x65, 0xE3, 0x70, 0x29,
+        0xBA, 0xA6, 0xC3, 0x4E, 0x8E, 0x80, 0x96, 0xE3, 0xF0, 0x69, 0xD8, 0x52, 0xA1, 0xFB, 0x14, 0x00,
+        0x21, 0x6E, 0xA5, 0x67, 0x33, 0x37, 0xF0, 0xD8, 0x89, 0x39, 0x70, 0x57, 0xED, 0xA4, 0xFE, 0x68,
+        0xB8, 0x9E, 0x7E, 0x36, 0x0E, 0x5A, 0x03, 0x46, 0x97, 0x4B, 0x2F, 0xF2, 0x73, 0x0A, 0x87, 0x06,
+        0x59, 0x7D, 0xEE, 0x0B, 0x89, 0x2F, 0x0E, 0xB9, 0xEA, 0xE3, 0xA5, 0x04, 0xC8, 0x71, 0xF3, 0x2C,
+        0xAB, 0x6D, 0xB6, 0x38, 0xDF, 0x98, 0x31, 0x91, 0xF6, 0xE9, 0xF1, 0x94, 0x03, 0xEC, 0xC7, 0xEA,
+        0x58, 0xBE, 0x4D, 0x3E, 0x19, 0x97, 0x5A, 0xFC, 0x16, 0xD9, 0x2C, 0xBE, 0x4A, 0xDF, 0x3E, 0x77,
+        0x2F, 0xE6, 0x27, 0xF2, 0x75, 0xB2, 0xD3, 0x2E, 0x96, 0x65, 0x96, 0xA4, 0x4C, 0x25, 0x98, 0x26,
+        0x59, 0x4C, 0x3B, 0x81, 0x45, 0xFA, 0xDB, 0xC0, 0x8F, 0x94, 0x1B, 0x05, 0x04, 0x37, 0x5C, 0xB8,
+        0xF9, 0xBA, 0xC4, 0xBC, 0xF5, 0x9C, 0x7F, 0xE5, 0x9C, 0x44, 0x17, 0xD8, 0x35, 0x5C, 0xCA, 0xD7,
+        0xED, 0x5D, 0x55, 0xF6, 0xC7, 0xBB, 0xF4, 0xA0, 0x28, 0x51, 0x0C, 0xBC, 0xFC, 0x42, 0xB1, 0xBE,
+        0x49, 0x67, 0x73, 0x37, 0xD6, 0x79, 0x1F, 0x48, 0x0A, 0x4E, 0x1D, 0x02, 0x34, 0xB4, 0xFD, 0xC3,
+        0x44, 0x23, 0xDE, 0xA0, 0x28, 0xD1, 0xE0, 0x3F, 0xF3, 0x3C, 0x4F, 0x01, 0x60, 0x04, 0x1F, 0x9B,
+        0xDA, 0xB5, 0x41, 0x7D, 0xFF, 0xE8, 0x78, 0xC1, 0x98, 0x0E, 0x26, 0xB3, 0x87, 0xD0, 0x49, 0x5E,
+        0x5A, 0xFD, 0x27, 0x97, 0x4F, 0xD2, 0x4C, 0xD9, 0xF0, 0xD3, 0xFC, 0x26, 0x36, 0x08, 0x5C, 0x5D,
+        0xA3, 0x1B, 0xCE, 0xAF, 0x86, 0x27, 0x10, 0xA9, 0x54, 0xEE, 0xD4, 0x3D, 0xC0, 0x03, 0x8A, 0x4F,
+        0xFC, 0x1F, 0xC9, 0x83, 0x4E, 0xE4, 0x24, 0x7B, 0x9F, 0x6C, 0xF7, 0x33, 0x56, 0xA5, 0x04, 0xDA,
+        0x1D, 0x61, 0xD0, 0xCA, 0x72, 0x1A, 0x11, 0xB1, 0xA5, 0xBF, 0x6B, 0x7D, 0x88, 0xE8, 0x42, 0x1A,
+        0x28, 0x8A, 0xB5, 0xD5, 0xBB, 0xA5, 0x22, 0x0E, 0x53, 0xD3, 0x2B, 0x5F, 0x06, 0x7E, 0xC2, 0x81,
+        0x57, 0xF5, 0x5A, 0x7C, 0x99, 0x30, 0x6C, 0x79, 0xC0, 0x76, 0x61, 0x61, 0xC9, 0x1E, 0x29, 0x66,
+        0xA7, 0x38, 0x99, 0xD2, 0x79, 0xB4, 0x8A, 0x65, 0x5F, 0xBA, 0x0F, 0x1A, 0xD8, 0x36, 0xF1, 0x04,
+        0x1B, 0xAA, 0x9C, 0xB8, 0x13, 0x55, 0xCF, 0x0E, 0x22, 0x04, 0xC3, 0x8A, 0x6A, 0xAE, 0xC7, 0xDD,
+        0x13, 0x51, 0x88, 0xC5, 0x4C, 0xD8, 0xF2, 0xF7, 0x99, 0x28, 0x3F, 0x37, 0xF1, 0x48, 0x54, 0x66,
+        0x41, 0x98, 0xB7, 0xCE, 0xA1, 0x3D, 0xF1, 0xAC, 0xE0, 0x6E, 0x41, 0x52, 0x8B, 0x6A, 0xB4, 0x5F,
+        0x6C, 0x17, 0x53, 0xDB, 0xCE, 0x8E, 0x16, 0xD9, 0xE9, 0x41, 0xEA, 0xA1, 0x17, 0x69, 0x07, 0xD6,
+        0x04, 0x39, 0x96, 0x52, 0x37, 0xE3, 0xD9, 0x35, 0x5D, 0xF0, 0x27, 0xE9, 0x79, 0x8F, 0xCB, 0xBD,
+        0xF0, 0x34, 0x61, 0x32, 0x85, 0xB1, 0xA3, 0xA9, 0xF0, 0x9C, 0xA1, 0x66, 0x0A, 0x13, 0xDA, 0x6B,
+        0x20, 0x22, 0x37, 0xBC, 0x23, 0xD3, 0x4B, 0xDE, 0x5B, 0x38, 0x24, 0xFE, 0x08, 0xCB, 0xEE, 0xFF,
+        0x6E, 0xE0, 0x92, 0xAB, 0xB0, 0x4C, 0x52, 0x41, 0x0A, 0x77, 0xC0, 0xC8, 0x83, 0x84, 0x76, 0xCE,
+        0xDD, 0x04, 0xF8, 0x9D, 0x05, 0xF2, 0x01, 0x49, 0xEB, 0xF5, 0x41, 0x5A, 0x06, 0x1B, 0xEE, 0xCE,
+        0x2B, 0x12, 0xCD, 0x58, 0x09, 0x87, 0x0D, 0x0B, 0x83, 0xC8, 0xBC, 0xB4, 0x86, 0x6F, 0x2E, 0x0C,
+        0xE0, 0x5F, 0x4C, 0x19, 0x0F, 0xD8, 0xB3, 0x7C, 0x60, 0x9C, 0x84, 0xEF, 0xE1, 0x90, 0x14, 0x4F,
+        0x0C, 0x19, 0x04, 0x83, 0x52, 0x7B, 0xBD, 0xCC, 0x04, 0x84, 0x3C, 0x8D, 0x6E, 0x4B, 0xB6, 0xC9,
+        0x55, 0x38, 0x04, 0x1B, 0x6D, 0xAA, 0xF4, 0x4E, 0x19, 0xAD, 0x82, 0x3A, 0x13, 0xAC, 0xD5, 0xCE,
+        0xEA, 0x9F, 0xF8, 0x7F, 0xDE, 0xBD, 0x89, 0x7E, 0x49, 0xDE, 0x55, 0x9C, 0xF2, 0x7F, 0x5B, 0x62,
+        0xCD, 0xBA, 0x21, 0xD9, 0xC3, 0xF8, 0x8C, 0xD5, 0xFC, 0x6B, 0x47, 0x78, 0xE3, 0x7B, 0xB9, 0x59,
+        0xBA, 0x48, 0x80, 0xC7, 0xD2, 0x9D, 0xF7, 0xD4, 0x32, 0xEA, 0x41, 0xA3, 0x11, 0xDC, 0xE3, 0x37,
+        0x29, 0x16, 0x75, 0x04, 0x07, 0x3F, 0x8E, 0x3B, 0xB9, 0x47, 0x3E, 0x65, 0x22, 0x92, 0x7B, 0x8C,
+        0xE7, 0x2E, 0x5F, 0xD1, 0x7D, 0x90, 0xD8, 0x9E, 0x5E, 0xFD, 0x7D, 0xA9, 0x48, 0x55, 0x48, 0x79,
+        0xE1, 0x55, 0x6D, 0x83, 0x22, 0x6F, 0x3B, 0x2B, 0x3C, 0x7B, 0x61, 0xAB, 0xBD, 0xA4, 0x70, 0x5C,
+        0xE3, 0x9D, 0x30, 0xDA, 0xEC, 0x39, 0xFC, 0x11, 0xCC, 0x1B, 0xDE, 0xFD, 0x51, 0x1B, 0x9E, 0x44,
+        0x21, 0xF0, 0xF6, 0xE8, 0x04, 0xB1, 0x6F, 0x07, 0x4E, 0x6D, 0xE8, 0x17, 0xE3, 0x35, 0x95, 0x43,
+        0xEF, 0xF5, 0x46, 0x48, 0x6A, 0xA6, 0x9B, 0x55, 0x95, 0xDC, 0x69, 0x41, 0x57, 0x80, 0xF1, 0x4B,
+        0x9A, 0x13, 0x76, 0x91, 0xB4, 0x1A, 0x06, 0x3B, 0x8A, 0x85, 0xD8, 0xE0, 0x59, 0xD8, 0x97, 0xE0,
+        0xF3, 0x14, 0xFD, 0xBD, 0x68, 0x78, 0xEF, 0xF5, 0x33, 0x3B, 0xE4, 0x98, 0x53, 0x41, 0x02, 0xFF,
+        0x0F, 0x02, 0x70, 0xC6, 0x93, 0x04, 0x52, 0xF2, 0x16, 0x63, 0xDB, 0x8F, 0xD6, 0x95, 0xA7, 0xA2,
+        0x75, 0x3E, 0xC1, 0x22, 0xDB, 0x06, 0x71, 0x3E, 0x2C, 0x3C, 0x36, 0xC9, 0xE6, 0x11, 0xA6, 0x16,
+        0x30, 0xCD, 0x96, 0x6D, 0x85, 0x07, 0x11, 0x5F, 0xBF, 0x5D, 0xCE, 0xCF, 0xB6, 0x80, 0x5B, 0x30,
+        0xC0, 0x6A, 0x59, 0x4C, 0xAB, 0x48, 0x06, 0xC3, 0xE0, 0xEA, 0x92, 0xBA, 0x37, 0x64, 0xD8, 0x18,
+        0x80, 0xD5, 0xED, 0xD5, 0x65, 0x3D, 0x04, 0x2D, 0xEE, 0x51, 0xFC, 0x44, 0x3A, 0x26, 0x66, 0x92,
+        0xCD, 0x78, 0x41, 0x87, 0xF0, 0x2C, 0xF8, 0xD6, 0x0D, 0x49, 0x79, 0xE0, 0x68, 0x5B, 0xE1, 0x7F,
+        0x2F, 0x06, 0xDD, 0xBE, 0x4B, 0x4A, 0xB7, 0x82, 0x06, 0xCD, 0x4F, 0x94, 0xBE, 0x6C, 0x05, 0xEF,
+        0x85, 0xBB, 0x6F, 0x2C, 0x29, 0xF9, 0x85, 0x9E, 0x78, 0x94, 0x52, 0xDF, 0xC2, 0x95, 0xB0, 0xE3,
+        0xDA, 0xE4, 0x56, 0x09, 0xCD, 0xEC, 0xA8, 0x04, 0x75, 0xD6, 0xF2, 0xD2, 0x9A, 0x6B, 0x3A, 0x5C,
+        0xD8, 0x50, 0x26, 0x64, 0x6C, 0xB4, 0x84, 0xDF, 0x32, 0xAA, 0xC3, 0x32, 0x55, 0xA5, 0x92, 0xD7,
+        0xC4, 0x30, 0xA1, 0x30, 0xED, 0xEA, 0xB2, 0x03, 0x0B, 0x17, 0xC1, 0xCC, 0xD3, 0xA9, 0xFD, 0xBA,
+        0x42, 0xC2, 0xD5, 0x14, 0x37, 0x2E, 0xE6, 0xA3, 0xEC, 0xF9, 0xCD, 0x6E, 0x44, 0x73, 0x67, 0x62,
+        0xE9, 0x0E, 0x34, 0xD8, 0xF6, 0x78, 0xDC, 0x06, 0x04, 0xCC, 0x5F, 0x8C, 0x4C, 0x2E, 0x41, 0xD9,
+        0x53, 0x53, 0x04, 0x5A, 0x0D, 0x0D, 0x8C, 0x81, 0x09, 0x31, 0xE5, 0xA2, 0x65, 0xC6, 0xC2, 0x56,
+        0x21, 0xAC, 0x5B, 0x33, 0x60, 0xA8, 0xF3, 0xF1, 0xED, 0xD3, 0x20, 0x9F, 0x06, 0x53, 0x32, 0x42,
+        0xF8, 0x2B, 0x6A, 0x1F, 0xB0, 0xB0, 0x31, 0x66, 0x0E, 0xFF, 0xA3, 0x98, 0xD2, 0x0B, 0x53, 0x38,
+        0x4C, 0xC4, 0xE6, 0xD9, 0x64, 0xAA, 0x04, 0x58, 0x1B, 0x04, 0x04, 0x71, 0x37, 0x44, 0xB0, 0x19,
+        0x76, 0x18, 0x02, 0xB6, 0xBF, 0x56, 0x7B, 0xCD, 0xCE, 0xED, 0x9D, 0xC8, 0xAE, 0x32, 0x4D, 0xF3,
+        0x19, 0x34, 0x6E, 0x58, 0x00, 0xF4, 0x52, 0x2B, 0x7C, 0xF8, 0xCA, 0x9D, 0x61, 0xC5, 0x8B, 0x94,
+        0xCD, 0xCF, 0xCA, 0xA0, 0xB3, 0xB4, 0xF9, 0xD6, 0x48, 0x85, 0x1D, 0x7C, 0x25, 0x22, 0x8E, 0xE3,
+        0xA9, 0xD6, 0x45, 0x02, 0x3D, 0x76, 0xC5, 0x39, 0x81, 0x7B, 0x04, 0x6E, 0xE9, 0x2C, 0x8D, 0x0D,
+        0x31, 0x89, 0x27, 0x30, 0xCD, 0x1E, 0x60, 0x8B, 0x49, 0x5C, 0xFB, 0x2C, 0xDF, 0xCE, 0x73, 0x1D,
+        0xBD, 0xB8, 0xA7, 0x28, 0xAE, 0xDB, 0xA1, 0x9D, 0xCA, 0xA7, 0x71, 0xBD, 0x3F, 0x31, 0xE5, 0xC7,
+        0x6B, 0xBF, 0xD6, 0x47, 0x56, 0xFC, 0x78, 0xCE, 0x75, 0x40, 0x8D, 0x0F, 0x50, 0x5D, 0xED, 0x6B,
+        0x52, 0xE6, 0xFD, 0xC3, 0x3B, 0x99, 0x4C, 0xF5, 0x8E, 0xF5, 0xEC, 0x04, 0xC3, 0xCA, 0x9F, 0x75,
+        0x03, 0xC1, 0x97, 0x22, 0x6D, 0x7C, 0xC0, 0x82, 0x4A, 0x17, 0x4F, 0x92, 0x69, 0x4F, 0x13, 0x99,
+        0xC6, 0x8C, 0x21, 0xB6, 0x91, 0x3F, 0xAC, 0xFF, 0xEF, 0x5A, 0x57, 0x99, 0x76, 0x7F, 0xD3, 0x3F,
+        0x33, 0x7F, 0x94, 0xA5, 0x4D, 0x07, 0xF2, 0xD5, 0x14, 0x62, 0x74, 0x1B, 0x34, 0x16, 0x01, 0xBE,
+        0x9F, 0xA6, 0x80, 0xCB, 0x64, 0xB3, 0xF6, 0xDE, 0x65, 0x64, 0x1A, 0x94, 0x04, 0x0B, 0x06, 0xC9,
+        0x1A, 0x50, 0x06, 0xF2, 0x47, 0x70, 0xCE, 0x8A, 0x37, 0xAC, 0x27, 0xD7, 0x21, 0x77, 0x32, 0xD5,
+        0xED, 0xCD, 0x92, 0xAA, 0x5D, 0x16, 0x26, 0xEC, 0xE3, 0x89, 0xE3, 0x6E, 0x46, 0xC8, 0x5E, 0x36,
+        0xAB, 0xCA, 0x9B, 0x2B, 0xEA, 0x27, 0xB0, 0xC1, 0x22, 0x5F, 0xEA, 0x32, 0x5E, 0x64, 0xE6, 0xE5,
+        0x2F, 0x63, 0x64, 0xFF, 0x34, 0x0E, 0x42, 0x2D, 0x32, 0xBE, 0xB1, 0x9E, 0x68, 0x04, 0xB9, 0x20,
+        0x08, 0xC6, 0xFF, 0xA8, 0x84, 0x96, 0xAE, 0x85, 0x2E, 0xC0, 0x09, 0xC2, 0x7F, 0xA5, 0x0F, 0x47,
+        0x8F, 0x82, 0xD3, 0x0F, 0x7C, 0xE2, 0x3C, 0xCD, 0xDE, 0x96, 0x9C, 0xA4, 0x4A, 0xEA, 0xEB, 0xD0,
+        0x9B, 0x88, 0xD6, 0x8C, 0x9E, 0x67, 0x22, 0x24, 0x74, 0x38, 0xCC, 0x51, 0xCC, 0xE2, 0xB7, 0xE6,
+        0x08, 0x9F, 0xF0, 0x68, 0xFA, 0x77, 0x75, 0x07, 0xAE, 0xF7, 0xCC, 0x17, 0x29, 0x22, 0x04, 0x82,
+        0x82, 0x26, 0x32, 0x12, 0xC6, 0x09, 0xD9, 0xEA, 0x2A, 0x6E, 0x3E, 0x17, 0x2D, 0xE2, 0x38, 0xD8,
+        0xC3, 0x9C, 0xAB, 0xD5, 0xAC, 0x1C, 0xA1, 0x06, 0x46, 0xE2, 0x3F, 0xD5, 0xF5, 0x15, 0x08, 0x11,
+        0xF8, 0xA8, 0x09, 0x85, 0x57, 0xDF, 0xE4, 0x5E, 0x82, 0x56, 0xE8, 0x30, 0xB6, 0x0A, 0xCE, 0x62,
+        0xD6, 0x13, 0xAC, 0x2F, 0x7B, 0x17, 0xBE, 0xD3, 0x1B, 0x6E, 0xAF, 0xF6, 0xE2, 0x6C, 0xAF, 0x04,
+        0x06, 0xF9, 0xD9, 0xB8, 0x03, 0xEC, 0xF1, 0x91, 0x63, 0x7C, 0x73, 0xA4, 0x41, 0x3D, 0xFA, 0x18,
+        0x0F, 0xDD, 0xF8, 0x4A, 0x59, 0x47, 0xFB, 0xC9, 0xC6, 0x06, 0xED, 0x86, 0xC3, 0xFA, 0xC3, 0xA7,
+        0x7C, 0x80, 0xC6, 0x8E, 0x60, 0x30, 0x59, 0xBA, 0x69, 0xB8, 0xE2, 0xA3, 0x0E, 0x45, 0xC4, 0xD4,
+        0x7E, 0xA4, 0xDD, 0x2F, 0x5C, 0x28, 0x10, 0x02, 0xD8, 0x68, 0x90, 0x60, 0x3A, 0x84, 0x21, 0x60,
+        0x04, 0x4C, 0x46, 0xD0, 0x61, 0x4F, 0x6D, 0x42, 0x98, 0xF9, 0x86, 0x75, 0x82, 0x0C, 0x42, 0x27,
+        0xA3, 0x03, 0xBC, 0xFF, 0x9B, 0x18, 0x4F, 0x24, 0x77, 0xDE, 0x96, 0x7C, 0x0A, 0x67, 0xD0, 0x02,
+        0xB8, 0x4F, 0xC6, 0x9B, 0xCF, 0x18, 0xC7, 0x43, 0x2B, 0x9A, 0x3F, 0xD0, 0x34, 0x73, 0x63, 0x6D,
+        0x75, 0xA5, 0xB0, 0x7C, 0x65, 0x4C, 0x92, 0x85, 0x84, 0xA2, 0xD8, 0x8D, 0xFE, 0xDA, 0xB1, 0x41,
+        0x78, 0x04, 0xB8, 0xDA, 0x94, 0x03, 0x2A, 0x95, 0x75, 0x18, 0xEB, 0x0F, 0x64, 0x33, 0x57, 0x1E,
+        0x87, 0x61, 0xCE, 0xFF, 0xC7, 0x36, 0x93, 0xE8, 0x4E, 0xDD, 0x49, 0x15, 0x0A, 0x56, 0x4F, 0x67,
+        0x6E, 0x03, 0x28, 0x04, 0xDF, 0xA4, 0x48, 0x05, 0xA1, 0xE4, 0xD7, 0xC9, 0x9C, 0xC9, 0x76, 0x28,
+        0x08, 0xB0, 0x92, 0xCC, 0x58, 0x4D, 0x95, 0xFF, 0x3B, 0x51, 0x14, 0x88, 0xE4, 0xE7, 0x4E, 0xFD,
+        0xF6, 0xE7, 0x04, 0x76, 0x9E, 0xDD, 0x6C, 0xB6, 0xF3, 0xA3, 0x5E, 0x3F, 0x60, 0xAF, 0x5B, 0x4D,
+        0x91, 0x99, 0x26, 0x0A, 0x30, 0x0E, 0x52, 0x69, 0xE5, 0xB3, 0x46, 0xB6, 0xFF, 0x5F, 0x91, 0x1D,
+        0xDE, 0x53, 0xDA, 0xAD, 0x08, 0xCE, 0x61, 0x7C, 0x03, 0xD9, 0x8D, 0x0C, 0xEB, 0x8C, 0x14, 0xC4,
+        0x33, 0x82, 0xF0, 0xC8, 0x51, 0xD9, 0x83, 0xD8, 0x84, 0xFC, 0x8B, 0x49, 0xE6, 0x75, 0xE8, 0xC6,
+        0x4A, 0x55, 0x0D, 0x04, 0x0D, 0xFC, 0x25, 0x8A, 0x51, 0xC0, 0x6D, 0xB1, 0x32, 0x68, 0xDD, 0xAE,
+        0x96, 0x8A, 0x91, 0x98, 0xCE, 0x19, 0xDE, 0xD6, 0x63, 0xF2, 0x1F, 0xFB, 0x6D, 0x42, 0x52, 0x60,
+        0xC9, 0x03, 0x22, 0x75, 0x62, 0xEA, 0x62, 0xD4, 0x28, 0x61, 0x92, 0x48, 0x1B, 0x47, 0x69, 0x74,
+        0xEC, 0x6B, 0x29, 0x8A, 0xED, 0x5D, 0xA9, 0x42, 0xB6, 0x04, 0x8A, 0xDD, 0x48, 0x3C, 0x8E, 0xE2,
+        0x35, 0xEE, 0x57, 0xE9, 0x04, 0xD7, 0x5A, 0x7B, 0xD6, 0x7E, 0x77, 0x53, 0xD6, 0xCE, 0xA3, 0xF7,
+        0x8B, 0xCB, 0xF5, 0xB5, 0xFF, 0xD8, 0x06, 0xEA, 0x23, 0xF1, 0xB7, 0xFF, 0x0B, 0xAD, 0x03, 0x16,
+        0x1B, 0x0D, 0xC3, 0x17, 0xF5, 0x8F, 0x59, 0xDE, 0x0B, 0x46, 0xBC, 0xA9, 0x13, 0xC6, 0x08, 0x57,
+        0x0E, 0x1C, 0xA6, 0x31, 0x32, 0x52, 0x52, 0xD4, 0xB5, 0x22, 0x50, 0x2A, 0xCE, 0x36, 0xC5, 0xD2,
+        0xF5, 0x51, 0x7C, 0xE3, 0xCD, 0x04, 0x60, 0x57, 0x17, 0x0B, 0x1D, 0xD1, 0x2F, 0xDF, 0x8D, 0xE0,
+        0x5F, 0x28, 0x1D, 0x8E, 0x06, 0xBB, 0x91, 0xE1, 0x49, 0x3A, 0x8B, 0x91, 0xD4, 0xCC, 0x5A, 0x21,
+        0x38, 0x21, 0x20, 0xA9, 0x59, 0xE5, 0x9A, 0x1A, 0xF0, 0xB2, 0x6A, 0x6A, 0x48, 0x07, 0xAD, 0xD9,
+        0xA2, 0xDA, 0xF7, 0x1D, 0xF2, 0x62, 0x46, 0x51, 0x52, 0xBC, 0x3E, 0xE2, 0x4C, 0x65, 0xE8, 0x99,
+        0xBE, 0x93, 0x23, 0x85, 0xA2, 0xA8, 0x04, 0xCA, 0x2C, 0xF7, 0x2F, 0x79, 0xFD, 0x7F, 0x80, 0x74,
+        0x65, 0x9D, 0x84, 0xE7, 0xED, 0xEB, 0x93, 0x90, 0xC0, 0xBF, 0x9E, 0x63, 0x47, 0x0C, 0x16, 0x85,
+        0xB9, 0x1E, 0x4B, 0xBB, 0x32, 0xEA, 0x4C, 0xDC, 0x12, 0x54, 0x27, 0x29, 0x87, 0x2E, 0xCB, 0xAD,
+        0x86, 0xA7, 0xA4, 0xD3, 0xC9, 0x98, 0xE5, 0x30, 0x84, 0x23, 0xA8, 0x7B, 0xF6, 0x35, 0xF6, 0x02,
+        0xE0, 0x3B, 0x15, 0x96, 0x36, 0xFC, 0x8C, 0x04, 0xB1, 0x0B, 0xA7, 0xC1, 0x43, 0xC4, 0x50, 0x5B,
+        0x7A, 0x61, 0xDD, 0xCB, 0xFD, 0x0B, 0xC0, 0x55, 0x7E, 0x89, 0x55, 0x64, 0x05, 0x5E, 0x1F, 0xD5,
+        0x0E, 0x4E, 0xC2, 0xD6, 0x23, 0xD2, 0x62, 0x4D, 0x7C, 0x46, 0x1A, 0xAB, 0xF3, 0x73, 0xCD, 0x11,
+        0xC9, 0xAE, 0xD8, 0xAF, 0x27, 0xD9, 0xC5, 0x8B, 0x5B, 0xBD, 0x4B, 0x60, 0x58, 0x4A, 0xBB, 0x1B,
+        0x88, 0xBE, 0x7E, 0x89, 0x15, 0x4C, 0x8E, 0x24, 0x04, 0xDA, 0xBB, 0x80, 0x6F, 0xA0, 0xE3, 0x1D,
+        0x9C, 0x49, 0xE1, 0xCA, 0xD3, 0xBC, 0xCD, 0x08, 0x22, 0x09, 0x00, 0x28, 0x7A, 0xE5, 0x27, 0x2D,
+        0xB4, 0xD8, 0x4A, 0x11, 0xFC, 0x70, 0x6F, 0xC4, 0xDF, 0x2B, 0xC5, 0xCA, 0x19, 0x91, 0x5A, 0x5F,
+        0xBC, 0x7A, 0xDA, 0xD0, 0x25, 0x6E, 0x09, 0xD2, 0xEE, 0xA7, 0x71, 0x9D, 0x2F, 0xCB, 0x80, 0x63,
+        0x0D, 0xA9, 0x06, 0xD9, 0xCA, 0x58, 0x9A, 0xB3, 0x13, 0x04, 0x6D, 0xB9, 0x50, 0x17, 0x22, 0xF1,
+        0x5A, 0xB8, 0xC3, 0xE2, 0xE8, 0xAE, 0x54, 0xBA, 0x8A, 0x32, 0xCC, 0xC7, 0x87, 0xFD, 0xBD, 0x47,
+        0x5F, 0x2A, 0x36, 0xBB, 0x17, 0xE1, 0xB9, 0x8B, 0x86, 0x11, 0xE0, 0x8D, 0x88, 0xD9, 0x4F, 0x79,
+        0xB6, 0x5D, 0x0B, 0xDC, 0x7C, 0xC3, 0x05, 0x5D, 0xC6, 0x4C, 0x22, 0x8A, 0x96, 0xFB, 0x9F, 0xF4,
+        0xC4, 0xAC, 0xC9, 0xB5, 0x2E, 0x7C, 0x1A, 0x30, 0x30, 0xFE, 0x04, 0xE7, 0xFD, 0x28, 0xC4, 0x03,
+        0xED, 0xC3, 0xDB, 0xDD, 0xA0, 0xDE, 0x37, 0x09, 0x3C, 0xF0, 0xDC, 0x0E, 0x6C, 0x25, 0xF4, 0x89,
+        0xB9, 0x44, 0x6E, 0x98, 0xBD, 0xD8, 0x7F, 0xEB, 0xC2, 0x34, 0x9D, 0x9D, 0x66, 0xCB, 0x8B, 0xB5,
+        0xD0, 0x02, 0x67, 0x6F, 0x1D, 0x9C, 0x2D, 0x06, 0x69, 0x45, 0xD5, 0x0D, 0x91, 0xFF, 0xEA, 0xC8,
+        0x3E, 0x1B, 0xD0, 0xAE, 0x8F, 0x5B, 0xA4, 0x58, 0xA5, 0xBF, 0xD8, 0x04, 0xD7, 0xE2, 0xD8, 0x4E,
+        0x58, 0x0F, 0x80, 0x0D, 0x09, 0xA5, 0x40, 0x9A, 0xE6, 0x5A, 0x4E, 0xBA, 0x41, 0xF4, 0x0A, 0x5E,
+        0x57, 0x6E, 0x03, 0x45, 0x94, 0xB4, 0x3C, 0x0D, 0x78, 0x46, 0x20, 0x42, 0x73, 0x94, 0x53, 0x0E,
+        0x13, 0xBD, 0x0E, 0xD6, 0xC1, 0x42, 0xB5, 0xFC, 0x89, 0x9F, 0x6D, 0x51, 0x9F, 0xF1, 0xA9, 0x95,
+        0x23, 0x4E, 0x60, 0x0E, 0x98, 0x48, 0xB9, 0x72, 0xBA, 0x84, 0x35, 0x55, 0x04, 0xC1, 0x21, 0x80,
+        0xF9, 0x82, 0x04, 0xCA, 0xAB, 0x92, 0x2D, 0x18, 0x2B, 0x56, 0x88, 0xD2, 0xD8, 0x38, 0xBD, 0xAE,
+        0xBF, 0x29, 0xB3, 0x32, 0xD3, 0x9F, 0xBE, 0xEE, 0x74, 0x10, 0xAA, 0xB1, 0x73, 0x7B, 0x31, 0xA8,
+        0x0C, 0xAF, 0x15, 0xC7, 0x2B, 0x1F, 0xBD, 0x98, 0xB2, 0x0A, 0x72, 0x14, 0x0B, 0x29, 0xAE, 0xF8,
+        0xE1, 0x12, 0xC6, 0x42, 0x08, 0xD6, 0xE0, 0xA1, 0x74, 0x94, 0x28, 0x4F, 0x5A, 0x04, 0xA8, 0xE2,
+        0x82, 0xFF, 0x0C, 0x97, 0x06, 0x90, 0x72, 0x15, 0xFF, 0x98, 0xE8, 0xFD, 0x41, 0x66, 0x15, 0x31,
+        0x1D, 0xE0, 0x44, 0x6F, 0x1E, 0x06, 0x2A, 0x73, 0xB0, 0x61, 0x0D, 0x06, 0x4E, 0x13, 0x7F, 0x97,
+        0x35, 0x5B, 0x8D, 0xB8, 0x1C, 0x09, 0xAB, 0xFB, 0x7F, 0x3C, 0x5B, 0x25, 0x15, 0x88, 0x8B, 0x67,
+        0x9A, 0x3E, 0x50, 0xDD, 0x6B, 0xD6, 0xCE, 0xF7, 0xC7, 0x31, 0x11, 0xF4, 0xCC, 0x0C, 0x04, 0x39,
+        0xD5, 0x92, 0x28, 0x0A, 0xE8, 0x57, 0xD1, 0x66, 0xAF, 0xC3, 0x98, 0xAA, 0x75, 0xC1, 0x35, 0x5A,
+        0xD8, 0x5A, 0x9C, 0x73, 0xCD, 0x2E, 0x0E, 0x2E, 0x3E, 0xC1, 0x8F, 0x3C, 0x97, 0xAB, 0x96, 0xD4,
+        0x9B, 0x5B, 0x7B, 0xAA, 0x5E, 0xCE, 0x0F, 0x0B, 0xA5, 0xE7, 0x70, 0xFB, 0xD0, 0xBD, 0xF5, 0xF0,
+        0xFF, 0x5F, 0x70, 0x0A, 0xDE, 0x02, 0xBD, 0x53, 0x13, 0xE6, 0xB5, 0xF8, 0xDA, 0xFB, 0x8D, 0x04,
+        0x1D, 0xE6, 0x89, 0xEE, 0xEB, 0xDF, 0xBA, 0x63, 0x55, 0x18, 0xA4, 0xF3, 0xA6, 0xBE, 0x12, 0xA1,
+        0xC6, 0x93, 0xF3, 0x18, 0x70, 0x54, 0xF6, 0x90, 0x44, 0x6D, 0x99, 0xA1, 0xDF, 0xD2, 0xDB, 0x12,
+        0xBF, 0x82, 0x1A, 0x82, 0x5E, 0xD7, 0x21, 0xE6, 0xA4, 0x1D, 0x1D, 0xB7, 0x2D, 0x1F, 0xA0, 0xFF,
+        0xD1, 0xE6, 0x9E, 0x39, 0xF0, 0xB4, 0x80, 0x17, 0x6E, 0x14, 0x15, 0xDB, 0x2F, 0x44, 0x40, 0x9F,
+        0x04, 0xD6, 0x1D, 0x83, 0x06, 0x82, 0x7C, 0xDA, 0x18, 0x7B, 0xB4, 0x6D, 0x55, 0xF3, 0xA7, 0x44,
+        0x6D, 0x53, 0x1C, 0x21, 0x97, 0x76, 0xB5, 0x5C, 0xC7, 0xB8, 0xC6, 0x01, 0x86, 0x08, 0x05, 0x78,
+        0x1A, 0xF8, 0x50, 0x81, 0x14, 0xBA, 0x1F, 0xB3, 0xA5, 0xD5, 0x32, 0xF6, 0x83, 0xAC, 0xE4, 0x7A,
+        0x3E, 0x58, 0x69, 0xB9, 0xD3, 0xF6, 0xF3, 0xE7, 0xD0, 0x6D, 0xFD, 0xE0, 0xCC, 0xF1, 0xD3, 0xF5,
+        0xCC, 0x04, 0x76, 0xC8, 0x57, 0xC6, 0x3C, 0xF0, 0x6A, 0x95, 0x40, 0x8F, 0xD4, 0x16, 0x3F, 0x7B,
+        0x18, 0xE6, 0xF6, 0x39, 0xCA, 0x33, 0x57, 0x8F, 0xED, 0x3B, 0xEF, 0x8D, 0x70, 0x3E, 0xA5, 0xCA,
+        0x9E, 0x33, 0xEF, 0xC9, 0x29, 0xFC, 0xEC, 0x50, 0xD8, 0x73, 0x78, 0xE6, 0x55, 0xF6, 0xA4, 0xDA,
+        0x7A, 0x90, 0xF0, 0xD9, 0x8F, 0x36, 0x4F, 0x6A, 0x03, 0x01, 0xBA, 0x75, 0x69, 0x46, 0xF0, 0xD1,
+        0x04, 0x2D, 0x04, 0x5E, 0xE6, 0xD1, 0x79, 0x4F, 0x23, 0x38, 0x72, 0x4E, 0x2A, 0x9B, 0xD9, 0x18,
+        0x1A, 0x65, 0x54, 0xFA, 0xD2, 0xBD, 0xD0, 0x2A, 0xF3, 0x90, 0x1B, 0xC1, 0x4C, 0x4B, 0x63, 0xD1,
+        0xE8, 0xDA, 0x8A, 0x9B, 0x71, 0x8A, 0x35, 0xB9, 0x9F, 0x4A, 0x41, 0x27, 0x6A, 0xDB, 0x5A, 0xAB,
+        0x02, 0x1F, 0xB6, 0x24, 0x68, 0x0E, 0x8F, 0x7A, 0x35, 0x75, 0xBA, 0x04, 0xFC, 0x65, 0x5C, 0x1E,
+        0xE8, 0xC6, 0x42, 0x04, 0x92, 0xD4, 0x30, 0x76, 0xBC, 0x30, 0xC4, 0x9F, 0x72, 0x16, 0x93, 0x40,
+        0x16, 0x12, 0xBE, 0xE9, 0xC2, 0x79, 0xCF, 0x52, 0x4F, 0x22, 0x09, 0xE3, 0x88, 0x80, 0x30, 0x10,
+        0xD7, 0x7B, 0x73, 0xBA, 0xC5, 0xEF, 0x77, 0x0E, 0xED, 0x24, 0x39, 0xD1, 0x9A, 0x9D, 0xE5, 0x19,
+        0x9E, 0x7D, 0x0E, 0x86, 0x30, 0x26, 0x7F, 0xE6, 0xCF, 0x4B, 0xB9, 0x54, 0xC0, 0xBF, 0xE2, 0x7C,
+        0x70, 0x97, 0xAD, 0x33, 0x04, 0x74, 0x57, 0xB9, 0x41, 0xC9, 0x30, 0x56, 0x5D, 0x62, 0x86, 0xC0,
+        0x7D, 0x13, 0x02, 0x23, 0xFF, 0x13, 0xEA, 0x92, 0x53, 0x82, 0xC9, 0x26, 0x7B, 0xEC, 0x68, 0x16,
+        0xD3, 0x07, 0x3C, 0x36, 0x4C, 0x44, 0xF8, 0xF4, 0x4B, 0x58, 0xDF, 0x3A, 0x4C, 0x9F, 0xE9, 0x8D,
+        0x71, 0x46, 0xF4, 0xEF, 0x5E, 0xE6, 0x23, 0xF8, 0x10, 0xD7, 0xA9, 0xDD, 0x1E, 0x64, 0x62, 0x7C,
+        0x81, 0x17, 0x08, 0x0B, 0x42, 0x04, 0x7E, 0xC5, 0x63, 0x33, 0x78, 0x0A, 0x3C, 0xE0, 0xC6, 0xE7,
+        0x82, 0x17, 0x90, 0x5F, 0x92, 0x52, 0x84, 0x3A, 0x85, 0x4D, 0xA2, 0xD3, 0x7E, 0x66, 0x6C, 0x2E,
+        0x69, 0xCA, 0xE3, 0xFB, 0x10, 0x23, 0xDF, 0xD1, 0x40, 0x8B, 0x86, 0xF0, 0x82, 0x8B, 0xF0, 0xA4,
+        0x5D, 0x96, 0x0E, 0x37, 0x18, 0x2D, 0xF8, 0xBB, 0x81, 0xEA, 0xBF, 0xCC, 0xDE, 0x3A, 0xEF, 0x77,
+        0xCD, 0x90, 0x1D, 0xB7, 0xEC, 0xFC, 0x04, 0xE3, 0x9A, 0x6D, 0xC7, 0xCD, 0xFD, 0x2E, 0x28, 0x3E,
+        0xE4, 0x22, 0x16, 0x0F, 0x92, 0x00, 0x36, 0xC0, 0x94, 0xA9, 0x22, 0xE4, 0x14, 0xB8, 0xDB, 0x05,
+        0x5C, 0x7A, 0x2D, 0x41, 0x07, 0xDE, 0x40, 0x7A, 0xAB, 0xDD, 0xC2, 0x88, 0x89, 0xF8, 0xC8, 0x15,
+        0x20, 0x1C, 0x9D, 0x6F, 0x21, 0x53, 0xE7, 0xB0, 0x6D, 0xCD, 0x9F, 0x97, 0x17, 0x64, 0xF9, 0x91,
+        0x30, 0xAD, 0x64, 0x8D, 0xD8, 0x65, 0xA1, 0x04, 0xD8, 0x37, 0x2B, 0xAD, 0x6E, 0x3C, 0xA5, 0xE2,
+        0x76, 0xC7, 0xD1, 0x08, 0xCD, 0x75, 0x14, 0x18, 0x87, 0x6A, 0xDF, 0x2D, 0x09, 0x87, 0x08, 0x97,
+        0xEE, 0x8E, 0x54, 0xEA, 0xD7, 0xDD, 0x32, 0xA1, 0xED, 0x12, 0x70, 0xA4, 0xC6, 0xCA, 0x6A, 0x9B,
+        0x42, 0xD3, 0x3A, 0x96, 0x05, 0x9C, 0xEB, 0x06, 0xBC, 0xB8, 0x88, 0x1D, 0x10, 0xB8, 0x23, 0xC0,
+        0xF6, 0x3F, 0x6D, 0xD7, 0xC9, 0x04, 0x31, 0x05, 0x04, 0xA4, 0xE9, 0x3D, 0xA3, 0xB9, 0x25, 0x4E,
+        0x0F, 0xD3, 0x23, 0xAF, 0xEC, 0xD0, 0x8E, 0xB3, 0x9B, 0x32, 0xEC, 0x2E, 0x23, 0x5C, 0x5B, 0x11,
+        0xAC, 0x39, 0x2D, 0x0A, 0x7D, 0x0F, 0x22, 0xC1, 0xCA, 0x63, 0x7D, 0x58, 0xC9, 0x70, 0xDB, 0x4E,
+        0x74, 0x42, 0xB2, 0x31, 0x13, 0x84, 0xD8, 0xE2, 0x5C, 0x94, 0xBE, 0x41, 0xD9, 0xC0, 0xA7, 0x21,
+        0x28, 0xA9, 0xB7, 0x92, 0x58, 0x40, 0xA4, 0x81, 0xB3, 0x04, 0x1F, 0xA8, 0x5D, 0x93, 0x5D, 0xBE,
+        0xDB, 0x19, 0xE2, 0x0C, 0x02, 0x0C, 0x2F, 0x32, 0x42, 0x06, 0x54, 0x41, 0x7E, 0x30, 0x91, 0xA1,
+        0x36, 0x41, 0xF0, 0x9C, 0xFD, 0x6B, 0xA4, 0xB2, 0xB9, 0x1E, 0x6E, 0x85, 0x7E, 0x66, 0x8E, 0x60,
+        0x95, 0xE9, 0x0A, 0x48, 0xC1, 0x0A, 0xC6, 0x59, 0xF8, 0xC6, 0x29, 0xE8, 0x13, 0xD1, 0x20, 0x70,
+        0xB1, 0x42, 0x45, 0xD5, 0x7E, 0x69, 0x7C, 0xAF, 0xAE, 0x02, 0x04, 0x03, 0x0E, 0x7D, 0x62, 0x75,
+        0x9E, 0xB8, 0xD2, 0x94, 0xD5, 0xC3, 0xC6, 0x4F, 0xF2, 0xB1, 0x34, 0xBE, 0x33, 0xAE, 0xC6, 0xD5,
+        0x5C, 0x94, 0x7B, 0xBA, 0xC3, 0x05, 0xEA, 0x8D, 0x08, 0x71, 0xD6, 0xCE, 0xB5, 0x4E, 0x25, 0x00,
+        0x14, 0xD3, 0x2F, 0x4A, 0xFA, 0x37, 0xB2, 0x31, 0x9C, 0x39, 0x42, 0x09, 0x7A, 0xEB, 0xEB, 0x6D,
+        0xE6, 0x1D, 0x4D, 0x24, 0x0A, 0xD4, 0x13, 0x8A, 0x5E, 0xA1, 0xD9, 0x04, 0x19, 0x07, 0x69, 0x4A,
+        0xDF, 0x50, 0xFD, 0x02, 0xC8, 0xE9, 0x34, 0x00, 0xEB, 0xDF, 0x4D, 0x45, 0x9D, 0x08, 0x57, 0x87,
+        0x28, 0x2A, 0xAE, 0x8C, 0xEE, 0x37, 0xBB, 0x3B, 0xAD, 0x38, 0x2A, 0xE9, 0x86, 0xEF, 0xE2, 0xB9,
+        0xA8, 0xBE, 0x66, 0x6D, 0xCE, 0xF2, 0xF6, 0x86, 0x82, 0xF9, 0xB1, 0xDA, 0xB1, 0xC6, 0x1F, 0xA3,
+        0x83, 0xAF, 0xF4, 0xC5, 0x3B, 0xAF, 0x02, 0x48, 0xFC, 0x74, 0xF5, 0x2D, 0x04, 0x9C, 0xD2, 0xE6,
+        0x25, 0xC4, 0x04, 0xDD, 0xBE, 0x5C, 0x1C, 0xC4, 0x2F, 0x4B, 0x04, 0xE1, 0xF2, 0xD6, 0xD4, 0xFA,
+        0x4A, 0x72, 0xD1, 0x19, 0x33, 0x6C, 0x54, 0x3F, 0x69, 0xC1, 0xF2, 0xDD, 0xF5, 0xBD, 0xA2, 0x51,
+        0x73, 0x17, 0x2D, 0xA0, 0x6A, 0xB1, 0xBD, 0x86, 0x8D, 0xF6, 0x84, 0x47, 0x11, 0x29, 0x0F, 0x2B,
+        0x0C, 0xAC, 0x54, 0x00, 0x61, 0x51, 0x2B, 0x42, 0x0E, 0x93, 0x91, 0xA1, 0x67, 0x04, 0x17, 0x5E,
+        0x15, 0x9F, 0x72, 0x8B, 0x86, 0x5A, 0x72, 0xF9, 0x9C, 0xC6, 0xC6, 0xFC, 0x84, 0x6D, 0xE0, 0xB9,
+        0x38, 0x33, 0xFD, 0x22, 0x22, 0xED, 0x73, 0xFC, 0xE5, 0xB5, 0x51, 0xE5, 0xB7, 0x39, 0xD3, 0x50,
+        0x6E, 0x0D, 0x9E, 0x3C, 0x79, 0xEB, 0xA4, 0xEF, 0x97, 0xA5, 0x1F, 0xF7, 0x1F, 0x5E, 0xAC, 0xB5,
+        0x95, 0x5A, 0xDD, 0x24, 0x34, 0x5C, 0x6E, 0xFA, 0x6F, 0xFE, 0xE9, 0xFE, 0xD6, 0x95, 0x04, 0x33,
+        0x22, 0xD4, 0x01, 0x24, 0x3C, 0x4E, 0x25, 0x82, 0xA2, 0x14, 0x7C, 0x10, 0x4D, 0x6E, 0xCB, 0xF7,
+        0x74, 0xD1, 0x63, 0xDB, 0x0F, 0x5E, 0x53, 0x13, 0xB7, 0xE0, 0xE7, 0x42, 0xD0, 0xE6, 0xBD, 0x56,
+        0xE7, 0x07, 0x97, 0xE9, 0x66, 0x4E, 0xF5, 0xBF, 0xB0, 0x19, 0xBC, 0x4D, 0xDA, 0xF9, 0xB7, 0x28,
+        0x05, 0xF6, 0x3E, 0xA2, 0x87, 0x3A, 0xF6, 0x24, 0xF3, 0xA2, 0xE9, 0x6C, 0x28, 0xB2, 0xA0, 0x04,
+        0x41, 0xEC, 0x3E, 0x58, 0x6B, 0xCB, 0x7B, 0xFE, 0x1F, 0x87, 0x4C, 0xE9, 0xFD, 0xDD, 0x88, 0xAC,
+        0x7D, 0x0D, 0x95, 0x99, 0x78, 0x16, 0x5A, 0x1E, 0x80, 0x4D, 0x9C, 0x0D, 0x97, 0x3A, 0xA6, 0x3F,
+        0x46, 0x70, 0xDE, 0xA3, 0xC0, 0x4B, 0xCA, 0x13, 0xD7, 0x0C, 0x36, 0x90, 0x40, 0xD9, 0x4E, 0xE9,
+        0xCB, 0x30, 0x0A, 0xFF, 0x3E, 0x67, 0x4A, 0xAD, 0xFC, 0xBB, 0x47, 0x1C, 0x13, 0x61, 0xAE, 0x6D,
+        0x04, 0xE8, 0x0F, 0xEA, 0x14, 0x44, 0x1F, 0xB3, 0x3A, 0x7D, 0x8A, 0xDA, 0xB9, 0x47, 0x5D, 0x7F,
+        0xAB, 0x20, 0x19, 0xEF, 0xFB, 0x51, 0x56, 0xA7, 0x92, 0xF1, 0xA1, 0x17, 0x78, 0xE3, 0xC0, 0xDF,
+        0x5D, 0xEE, 0xD1, 0xDE, 0x7F, 0x63, 0x8E, 0x00, 0x77, 0x1E, 0x89, 0x76, 0x8C, 0xA3, 0xCA, 0x94,
+        0x47, 0x2D, 0x15, 0x5E, 0x80, 0xAF, 0x32, 0x2E, 0xA9, 0xFC, 0xB4, 0x29, 0x1B, 0x6A, 0xC9, 0xEC,
+        0x78, 0x04, 0x08, 0x07, 0x3F, 0x2B, 0xF1, 0x8F, 0x2D, 0x3A, 0xE9, 0x2E, 0xA1, 0x74, 0xFA, 0x72,
+        0xE0, 0xDC, 0x31, 0xC3, 0x16, 0x82, 0x10, 0x27, 0xB6, 0xC2, 0x74, 0xC3, 0x8A, 0xEE, 0x5B, 0x54,
+        0x86, 0x01, 0xE8, 0x73, 0x79, 0x4E, 0xA3, 0x79, 0x3C, 0x60, 0xCA, 0xDB, 0xB7, 0x1F, 0x74, 0x39,
+        0x31, 0x3D, 0x6B, 0x8E, 0xAA, 0x16, 0xBE, 0xF6, 0xB4, 0xC9, 0x40, 0x4D, 0x49, 0x3F, 0xFF, 0x9B,
+        0xF8, 0xB2, 0x04, 0xD9, 0xF0, 0x97, 0xD3, 0xA0, 0x00, 0x1F, 0xDE, 0x7B, 0xA4, 0xC3, 0xEF, 0x86,
+        0x64, 0x55, 0xD9, 0xF0, 0xA9, 0xB1, 0xB3, 0x8F, 0x21, 0xE4, 0x0C, 0xC6, 0x1F, 0x2F, 0xD4, 0xAB,
+        0xF5, 0xA7, 0xD8, 0x48, 0x7E, 0xB6, 0x1C, 0x28, 0x4F, 0xE7, 0x0D, 0xD9, 0xA4, 0xA0, 0x6D, 0x94,
+        0x2A, 0xE3, 0x87, 0x8A, 0x90, 0x4B, 0xAC, 0x0F, 0x16, 0x7D, 0xC7, 0x1F, 0x79, 0xC2, 0x2D, 0xA5,
+        0x47, 0x2E, 0xAB, 0x04, 0xAB, 0x5E, 0x3B, 0x53, 0x49, 0xB9, 0x25, 0xC4, 0xE1, 0xA3, 0xA7, 0x95,
+        0xC8, 0x11, 0x95, 0x43, 0x92, 0x1B, 0xA5, 0x2A, 0x98, 0xFF, 0xB0, 0x3C, 0x7B, 0xC5, 0x48, 0x22,
+        0xCA, 0xA2, 0x34, 0x65, 0x73, 0x3C, 0x9C, 0x08, 0x59, 0x8B, 0x2E, 0x14, 0xF4, 0x19, 0xF7, 0x28,
+        0xEB, 0x40, 0xFE, 0xF9, 0x08, 0x7C, 0x84, 0x3A, 0x17, 0x7A, 0x58, 0x55, 0xA7, 0xCA, 0xAF, 0x47,
+        0x3A, 0x78, 0x9C, 0x03, 0x04, 0xA5, 0x76, 0xDF, 0x8E, 0x23, 0xA0, 0x84, 0x11, 0x42, 0x14, 0x39,
+        0xA4, 0x51, 0x8D, 0xA3, 0x18, 0x80, 0xCE, 0xF0, 0xFB, 0xA7, 0xD4, 0xDF, 0x12, 0xB1, 0xA6, 0x97,
+        0x3E, 0xEC, 0xB9, 0x42, 0x66, 0x40, 0xA6, 0xBF, 0x20, 0xE7, 0x66, 0x40, 0xB2, 0xC9, 0x2B, 0x97,
+        0xAF, 0xE5, 0x8C, 0xD8, 0x2C, 0x43, 0x2E, 0x10, 0xA7, 0xF5, 0x14, 0xD9, 0xF3, 0xEE, 0x8B, 0xE1,
+        0x1A, 0xE1, 0xB2, 0x8E, 0xC8, 0x04, 0x4F, 0x39, 0xEB, 0xEA, 0xC7, 0xAB, 0x04, 0xAD, 0xEC, 0x46,
+        0x80, 0x2D, 0x6E, 0xB4, 0x49, 0x2C, 0x32, 0xC7, 0xE2, 0xA4, 0xCF, 0xA2, 0xAF, 0x54, 0x90, 0x46,
+        0xDA, 0x4F, 0x38, 0x48, 0x72, 0x9C, 0x59, 0x20, 0xC7, 0x62, 0xB2, 0x71, 0x40, 0x58, 0x28, 0x4D,
+        0x84, 0xAB, 0x7E, 0x85, 0x0A, 0x8C, 0xFC, 0x23, 0x2A, 0xA7, 0x50, 0xC9, 0xAF, 0x65, 0xA2, 0x0C,
+        0x5C, 0x86, 0x1C, 0x6C, 0x82, 0xF4, 0x04, 0x3C, 0xD3, 0x85, 0x5B, 0x14, 0x5C, 0xE5, 0x8C, 0xBB,
+        0x5A, 0x6C, 0x05, 0xF3, 0x66, 0x86, 0x4B, 0xE1, 0x37, 0x83, 0x16, 0x60, 0xA8, 0x63, 0x22, 0xA4,
+        0x0D, 0xE8, 0xA1, 0xC4, 0x03, 0x79, 0x54, 0x1D, 0x4A, 0xF9, 0xE2, 0x4A, 0x46, 0x56, 0x09, 0x56,
+        0x30, 0x3F, 0x1C, 0xA7, 0x18, 0x6B, 0x88, 0x02, 0xAB, 0x61, 0xA7, 0xDF, 0xAF, 0x3F, 0x54, 0xAC,
+        0x95, 0xB4, 0xAB, 0xAD, 0x0E, 0x4C, 0xD5, 0x04, 0x8D, 0x7B, 0x40, 0x26, 0xE7, 0xCE, 0x8C, 0xB3,
+        0xF9, 0x65, 0x43, 0x8F, 0xAA, 0x37, 0x89, 0x68, 0xD4, 0x9B, 0x48, 0x1D, 0xBA, 0xB8, 0x3C, 0x1A,
+        0x75, 0xB8, 0x6B, 0x1E, 0x10, 0x41, 0x54, 0x89, 0x9C, 0x4A, 0x2E, 0x9C, 0xF7, 0xE9, 0x5A, 0xE9,
+        0xB6, 0x16, 0x31, 0xB7, 0x37, 0x1C, 0xC0, 0x36, 0x83, 0x09, 0x3D, 0x8E, 0xA1, 0x2F, 0xB3, 0x9F,
+        0x84, 0x3E, 0xDC, 0xC0, 0x36, 0x2B, 0x02, 0x63, 0x04, 0xA1, 0x55, 0x29, 0x28, 0x2E, 0x11, 0x6A,
+        0x1A, 0xDF, 0xE9, 0x7F, 0xB7, 0xC4, 0x6A, 0xAD, 0x1B, 0x1F, 0xB9, 0xE7, 0x42, 0xFC, 0x50, 0x15,
+        0x3E, 0x6E, 0x31, 0x70, 0xA8, 0xA6, 0xD4, 0x15, 0x2E, 0xE0, 0x93, 0x83, 0xFE, 0x22, 0x5D, 0x2A,
+        0xB9, 0xCF, 0x31, 0xEA, 0x85, 0x38, 0xEC, 0xA1, 0x79, 0x28, 0xB9, 0x1C, 0xE1, 0xA7, 0x7B, 0x1C,
+        0xE3, 0x3E, 0x4E, 0xF5, 0x29, 0x35, 0xFA, 0x94, 0xED, 0x04, 0xC0, 0xDF, 0xA2, 0xDF, 0x3B, 0x60,
+        0xDE, 0x5C, 0xD8, 0xBF, 0x96, 0x9D, 0xFE, 0x9E, 0xF1, 0x02, 0x76, 0xDE, 0x2B, 0xA8, 0xBC, 0xB4,
+        0x48, 0xAF, 0x44, 0xA2, 0x73, 0x06, 0x89, 0xE0, 0x98, 0xDC, 0xBB, 0xA0, 0xBB, 0xD1, 0x1F, 0x84,
+        0x7D, 0x8A, 0xF1, 0xA7, 0x8D, 0x7C, 0x48, 0xA3, 0xB4, 0xCE, 0x11, 0x0A, 0x8A, 0xDB, 0xB0, 0xAC,
+        0xBB, 0x4F, 0xB3, 0x53, 0x8B, 0x30, 0x2B, 0xF5, 0x9B, 0x58, 0x04, 0x40, 0xA2, 0x74, 0xFE, 0x3F,
+        0xD8, 0x06, 0x82, 0x2A, 0x98, 0xD5, 0xAA, 0x5D, 0x4D, 0x98, 0x1B, 0x85, 0xF5, 0xCB, 0x59, 0x7B,
+        0xDF, 0xAC, 0xE1, 0x2A, 0x93, 0xDE, 0x68, 0x06, 0x38, 0xAE, 0xD2, 0x3F, 0x21, 0x0B, 0x4D, 0x0E,
+        0xB1, 0xFF, 0xD2, 0x93, 0x2B, 0xF1, 0xFD, 0xD8, 0x16, 0x04, 0x81, 0x29, 0xEB, 0x79, 0x5C, 0x2E,
+        0x93, 0x6D, 0xF1, 0xC4, 0x35, 0x05, 0xA0, 0xFC, 0xCD, 0x1C, 0x50, 0x04, 0x45, 0x9E, 0xEE, 0xCA,
+        0xEB, 0xF3, 0x3D, 0xDD, 0xC4, 0xEC, 0xAD, 0x9D, 0x61, 0x33, 0xA8, 0xF3, 0xA8, 0xAD, 0x37, 0xB5,
+        0xFE, 0xB9, 0x29, 0x58, 0x4E, 0x1F, 0x19, 0x8B, 0xF1, 0x53, 0xD3, 0x57, 0x2A, 0x50, 0x43, 0xE5,
+        0x14, 0x91, 0x07, 0x04, 0x1F, 0x63, 0xFB, 0x9D, 0xB1, 0x16, 0xA1, 0xAA, 0xD6, 0xC1, 0xC8, 0x62,
+        0x6C, 0x28, 0xEF, 0x44, 0x94, 0x0C, 0x07, 0xD0, 0x47, 0xCE, 0x41, 0x50, 0x04, 0x17, 0x4A, 0x53,
+        0xB9, 0xC9, 0xA2, 0x85, 0x87, 0x2D, 0x39, 0xE5, 0x6E, 0x69, 0x13, 0xCA, 0xB1, 0x5D, 0x59, 0xB1,
+        0xFA, 0x51, 0x25, 0x08, 0xC0, 0x22, 0xF3, 0x82, 0xDE, 0x83, 0x19, 0x49, 0x7C, 0xCC, 0xC9, 0xDC,
+        0x37, 0xAB, 0xFC, 0x9C, 0x16, 0x57, 0xB4, 0x15, 0x5F, 0x2C, 0x47, 0xF9, 0xE6, 0x64, 0x6B, 0x3A,
+        0x1D, 0x8C, 0xB9, 0x85, 0x43, 0x83, 0xDA, 0x13, 0xAC, 0x07, 0x9A, 0xFA, 0x73, 0x04, 0xD9, 0x77,
+        0xB4, 0x08, 0x6F, 0xBD, 0xA4, 0x85, 0x9A, 0x68, 0x42, 0x4D, 0x7C, 0xF0, 0x8A, 0x45, 0x8B, 0x03,
+        0x11, 0x1F, 0xC7, 0xC8, 0xEC, 0x96, 0xB4, 0xFD, 0x19, 0x1B, 0xAC, 0x35, 0x68, 0x07, 0xFA, 0xA0,
+        0x45, 0xCC, 0x34, 0x65, 0x4B, 0x8E, 0x99, 0xAA, 0x8F, 0x80, 0xA6, 0xE6, 0xED, 0x20, 0x1C, 0x37,
+        0xE5, 0xEC, 0x89, 0x62, 0x24, 0x42, 0x8F, 0x9D, 0x1F, 0x85, 0xD4, 0xD0, 0x2C, 0x50, 0x04, 0xEE,
+        0x8F, 0xDC, 0x72, 0x2A, 0x6A, 0x16, 0x0F, 0x97, 0x95, 0xBB, 0xAC, 0xF9, 0x17, 0x12, 0x64, 0x73,
+        0xB7, 0x7A, 0x64, 0x39, 0xA6, 0x1F, 0xD1, 0x8D, 0xF9, 0x23, 0x11, 0xEF, 0x75, 0x49, 0x68, 0xFD,
+        0x1F, 0x7F, 0x45, 0x16, 0x43, 0x8B, 0x7B, 0xB7, 0x62, 0xE3, 0x18, 0x33, 0xE9, 0x99, 0x06, 0xFE,
+        0x48, 0xC1, 0x8A, 0xE3, 0x13, 0xAA, 0xE9, 0x74, 0x7F, 0xD8, 0x28, 0x67, 0x37, 0x2B, 0x79, 0x04,
+        0x28, 0x56, 0xD7, 0xF3, 0x05, 0x45, 0xCB, 0x72, 0xE0, 0x0E, 0xCE, 0x60, 0xE3, 0xA4, 0x18, 0x9B,
+        0x9F, 0xCB, 0x9C, 0x67, 0x5E, 0xBA, 0x40, 0x96, 0xAE, 0xA7, 0xC0, 0x52, 0x0F, 0x68, 0xCA, 0xAA,
+        0x89, 0xDE, 0x6B, 0x28, 0xCA, 0x4F, 0x69, 0xA4, 0xF8, 0xBB, 0x99, 0xAA, 0x9F, 0x51, 0xAE, 0xDB,
+        0x82, 0xE2, 0x17, 0xB5, 0x4C, 0xBC, 0x83, 0xFA, 0x51, 0x09, 0xDF, 0x1D, 0xEB, 0x7E, 0xFD, 0x3F,
+        0x04, 0xBF, 0x3F, 0x81, 0x04, 0x6D, 0x75, 0xD6, 0x68, 0x48, 0xA5, 0xF7, 0xA7, 0x1C, 0x26, 0xF6,
+        0xD1, 0x19, 0x50, 0xAC, 0x27, 0x21, 0x79, 0xB0, 0x4C, 0xA4, 0x30, 0x9C, 0x09, 0xDB, 0x1E, 0x3A,
+        0xC0, 0x1D, 0x82, 0xBA, 0x5A, 0x3F, 0xD4, 0x5B, 0x4E, 0x55, 0xF2, 0x23, 0xB9, 0xF9, 0x0D, 0x9D,
+        0x41, 0x8B, 0x20, 0x5B, 0x35, 0xAD, 0xFC, 0xC3, 0x18, 0x93, 0xC7, 0x63, 0xCB, 0x5F, 0x5F, 0xE5,
+        0xD1, 0x04, 0x53, 0x4E, 0x39, 0x33, 0x81, 0xF0, 0x61, 0xC1, 0x25, 0x4F, 0x03, 0x36, 0xA1, 0xC4,
+        0xB6, 0xC5, 0x26, 0xA2, 0x82, 0x8B, 0x02, 0x43, 0x20, 0x03, 0xB4, 0xF4, 0xFF, 0x32, 0x52, 0x1F,
+        0xA1, 0x73, 0x23, 0xC9, 0x54, 0xF1, 0x2B, 0x07, 0x24, 0xBE, 0x85, 0x4B, 0x2E, 0x1A, 0x07, 0x1C,
+        0xE7, 0xB9, 0xAD, 0x51, 0xC8, 0x3E, 0x05, 0xF5, 0x2A, 0xA2, 0x0F, 0xAF, 0x4F, 0x29, 0xD0, 0xBB,
+        0x12, 0x18, 0x04, 0x40, 0x06, 0x93, 0x9A, 0xE5, 0x3E, 0xE1, 0xA3, 0xEE, 0x9A, 0xE0, 0x73, 0x10,
+        0x9D, 0x38, 0x0C, 0xC1, 0x78, 0xE7, 0xE6, 0x23, 0x12, 0xCE, 0x21, 0xDE, 0x96, 0x3B, 0x27, 0x37,
+        0xD9, 0xD1, 0xFA, 0x79, 0x5A, 0xFF, 0x32, 0xC7, 0x2E, 0xCB, 0x0A, 0xC9, 0x0D, 0x5B, 0xBB, 0x20,
+        0x61, 0xC4, 0x57, 0xC3, 0xD5, 0x8C, 0xA8, 0x4E, 0xD1, 0x0E, 0x8C, 0xC4, 0x73, 0xFB, 0x38, 0x32,
+        0xA5, 0x6B, 0xAE, 0x04, 0x75, 0xED, 0x46, 0xAE, 0x10, 0x59, 0xD6, 0x13, 0xCF, 0xCD, 0xFF, 0xA2,
+        0x36, 0x84, 0x91, 0xCF, 0x13, 0x0E, 0xEB, 0x73, 0x94, 0x6F, 0xAB, 0x9A, 0xD6, 0x8D, 0xFB, 0x54,
+        0xD8, 0x1E, 0x2A, 0x25, 0x25, 0xEB, 0xA8, 0x23, 0x17, 0x05, 0x17, 0x9B, 0x19, 0xBF, 0x23, 0x8C,
+        0xE9, 0x52, 0xBB, 0x62, 0xBA, 0xAF, 0x20, 0xD7, 0x84, 0x8F, 0x91, 0x54, 0x7A, 0x7A, 0xD0, 0x78,
+        0x12, 0x36, 0xCB, 0xF8, 0x04, 0x70, 0xE3, 0x62, 0x92, 0xBD, 0x0B, 0x28, 0x7A, 0x15, 0x69, 0x8B,
+        0x91, 0x72, 0x38, 0xCC, 0x8A, 0xB3, 0x98, 0xF0, 0xE4, 0xA5, 0xDC, 0xA6, 0x4B, 0x5E, 0x15, 0x71,
+        0x76, 0xFF, 0xB2, 0xB8, 0x4A, 0x0A, 0x0F, 0x26, 0x78, 0x9F, 0x77, 0xCA, 0x6B, 0xAB, 0x5B, 0xF4,
+        0xE6, 0x6E, 0xDC, 0xE4, 0x36, 0xE7, 0x58, 0xE2, 0xB7, 0xC8, 0x63, 0xC2, 0xC8, 0xF5, 0x86, 0x3D,
+        0xFC, 0x7C, 0x82, 0x80, 0x1C, 0x04, 0xFC, 0xE6, 0x96, 0xEF, 0x82, 0x76, 0x90, 0xF3, 0xD6, 0x68,
+        0x3B, 0x1E, 0x5C, 0x6C, 0xFE, 0xCE, 0x77, 0xC8, 0x66, 0x1D, 0x4E, 0x0C, 0x5D, 0xE3, 0xF4, 0x12,
+        0x8F, 0x09, 0xAE, 0xEC, 0x8E, 0x40, 0x74, 0xE6, 0xC9, 0xB5, 0x61, 0x6C, 0x40, 0x56, 0xFD, 0xBF,
+        0xDA, 0x7F, 0xEF, 0xD0, 0xF0, 0x9D, 0xFC, 0x4C, 0xC3, 0xEC, 0x27, 0xEB, 0xB5, 0x89, 0x1C, 0x6A,
+        0x8A, 0x52, 0x96, 0x0B, 0xB2, 0x95, 0x04, 0xDF, 0xFD, 0x20, 0xE0, 0x61, 0x2A, 0x7A, 0x98, 0xE8,
+        0x7A, 0xCD, 0x34, 0xF5, 0x1C, 0xF1, 0xBA, 0x15, 0x97, 0x92, 0x78, 0xA1, 0x84, 0x82, 0x38, 0x94,
+        0x77, 0x55, 0x46, 0xA1, 0x67, 0x37, 0x9D, 0x2F, 0xCE, 0xDF, 0x36, 0x79, 0xF2, 0x2B, 0x20, 0xF2,
+        0x07, 0x2C, 0xE7, 0x79, 0x25, 0x05, 0x86, 0x0E, 0x18, 0xF9, 0x70, 0x8B, 0x7A, 0x14, 0x21, 0xE9,
+        0x55, 0x8D, 0xAB, 0xBA, 0x3C, 0xEF, 0x11, 0x04, 0x94, 0xB1, 0x0A, 0x76, 0xFF, 0x60, 0x79, 0x5F,
+        0x2F, 0x80, 0xB5, 0x26, 0xB4, 0x20, 0x27, 0x31, 0xBC, 0x76, 0xC1, 0xEC, 0xA1, 0x32, 0x89, 0x61,
+        0x14, 0xB4, 0x8E, 0xAD, 0xDE, 0x7A, 0x9D, 0x4A, 0x9A, 0x6F, 0x1F, 0x1F, 0xE7, 0xA0, 0x1A, 0x2F,
+        0x59, 0x0C, 0x9A, 0x7D, 0x24, 0xA0, 0x1E, 0x26, 0x50, 0x7F, 0x2D, 0x95, 0x28, 0x41, 0x88, 0x5B,
+        0x64, 0xF6, 0x03, 0xE1, 0xA6, 0x0A, 0x27, 0x40, 0x04, 0x9A, 0xB2, 0xD9, 0x5E, 0x73, 0x01, 0x0B,
+        0x9A, 0x65, 0xB9, 0x9E, 0x61, 0x3A, 0xE6, 0xC3, 0xBB, 0xAD, 0x79, 0xED, 0xF2, 0x20, 0x24, 0xD0,
+        0xCF, 0x13, 0x3F, 0x66, 0x16, 0xBA, 0x4F, 0x10, 0x09, 0xB5, 0x1D, 0x56, 0xF3, 0x7B, 0x46, 0xB4,
+        0x14, 0xA7, 0x0C, 0xF7, 0xE5, 0xE4, 0xDA, 0xEF, 0x1B, 0xF4, 0x7D, 0x8F, 0x92, 0x5C, 0x06, 0xA5,
+        0x0F, 0x36, 0xFA, 0x74, 0x2A, 0x03, 0x7F, 0x41, 0xA0, 0x04, 0x18, 0x0F, 0xFB, 0x3F, 0xFC, 0x41,
+        0x66, 0xB0, 0x6F, 0x72, 0xBC, 0xAF, 0xC1, 0xB9, 0xF1, 0x37, 0xBA, 0x7E, 0x13, 0xB9, 0xC3, 0x62,
+        0xC6, 0xF4, 0x99, 0x9A, 0x2F, 0xD2, 0xBC, 0x4F, 0x05, 0xC5, 0x0B, 0x95, 0x1A, 0x96, 0xA2, 0x2C,
+        0xC2, 0xF1, 0x12, 0x0F, 0xB4, 0xDB, 0x5E, 0x12, 0xDC, 0x02, 0x81, 0xA1, 0xBB, 0x01, 0xC2, 0x4A,
+        0xE6, 0x0B, 0x03, 0x59, 0x60, 0x9C, 0x73, 0xC2, 0x87, 0x5B, 0x04, 0x9E, 0x8A, 0x68, 0x24, 0xA6,
+        0x14, 0x00, 0xE6, 0xBE, 0x28, 0x7C, 0x98, 0x74, 0x01, 0xBF, 0xF9, 0xEB, 0x77, 0x19, 0x22, 0x84,
+        0xEA, 0xD0, 0x46, 0x78, 0x4E, 0xE6, 0x15, 0x7B, 0xE7, 0x53, 0xFE, 0xC7, 0xD7, 0x80, 0xEB, 0x34,
+        0xEF, 0x6D, 0x72, 0x5C, 0xFE, 0x53, 0xCB, 0xFA, 0x29, 0x1A, 0x07, 0x6A, 0x1C, 0x9D, 0x35, 0x0E,
+        0x07, 0x9B, 0x6E, 0x6D, 0x7F, 0xE1, 0x65, 0x84, 0xBB, 0x92, 0x05, 0x04, 0x4E, 0x0B, 0xBE, 0xE4,
+        0x97, 0xE8, 0x67, 0xAE, 0x83, 0xD1, 0xEB, 0x15, 0x99, 0x7E, 0x73, 0x47, 0x98, 0x3E, 0x39, 0x2C,
+        0x61, 0x28, 0xD5, 0x1C, 0xBB, 0x97, 0xB3, 0x40, 0xC1, 0xC0, 0x76, 0x2B, 0xAF, 0xFF, 0x1F, 0x8A,
+        0x17, 0x1C, 0x04, 0xA9, 0x4B, 0xFB, 0xC5, 0x3B, 0xBC, 0xA1, 0xD1, 0x0C, 0xC2, 0xB2, 0x71, 0x5A,
+        0x0B, 0x47, 0xB5, 0x25, 0x43, 0x56, 0x84, 0xB6, 0x94, 0x82, 0x38, 0x3F, 0x04, 0x36, 0x3D, 0x90,
+        0xD4, 0x47, 0xB0, 0x0C, 0x9C, 0x99, 0xCE, 0xAC, 0x05, 0xB6, 0x26, 0x2E, 0xE0, 0x53, 0x44, 0x1C,
+        0x7E, 0x55, 0x55, 0x2F, 0xFE, 0x52, 0x6B, 0xAD, 0x8F, 0x83, 0xFF, 0x46, 0x40, 0x04, 0xE2, 0x73,
+        0xAD, 0xFC, 0x73, 0x22, 0x21, 0x95, 0x3B, 0x44, 0x53, 0x97, 0xF3, 0x36, 0x31, 0x45, 0xB9, 0xA8,
+        0x90, 0x08, 0x19, 0x9E, 0xCB, 0x62, 0x00, 0x3C, 0x7F, 0x3B, 0xEE, 0x9D, 0xE9, 0x04, 0x85, 0x67,
+        0x2C, 0x7D, 0x2D, 0xE0, 0xB7, 0xDA, 0x2B, 0xD1, 0x77, 0x0D, 0x89, 0x66, 0x58, 0x68, 0x74, 0x1B,
+        0x3F, 0x9A, 0xF7, 0x64, 0x33, 0x97, 0x72, 0x1D, 0x74, 0xD2, 0x81, 0x34, 0xAB, 0x83, 0x7C, 0x48,
+        0x1B, 0x9B, 0x5B, 0x43, 0xB2, 0xEB, 0x63, 0x74, 0x04, 0x9B, 0xFA, 0x62, 0xC2, 0xE5, 0xE7, 0x7F,
+        0x17, 0xFC, 0xC5, 0x29, 0x8F, 0x44, 0xC8, 0xE3, 0x09, 0x4F, 0x79, 0x03, 0x13, 0xA6, 0x04, 0xB0,
+        0x61, 0x1B, 0xD4, 0x16, 0x80, 0x97, 0x6D, 0xC0, 0x52, 0xC4, 0x04, 0x55, 0xF9, 0xBF, 0xE0, 0x73,
+        0x0A, 0xB6, 0xCA, 0x48, 0x1F, 0xB0, 0xB7, 0xA3, 0x25, 0x07, 0x75, 0xF2, 0x82, 0xEB, 0x8B, 0xEE,
+        0xE5, 0x51, 0xEF, 0xA0, 0x50, 0xEF, 0xB0, 0x62, 0x9E, 0xA4, 0x00, 0x0B, 0x81, 0x35, 0x68, 0x73,
+        0x81, 0x06, 0x5D, 0x63, 0x36, 0xDF, 0x62, 0x4F, 0x01, 0xF8, 0xC2, 0x42, 0x12, 0xD6, 0x41, 0x04,
+        0xA3, 0x01, 0x69, 0x7B, 0xDF, 0xCD, 0x70, 0x43, 0x13, 0xBA, 0x48, 0xE5, 0x1D, 0x56, 0x75, 0x43,
+        0xF2, 0xA1, 0x82, 0x03, 0x1E, 0xFD, 0x69, 0x15, 0xDD, 0xC0, 0x7B, 0xBC, 0xC4, 0xE1, 0x60, 0x70,
+        0x73, 0x70, 0xF9, 0x1C, 0xFB, 0x67, 0xE4, 0xF5, 0x08, 0x18, 0x09, 0xFA, 0x25, 0xD4, 0x0F, 0x9B,
+        0x17, 0x35, 0xDB, 0xF7, 0xC0, 0xA1, 0x1A, 0x13, 0x0C, 0x0D, 0x1A, 0x04, 0x1E, 0x17, 0x7E, 0xA1,
+        0x04, 0x48, 0x91, 0x00, 0xC6, 0xF9, 0xE2, 0xB0, 0x14, 0x3F, 0x1C, 0x23, 0x06, 0xC4, 0x09, 0x99,
+        0x95, 0x7B, 0x0F, 0xD6, 0x86, 0xED, 0x4C, 0x23, 0xE9, 0x8E, 0xBC, 0x0A, 0xEC, 0x5A, 0x49, 0x2D,
+        0xE5, 0x30, 0xBF, 0xB5, 0x63, 0x27, 0x10, 0x60, 0x3B, 0xC0, 0x9F, 0x3C, 0x7E, 0x4D, 0x63, 0xA2,
+        0x3B, 0xF0, 0x3A, 0xE5, 0xFF, 0xC8, 0xBE, 0x80, 0xBE, 0x92, 0x01, 0x49, 0x1E, 0x6C, 0xF6, 0xFF,
+        0x6D, 0x04, 0x95, 0x2E, 0xC5, 0xC8, 0x50, 0xD8, 0x4F, 0xB8, 0x22, 0x5F, 0x81, 0xBD, 0x05, 0x31,
+        0xA6, 0x8E, 0x21, 0xC4, 0x59, 0x91, 0x40, 0x17, 0x6B, 0x8B, 0x7D, 0xD1, 0x9C, 0x05, 0x09, 0x2D,
+        0x0E, 0x88, 0x07, 0xA5, 0xA0, 0x15, 0x84, 0x11, 0x24, 0x59, 0x85, 0xD9, 0x00, 0x8F, 0x6D, 0xC1,
+        0xB3, 0xDC, 0x5A, 0x56, 0xDC, 0x55, 0x34, 0x81, 0x72, 0x64, 0xDE, 0xA7, 0xB9, 0xBE, 0x19, 0xD5,
+        0x7C, 0x96, 0x04, 0x56, 0x7B, 0x85, 0x81, 0x6A, 0x1C, 0x69, 0x20, 0x2E, 0x9A, 0x36, 0x10, 0xE4,
+        0x88, 0xD6, 0xBB, 0xAA, 0x47, 0xEC, 0x43, 0xC4, 0x99, 0xE2, 0x7A, 0x76, 0xEC, 0x7C, 0x61, 0x19,
+        0xD0, 0xF1, 0x9C, 0xE2, 0xBC, 0xBB, 0xEA, 0x61, 0xA1, 0x49, 0xA2, 0x2A, 0xDA, 0x05, 0x83, 0x4C,
+        0xF6, 0x4B, 0xC8, 0x33, 0xCB, 0x11, 0x38, 0xD0, 0xA4, 0xB4, 0x58, 0x67, 0xC1, 0xFC, 0x5A, 0xC4,
+        0x3E, 0xD9, 0x80, 0x04, 0x77, 0x78, 0xA7, 0x8C, 0x28, 0xDE, 0xC3, 0xE3, 0x0A, 0x05, 0xFE, 0x96,
+        0x29, 0xDE, 0x8C, 0x38, 0xBB, 0x30, 0xD1, 0xF5, 0xCF, 0x9A, 0x3A, 0x20, 0x8F, 0x76, 0x38, 0x89,
+        0xBE, 0x58, 0xAD, 0x71, 0x34, 0x62, 0x6D, 0x9A, 0xB5, 0xA5, 0xB2, 0x2F, 0xF7, 0x09, 0x8E, 0x12,
+        0xF2, 0xFF, 0x58, 0x00, 0x87, 0xB3, 0x84, 0x11, 0xFF, 0x24, 0xAC, 0x56, 0x3B, 0x51, 0x3F, 0xC1,
+        0xFD, 0x9F, 0x43, 0xAC, 0x04, 0x32, 0x0E, 0x94, 0x5D, 0x6E, 0xD0, 0xE2, 0x7D, 0x66, 0x8B, 0x17,
+        0xAD, 0x69, 0xD5, 0x17, 0x22, 0xB6, 0x9F, 0x1C, 0x9F, 0xBA, 0xAF, 0x00, 0x50, 0x19, 0xE2, 0xE4,
+        0xAE, 0x81, 0x55, 0xFF, 0xF0, 0x5C, 0x06, 0xC9, 0x62, 0xD6, 0x85, 0x2E, 0xE8, 0x79, 0xF2, 0x7E,
+        0x08, 0x04, 0xF9, 0x39, 0xCE, 0x27, 0xEC, 0x64, 0x32, 0xDC, 0x7C, 0x65, 0x39, 0xB2, 0x83, 0xA5,
+        0x0D, 0x6B, 0x8B, 0x9A, 0x4F, 0x04, 0x24, 0x47, 0xA5, 0x47, 0xB5, 0x85, 0x9A, 0xFB, 0x4F, 0xC3,
+        0x89, 0x3C, 0x41, 0xD6, 0x18, 0xB3, 0xA0, 0xF9, 0x00, 0x20, 0x51, 0xA0, 0x64, 0x6D, 0x76, 0x68,
+        0x56, 0x36, 0x32, 0x02, 0x70, 0xF2, 0xA8, 0xF7, 0xB5, 0x32, 0xC0, 0xD5, 0xDA, 0x32, 0x43, 0x44,
+        0xB0, 0x9E, 0xCE, 0xED, 0x80, 0xE3, 0x56, 0x11, 0xFE, 0xC2, 0x52, 0x1A, 0x9D, 0x57, 0x03, 0x66,
+        0x26, 0x8D, 0xE6, 0x71, 0x75, 0x2F, 0x04, 0x2B, 0x8D, 0x21, 0x56, 0x48, 0xF7, 0xB3, 0x64, 0x85,
+        0xF6, 0xFF, 0xFE, 0xEE, 0xD1, 0x31, 0x64, 0xBF, 0xD8, 0xD9, 0x32, 0x4B, 0x9F, 0xB1, 0x87, 0x9C,
+        0xCF, 0x3C, 0x17, 0x7B, 0x5E, 0x86, 0xDC, 0x1E, 0x02, 0x58, 0x48, 0x69, 0xB2, 0x73, 0xF3, 0xAE,
+        0x46, 0x09, 0xB1, 0x25, 0x94, 0xE0, 0x1A, 0x04, 0x81, 0xA3, 0x17, 0x33, 0xC4, 0xB2, 0x55, 0x7B,
+        0x22, 0x71, 0x61, 0x50, 0xC8, 0x1C, 0xEC, 0x04, 0x95, 0x6B, 0x80, 0xD2, 0xE0, 0xF4, 0xF1, 0xF7,
+        0x7C, 0x3F, 0x43, 0xBA, 0xA6, 0xBA, 0xA3, 0x56, 0x50, 0xAF, 0x6E, 0xB5, 0xA9, 0xE5, 0x4A, 0x15,
+        0x08, 0x1E, 0x21, 0x13, 0x43, 0x69, 0x3D, 0x45, 0x0C, 0x2E, 0x42, 0x90, 0x2D, 0x5E, 0x77, 0xDE,
+        0xFF, 0x65, 0xC4, 0xD5, 0x36, 0xE3, 0x04, 0xA9, 0x47, 0xCA, 0xDB, 0x87, 0xC0, 0x43, 0x4B, 0xBF,
+        0xEC, 0x93, 0x55, 0xD7, 0x3A, 0x5E, 0x58, 0xB3, 0x04, 0xD7, 0xB2, 0x12, 0x55, 0xF0, 0xAD, 0x5D,
+        0x6A, 0x51, 0x17, 0xD2, 0x35, 0x02, 0x07, 0xDF, 0x05, 0x3D, 0x29, 0xA7, 0xE2, 0xF1, 0x7E, 0xC3,
+        0xAE, 0xE8, 0xE8, 0xC1, 0xDF, 0x9F, 0xCC, 0x78, 0xAE, 0x2A, 0x94, 0x36, 0xF1, 0x5C, 0xE9, 0xDA,
+        0x9B, 0x62, 0xEF, 0x7D, 0x3F, 0xA1, 0x52, 0x73, 0xE7, 0xF2, 0x06, 0x8B, 0xB3, 0x99, 0x2B, 0x2C,
+        0x31, 0xA2, 0xD7, 0x17, 0xD4, 0xC1, 0x89, 0xB6, 0xA8, 0x04, 0x24, 0x78, 0xBB, 0x46, 0x22, 0x33,
+        0xE8, 0x5E, 0xDE, 0x84, 0xCD, 0x5B, 0x89, 0x04, 0xB8, 0x87, 0x11, 0x77, 0x62, 0xB7, 0xB7, 0x30,
+        0xF2, 0x32, 0x4A, 0x8A, 0x9F, 0xF8, 0x97, 0xCD, 0x8A, 0xEC, 0x5B, 0x89, 0x78, 0xA2, 0xAB, 0xB5,
+        0x4A, 0xDF, 0x73, 0x60, 0xC3, 0x7A, 0x91, 0x13, 0xCB, 0xAC, 0x7F, 0x8A, 0xDC, 0x3A, 0x88, 0xF9,
+        0x80, 0x80, 0xB9, 0x08, 0x7C, 0xE0, 0xEE, 0x7B, 0xF6, 0x3F, 0x04, 0xCE, 0x18, 0x7B, 0xE5, 0x07,
+        0x7A, 0x6C, 0x94, 0xCB, 0xF6, 0x6B, 0x81, 0x5B, 0x3A, 0xD2, 0x5D, 0x69, 0xAA, 0x70, 0x1D, 0x63,
+        0x42, 0xA1, 0x3D, 0x04, 0x02, 0x8F, 0xB4, 0x7E, 0x25, 0xA2, 0xDC, 0xBA, 0xBA, 0x50, 0x08, 0xF0,
+        0x96, 0x52, 0x6B, 0x39, 0x3A, 0x92, 0x87, 0x3E, 0x33, 0xD4, 0xC6, 0xBF, 0xFC, 0x6C, 0xE4, 0x16,
+        0xD0, 0x2A, 0x29, 0x7A, 0x68, 0x66, 0x46, 0x1B, 0x4F, 0x37, 0x22, 0x04, 0x95, 0x93, 0x96, 0x98,
+        0x19, 0x43, 0x78, 0x5C, 0x3D, 0x3E, 0x57, 0xED, 0xF5, 0x01, 0x8C, 0xDB, 0xE0, 0x39, 0xE7, 0x30,
+        0xE4, 0x91, 0x8B, 0x3D, 0x88, 0x4F, 0xDF, 0xF0, 0x94, 0x75, 0xB7, 0xBA, 0x2E, 0x7E, 0x55, 0x28,
+        0x88, 0xC3, 0x31, 0xDD, 0x8B, 0xA0, 0x38, 0x6A, 0x4B, 0x9C, 0xD6, 0x84, 0x9C, 0x65, 0x3F, 0x64,
+        0xC8, 0x70, 0x93, 0x85, 0xE9, 0xB8, 0xAB, 0xF8, 0x75, 0x24, 0xF2, 0xFD, 0x04, 0x8D, 0xAF, 0x13,
+        0x8F, 0x27, 0x11, 0x2C, 0xAF, 0xDB, 0xEF, 0xE9, 0x53, 0x25, 0x0F, 0xFB, 0xDA, 0xCC, 0x93, 0xE7,
+        0x63, 0xB9, 0x6E, 0xBF, 0x08, 0x81, 0x9B, 0xE6, 0x7E, 0x06, 0x19, 0xC5, 0x8A, 0x9D, 0x3D, 0xAA,
+        0x55, 0x43, 0x65, 0xBB, 0xFF, 0xD2, 0x7E, 0x4C, 0x73, 0x0C, 0x1B, 0x68, 0xC1, 0x6E, 0x04, 0x40,
+        0x0B, 0x98, 0x48, 0xD2, 0x87, 0x08, 0xEE, 0xFB, 0xA0, 0xC2, 0x2B, 0x30, 0xC9, 0x04, 0xA7, 0x02,
+        0x7D, 0x7E, 0x20, 0x8A, 0xE5, 0x3B, 0x45, 0x1F, 0xCA, 0x56, 0xE9, 0xD8, 0xB0, 0xBF, 0x56, 0x91,
+        0x40, 0xE6, 0xB7, 0x5C, 0x9D, 0xBD, 0x4C, 0x4E, 0xC0, 0x38, 0xB0, 0xD8, 0xAC, 0x3D, 0xE4, 0x6F,
+        0x1D, 0x8C, 0x26, 0xF6, 0x81, 0x50, 0xF7, 0x9D, 0x4C, 0x78, 0xEE, 0x77, 0xBA, 0x34, 0xC3, 0xF7,
+        0xB6, 0xAF, 0xC0, 0x4B, 0xF1, 0xDF, 0xFC, 0xED, 0x43, 0x59, 0x57, 0x0F, 0xE3, 0xA1, 0x04, 0x8D,
+        0x3D, 0x4D, 0xD3, 0x6B, 0x63, 0x7E, 0x98, 0xCE, 0x13, 0xAC, 0x3B, 0x55, 0x55, 0x84, 0x87, 0xF2,
+        0xA8, 0xBA, 0x9F, 0x21, 0x49, 0x06, 0xDA, 0xCA, 0xEC, 0x9C, 0x89, 0x78, 0xCF, 0x12, 0x63, 0xAD,
+        0x56, 0xBC, 0x30, 0xF1, 0x18, 0x62, 0xD6, 0xDE, 0xB0, 0xF7, 0xAE, 0x43, 0xF8, 0xCB, 0x2E, 0x36,
+        0x7E, 0xA2, 0x5E, 0x21, 0xC5, 0x73, 0xFC, 0x54, 0xBD, 0x1F, 0xB8, 0x73, 0x0D, 0x44, 0x89, 0x04,
+        0xBB, 0x75, 0xCE, 0x57, 0x94, 0x04, 0xA8, 0x8E, 0x1B, 0xAB, 0x49, 0xA4, 0xB0, 0x95, 0x1C, 0x74,
+        0x19, 0x3C, 0x05, 0xF2, 0x06, 0xBA, 0xA5, 0xF9, 0xB7, 0x6F, 0xE4, 0xA4, 0xB1, 0xAB, 0x30, 0x66,
+        0x22, 0xFB, 0xC7, 0xF1, 0xAA, 0x6E, 0x53, 0xE3, 0x65, 0xD7, 0xB3, 0x5B, 0x24, 0x4A, 0xA3, 0x7F,
+        0x42, 0x1F, 0xD4, 0xBE, 0x01, 0xBF, 0xC1, 0x06, 0xE9, 0xC3, 0x77, 0x65, 0x32, 0x26, 0x83, 0x1E,
+        0x04, 0x2E, 0x6D, 0x2E, 0x24, 0x4A, 0x59, 0x4E, 0x68, 0x6F, 0x32, 0x55, 0x12, 0x9A, 0x2D, 0xCF,
+        0x61, 0x21, 0xD3, 0x2D, 0x35, 0xDC, 0xCA, 0x39, 0x06, 0x54, 0x29, 0x34, 0xCF, 0x4B, 0x6E, 0x8A,
+        0xF3, 0xE6, 0x68, 0xBD, 0x2B, 0x0A, 0x8A, 0x9F, 0xC6, 0x26, 0xF1, 0x2E, 0xD2, 0x0E, 0x15, 0xDF,
+        0xF8, 0x30, 0x99, 0xD0, 0x9B, 0x49, 0xDA, 0x59, 0x17, 0xE7, 0xA8, 0x63, 0xE8, 0xE8, 0x93, 0xB7,
+        0x41, 0x04, 0xC1, 0x0B, 0xFB, 0x23, 0x3D, 0xEA, 0xCF, 0xD7, 0x00, 0x64, 0x06, 0x0F, 0xF7, 0x9C,
+        0x70, 0x88, 0x51, 0x22, 0x23, 0x91, 0x9B, 0x12, 0x0F, 0x46, 0x03, 0x60, 0x10, 0x10, 0x86, 0x0E,
+        0x35, 0x79, 0x95, 0x47, 0x7B, 0x27, 0xF1, 0x23, 0xC5, 0x2C, 0xA2, 0xDB, 0xFA, 0x1A, 0x86, 0xEA,
+        0x0F, 0x89, 0xA5, 0x12, 0x48, 0x67, 0x98, 0x63, 0xC1, 0xDE, 0x3D, 0x35, 0x9D, 0x4D, 0xAE, 0xD5,
+        0xE8, 0xE4, 0x04, 0xBB, 0x44, 0xA5, 0x94, 0xB5, 0x09, 0xC3, 0x80, 0x7E, 0x01, 0x68, 0x0D, 0xD2,
+        0x81, 0x56, 0xDD, 0x5C, 0xD3, 0xDB, 0x3D, 0xCE, 0xAF, 0x12, 0x9A, 0xB4, 0x06, 0x03, 0x0A, 0xB8,
+        0x03, 0xEC, 0xB3, 0xDA, 0x24, 0x2E, 0xBB, 0xF9, 0x93, 0x2F, 0xC2, 0x1D, 0xAA, 0x5C, 0x44, 0x6B,
+        0x46, 0xB6, 0x56, 0x63, 0xAC, 0xB5, 0x3B, 0xD1, 0xDF, 0x68, 0x98, 0xCD, 0xB2, 0x5C, 0xE8, 0x10,
+        0x25, 0x5D, 0x79, 0x04, 0xD5, 0x1E, 0x63, 0x6D, 0x1E, 0x50, 0x23, 0x65, 0xE7, 0x3B, 0x44, 0xB6,
+        0xDE, 0xCD, 0x4E, 0x04, 0x4A, 0x8F, 0x12, 0x5E, 0x13, 0x36, 0xFE, 0xAB, 0x48, 0xBD, 0x26, 0x8A,
+        0x00, 0xF4, 0x36, 0x5C, 0x92, 0x6D, 0xDB, 0x67, 0x28, 0x32, 0xA6, 0x13, 0x25, 0x59, 0xFA, 0x77,
+        0x2C, 0x68, 0x9E, 0xFB, 0xD9, 0x34, 0x3D, 0xF1, 0xEF, 0x34, 0xEE, 0xE8, 0x3D, 0x26, 0x1D, 0x26,
+        0x70, 0xD4, 0x87, 0xC5, 0x04, 0x40, 0x3A, 0xC4, 0x54, 0x9B, 0x43, 0xE3, 0x8E, 0xE4, 0xD1, 0x51,
+        0x46, 0xEF, 0x2B, 0xD6, 0x09, 0xB8, 0xE0, 0x4E, 0x92, 0x64, 0x51, 0xA2, 0x21, 0xCB, 0x4D, 0x3A,
+        0x71, 0xF9, 0x1E, 0x4D, 0xF6, 0xA2, 0xF5, 0xCF, 0xCF, 0x95, 0xFD, 0x2E, 0xBA, 0xE1, 0xC1, 0x72,
+        0x6D, 0xD8, 0xCD, 0x86, 0x7E, 0x4C, 0x2D, 0x62, 0xA3, 0x8F, 0x04, 0x5E, 0x30, 0xC5, 0xBD, 0x88,
+        0x9D, 0x65, 0x67, 0x90, 0x09, 0x04, 0xDC, 0x25, 0xC9, 0xDC, 0x19, 0x70, 0x90, 0x61, 0x0F, 0xC6,
+        0xE7, 0x67, 0xD2, 0x6F, 0x4A, 0xAD, 0x6E, 0x0D, 0xBE, 0xEC, 0xD0, 0x4D, 0xB3, 0x3F, 0x0F, 0xAA,
+        0x2A, 0xD7, 0xD6, 0xBD, 0x11, 0x95, 0x1B, 0x0D, 0x2E, 0x93, 0x0C, 0xFF, 0xD2, 0x51, 0xD3, 0x58,
+        0xC8, 0xB9, 0xD6, 0x39, 0xBC, 0x66, 0xD4, 0x9A, 0xAB, 0x55, 0x82, 0xA9, 0x20, 0x28, 0x6A, 0xB7,
+        0xA3, 0xF8, 0x28, 0x60, 0xE6, 0x95, 0x04, 0x45, 0x25, 0xE3, 0x54, 0x02, 0xE9, 0xCF, 0x24, 0x81,
+        0x9F, 0x86, 0xC9, 0x7F, 0xBF, 0xD4, 0xD3, 0x3E, 0x90, 0x15, 0x29, 0x2A, 0x36, 0x8D, 0xAB, 0x79,
+        0x95, 0x65, 0x49, 0x37, 0x13, 0xBA, 0x3D, 0x2A, 0x94, 0x45, 0x26, 0x2B, 0x07, 0xE0, 0x37, 0xDF,
+        0xE7, 0x9E, 0xD8, 0x3E, 0x94, 0x98, 0xD9, 0x83, 0x02, 0x4A, 0x70, 0x5A, 0x15, 0x3B, 0x47, 0x8C,
+        0xCB, 0x18, 0xD2, 0xB4, 0x9B, 0x4D, 0xDD, 0x04, 0xE1, 0x09, 0x3D, 0x2D, 0xAB, 0x31, 0x8E, 0x5D,
+        0x61, 0x18, 0xF3, 0x9D, 0xAC, 0x3A, 0xDF, 0x76, 0x92, 0x07, 0x77, 0x1B, 0xC5, 0x3F, 0x8A, 0xB8,
+        0x85, 0x49, 0xEF, 0x91, 0x49, 0x30, 0x24, 0xF4, 0xF4, 0xC4, 0xC1, 0x48, 0x2F, 0x3D, 0x88, 0xB1,
+        0xB2, 0xAE, 0x4C, 0x0F, 0xFD, 0xBC, 0xD7, 0x43, 0x50, 0x8E, 0x2E, 0x91, 0x6F, 0x98, 0x33, 0x22,
+        0xD3, 0x6A, 0x4A, 0x80, 0xFA, 0x0A, 0x83, 0x7D, 0x04, 0x9A, 0x15, 0x68, 0x0C, 0xC9, 0x25, 0x26,
+        0x88, 0xBE, 0x94, 0x95, 0x68, 0x8C, 0x58, 0xED, 0x47, 0x8F, 0x0A, 0x3C, 0x0F, 0x43, 0xB2, 0x04,
+        0x02, 0xB1, 0x66, 0x30, 0x04, 0x22, 0xE6, 0x40, 0x9E, 0xE7, 0x71, 0xE4, 0xC9, 0xBE, 0x5E, 0x9A,
+        0x62, 0x08, 0xC4, 0xBF, 0x94, 0xF2, 0x5D, 0x8E, 0xB2, 0xA7, 0x47, 0x19, 0x1B, 0xC8, 0x15, 0xEA,
+        0x35, 0x55, 0x30, 0x73, 0x6C, 0xD9, 0x79, 0xD7, 0x3E, 0x04, 0xD5, 0x56, 0xB3, 0x0C, 0xBE, 0xF1,
+        0x4F, 0x6E, 0x7C, 0x2E, 0x0B, 0xE2, 0xFA, 0x35, 0x8B, 0x09, 0xA1, 0xDC, 0xDB, 0x94, 0x9C, 0x4B,
+        0x0C, 0x24, 0xBA, 0x2E, 0x69, 0xC5, 0x61, 0xB3, 0x30, 0x39, 0xDA, 0x69, 0xA1, 0x99, 0x32, 0x1D,
+        0x12, 0xD5, 0x63, 0x66, 0x37, 0x1D, 0xDC, 0xFF, 0x02, 0x4B, 0x3E, 0x05, 0x9B, 0x31, 0x56, 0xE8,
+        0x0A, 0xF0, 0xB4, 0xA8, 0x89, 0x6D, 0x6E, 0x68, 0xF7, 0xD8, 0x04, 0x30, 0xD1, 0x19, 0xC6, 0xB2,
+        0xF1, 0x1D, 0x3F, 0xCF, 0x2C, 0xAA, 0x8D, 0xED, 0x74, 0xE9, 0x5F, 0x8E, 0xA3, 0x50, 0xF5, 0xCC,
+        0xB9, 0x66, 0x51, 0x3A, 0xD2, 0xEA, 0xA0, 0x45, 0x18, 0x70, 0xDB, 0x5E, 0x65, 0xDA, 0xE4, 0x9E,
+        0x96, 0x5D, 0xEC, 0x61, 0x94, 0xA5, 0x16, 0x8B, 0x34, 0xCF, 0x62, 0x61, 0xA8, 0xE8, 0x3A, 0x53,
+        0xE6, 0xAD, 0xE4, 0x1F, 0xF5, 0x16, 0xD5, 0xE1, 0xBF, 0xCB, 0x49, 0x04, 0x8B, 0x4B, 0x5F, 0x16,
+        0x5D, 0xF3, 0xC2, 0xBE, 0x8C, 0x62, 0x44, 0xB5, 0xB7, 0x45, 0x63, 0x88, 0x43, 0xE4, 0xA7, 0x81,
+        0xA1, 0x5B, 0xCD, 0x1B, 0x69, 0xF7, 0x9A, 0x55, 0xDF, 0xFD, 0xF8, 0x0C, 0x4A, 0xAD, 0x0A, 0x6F,
+        0x68, 0xD3, 0x08, 0xB4, 0xB3, 0xFB, 0xD7, 0x81, 0x3A, 0xB0, 0xDA, 0x04, 0xF9, 0xE3, 0x36, 0x54,
+        0x61, 0x62, 0xEE, 0x56, 0xB3, 0xEF, 0xF0, 0xC6, 0x5F, 0xD4, 0xFD, 0x36, 0x04, 0x09, 0x48, 0xBF,
+        0x80, 0x9B, 0x19, 0x88, 0xA4, 0x6B, 0x06, 0xC9, 0xF1, 0x91, 0x94, 0x13, 0xB1, 0x0F, 0x92, 0x26,
+        0xC6, 0x0F, 0x66, 0x88, 0x32, 0xFF, 0xD9, 0x59, 0xAF, 0x60, 0xC8, 0x2A, 0x0A, 0x53, 0xA5, 0x62,
+        0x85, 0x6D, 0xCB, 0x66, 0x46, 0xDC, 0x6B, 0x74, 0xC5, 0xD1, 0xC3, 0x41, 0x8C, 0x6D, 0x4D, 0xFF,
+        0x08, 0xC9, 0x7C, 0xD2, 0xBE, 0xD4, 0xCB, 0x7F, 0x88, 0xD8, 0xC8, 0xE5, 0x89, 0x04, 0xF4, 0x80,
+        0x60, 0xA5, 0x44, 0xD9, 0xF4, 0x8C, 0x74, 0xF6, 0x25, 0xBF, 0x08, 0x97, 0x50, 0x8E, 0x9B, 0x28,
+        0x19, 0xE9, 0xE5, 0x47, 0xBA, 0xDB, 0xD5, 0x49, 0x0B, 0x88, 0xDB, 0xA0, 0x27, 0x49, 0x36, 0xB8,
+        0x3C, 0x9F, 0xAA, 0xF3, 0xDC, 0xF1, 0x57, 0x51, 0xAE, 0x77, 0x1A, 0x8B, 0x3E, 0x3E, 0x6F, 0xE5,
+        0x05, 0x8A, 0x50, 0x6B, 0x2F, 0xEF, 0xEC, 0xC3, 0xC6, 0x55, 0xE1, 0xBE, 0x9C, 0xD4, 0x04, 0x90,
+        0xAD, 0x85, 0xB3, 0x89, 0xD6, 0xB9, 0x36, 0x46, 0x3F, 0x9D, 0x05, 0x12, 0x67, 0x8D, 0xE2, 0x08,
+        0xCC, 0x33, 0x0B, 0x11, 0x30, 0x7F, 0xFF, 0xAB, 0x7A, 0xC6, 0x3E, 0x3F, 0xB0, 0x4E, 0xD4, 0x0E,
+        0x50, 0x7A, 0x36, 0x20, 0xA3, 0x82, 0x61, 0xAF, 0xFD, 0xCB, 0xD9, 0x42, 0x72, 0x22, 0xB8, 0x39,
+        0xAE, 0xFA, 0xBE, 0x15, 0x82, 0x89, 0x4D, 0x99, 0x1D, 0x4D, 0x48, 0xCB, 0x6E, 0xF1, 0x50, 0x04,
+        0x96, 0x54, 0x95, 0xE0, 0x4F, 0x0C, 0xA1, 0x42, 0x00, 0x77, 0x5B, 0x89, 0x42, 0xA2, 0x17, 0x19,
+        0x86, 0xA1, 0x59, 0x02, 0xE2, 0x4B, 0xA4, 0x69, 0x0D, 0xB1, 0xF4, 0xB2, 0x5B, 0x28, 0x57, 0x74,
+        0x7D, 0xB9, 0x44, 0xB1, 0x4B, 0x86, 0x4E, 0x4C, 0x67, 0x73, 0xFF, 0xDB, 0x83, 0x90, 0xF8, 0xD2,
+        0xAB, 0xC3, 0x2E, 0xA7, 0x76, 0xE1, 0xF8, 0xD1, 0x38, 0x49, 0xF8, 0xF3, 0x88, 0xB5, 0x9F, 0x30,
+        0x04, 0x83, 0xE4, 0xDC, 0xD8, 0xC3, 0x9E, 0x21, 0x3E, 0x7E, 0x24, 0x27, 0xD2, 0xCA, 0x79, 0x40,
+        0x1A, 0x6C, 0x8F, 0x44, 0x31, 0x7D, 0x00, 0xDA, 0xDF, 0x59, 0xD6, 0xB1, 0x72, 0xA1, 0x5E, 0xDF,
+        0xF1, 0x93, 0x44, 0xDE, 0x5A, 0x72, 0x72, 0x3F, 0x09, 0x69, 0xA2, 0xFE, 0xF1, 0x36, 0xA4, 0x8C,
+        0x8C, 0xE7, 0xF6, 0xF6, 0xD9, 0xF9, 0x95, 0x13, 0x14, 0xBA, 0xCD, 0xCE, 0xB7, 0x74, 0x43, 0xB3,
+        0x53, 0x04, 0x41, 0x98, 0x57, 0xF9, 0xF8, 0x41, 0x10, 0x0D, 0x78, 0x24, 0x2C, 0xCF, 0x63, 0x30,
+        0x16, 0x40, 0xD0, 0x7E, 0x60, 0x63, 0x9E, 0x61, 0xDC, 0xD7, 0x77, 0x9D, 0xC3, 0xB8, 0x16, 0x45,
+        0x92, 0x9A, 0xB9, 0x33, 0xBE, 0x87, 0x26, 0xDB, 0xB0, 0x90, 0xDF, 0x4A, 0xF0, 0x38, 0xC2, 0xE2,
+        0xC7, 0x3C, 0x29, 0x09, 0x8F, 0x7C, 0xD9, 0x5C, 0xDB, 0x84, 0x99, 0x5B, 0x7D, 0x9F, 0x49, 0xAC,
+        0x48, 0x84, 0x04, 0x09, 0x28, 0x95, 0x5E, 0xE6, 0x37, 0xA8, 0x44, 0x63, 0x72, 0x9F, 0xD3, 0x0E,
+        0x7A, 0xFD, 0x2E, 0xD5, 0xF9, 0x62, 0x74, 0xE5, 0xAD, 0x7E, 0x5C, 0xB0, 0x9E, 0xDA, 0x9C, 0x06,
+        0xD9, 0x03, 0xAC, 0xC2, 0x56, 0x21, 0x00, 0x3D, 0x3F, 0x42, 0xA8, 0x27, 0xB7, 0x8A, 0x13, 0x09,
+        0x3A, 0x95, 0xEE, 0xAC, 0x3D, 0x26, 0xEF, 0xA8, 0xA8, 0xD8, 0x3F, 0xC5, 0x18, 0x0E, 0x93, 0x5B,
+        0xCD, 0x09, 0x1F, 0x04, 0x26, 0xED, 0x16, 0xB7, 0x66, 0x5B, 0xB9, 0x47, 0xDC, 0xE0, 0xBE, 0x5F,
+        0x30, 0xC9, 0x20, 0xAF, 0xD4, 0xE9, 0x0E, 0x5E, 0x05, 0x48, 0x6D, 0x79, 0x9B, 0x2C, 0xAD, 0xE4,
+        0xE7, 0x6C, 0x9F, 0xE4, 0xEB, 0x40, 0xEB, 0x99, 0x05, 0xE2, 0x08, 0x79, 0x10, 0xBC, 0x41, 0xAE,
+        0xCE, 0x61, 0xE4, 0x5A, 0x82, 0x60, 0x0B, 0x2F, 0x5E, 0x44, 0x29, 0xF2, 0x0E, 0x12, 0x48, 0x25,
+        0xFF, 0x82, 0x97, 0x6D, 0x04, 0x53, 0x25, 0x5A, 0xB7, 0x15, 0x8B, 0xDA, 0xE1, 0xAD, 0x85, 0x98,
+        0x43, 0xF6, 0x24, 0x88, 0xC7, 0x12, 0xEF, 0xEF, 0xFB, 0x81, 0xF7, 0xD7, 0x9B, 0x87, 0xED, 0x0A,
+        0x34, 0x0C, 0x38, 0x32, 0xBA, 0x2D, 0xE5, 0xDC, 0xDE, 0xD6, 0xC9, 0x03, 0xD7, 0x5D, 0x9B, 0x9C,
+        0x5C, 0x0C, 0x28, 0xE2, 0x3F, 0xF5, 0x4A, 0x2E, 0x2D, 0x1F, 0x4E, 0xC2, 0x9D, 0xBE, 0x41, 0xDC,
+        0x31, 0x3C, 0x2A, 0x1B, 0xD5, 0x04, 0xAA, 0xD9, 0x21, 0x5D, 0x35, 0xE1, 0x63, 0x22, 0x83, 0x0D,
+        0x9B, 0x67, 0x62, 0x33, 0xA5, 0xA0, 0xC4, 0x63, 0x81, 0xB5, 0x0C, 0x58, 0x25, 0x53, 0xBA, 0x3F,
+        0x24, 0x94, 0x87, 0x9E, 0xA4, 0x5C, 0xA1, 0x7E, 0xA3, 0xF8, 0x00, 0x1B, 0x9B, 0xF9, 0x1F, 0x89,
+        0x73, 0x5D, 0x03, 0x6A, 0x84, 0xDE, 0xE3, 0xFD, 0x23, 0x65, 0x0C, 0xDE, 0x07, 0xDC, 0x6D, 0xC3,
+        0xDA, 0xAD, 0x18, 0xDA, 0x2F, 0x40, 0x04, 0x3D, 0x4D, 0x73, 0xAB, 0x81, 0xE5, 0x9B, 0x86, 0xD1,
+        0x6F, 0x1E, 0x9E, 0x18, 0x58, 0x0D, 0xA0, 0x83, 0xE3, 0x88, 0xD9, 0x32, 0x65, 0xE6, 0x0F, 0xFA,
+        0x6D, 0xE8, 0x79, 0x27, 0xE2, 0x67, 0x59, 0xE9, 0x3A, 0x1E, 0x19, 0x7C, 0x61, 0xB0, 0xE4, 0x43,
+        0x6E, 0x19, 0x18, 0xA6, 0x4F, 0xFC, 0x7A, 0xE8, 0xBE, 0xBD, 0xE8, 0x8C, 0x33, 0xBE, 0xD6, 0x8F,
+        0x99, 0xAB, 0x1B, 0xFF, 0xD0, 0x4B, 0xB9, 0x04, 0x30, 0x76, 0x2F, 0x0D, 0x33, 0x4F, 0x00, 0xC2,
+        0x05, 0xC9, 0x42, 0xC6, 0x15, 0x47, 0x98, 0x8C, 0xB0, 0xC3, 0x09, 0xF4, 0x8B, 0xA5, 0xD2, 0x30,
+        0xFC, 0x2C, 0xF6, 0xDE, 0x1E, 0xBE, 0xE5, 0xFB, 0x32, 0xC0, 0x87, 0x82, 0x08, 0x2F, 0x69, 0x65,
+        0x8E, 0x1C, 0x14, 0xB2, 0x52, 0x6D, 0x53, 0xF4, 0x39, 0x29, 0x4F, 0x4E, 0x04, 0x82, 0xCC, 0xF5,
+        0xC1, 0xE2, 0x5F, 0xA0, 0x2F, 0x4B, 0x8F, 0x62, 0x04, 0x13, 0x9B, 0xCF, 0xC5, 0x19, 0x32, 0xCC,
+        0x68, 0x47, 0xC1, 0x49, 0x25, 0x9A, 0x87, 0x13, 0x90, 0xEE, 0x99, 0x47, 0xC6, 0x80, 0x3D, 0x31,
+        0x75, 0x92, 0x4F, 0x6B, 0xAB, 0x64, 0x73, 0x95, 0xE4, 0x48, 0x0C, 0xFF, 0xC8, 0xE7, 0x84, 0xFC,
+        0x25, 0x75, 0x50, 0x0E, 0xB0, 0xC4, 0x08, 0x21, 0x2A, 0x5B, 0xF3, 0xB1, 0x81, 0x3E, 0x0C, 0x26,
+        0x8B, 0xC3, 0x86, 0xA4, 0xFD, 0x35, 0x53, 0x49, 0xEE, 0x04, 0x24, 0x02, 0x39, 0x20, 0x5A, 0xEA,
+        0x76, 0x30, 0x30, 0x81, 0xA1, 0x82, 0x9C, 0x97, 0x38, 0x62, 0x93, 0x86, 0xA6, 0x44, 0x3B, 0xA3,
+        0x03, 0xE8, 0xAF, 0x43, 0xC1, 0xC5, 0xFE, 0xE8, 0xFF, 0x82, 0x25, 0xFC, 0x39, 0x4E, 0x13, 0x78,
+        0x80, 0x72, 0x5F, 0x6E, 0x1D, 0x21, 0xAB, 0x13, 0x50, 0x60, 0xC1, 0xFD, 0xFB, 0x3B, 0x64, 0xD8,
+        0x71, 0xEA, 0x37, 0xFA, 0xAA, 0xD5, 0x28, 0x23, 0xC8, 0x95, 0x04, 0xD2, 0xA6, 0x3A, 0x50, 0xAE,
+        0x40, 0x1E, 0x56, 0xD6, 0x45, 0xA1, 0x15, 0x3B, 0x10, 0x9A, 0x8F, 0xCC, 0xA0, 0xA4, 0x3D, 0x56,
+        0x1F, 0xBA, 0x2D, 0xBB, 0x51, 0x34, 0x0C, 0x9D, 0x82, 0xB1, 0x51, 0xE8, 0x2D, 0x86, 0xFB, 0x64,
+        0x43, 0xFC, 0xB7, 0x56, 0x5A, 0xEE, 0x58, 0xB2, 0x94, 0x82, 0x20, 0xA7, 0x0F, 0x75, 0x0A, 0xF4,
+        0x84, 0xCA, 0x52, 0xD4, 0x14, 0x21, 0x74, 0xDC, 0xF8, 0x94, 0x05, 0x04, 0x09, 0xE7, 0xF3, 0x60,
+        0xEA, 0x69, 0x72, 0x1C, 0x54, 0x48, 0x55, 0xCB, 0xDE, 0xCE, 0xF0, 0xB1, 0xE7, 0x45, 0xFB, 0xF2,
+        0x10, 0x74, 0xA7, 0x7E, 0x92, 0xC9, 0xD2, 0xDA, 0xD5, 0xAF, 0xE2, 0xDE, 0x6E, 0xC7, 0x5B, 0xDE,
+        0x79, 0x31, 0x2B, 0x9B, 0xE2, 0x62, 0xFC, 0xE4, 0x26, 0xFA, 0xA9, 0xC2, 0x81, 0x59, 0xAB, 0xA2,
+        0x9D, 0x01, 0x51, 0x03, 0xB4, 0x09, 0xC2, 0x82, 0xFB, 0x84, 0x8B, 0x59, 0x04, 0xE8, 0xCC, 0x1A,
+        0x46, 0x22, 0x2E, 0x81, 0x55, 0x96, 0x8C, 0xFB, 0x81, 0xBA, 0x90, 0x1D, 0x96, 0x82, 0x3A, 0xE0,
+        0x91, 0xB6, 0xBD, 0x5F, 0xA7, 0xF1, 0xE4, 0x25, 0xD7, 0x56, 0x8B, 0x87, 0x84, 0xA3, 0x8B, 0xA4,
+        0x50, 0xD4, 0x77, 0x43, 0x59, 0xA5, 0x13, 0xD6, 0x10, 0xE0, 0xF2, 0x15, 0x4C, 0x77, 0xDB, 0xAB,
+        0x4D, 0xE2, 0x63, 0x5E, 0x84, 0x8F, 0xFD, 0xB8, 0x4D, 0x49, 0x49, 0xD7, 0x29, 0x04, 0x6F, 0xB2,
+        0xA5, 0x0A, 0x43, 0x2D, 0xC1, 0x4C, 0x1C, 0x42, 0x58, 0x52, 0xBD, 0x69, 0xFF, 0x2A, 0x79, 0x39,
+        0x45, 0x30, 0x8D, 0xAA, 0x89, 0xA3, 0xF4, 0x22, 0x61, 0xF5, 0x82, 0xB4, 0x11, 0x01, 0x31, 0x2B,
+        0x6F, 0xE4, 0xE0, 0x23, 0x2B, 0x8B, 0x1B, 0x04, 0x0F, 0x9D, 0xEA, 0xE8, 0xD3, 0x10, 0x4E, 0x60,
+        0x3C, 0x94, 0x76, 0x07, 0x07, 0xE1, 0xA1, 0x1C, 0xA6, 0xE7, 0xF8, 0x5F, 0x64, 0x1F, 0x04, 0x5B,
+        0xAA, 0x43, 0xD9, 0xA3, 0xAF, 0xCB, 0x51, 0x30, 0x9C, 0xFB, 0xE7, 0x7F, 0x51, 0x13, 0xD7, 0xAE,
+        0x79, 0x39, 0x88, 0x20, 0x59, 0xBC, 0x8D, 0xF3, 0xDA, 0x99, 0x50, 0x69, 0x16, 0xE0, 0xDE, 0xB5,
+        0xB7, 0x62, 0x00, 0xEC, 0x0F, 0xA5, 0x97, 0x2B, 0x9D, 0x5D, 0x25, 0x46, 0xFB, 0x7E, 0x90, 0xB8,
+        0x84, 0x36, 0x8F, 0x3C, 0xA9, 0x60, 0xF5, 0x1A, 0x18, 0xF3, 0xE0, 0xEA, 0xAA, 0x2A, 0x36, 0x04,
+        0x4B, 0xE2, 0x49, 0x41, 0x02, 0x84, 0x3E, 0x3A, 0x26, 0x56, 0x57, 0x1C, 0x86, 0x45, 0xB2, 0x1D,
+        0x8C, 0x0D, 0x7B, 0xE5, 0x2C, 0xA9, 0x6C, 0xD3, 0x4E, 0x8A, 0xDD, 0x32, 0x6F, 0x0D, 0xD4, 0xEA,
+        0x95, 0x42, 0xC0, 0xB6, 0xA2, 0xAD, 0x0D, 0xE6, 0x52, 0x67, 0x98, 0x12, 0x8B, 0xBC, 0x09, 0x44,
+        0x45, 0x56, 0xBA, 0xB8, 0x52, 0xBD, 0x02, 0xF0, 0x81, 0xB1, 0x1A, 0x96, 0x93, 0xB5, 0x19, 0xD6,
+        0x04, 0x45, 0x94, 0x2D, 0x94, 0x2D, 0x99, 0x26, 0x1B, 0x1D, 0xC7, 0x14, 0xA8, 0x7A, 0x39, 0x88,
+        0x43, 0x2A, 0x50, 0x0A, 0xE8, 0x72, 0x39, 0x2D, 0x8A, 0x2F, 0x77, 0x4D, 0xFD, 0xB9, 0xF7, 0xC8,
+        0xF3, 0xE0, 0xCB, 0x2F, 0x5C, 0xC6, 0x75, 0x11, 0xE3, 0x1F, 0x99, 0xE3, 0x39, 0x91, 0x07, 0x08,
+        0xC2, 0x1A, 0x6D, 0x15, 0x72, 0x14, 0x63, 0x83, 0xEF, 0xE4, 0xFD, 0x3E, 0x61, 0xDA, 0x99, 0x73,
+        0xE8, 0x04, 0xB3, 0x18, 0x5C, 0x78, 0x0C, 0xE0, 0x51, 0xC7, 0x7E, 0xA7, 0xB4, 0x03, 0x16, 0xEA,
+        0x5E, 0x06, 0x12, 0x17, 0x4F, 0x0E, 0x40, 0x15, 0x1F, 0x66, 0x63, 0x8D, 0x58, 0x5F, 0xCA, 0xA6,
+        0xFB, 0x9C, 0xEF, 0x5A, 0x1F, 0x65, 0x3C, 0x14, 0x6D, 0x22, 0x42, 0xD2, 0xFC, 0xE3, 0x0E, 0x39,
+        0xF7, 0x1D, 0xDA, 0x16, 0xEB, 0x3D, 0xAE, 0xEE, 0xD7, 0x1D, 0x39, 0x64, 0x22, 0x1E, 0x16, 0x65,
+        0x99, 0x4D, 0x04, 0x46, 0x9F, 0xA7, 0xFB, 0xCB, 0x8E, 0xB1, 0x7C, 0xE5, 0x2C, 0x1F, 0xF7, 0x0B,
+        0x80, 0x54, 0x37, 0x08, 0x1C, 0xD6, 0xFB, 0xE3, 0xE7, 0xCF, 0x09, 0xA0, 0x62, 0xD7, 0x37, 0x3C,
+        0x1F, 0xB7, 0x34, 0xE9, 0x8F, 0x3F, 0x0D, 0x76, 0x01, 0x5B, 0xBD, 0x58, 0xBD, 0xEB, 0x85, 0x33,
+        0x61, 0x56, 0xAD, 0xEA, 0x48, 0x2F, 0x83, 0xD8, 0xF2, 0x1E, 0x27, 0x54, 0x10, 0xA5, 0x1E, 0x56,
+        0xF0, 0xA3, 0xF1, 0x04, 0x4B, 0x03, 0x06, 0xCD, 0x92, 0xBA, 0xD3, 0x21, 0xB7, 0xD5, 0xFC, 0x84,
+        0x2B, 0x5A, 0x74, 0x63, 0xD2, 0x8B, 0x5A, 0x74, 0x71, 0xAC, 0xDD, 0xA0, 0xAE, 0xCC, 0x8D, 0x84,
+        0x3C, 0x1E, 0x34, 0x0D, 0x6A, 0x3A, 0x65, 0x39, 0xE6, 0x18, 0xFB, 0x0B, 0x64, 0x75, 0xB9, 0x5F,
+        0x93, 0xF7, 0xBB, 0x45, 0xC9, 0x4C, 0x52, 0xFB, 0xEC, 0x1D, 0x14, 0x21, 0x5A, 0x82, 0xA5, 0x48,
+        0x00, 0xA1, 0x32, 0x7E, 0x04, 0xE8, 0xAA, 0x38, 0x78, 0xF6, 0x37, 0x86, 0x3E, 0xC0, 0xF0, 0x65,
+        0x2D, 0xE9, 0x2A, 0x6B, 0x6B, 0x58, 0x11, 0xF0, 0x70, 0xFB, 0x61, 0x4C, 0x3D, 0x71, 0x49, 0xA2,
+        0x09, 0x55, 0x9E, 0x70, 0x8B, 0x6A, 0x73, 0xED, 0x31, 0x92, 0x66, 0xF5, 0x8E, 0x08, 0x3B, 0x7B,
+        0x47, 0x08, 0xDB, 0xAC, 0x38, 0xBE, 0x36, 0xDD, 0x37, 0xB9, 0x67, 0x1A, 0xB1, 0x6C, 0xFC, 0xA7,
+        0xE5, 0x98, 0x8F, 0x8E, 0x5F, 0x04, 0x3F, 0x4E, 0x60, 0x42, 0x7B, 0x3B, 0xB3, 0x01, 0x19, 0x94,
+        0x78, 0x06, 0x0E, 0x4B, 0x0E, 0x89, 0xE0, 0xAC, 0x31, 0xA8, 0x95, 0xF5, 0x92, 0x5E, 0xD7, 0x2A,
+        0x09, 0xB2, 0xD9, 0x3E, 0xE7, 0x0E, 0x1F, 0xCF, 0xBA, 0xA5, 0xA2, 0xBA, 0x60, 0xEF, 0xDF, 0x82,
+        0x4D, 0xAC, 0x53, 0xB3, 0xB2, 0x94, 0x8D, 0x23, 0x8B, 0xD9, 0xC0, 0x0E, 0x82, 0x45, 0xE8, 0xB7,
+        0x9C, 0x02, 0x1A, 0xC6, 0xB4, 0x3F, 0x04, 0x09, 0xD1, 0xBA, 0xFD, 0xA8, 0x46, 0x8A, 0x7F, 0xEA,
+        0x8E, 0x93, 0x8F, 0xB9, 0x3E, 0xAC, 0x29, 0xF2, 0x33, 0x7F, 0x66, 0x7C, 0xD1, 0xEC, 0x6E, 0x37,
+        0xCA, 0x1F, 0x7E, 0x63, 0x61, 0xBC, 0xDA, 0x5D, 0x35, 0xC7, 0x8C, 0x6B, 0xD2, 0xA7, 0x7F, 0xDD,
+        0x2C, 0xDD, 0xFF, 0x06, 0xE0, 0xF9, 0xD9, 0xE7, 0xC4, 0x49, 0xB8, 0xD3, 0xCD, 0xF2, 0xFE, 0x54,
+        0x5B, 0xE1, 0xEC, 0xC7, 0xF1, 0xBC, 0xE8, 0x04, 0xFB, 0x70, 0x5C, 0x6E, 0x02, 0x2D, 0x68, 0xEA,
+        0x6F, 0x96, 0x38, 0x7D, 0x4A, 0x0A, 0x91, 0x42, 0xAE, 0xC8, 0x58, 0x68, 0xC0, 0x58, 0xCC, 0x4F,
+        0xE1, 0xA9, 0xF5, 0xD4, 0x93, 0x1D, 0x47, 0x8E, 0xCC, 0xDB, 0x72, 0xF9, 0x78, 0xE3, 0x52, 0x7A,
+        0x7D, 0x0F, 0xA1, 0x31, 0x74, 0x69, 0x6D, 0xB0, 0xD3, 0x7C, 0xE9, 0x17, 0x51, 0xD7, 0x4E, 0xB7,
+        0x1B, 0x53, 0xA4, 0x16, 0x6A, 0x23, 0x14, 0xF5, 0x04, 0xB3, 0x7C, 0x49, 0xD1, 0x33, 0x82, 0x40,
+        0xBC, 0x97, 0x27, 0x13, 0xD6, 0x4C, 0xB1, 0xEB, 0x67, 0x29, 0xB3, 0x73, 0x19, 0x02, 0x72, 0x6B,
+        0xA5, 0x45, 0x08, 0x42, 0x6D, 0x36, 0xA5, 0xA1, 0x8D, 0xA0, 0x8B, 0x2B, 0x48, 0x32, 0x2A, 0x67,
+        0xCC, 0x4A, 0x6F, 0xE9, 0x7F, 0x4A, 0x7C, 0xA0, 0x94, 0x09, 0xFD, 0x98, 0x5E, 0x87, 0xA3, 0xD7,
+        0x09, 0x97, 0x6A, 0xAE, 0x27, 0x31, 0x7F, 0xB6, 0xE4, 0x04, 0xCF, 0x1A, 0x49, 0x1F, 0x84, 0x76,
+        0xB7, 0xEC, 0x9D, 0x0E, 0x35, 0x60, 0x63, 0x55, 0xB0, 0x89, 0x0E, 0x2F, 0xAE, 0xDB, 0x11, 0x2D,
+        0xA5, 0xA1, 0x9E, 0x58, 0xCE, 0xD7, 0x7F, 0xC6, 0x21, 0xCB, 0xC9, 0xCA, 0xDE, 0xA0, 0x0A, 0x73,
+        0x77, 0x84, 0x9E, 0xDF, 0x6E, 0x94, 0xAB, 0x51, 0xFF, 0x45, 0x6B, 0xC8, 0x07, 0x1D, 0x02, 0xE1,
+        0x08, 0x07, 0x33, 0x76, 0xB6, 0xBF, 0x92, 0xC6, 0xBB, 0xD6, 0x04, 0x72, 0x3C, 0xBA, 0xA6, 0xE5,
+        0xDB, 0x99, 0x6D, 0x6B, 0xF7, 0x71, 0xC0, 0x0B, 0xD5, 0x48, 0xC7, 0xB7, 0x00, 0xDB, 0xFF, 0xA6,
+        0xC0, 0xE7, 0x7B, 0xCB, 0x61, 0x15, 0x92, 0x52, 0x32, 0xFC, 0xDA, 0x96, 0xE8, 0x67, 0xB5, 0x59,
+        0x5C, 0xC4, 0x98, 0xA9, 0x21, 0x13, 0x74, 0x88, 0x82, 0x4D, 0x6E, 0x26, 0x60, 0xA0, 0x65, 0x37,
+        0x79, 0x49, 0x48, 0x01, 0xDC, 0x06, 0x9D, 0x9E, 0xB3, 0x9F, 0x5F, 0x04, 0x62, 0x60, 0xCE, 0x7F,
+        0x46, 0x18, 0x01, 0xC3, 0x4F, 0x06, 0x7C, 0xE0, 0xF0, 0x28, 0x73, 0xA8, 0xF1, 0xB0, 0xE4, 0x4D,
+        0xFC, 0x69, 0x75, 0x2A, 0xCC, 0xEC, 0xD8, 0x19, 0xF3, 0x8F, 0xD8, 0xE8, 0xBC, 0x2D, 0xA8, 0x2B,
+        0x6F, 0xA5, 0xB5, 0x71, 0xA7, 0xF0, 0x90, 0x49, 0x77, 0x6A, 0x1E, 0xF7, 0xEC, 0xD2, 0x92, 0x23,
+        0x80, 0x51, 0xC1, 0x98, 0xC1, 0xA8, 0x4E, 0x95, 0xB2, 0xB4, 0xAE, 0x17, 0x04, 0x7A, 0xB7, 0x80,
+        0x3B, 0x8B, 0xFA, 0xD0, 0x36, 0x27, 0x99, 0x32, 0xD7, 0x08, 0x6A, 0xCC, 0x12, 0xC9, 0x04, 0x78,
+        0x12, 0xBB, 0x1A, 0x17, 0xD3, 0x4F, 0x8E, 0xDC, 0x12, 0x10, 0xFE, 0x83, 0xF9, 0x7C, 0x6E, 0x7A,
+        0x58, 0x4D, 0x07, 0xCC, 0x44, 0xC5, 0x39, 0xF0, 0x08, 0xE9, 0xB5, 0x93, 0x68, 0xC0, 0x30, 0x98,
+        0x6E, 0x90, 0x40, 0xD8, 0xB3, 0x2A, 0x4D, 0xAC, 0xA8, 0x6B, 0xFD, 0x83, 0xF1, 0x04, 0x8F, 0x68,
+        0xB9, 0xD2, 0xF6, 0x3B, 0x5F, 0x33, 0x92, 0x39, 0xC1, 0xAD, 0x98, 0x1F, 0x16, 0x2E, 0xE8, 0x8C,
+        0x56, 0x78, 0x72, 0x3E, 0xA3, 0x35, 0x1B, 0x7B, 0x44, 0x4C, 0x9E, 0xC4, 0xC0, 0xDA, 0x66, 0x2A,
+        0x9F, 0x2D, 0xBA, 0x06, 0x39, 0x86, 0xDE, 0x1D, 0x90, 0xC2, 0xB6, 0xBE, 0x21, 0x5D, 0xBB, 0xEA,
+        0x2C, 0xFE, 0x95, 0x51, 0x0B, 0xFD, 0xF2, 0x3C, 0xBF, 0x79, 0x50, 0x1F, 0xFF, 0x82, 0x04, 0xA4,
+        0x57, 0xB6, 0xB0, 0xD8, 0xD7, 0x77, 0x83, 0x28, 0xE6, 0x18, 0x7D, 0xF0, 0xF0, 0xB4, 0xED, 0xE2,
+        0xC9, 0x6C, 0xB7, 0x3D, 0xDC, 0x2A, 0xD8, 0xDE, 0x86, 0x3F, 0x53, 0xA0, 0x33, 0xFC, 0x97, 0x00,
+        0x1D, 0xDA, 0x4D, 0xA6, 0x97, 0xFD, 0xB4, 0x04, 0x82, 0x72, 0xE0, 0xD1, 0x61, 0x07, 0xB5, 0xB1,
+        0xD0, 0xDC, 0xE7, 0x3A, 0x1E, 0xFC, 0x7D, 0xD5, 0xF7, 0xDE, 0x99, 0x45, 0x9F, 0xDE, 0xF8, 0x04,
+        0x4B, 0x91, 0x3A, 0xFC, 0xE3, 0x72, 0xFE, 0x36, 0x1D, 0x4B, 0xE5, 0x07, 0x07, 0x03, 0x2C, 0x8A,
+        0x0E, 0xFC, 0x60, 0x68, 0x4B, 0xB8, 0xBD, 0x00, 0x27, 0xCB, 0xCE, 0xDB, 0x2B, 0x22, 0x80, 0x8A,
+        0x1B, 0xC6, 0x8A, 0x68, 0x4B, 0x36, 0x37, 0xB3, 0x94, 0x5A, 0xA9, 0x5F, 0x88, 0xD9, 0x9C, 0x0C,
+        0x55, 0x1D, 0xA5, 0x37, 0x67, 0xA7, 0xA2, 0xB0, 0x0D, 0x48, 0x7C, 0x85, 0xD7, 0x25, 0x6F, 0x7B,
+        0x04, 0x46, 0x20, 0x67, 0xB9, 0x12, 0xC4, 0x61, 0x1A, 0x63, 0x68, 0xED, 0x3B, 0xF6, 0x9B, 0x3A,
+        0xE9, 0xE3, 0x68, 0x38, 0xCD, 0xD2, 0x8D, 0x7B, 0x5B, 0x09, 0xBC, 0xB2, 0xDC, 0x7E, 0x9C, 0xA0,
+        0x99, 0x1E, 0x27, 0xE3, 0x9C, 0xBE, 0x04, 0xA9, 0xB5, 0x2B, 0x11, 0xC4, 0xAD, 0x30, 0xC8, 0x0D,
+        0x86, 0x46, 0x50, 0x09, 0x79, 0x17, 0x9F, 0xC1, 0xAB, 0xF4, 0xDD, 0x54, 0x8D, 0xE2, 0x96, 0xD4,
+        0x53, 0x04, 0x85, 0xD0, 0xFE, 0xF3, 0xEC, 0x6D, 0xB1, 0x09, 0x39, 0x90, 0x64, 0xF3, 0xA0, 0xE3,
+        0xB2, 0x85, 0x56, 0x45, 0xB4, 0xA9, 0x07, 0xAD, 0x35, 0x45, 0x27, 0xAA, 0xE7, 0x51, 0x63, 0xD8,
+        0x27, 0x51, 0x1F, 0x03, 0x64, 0x84, 0x13, 0xA3, 0x8C, 0x0B, 0xE2, 0x9D, 0x49, 0x6E, 0x58, 0x2C,
+        0xF5, 0x66, 0x3E, 0x87, 0x51, 0xE9, 0x68, 0x77, 0x33, 0x15, 0x82, 0xC2, 0x37, 0xA2, 0x4E, 0xB1,
+        0xF9, 0x62, 0x04, 0x38, 0xA4, 0xD1, 0x72, 0x2F, 0x47, 0x2F, 0x80, 0x22, 0x81, 0x8E, 0x1E, 0xFC,
+        0xD8, 0x69, 0xEA, 0x7A, 0x11, 0xEF, 0xEC, 0x2C, 0x0D, 0x2F, 0x9F, 0x4D, 0x87, 0x08, 0x65, 0x97,
+        0x5A, 0x9F, 0x51, 0x80, 0xF0, 0x1F, 0x9A, 0xFF, 0x15, 0xA3, 0x79, 0xE9, 0xA1, 0xB4, 0xF7, 0x0F,
+        0x74, 0x5F, 0xCE, 0x4C, 0x79, 0xE4, 0x2C, 0xF8, 0xF2, 0x25, 0xC9, 0x63, 0x8D, 0xEC, 0xD0, 0x94,
+        0xC9, 0x59, 0xB5, 0x04, 0x81, 0x18, 0xB0, 0x89, 0x4A, 0xAE, 0x35, 0xC0, 0x7C, 0x75, 0x50, 0x27,
+        0xCB, 0x82, 0x04, 0x47, 0xA6, 0x27, 0x30, 0x56, 0x98, 0x4B, 0x22, 0x52, 0x58, 0xAA, 0x17, 0x4D,
+        0xC8, 0x82, 0xA1, 0xA2, 0x07, 0xCC, 0x93, 0xB0, 0xE4, 0xFB, 0xD7, 0x51, 0x2B, 0x96, 0x82, 0x71,
+        0x35, 0x0C, 0x7E, 0xE7, 0xF5, 0x64, 0x55, 0x94, 0x6A, 0xDB, 0x76, 0x6F, 0x69, 0xB1, 0xD7, 0x7F,
+        0x91, 0xB6, 0x0D, 0x56, 0x04, 0xD1, 0x87, 0xDE, 0x9F, 0xC7, 0x5D, 0x3C, 0xF8, 0x62, 0x79, 0x4D,
+        0x12, 0x01, 0x64, 0x94, 0x64, 0x6B, 0x8F, 0x80, 0x30, 0x3E, 0x85, 0x96, 0x3D, 0xD8, 0x86, 0x59,
+        0x91, 0xBD, 0x9F, 0x81, 0xEC, 0xF7, 0xED, 0xAA, 0xAB, 0x67, 0x4E, 0x16, 0xEA, 0x72, 0x57, 0xE4,
+        0xD4, 0x91, 0x08, 0x23, 0xF8, 0x16, 0x4C, 0x6D, 0x40, 0x06, 0x56, 0xE5, 0x9D, 0xEA, 0xEC, 0x3F,
+        0xAB, 0x43, 0xC6, 0x35, 0x65, 0x04, 0xD2, 0x37, 0x7A, 0x74, 0xBB, 0xE0, 0xD8, 0x35, 0xD2, 0xA7,
+        0x6E, 0x4F, 0xF5, 0x9D, 0x5E, 0x79, 0xCB, 0x40, 0x5B, 0x01, 0x1F, 0xE1, 0xC1, 0x2F, 0xA1, 0x65,
+        0x09, 0xC5, 0x7A, 0x84, 0x66, 0xC9, 0x68, 0x5C, 0xB0, 0xC1, 0x88, 0xD0, 0x54, 0x9D, 0x38, 0x74,
+        0x7B, 0x4B, 0xE6, 0xE0, 0xFE, 0x57, 0x17, 0x65, 0x2F, 0x9D, 0x0C, 0x0C, 0x9B, 0x6B, 0x9F, 0x95,
+        0x3C, 0x64, 0x31, 0x37, 0x8A, 0x43, 0x04, 0x07, 0x6A, 0xBD, 0x64, 0x0A, 0xE0, 0xD4, 0x44, 0xDF,
+        0x7A, 0xCC, 0x64, 0xAB, 0x9D, 0xA9, 0x0A, 0xAE, 0x46, 0x30, 0x13, 0xA6, 0xA2, 0x08, 0x0D, 0xF9,
+        0x20, 0x96, 0xFE, 0xDB, 0xF7, 0x30, 0xDD, 0x7E, 0xD6, 0x76, 0x5D, 0xF2, 0x36, 0x0F, 0x64, 0xC0,
+        0x11, 0xB9, 0xCA, 0x0C, 0xFF, 0x67, 0x1D, 0xEA, 0x60, 0x72, 0xF6, 0x72, 0x03, 0x10, 0x9C, 0x74,
+        0xDB, 0xB5, 0xC1, 0x1F, 0xD6, 0x18, 0xE6, 0x04, 0xD2, 0x59, 0x86, 0x48, 0xEF, 0xA0, 0xBE, 0x45,
+        0x90, 0x9F, 0xD5, 0xE4, 0x5E, 0x2F, 0x3B, 0x15, 0x79, 0x1F, 0x28, 0x5B, 0xFA, 0xA4, 0x3F, 0x25,
+        0x9D, 0x73, 0x91, 0x27, 0x62, 0x1A, 0x9E, 0xA3, 0x31, 0x8B, 0x38, 0xBC, 0x90, 0x25, 0xC7, 0x97,
+        0xE5, 0x55, 0x26, 0x24, 0x92, 0x14, 0x0A, 0x86, 0xF9, 0x1E, 0xBE, 0x64, 0xB2, 0x99, 0x1F, 0xE7,
+        0x71, 0x53, 0xE4, 0xD0, 0xBF, 0x47, 0x00, 0x14, 0x04, 0xB5, 0x3F, 0x29, 0xB9, 0x61, 0x05, 0x48,
+        0x26, 0x76, 0x91, 0x8A, 0xAA, 0xF1, 0x5B, 0x30, 0xAD, 0x44, 0x72, 0x81, 0xB4, 0xCC, 0x25, 0xB4,
+        0x08, 0x16, 0xA3, 0x2C, 0x78, 0x72, 0x20, 0x69, 0xE8, 0xBC, 0x6E, 0xB5, 0xEF, 0x79, 0x95, 0x8B,
+        0x0F, 0x79, 0x5B, 0x19, 0x6E, 0xF5, 0x69, 0x57, 0x96, 0xF5, 0x56, 0x6C, 0x08, 0xC3, 0x47, 0xC3,
+        0x4C, 0x4C, 0x3A, 0x6C, 0x70, 0xBD, 0xBF, 0x8E, 0x60, 0x04, 0x64, 0x58, 0x7E, 0x23, 0x35, 0x47,
+        0x1E, 0xB8, 0x90, 0xEE, 0x78, 0x96, 0xD7, 0xCF, 0xDC, 0x86, 0x6B, 0xAC, 0xBD, 0xBD, 0x38, 0x39,
+        0x31, 0x7B, 0x34, 0x36, 0xF9, 0xB4, 0x56, 0x17, 0xE0, 0x73, 0xD9, 0x9F, 0xCD, 0xD5, 0xBF, 0x69,
+        0x02, 0xE2, 0xAE, 0x96, 0xDD, 0x64, 0x47, 0xC2, 0x99, 0xA1, 0x85, 0xB9, 0x0A, 0x39, 0x13, 0x3A,
+        0xEA, 0xB3, 0x58, 0x29, 0x9E, 0x5E, 0x9F, 0xAF, 0x65, 0x89, 0x04, 0x5E, 0xE2, 0x1E, 0x80, 0xED,
+        0x67, 0xA3, 0x7A, 0xF0, 0x7E, 0x34, 0x5C, 0x95, 0xBD, 0x43, 0x12, 0xA5, 0x57, 0x87, 0xCE, 0x38,
+        0x78, 0x18, 0x12, 0x04, 0x3D, 0x98, 0xB5, 0xC7, 0xCF, 0x4A, 0x1F, 0xC9, 0x0E, 0x5C, 0xDB, 0xA8,
+        0xE7, 0xBD, 0x9F, 0x46, 0xF4, 0xF5, 0x24, 0x2C, 0x3F, 0xC6, 0x0B, 0x6B, 0x78, 0x10, 0xC5, 0xF1,
+        0xFB, 0xA1, 0xA8, 0xE2, 0x1E, 0x00, 0x66, 0xB2, 0x76, 0x80, 0x5D, 0x04, 0x22, 0xFA, 0x7C, 0x84,
+        0x91, 0x24, 0x57, 0x5E, 0x11, 0x33, 0x67, 0x13, 0x65, 0x77, 0x7E, 0x5C, 0xEB, 0x35, 0xDF, 0x3E,
+        0xFB, 0xD0, 0xA9, 0x84, 0xD3, 0xB7, 0x00, 0x7B, 0x81, 0xBE, 0xAE, 0x5C, 0x02, 0x7A, 0x4B, 0x5E,
+        0x2E, 0x17, 0xDD, 0x74, 0x3E, 0x27, 0x37, 0x25, 0x84, 0x54, 0x82, 0xA9, 0xA2, 0xA5, 0x86, 0x5B,
+        0x73, 0xE5, 0xF9, 0x97, 0x82, 0x17, 0xC9, 0x10, 0xFB, 0xC1, 0xCE, 0x95, 0x04, 0x16, 0xB4, 0xED,
+        0x09, 0x28, 0x74, 0xA8, 0x07, 0x5D, 0xE9, 0x6D, 0x70, 0x06, 0x40, 0x88, 0xC9, 0xF2, 0x6C, 0x3A,
+        0xE9, 0x63, 0x83, 0xDA, 0xAB, 0xF8, 0x19, 0x1F, 0xF5, 0x73, 0xFC, 0x58, 0xDF, 0x40, 0x8E, 0xE1,
+        0x06, 0xFF, 0x9B, 0x6D, 0xAD, 0xFC, 0x6B, 0x99, 0xBC, 0x10, 0x6C, 0xBF, 0x50, 0xF5, 0x40, 0x81,
+        0xD6, 0x22, 0x9C, 0x5A, 0x71, 0xFA, 0xBC, 0xE5, 0xCC, 0x1E, 0x90, 0x5B, 0x30, 0x04, 0xEA, 0xD4,
+        0x3A, 0xAA, 0xB2, 0xF6, 0x72, 0xAA, 0xB9, 0xA3, 0x7E, 0xB0, 0xF9, 0x9D, 0x36, 0x57, 0x98, 0x2E,
+        0x00, 0x16, 0x9C, 0x96, 0x25, 0x2E, 0xB5, 0x06, 0xED, 0xBB, 0xFE, 0x85, 0xE5, 0x03, 0xE1, 0x03,
+        0x20, 0xC7, 0x88, 0x80, 0xD7, 0xB6, 0x6A, 0x8C, 0xAE, 0xB0, 0x41, 0xE5, 0x29, 0x6A, 0xE4, 0x3F,
+        0x19, 0x37, 0x3D, 0xB5, 0x71, 0x51, 0xBA, 0xA2, 0xB1, 0x9F, 0x95, 0xC8, 0x3F, 0x15, 0x04, 0xF6,
+        0xFC, 0xEC, 0xE5, 0x89, 0xA0, 0x6A, 0x52, 0xB5, 0x54, 0xC1, 0x49, 0x1B, 0xC8, 0x13, 0x62, 0x9C,
+        0x7F, 0x74, 0x75, 0xFB, 0x7D, 0xA8, 0xD1, 0x30, 0xD7, 0x33, 0xE8, 0xDE, 0x96, 0xC5, 0xC3, 0x5A,
+        0xB1, 0xDE, 0x22, 0x05, 0x3E, 0xD4, 0xCD, 0x19, 0xDC, 0x8E, 0xF7, 0x98, 0xA3, 0xA4, 0xBC, 0xAC,
+        0xE2, 0x81, 0x9B, 0x81, 0xD5, 0xE4, 0xDF, 0x5C, 0x30, 0xBB, 0x24, 0xC5, 0x12, 0x52, 0x75, 0x04,
+        0x98, 0x01, 0x04, 0xAF, 0x3A, 0x1E, 0x81, 0x86, 0x4B, 0x1A, 0x70, 0x17, 0x9E, 0x58, 0x72, 0x7F,
+        0xAB, 0x90, 0xB5, 0xE6, 0xE5, 0x5F, 0xAE, 0xCC, 0x3A, 0xD1, 0xED, 0x6F, 0x62, 0x9E, 0x18, 0x1D,
+        0x75, 0xC2, 0xBA, 0x24, 0xDF, 0xBE, 0x45, 0xE9, 0xF1, 0x64, 0x4A, 0x2C, 0xC5, 0x03, 0x88, 0x2A,
+        0x8D, 0xDC, 0x0C, 0xB9, 0x7D, 0x1B, 0x8A, 0x3C, 0x4F, 0xB2, 0x98, 0x40, 0xF3, 0xC8, 0x7B, 0x09,
+        0x04, 0xA3, 0x17, 0xCE, 0xE5, 0x29, 0xFE, 0x17, 0x53, 0x83, 0x32, 0x1C, 0x44, 0xD7, 0x29, 0x29,
+        0xD0, 0xB4, 0x28, 0x7C, 0xFE, 0x35, 0xB8, 0xED, 0xE8, 0xC9, 0x6A, 0xEA, 0x04, 0xE9, 0xEF, 0x78,
+        0x2B, 0xA4, 0x62, 0x96, 0x2D, 0x9E, 0x6A, 0xD5, 0xC9, 0x0F, 0x19, 0x5B, 0x88, 0x77, 0xD9, 0x5B,
+        0x4E, 0xEB, 0x08, 0x00, 0xEC, 0x1C, 0xC9, 0x11, 0x26, 0x1D, 0x08, 0x25, 0x53, 0xDF, 0xDF, 0x08,
+        0xE3, 0x04, 0x91, 0x6A, 0xA6, 0x5C, 0x6B, 0x57, 0x07, 0xD7, 0xBE, 0x9F, 0xE1, 0xFB, 0xCB, 0x01,
+        0x6D, 0xD8, 0x63, 0x66, 0xE3, 0xF2, 0xD4, 0xA6, 0xEA, 0x05, 0x52, 0xAB, 0x04, 0x2C, 0x95, 0x4F,
+        0xEA, 0x0D, 0x3B, 0x95, 0x31, 0xA9, 0xD5, 0x11, 0xF1, 0xBA, 0xA6, 0xD8, 0xD9, 0x15, 0xE2, 0x17,
+        0x4E, 0xD8, 0x1C, 0xC8, 0x23, 0x4F, 0x53, 0x88, 0xF7, 0xC8, 0xB1, 0xD0, 0x42, 0x2F, 0x09, 0x7B,
+        0x9E, 0xA8, 0x04, 0x3D, 0x36, 0x4E, 0xEA, 0xF1, 0xD1, 0xDB, 0x4D, 0xEB, 0x13, 0x81, 0x73, 0x96,
+        0x78, 0x22, 0xA9, 0x52, 0xF5, 0xF6, 0xC2, 0x22, 0x8F, 0x58, 0x6F, 0x44, 0xD0, 0xCC, 0xB3, 0x6F,
+        0xF3, 0x65, 0x39, 0x90, 0x94, 0x60, 0x1E, 0x30, 0x27, 0xC4, 0x72, 0x0C, 0xF4, 0xC9, 0x28, 0x2B,
+        0xAA, 0xDC, 0x3C, 0xD7, 0x52, 0xE6, 0x61, 0x4A, 0x0D, 0xB4, 0x82, 0xA5, 0xEB, 0xEC, 0x3E, 0x60,
+        0x5A, 0x5C, 0xFF, 0x04, 0xBC, 0x2D, 0x36, 0x17, 0xBD, 0x32, 0xAD, 0x81, 0x91, 0xC1, 0x2A, 0x31,
+        0xFD, 0xAA, 0x64, 0x6C, 0x5F, 0x21, 0x94, 0xF3, 0xAF, 0x21, 0xB6, 0xC2, 0xD5, 0x35, 0x01, 0xFD,
+        0x84, 0x12, 0xD1, 0x64, 0x65, 0xF9, 0xBD, 0x64, 0x0D, 0x47, 0x97, 0x67, 0xCF, 0xAA, 0x88, 0x68,
+        0x0D, 0x35, 0xFB, 0xEB, 0xCA, 0x62, 0xE6, 0x43, 0x63, 0xAD, 0x7F, 0x4E, 0x29, 0xFA, 0x0F, 0x1F,
+        0xB9, 0x55, 0xC0, 0x24, 0x04, 0x2E, 0xBB, 0x89, 0xA9, 0x09, 0x48, 0xE5, 0x2C, 0x86, 0xC4, 0xCD,
+        0x38, 0xBC, 0x63, 0x5C, 0xB0, 0x0B, 0xD1, 0xA4, 0x91, 0xBF, 0xD8, 0x5B, 0x39, 0x23, 0x43, 0x76,
+        0x68, 0x16, 0x02, 0x83, 0x44, 0x5A, 0xA8, 0x82, 0xBA, 0x20, 0x16, 0xDB, 0xC3, 0x51, 0x65, 0xDF,
+        0x33, 0x49, 0x14, 0x3E, 0x7E, 0xC9, 0x06, 0xE5, 0x81, 0xAC, 0x8F, 0x8D, 0x3E, 0x80, 0xB2, 0x80,
+        0x9E, 0xC0, 0xC7, 0x3F, 0x50, 0x04, 0xEE, 0x04, 0x75, 0xAC, 0xCC, 0x2E, 0x9A, 0x9B, 0xA1, 0xBD,
+        0x8B, 0x74, 0xCC, 0xEA, 0x66, 0x43, 0x05, 0x60, 0x5A, 0xC7, 0xAB, 0xF0, 0x1E, 0x4F, 0x26, 0x4F,
+        0xC5, 0xC9, 0x8F, 0x3F, 0xCE, 0x2A, 0x6C, 0x36, 0x3A, 0xB2, 0x79, 0x4A, 0x3D, 0x17, 0x98, 0x18,
+        0xD0, 0xB0, 0xDA, 0xAF, 0x71, 0x83, 0x01, 0x9D, 0xE6, 0xE6, 0x54, 0x13, 0xF9, 0x18, 0x32, 0xA8,
+        0x02, 0x78, 0x70, 0xEB, 0x35, 0x37, 0x04, 0x16, 0xEC, 0x17, 0xDF, 0x10, 0x71, 0x15, 0xD9, 0x72,
+        0x03, 0x56, 0x69, 0xB9, 0xC0, 0x36, 0xDD, 0x94, 0xD2, 0x90, 0x45, 0x06, 0x49, 0xFA, 0x8B, 0xF3,
+        0xE1, 0xB3, 0xFA, 0x8D, 0x30, 0x04, 0xA7, 0x83, 0x17, 0xAF, 0xC3, 0x5C, 0x8E, 0x69, 0x23, 0x79,
+        0x4D, 0x26, 0x8E, 0x93, 0x69, 0x98, 0x3B, 0x69, 0x39, 0x09, 0x0B, 0x69, 0xD2, 0x15, 0x9D, 0x0B,
+        0xF1, 0x16, 0x82, 0x66, 0x5C, 0x95, 0xD7, 0x04, 0xEE, 0x5F, 0x03, 0xD0, 0xBB, 0xBA, 0xDD, 0x41,
+        0x66, 0xE9, 0x41, 0xDB, 0x89, 0xAF, 0x54, 0x1D, 0xAC, 0xD5, 0x88, 0x6E, 0x36, 0x04, 0x23, 0x5C,
+        0xAA, 0xE3, 0x06, 0x61, 0x38, 0x33, 0x61, 0xB1, 0x25, 0x6B, 0xA2, 0xB2, 0x74, 0x09, 0x1E, 0xE0,
+        0xD2, 0xC5, 0xD8, 0xDC, 0x09, 0x99, 0xA9, 0x8E, 0x9B, 0xF1, 0x08, 0xD1, 0x4F, 0x6A, 0xBD, 0x64,
+        0x0D, 0x6F, 0xD3, 0x0E, 0x62, 0xD2, 0x98, 0x4E, 0x04, 0xC5, 0xD4, 0xD3, 0xC4, 0x1D, 0x55, 0xC2,
+        0xB4, 0x3D, 0x47, 0x72, 0x23, 0xD4, 0x1D, 0xA7, 0xF3, 0x77, 0x4D, 0x82, 0xA8, 0x6D, 0xD0, 0xEC,
+        0xF3, 0xBF, 0x1B, 0x2B, 0x10, 0x18, 0x57, 0x0D, 0x19, 0xA5, 0x65, 0x86, 0x31, 0xD7, 0xDA, 0xEE,
+        0x09, 0xA7, 0x47, 0xB9, 0xF3, 0xB2, 0x77, 0x93, 0x9A, 0xA4, 0x41, 0x74, 0x7F, 0xC1, 0x4E, 0xA6,
+        0xE3, 0xB1, 0x2C, 0xC3, 0x3A, 0x43, 0xEE, 0xC5, 0x47, 0x04, 0xEE, 0xBF, 0xA4, 0xD4, 0x93, 0xBE,
+        0xBF, 0x98, 0xBA, 0x5F, 0xEE, 0xC8, 0x12, 0xC2, 0xD3, 0xB5, 0x09, 0x47, 0x96, 0x12, 0x37, 0xA9,
+        0x19, 0x83, 0x9A, 0x53, 0x3E, 0xCA, 0x0E, 0x7D, 0xD7, 0xFA, 0x5D, 0x9A, 0x8C, 0xA3, 0x97, 0x0E,
+        0xF0, 0xF2, 0x69, 0xEE, 0x7E, 0xDA, 0xF1, 0x78, 0x08, 0x9D, 0x9A, 0xE4, 0xCD, 0xC3, 0xA7, 0x11,
+        0xF7, 0x12, 0xDD, 0xFD, 0x4F, 0xDA, 0xE1, 0xDE, 0x89, 0x99, 0x04, 0xE5, 0x03, 0x7D, 0xE0, 0xAF,
+        0xC1, 0xD8, 0xD4, 0x3D, 0x83, 0x48, 0x41, 0x4B, 0xBF, 0x41, 0x03, 0x04, 0x3E, 0xC8, 0xF5, 0x75,
+        0xBF, 0xDC, 0x43, 0x29, 0x53, 0xCC, 0x8D, 0x20, 0x37, 0xFA, 0x2D, 0x45, 0x71, 0x53, 0x4B, 0xAA,
+        0x94, 0xD3, 0xB5, 0xF9, 0xF9, 0x8D, 0x09, 0xFB, 0x99, 0x0B, 0xDD, 0xBD, 0x5F, 0x5B, 0x03, 0xEC,
+        0x48, 0x1F, 0x10, 0xE0, 0xE5, 0xDC, 0x84, 0x1D, 0x75, 0x5B, 0xDA, 0x04, 0xA9, 0x93, 0x91, 0x14,
+        0x2D, 0xB2, 0xC4, 0x8D, 0x17, 0xBF, 0xC4, 0x5B, 0x76, 0xF0, 0xB5, 0x6C, 0x15, 0x08, 0x3A, 0x49,
+        0xF0, 0x59, 0x04, 0xE3, 0x70, 0x99, 0xB9, 0xE4, 0x48, 0x75, 0x9B, 0xB8, 0x20, 0xB5, 0xFF, 0x54,
+        0x20, 0x91, 0x70, 0x56, 0xFB, 0x93, 0xB7, 0xE1, 0xF0, 0x25, 0x66, 0xF5, 0x34, 0xAF, 0x46, 0x89,
+        0xDF, 0x8C, 0x80, 0x55, 0xAC, 0xCE, 0x80, 0xE2, 0xE6, 0x00, 0x44, 0x7F, 0x04, 0xE4, 0xF3, 0xFB,
+        0x01, 0x76, 0xAF, 0x85, 0xD6, 0x5F, 0xF9, 0x9F, 0xF9, 0x19, 0x8C, 0x36, 0x09, 0x1F, 0x48, 0xE8,
+        0x65, 0x03, 0x68, 0x1E, 0x3E, 0x66, 0x86, 0xFD, 0x50, 0x53, 0x23, 0x1E, 0x11, 0x1E, 0x63, 0x63,
+        0x3A, 0xD0, 0xEF, 0x4F, 0x1C, 0x16, 0x61, 0xA6, 0xD0, 0xEA, 0x02, 0xB7, 0x28, 0x6C, 0xC7, 0xE7,
+        0x4E, 0xC9, 0x51, 0xD1, 0xC9, 0x82, 0x2C, 0x38, 0x57, 0x6F, 0xEB, 0x73, 0xBC, 0x04, 0xF8, 0x44,
+        0xAC, 0xE6, 0x35, 0x49, 0x7D, 0xD0, 0x74, 0x24, 0x64, 0x16, 0xBF, 0x94, 0xA8, 0xA4, 0x95, 0xEE,
+        0xA7, 0x25, 0xB3, 0x89, 0x70, 0x04, 0xA4, 0x56, 0x30, 0xB2, 0x69, 0x9B, 0xFA, 0x07, 0xDF, 0xB6,
+        0x60, 0x0A, 0xEE, 0x7D, 0xE7, 0x4A, 0x95, 0x19, 0xC5, 0x5F, 0x6D, 0x6A, 0x13, 0xEF, 0x4D, 0xBE,
+        0xCD, 0x46, 0xC6, 0xBF, 0xC2, 0x84, 0x26, 0xC9, 0xBC, 0x9D, 0x63, 0x9E, 0x15, 0x75, 0x04, 0xA7,
+        0x9C, 0x98, 0x48, 0x61, 0x3A, 0xD4, 0xB8, 0x99, 0xB8, 0xDE, 0x6F, 0x04, 0xB2, 0x7F, 0xE9, 0xBD,
+        0x07, 0x54, 0x8C, 0xF5, 0x3E, 0x34, 0xED, 0x5F, 0xA6, 0xC0, 0xCF, 0x66, 0xE9, 0xAE, 0x41, 0xA5,
+        0xD0, 0xC8, 0x1F, 0x8F, 0xCC, 0x54, 0xA5, 0x78, 0xAF, 0xEA, 0x2B, 0x0A, 0xE5, 0x50, 0xFD, 0xC0,
+        0xCE, 0xF7, 0x77, 0xEF, 0x88, 0x9C, 0x8F, 0xCF, 0x82, 0xBE, 0x08, 0x49, 0xEE, 0x2B, 0xA3, 0x04,
+        0x1C, 0xA3, 0x2B, 0x8F, 0x9C, 0xE2, 0x5A, 0xC2, 0x3A, 0x1A, 0xD4, 0x2B, 0xD3, 0xEA, 0x77, 0x6A,
+        0x3A, 0x5E, 0x14, 0xF6, 0xA3, 0xDA, 0x96, 0x70, 0x4A, 0xF7, 0x5C, 0x03, 0xE6, 0xAF, 0x70, 0xA9,
+        0xCC, 0x6F, 0x90, 0xDC, 0x35, 0x5E, 0xC9, 0x25, 0x18, 0x7E, 0x93, 0x2D, 0x06, 0x6B, 0x51, 0x12,
+        0x2A, 0xF1, 0x56, 0x20, 0x5C, 0xDE, 0x14, 0xC6, 0x0D, 0x08, 0x4B, 0x05, 0xD2, 0x5B, 0x38, 0xB8,
+        0x04, 0xFF, 0x2B, 0x0D, 0xCE, 0x97, 0xEE, 0xCE, 0x97, 0xC1, 0xC9, 0xB6, 0x04, 0x17, 0x98, 0xB8,
+        0x5D, 0xFD, 0xFB, 0x6D, 0x88, 0x82, 0xDA, 0x20, 0x30, 0x8F, 0x54, 0x04, 0x82, 0x45, 0x26, 0x08,
+        0x7E, 0x49, 0x3D, 0x13, 0xFE, 0xF5, 0x24, 0xBA, 0x18, 0x8A, 0xF4, 0xC4, 0xDC, 0x54, 0xD0, 0x79,
+        0x36, 0xC7, 0xB7, 0xED, 0x6F, 0xB9, 0x0E, 0x2C, 0xEB, 0x2C, 0x95, 0x1E, 0x01, 0xF0, 0xC2, 0x99,
+        0x07, 0x04, 0x77, 0x4F, 0x67, 0x7D, 0x7E, 0x80, 0xEF, 0x57, 0xBB, 0x76, 0xC5, 0x6E, 0xE2, 0xC9,
+        0x85, 0x2F, 0x38, 0x16, 0xEA, 0x1E, 0xF5, 0x8F, 0x1B, 0x8F, 0xB5, 0xA2, 0xBC, 0x2B, 0x3E, 0x91,
+        0xA4, 0x18, 0x45, 0x2C, 0x74, 0x27, 0x9D, 0x40, 0x9C, 0xF6, 0x14, 0x9F, 0xE6, 0x61, 0xC8, 0x83,
+        0xEC, 0xD6, 0x96, 0x92, 0x30, 0x40, 0x80, 0xA3, 0xEF, 0xF0, 0x70, 0x6F, 0xC7, 0x23, 0x8B, 0x3C,
+        0x59, 0xE1, 0x04, 0x87, 0xE9, 0x1C, 0xA5, 0xBE, 0xAF, 0xE8, 0x0D, 0xE5, 0x27, 0x0B, 0x45, 0x9B,
+        0xBF, 0xC6, 0xA5, 0x97, 0x84, 0xF3, 0xF6, 0x13, 0x08, 0xB2, 0x25, 0x82, 0xE1, 0xAD, 0xA4, 0x33,
+        0xB3, 0xD5, 0xDC, 0xE4, 0xFE, 0xD9, 0xB6, 0x1E, 0x22, 0x5A, 0x1B, 0xD1, 0x9B, 0xC0, 0x6B, 0x11,
+        0xA2, 0x92, 0x33, 0x2B, 0xC6, 0xC3, 0x9D, 0x81, 0x9D, 0x91, 0xC4, 0x64, 0x44, 0x48, 0x96, 0x3F,
+        0x64, 0xCA, 0xC5, 0x04, 0x9C, 0x05, 0xC6, 0x7D, 0x00, 0xC5, 0x9C, 0x59, 0x6D, 0x2D, 0x66, 0x84,
+        0x74, 0x73, 0x63, 0x27, 0x2D, 0x05, 0xF0, 0x0F, 0x2F, 0x71, 0x80, 0xA2, 0xE5, 0x79, 0x74, 0x2E,
+        0x99, 0x2B, 0x26, 0xCB, 0x49, 0x3F, 0x0F, 0xD2, 0xFE, 0x1E, 0x01, 0x51, 0x9F, 0xB7, 0x49, 0xC5,
+        0x23, 0x24, 0x56, 0xC5, 0x5F, 0x87, 0x6D, 0xD4, 0x2D, 0x07, 0xCB, 0x57, 0x3F, 0xE3, 0x5E, 0x68,
+        0x76, 0xA6, 0xEF, 0x28, 0x04, 0xBB, 0x6B, 0x23, 0xB9, 0x6A, 0xAE, 0x96, 0xA4, 0x15, 0x43, 0x27,
+        0x13, 0x58, 0x09, 0x53, 0xE8, 0x9B, 0xE3, 0x35, 0xC4, 0x7C, 0x1C, 0x11, 0x7D, 0x2C, 0x54, 0xE0,
+        0xAA, 0x39, 0xE2, 0x8A, 0x85, 0xE8, 0xC8, 0xFC, 0x81, 0xF4, 0xD8, 0x0B, 0x12, 0x3D, 0xCE, 0x39,
+        0xAF, 0x43, 0x2B, 0xE5, 0x05, 0x31, 0x4C, 0xA2, 0xC1, 0xC8, 0x66, 0x3B, 0x5D, 0x17, 0xB9, 0xC0,
+        0xA0, 0xD7, 0x18, 0x18, 0xDC, 0x04, 0x02, 0x82, 0x18, 0xBA, 0x74, 0x3E, 0xE1, 0xF9, 0xED, 0xE4,
+        0xEC, 0xA5, 0xAB, 0x01, 0x68, 0x76, 0x4C, 0x6D, 0x0C, 0x04, 0xCB, 0x51, 0xC6, 0x75, 0x30, 0x71,
+        0x4F, 0xFE, 0x87, 0x50, 0xA2, 0x77, 0x4F, 0x71, 0x2B, 0xD4, 0x13, 0xC7, 0x1A, 0x19, 0x66, 0x93,
+        0x03, 0x0E, 0x6D, 0x3B, 0xD7, 0x68, 0x4D, 0x7A, 0x90, 0xA3, 0x1B, 0x76, 0x54, 0x83, 0xBE, 0x34,
+        0x94, 0xA8, 0xD7, 0x61, 0x22, 0x8F, 0x04, 0x43, 0xA1, 0x5E, 0x01, 0x15, 0xD6, 0xAF, 0xE5, 0xA5,
+        0x70, 0x20, 0xFF, 0x86, 0xDE, 0xBB, 0x3E, 0xBA, 0xD4, 0x27, 0x6F, 0x16, 0xE9, 0xCE, 0x81, 0x2D,
+        0x72, 0xFC, 0xC9, 0x76, 0xDF, 0x2F, 0x08, 0x17, 0x47, 0x63, 0x07, 0xF7, 0xE5, 0xD7, 0xF7, 0x29,
+        0x6D, 0x09, 0xB9, 0x0E, 0xF5, 0x90, 0x16, 0xED, 0x7C, 0x96, 0x22, 0x3C, 0x06, 0x09, 0x4D, 0xD2,
+        0xE1, 0x58, 0xCB, 0x99, 0x26, 0x22, 0x91, 0x04, 0xA2, 0x4B, 0xA0, 0xB8, 0xEC, 0x18, 0xC9, 0x2C,
+        0x03, 0x47, 0x7D, 0x26, 0x29, 0x00, 0xDE, 0xE3, 0x29, 0xAA, 0x41, 0xCC, 0x97, 0x45, 0x65, 0x8E,
+        0xC0, 0x4F, 0x02, 0x94, 0x18, 0x07, 0xD9, 0x71, 0x17, 0x47, 0x59, 0x87, 0x7C, 0xB7, 0xFA, 0xF6,
+        0x36, 0x1E, 0x98, 0x58, 0x98, 0x9C, 0x7B, 0x68, 0x2D, 0xBD, 0x95, 0xEA, 0xD4, 0x1D, 0x69, 0xEC,
+        0xC9, 0x72, 0x1C, 0xB7, 0xA3, 0xA4, 0x00, 0xDD, 0x04, 0x84, 0x81, 0xBD, 0xE0, 0xE4, 0xE4, 0xD8,
+        0x85, 0xB3, 0xA5, 0x46, 0xD3, 0xE5, 0x49, 0xDE, 0x04, 0x2F, 0x0A, 0xA6, 0xCE, 0xA2, 0x50, 0xE7,
+        0xFD, 0x35, 0x8D, 0x6C, 0x86, 0xDD, 0x45, 0xE4, 0x58, 0x38, 0xEE, 0x7B, 0x8C, 0xBA, 0x54, 0x04,
+        0xDD, 0x84, 0xA2, 0x5B, 0xF3, 0x9C, 0xEC, 0xB2, 0xCA, 0x90, 0x0A, 0x79, 0xC4, 0x2B, 0x26, 0x2E,
+        0x55, 0x6D, 0x64, 0xB1, 0xB5, 0x97, 0x79, 0x05, 0x7E, 0x04, 0xD0, 0x35, 0x99, 0x39, 0x18, 0x40,
+        0xCD, 0xC4, 0xC0, 0x71, 0x19, 0x0E, 0x6B, 0xD1, 0xCA, 0x1D, 0x77, 0xAD, 0x3A, 0xC3, 0x2D, 0xA4,
+        0xB9, 0xDB, 0x55, 0x65, 0x19, 0x79, 0xA1, 0x63, 0xCF, 0xC6, 0x28, 0x30, 0xD3, 0x7D, 0x96, 0x49,
+        0x8A, 0x78, 0x4F, 0x12, 0xE4, 0xD6, 0x30, 0x8D, 0xE2, 0xEF, 0x47, 0x65, 0x20, 0x4E, 0x3F, 0xA6,
+        0x55, 0x40, 0xF9, 0x67, 0xB1, 0x4C, 0x24, 0xDB, 0xE9, 0x68, 0x04, 0xB7, 0x1F, 0x2F, 0x27, 0x84,
+        0x20, 0x17, 0x03, 0xB9, 0x28, 0xA7, 0xAF, 0xDF, 0x84, 0xDD, 0xCE, 0x55, 0x71, 0x9E, 0xE0, 0x32,
+        0x9B, 0xB7, 0x6C, 0xB8, 0x89, 0xB3, 0x3B, 0x6C, 0x1A, 0x8C, 0x8E, 0x94, 0xEA, 0x02, 0x56, 0x58,
+        0x9D, 0x28, 0xBB, 0x7B, 0xD1, 0x3D, 0xAA, 0x89, 0x73, 0x34, 0x1C, 0xDA, 0x73, 0xB2, 0x35, 0x3C,
+        0x85, 0x3A, 0x5D, 0x63, 0x9A, 0x8F, 0x75, 0x07, 0x0F, 0x68, 0x43, 0x04, 0x76, 0x37, 0x04, 0xBE,
+        0xE7, 0x0F, 0xE5, 0xB0, 0x5D, 0x08, 0x8D, 0x8A, 0xE9, 0x18, 0x1A, 0x14, 0xEE, 0xE9, 0x05, 0x33,
+        0x25, 0x4D, 0xBB, 0xA8, 0x43, 0xBF, 0xBC, 0xBD, 0x92, 0x23, 0x7F, 0x05, 0x11, 0xC1, 0x2D, 0xD6,
+        0x91, 0x6B, 0x97, 0x21, 0xE7, 0x98, 0x31, 0xB7, 0x35, 0x97, 0x94, 0xD4, 0x4A, 0x94, 0x14, 0x40,
+        0x8D, 0x94, 0x99, 0x1D, 0x0E, 0xB9, 0x5E, 0x4B, 0x62, 0xD2, 0x1B, 0x8B, 0x04, 0x36, 0xD9, 0x42,
+        0x38, 0xC6, 0x2F, 0x80, 0x29, 0xD8, 0xF6, 0xC6, 0xD5, 0x5A, 0x6F, 0x7C, 0xD6, 0xA3, 0xD3, 0x10,
+        0xC4, 0x2B, 0x06, 0x32, 0x69, 0x0A, 0xC8, 0x65, 0x21, 0x33, 0x57, 0xC9, 0x21, 0xF4, 0x26, 0x1D,
+        0xA6, 0x11, 0x51, 0x52, 0xFA, 0xE6, 0xED, 0x47, 0xAD, 0x82, 0x9C, 0x07, 0x23, 0x05, 0x44, 0x52,
+        0x55, 0xC4, 0x34, 0xA6, 0x7C, 0x18, 0xA1, 0x58, 0x52, 0x73, 0x3E, 0x32, 0xED, 0x04, 0xD6, 0x76,
+        0x2C, 0x68, 0x3C, 0x13, 0x24, 0xC2, 0xF1, 0xE5, 0x27, 0xAE, 0x81, 0x4F, 0x32, 0x2E, 0xED, 0xA0,
+        0x59, 0x00, 0x0F, 0xF8, 0x9B, 0x23, 0x9E, 0x7D, 0x91, 0x9C, 0x8F, 0x3D, 0xBC, 0x00, 0xD8, 0x2A,
+        0xFA, 0xF2, 0xF3, 0x47, 0x6D, 0x8B, 0x96, 0x1D, 0xB3, 0xE7, 0x7A, 0xA4, 0x38, 0xA2, 0xD4, 0xF4,
+        0x40, 0x7F, 0x64, 0x08, 0xFC, 0x98, 0xA6, 0x27, 0x15, 0xC2, 0x18, 0x08, 0xD4, 0xD9, 0x04, 0x41,
+        0x10, 0x62, 0xE6, 0xBA, 0xCC, 0x3D, 0xD6, 0x6C, 0xB9, 0x8B, 0x29, 0x12, 0x4F, 0xF4, 0x92, 0x15,
+        0x7D, 0xE1, 0xF3, 0x28, 0x79, 0x4C, 0x3D, 0xA3, 0x78, 0xB7, 0x09, 0x82, 0xBF, 0x68, 0xD5, 0x9F,
+        0xBC, 0x0E, 0x55, 0x43, 0x2E, 0xD3, 0xC5, 0xC0, 0x04, 0x5C, 0xD8, 0x90, 0x52, 0xAE, 0xF0, 0x2A,
+        0xFF, 0x6F, 0x2B, 0x70, 0xF7, 0x4D, 0x46, 0xE1, 0x10, 0x4F, 0x96, 0xC2, 0x0D, 0xFC, 0x3A, 0x04,
+        0xF6, 0x77, 0xBE, 0x60, 0x11, 0x85, 0x1E, 0x4E, 0x9D, 0x92, 0xB2, 0xD7, 0xDD, 0xBF, 0x40, 0xA0,
+        0xD4, 0xC7, 0x8E, 0xD9, 0x81, 0x35, 0x1A, 0x63, 0x30, 0x69, 0x92, 0xAC, 0x4A, 0x6F, 0x32, 0x03,
+        0x67, 0x9F, 0xDC, 0xCA, 0x6B, 0xD1, 0x78, 0x11, 0xB5, 0x0B, 0x61, 0x57, 0x6D, 0xC9, 0x2F, 0xF6,
+        0xC3, 0x79, 0xB2, 0xA3, 0x85, 0xBD, 0x85, 0x65, 0x47, 0x64, 0xB1, 0xF7, 0x94, 0x85, 0x95, 0xBB,
+        0x04, 0x3F, 0x68, 0x94, 0xA5, 0xDB, 0x8F, 0xB9, 0x8E, 0x28, 0x3E, 0x59, 0x1B, 0xAC, 0x8B, 0x06,
+        0x58, 0x25, 0x33, 0x7F, 0x63, 0xF8, 0xF9, 0xEB, 0x61, 0x0F, 0xE4, 0x55, 0x90, 0x20, 0x6F, 0xA8,
+        0x45, 0xA2, 0x5F, 0xE5, 0x40, 0x9C, 0x74, 0xEE, 0x1A, 0xD7, 0xBC, 0x04, 0xA3, 0x56, 0x1D, 0xF2,
+        0xC6, 0x88, 0xD7, 0x6D, 0xDF, 0x45, 0x33, 0x41, 0x78, 0xDB, 0xC9, 0x31, 0xE0, 0x29, 0x73, 0x11,
+        0xCB, 0x04, 0x7B, 0xE1, 0x95, 0x72, 0x03, 0x8B, 0x64, 0xF6, 0x74, 0x87, 0x69, 0x15, 0x72, 0xBC,
+        0xB0, 0xE9, 0xB1, 0xA7, 0x56, 0xBE, 0xE5, 0x14, 0x07, 0x20, 0xE2, 0xE1, 0x92, 0x98, 0x2C, 0xB9,
+        0xDC, 0x98, 0x04, 0x0D, 0xCB, 0x96, 0x64, 0x5F, 0x78, 0x4F, 0xE9, 0xEE, 0x9F, 0xEE, 0x38, 0x26,
+        0x6D, 0x7A, 0xFD, 0x65, 0xEE, 0x0C, 0xF9, 0xA1, 0x74, 0x7A, 0x20, 0xE2, 0x3F, 0x2C, 0x0C, 0x5B,
+        0x6A, 0x61, 0x04, 0x1D, 0xE8, 0x70, 0xE5, 0x45, 0x27, 0xE3, 0x8E, 0x61, 0x30, 0xC4, 0x0C, 0x53,
+        0x01, 0x40, 0xD8, 0xE2, 0x4A, 0xFF, 0xB2, 0x64, 0xA7, 0x34, 0x78, 0x3C, 0x99, 0xFB, 0x3A, 0xC2,
+        0x98, 0x88, 0xF9, 0x79, 0x72, 0x76, 0x78, 0xC9, 0x0A, 0x92, 0xD1, 0xE3, 0xA5, 0x74, 0xEA, 0x8E,
+        0xE7, 0x29, 0x10, 0xB4, 0x60, 0xD9, 0x9A, 0xAA, 0xF1, 0x47, 0x06, 0xF8, 0x26, 0xE6, 0x0E, 0x1D,
+        0x72, 0xFD, 0x00, 0x04, 0x25, 0xCF, 0x16, 0x53, 0x49, 0xD2, 0x21, 0xD7, 0x73, 0xD8, 0x9C, 0xD3,
+        0x11, 0xBE, 0x28, 0x92, 0xEE, 0xDE, 0x79, 0x4E, 0x49, 0x91, 0xD1, 0x2F, 0xD8, 0x71, 0xC8, 0x63,
+        0x66, 0x48, 0x4A, 0x18, 0xAF, 0x55, 0x70, 0x6E, 0xDD, 0xCD, 0xF6, 0xC1, 0x76, 0xEA, 0x14, 0x0B,
+        0x85, 0x1B, 0x7D, 0x26, 0x28, 0x67, 0x5C, 0xF1, 0xA1, 0xD8, 0x7B, 0xCC, 0x92, 0x8C, 0xA1, 0x39,
+        0x72, 0x98, 0xB9, 0x28, 0x04, 0xD7, 0xB7, 0x17, 0xFD, 0x26, 0x0A, 0x08, 0x66, 0x82, 0x16, 0xC1,
+        0x5B, 0x2C, 0x5A, 0xB8, 0xC8, 0x18, 0x34, 0xDD, 0x45, 0xDF, 0xA1, 0x66, 0x42, 0xD4, 0x75, 0xC1,
+        0x1B, 0xC7, 0x58, 0xCB, 0xBC, 0x86, 0x16, 0x6A, 0x11, 0x7E, 0xD8, 0xC6, 0xD0, 0x8C, 0x77, 0xD4,
+        0x8A, 0xBC, 0x2B, 0x49, 0xFE, 0xE4, 0xAF, 0xDB, 0xE1, 0xEA, 0x7E, 0xB6, 0xFB, 0xBF, 0x83, 0x2B,
+        0x17, 0x40, 0x30, 0x74, 0x3E, 0x04, 0x8A, 0xFD, 0x15, 0x65, 0xCC, 0x67, 0x2C, 0x24, 0x65, 0x46,
+        0xE5, 0xF3, 0x37, 0x4E, 0xC0, 0x6B, 0xAB, 0x8D, 0x9A, 0x2C, 0x1B, 0xC3, 0x7F, 0x4F, 0xE0, 0x71,
+        0x5C, 0x4D, 0x47, 0x18, 0xF8, 0x49, 0x1A, 0x95, 0x3E, 0x57, 0x4D, 0x3E, 0xDE, 0x23, 0x6C, 0xB1,
+        0x26, 0xB1, 0x7C, 0x43, 0x09, 0xAB, 0x9B, 0x93, 0xF3, 0x30, 0xC0, 0x31, 0x6A, 0x6C, 0x40, 0xD9,
+        0x74, 0x16, 0x18, 0x68, 0x0D, 0x96, 0x04, 0x3B, 0x0B, 0xFE, 0xED, 0x90, 0x10, 0x2F, 0x62, 0x1A,
+        0x14, 0xBE, 0x4F, 0x10, 0x4F, 0x0D, 0xFD, 0x2A, 0x51, 0x99, 0xA9, 0xE7, 0x51, 0x96, 0x66, 0xE9,
+        0xA6, 0x18, 0x8A, 0xD9, 0x5C, 0x6D, 0xCA, 0x01, 0x39, 0xA3, 0x2B, 0xBC, 0x38, 0xBB, 0xB6, 0x82,
+        0xBE, 0x14, 0xF8, 0xD1, 0xFA, 0xF4, 0xD7, 0x2C, 0xAF, 0xDB, 0x7C, 0xBE, 0x91, 0x58, 0x78, 0xD2,
+        0x9F, 0xAF, 0x88, 0x90, 0xC1, 0xBF, 0xA7, 0x04, 0xD2, 0x51, 0xFE, 0x46, 0xC6, 0x1B, 0xBB, 0x0E,
+        0x83, 0xDF, 0xD9, 0x93, 0x33, 0x5C, 0x93, 0x66, 0xC8, 0x88, 0x66, 0xE7, 0x76, 0xC6, 0xA7, 0x38,
+        0xA7, 0x85, 0x70, 0x14, 0x32, 0xF1, 0x59, 0x53, 0x39, 0x0C, 0x7F, 0xE7, 0xF3, 0xA6, 0x1F, 0xE9,
+        0xE8, 0xB7, 0x8E, 0x2E, 0xDA, 0x36, 0x95, 0x1A, 0x7D, 0xCE, 0xAA, 0x4A, 0x14, 0x34, 0x78, 0x89,
+        0x2A, 0x33, 0x0E, 0xBF, 0xB7, 0xF9, 0x8D, 0xF0, 0x04, 0x10, 0x0F, 0x44, 0xDA, 0x69, 0x6E, 0x71,
+        0x67, 0x27, 0x91, 0xD0, 0xA0, 0x9B, 0x7B, 0xDE, 0x45, 0x9F, 0x12, 0x15, 0xA2, 0x9B, 0x3C, 0x03,
+        0xBF, 0xEF, 0xD7, 0x83, 0x5B, 0x39, 0xA4, 0x8D, 0xB0, 0xCD, 0xD9, 0xE1, 0x31, 0x92, 0xA0, 0x0B,
+        0x77, 0x2E, 0xC8, 0xF3, 0x30, 0x0C, 0x09, 0x06, 0x66, 0xB7, 0xFF, 0x4A, 0x18, 0xFF, 0x51, 0x95,
+        0xAC, 0x0F, 0xBD, 0x5C, 0xD6, 0x2B, 0xC6, 0x5A, 0x09, 0x04, 0xE0, 0x63, 0x72, 0xB0, 0xF4, 0xA2,
+        0x07, 0xAD, 0xF5, 0xEA, 0x90, 0x5E, 0x8F, 0x17, 0x71, 0xB4, 0xE7, 0xE8, 0xDB, 0xD1, 0xC6, 0xA6,
+        0xC5, 0xB7, 0x25, 0x86, 0x6A, 0x0A, 0xE4, 0xFC, 0xE7, 0x25, 0x7A, 0x90, 0x89, 0x74, 0xBC, 0xE1,
+        0x8C, 0xFE, 0x12, 0xA2, 0x7B, 0xB2, 0xAD, 0x5A, 0x48, 0x8C, 0xD7, 0x48, 0x4A, 0x77, 0x87, 0x10,
+        0x48, 0x70, 0xB2, 0x70, 0x34, 0xF9, 0x4E, 0xEE, 0x31, 0xDD, 0x04, 0xC6, 0x33, 0x38, 0x6A, 0xA5,
+        0x72, 0xC7, 0x09, 0xA9, 0x2D, 0xBC, 0x1A, 0x74, 0x7B, 0xB2, 0x9B, 0x51, 0xE2, 0xF1, 0x68, 0x08,
+        0xBE, 0xDE, 0x12, 0x54, 0xC2, 0xE9, 0x14, 0xBD, 0xE5, 0xA1, 0xB5, 0xAB, 0x85, 0xF8, 0x0D, 0x97,
+        0x2A, 0xAB, 0x14, 0x5F, 0xB9, 0x4A, 0xC6, 0xC5, 0x8B, 0x48, 0x49, 0x2B, 0x68, 0x03, 0x5F, 0x1C,
+        0xE4, 0x5E, 0xAF, 0x5D, 0xA5, 0x40, 0xE3, 0xB2, 0x5C, 0xAB, 0x81, 0x04, 0x8C, 0x00, 0xFA, 0x9B,
+        0x18, 0xEB, 0xF3, 0x31, 0xEB, 0x96, 0x15, 0x37, 0xA4, 0x5A, 0x42, 0x66, 0xC7, 0x03, 0x4F, 0x2F,
+        0x0D, 0x4E, 0x1D, 0x07, 0x16, 0xFB, 0x6E, 0xAE, 0x20, 0xEA, 0xE2, 0x9E, 0xEF, 0xA4, 0x72, 0x67,
+        0xFE, 0xA5, 0x21, 0xA1, 0xA9, 0xDC, 0x34, 0x3A, 0x37, 0x36, 0xC9, 0x74, 0xC2, 0xFA, 0xDA, 0xFA,
+        0x81, 0xE3, 0x6C, 0x54, 0xE7, 0xD2, 0xA4, 0xC6, 0x67, 0x02, 0x41, 0x4B, 0x04, 0xAE, 0xFD, 0xF9,
+        0x54, 0x5E, 0x26, 0xAD, 0x3E, 0x9D, 0x27, 0xED, 0x75, 0xF1, 0x73, 0x50, 0x82, 0x35, 0x74, 0x83,
+        0x1A, 0x26, 0x6C, 0xBB, 0x7A, 0x73, 0x02, 0x29, 0x07, 0x22, 0x96, 0x67, 0xCD, 0x2C, 0x6D, 0x2F,
+        0x93, 0xF0, 0x1E, 0xE7, 0xF0, 0xCA, 0x7F, 0xE0, 0xBC, 0x34, 0xC4, 0xCE, 0x87, 0xD6, 0x48, 0xF2,
+        0x76, 0x30, 0x72, 0xAC, 0xF8, 0xE8, 0x0F, 0xD0, 0xBB, 0xD1, 0x93, 0x78, 0xF7, 0x04, 0x30, 0xEB,
+        0x0D, 0x51, 0xF4, 0x25, 0x15, 0x28, 0xD8, 0x39, 0xDF, 0x1F, 0x3C, 0x71, 0xA9, 0x2D, 0x38, 0x13,
+        0x92, 0xFE, 0x05, 0x63, 0x95, 0x6E, 0x86, 0x53, 0x1F, 0x2D, 0x0A, 0x40, 0x49, 0x28, 0xC4, 0x88,
+        0xA8, 0x04, 0xB8, 0x41, 0xC6, 0x37, 0xDE, 0xA4, 0x62, 0x68, 0x15, 0xBA, 0x41, 0x64, 0x84, 0x6F,
+        0xD9, 0x70, 0xA0, 0xBD, 0x14, 0xFB, 0x96, 0x45, 0x81, 0xDC, 0x09, 0x6A, 0x64, 0x73, 0x04, 0x06,
+        0x88, 0x3E, 0xEA, 0x03, 0xD2, 0x7B, 0x73, 0x77, 0x8E, 0xFB, 0x00, 0x46, 0xAB, 0xB2, 0xBB, 0xC1,
+        0x34, 0x3B, 0xA4, 0xA2, 0xEF, 0xB8, 0xC0, 0x33, 0xDD, 0x1B, 0x11, 0x4C, 0x8A, 0x89, 0xFE, 0x48,
+        0xEA, 0x6D, 0x8C, 0xFF, 0x8E, 0x39, 0x35, 0xBC, 0xE0, 0xBE, 0x51, 0xC1, 0x95, 0x1E, 0xE0, 0xE5,
+        0x14, 0x58, 0x5E, 0x18, 0x7D, 0x5F, 0x18, 0x11, 0x19, 0xCC, 0x12, 0x7A, 0x3F, 0xA7, 0x8C, 0x04,
+        0x82, 0x7F, 0xBB, 0xE4, 0xB1, 0xE8, 0x80, 0xEA, 0x9E, 0xD2, 0xB2, 0xE6, 0x30, 0x1B, 0x21, 0x2B,
+        0x57, 0xF1, 0xEE, 0x14, 0x8C, 0xD6, 0xDD, 0x28, 0x78, 0x0E, 0x5E, 0x2C, 0xF8, 0x56, 0xE2, 0x41,
+        0xC6, 0x0F, 0x9C, 0x92, 0x3C, 0x72, 0x7B, 0x0B, 0x71, 0xBE, 0xF2, 0xC6, 0x7D, 0x1D, 0x12, 0x68,
+        0x7F, 0xF7, 0xA6, 0x31, 0x86, 0x90, 0x31, 0x66, 0xD6, 0x05, 0xB6, 0x8B, 0xAE, 0xC2, 0x93, 0xEC,
+        0x04, 0x04, 0x42, 0xD5, 0x0E, 0x46, 0x90, 0x7C, 0x81, 0x66, 0xE1, 0x76, 0x12, 0x6B, 0xBE, 0x49,
+        0x29, 0x41, 0x77, 0x7B, 0x90, 0x5C, 0x96, 0xEB, 0x75, 0x60, 0x8D, 0x47, 0xBF, 0x48, 0x30, 0x48,
+        0x28, 0x31, 0x5A, 0x76, 0x5F, 0x62, 0xC2, 0xC8, 0x97, 0x66, 0x02, 0xCF, 0x5B, 0xD3, 0x5A, 0x35,
+        0x2B, 0x6E, 0x5D, 0xAE, 0x38, 0x56, 0x6E, 0x4F, 0xA0, 0x6F, 0xCC, 0x23, 0x35, 0xC1, 0xC0, 0xD8,
+        0x79, 0x04, 0xDD, 0x18, 0xD8, 0x34, 0x69, 0xFA, 0x85, 0x31, 0x6B, 0x80, 0x1B, 0xA9, 0x79, 0xB1,
+        0x7A, 0x58, 0xB1, 0xF8, 0x40, 0x85, 0x5D, 0x9E, 0x15, 0x46, 0x54, 0x71, 0x8E, 0xA6, 0x69, 0x0D,
+        0xA2, 0xB0, 0x76, 0x2C, 0x43, 0x29, 0x94, 0x18, 0xEA, 0x8C, 0xEC, 0x97, 0x51, 0x74, 0xC8, 0x79,
+        0xC9, 0x32, 0xAC, 0x2B, 0xD0, 0x79, 0xF8, 0x6B, 0xF7, 0xB4, 0x79, 0x2C, 0xC8, 0x04, 0x93, 0x98,
+        0x4A, 0x3C, 0x04, 0x73, 0xD0, 0x81, 0x77, 0xC7, 0xD5, 0xAC, 0xE7, 0x05, 0xC2, 0xDC, 0x8B, 0x52,
+        0x79, 0x1B, 0x92, 0x57, 0x33, 0xF2, 0x1C, 0xEB, 0xBC, 0xBB, 0xFA, 0xB3, 0xF5, 0x09, 0xFD, 0xBE,
+        0x5E, 0x55, 0xB9, 0xE9, 0x02, 0xF0, 0x19, 0x33, 0x2D, 0xEA, 0x99, 0x0D, 0xE8, 0x95, 0x1B, 0x03,
+        0x5E, 0x08, 0x07, 0x64, 0x73, 0x63, 0xBC, 0xEC, 0x83, 0xAC, 0x3E, 0xD7, 0x3E, 0x8B, 0x07, 0x4E,
+        0x8E, 0xAF, 0x99, 0x04, 0x26, 0x1F, 0x58, 0xAE, 0xD4, 0xBC, 0x33, 0xE0, 0x92, 0x21, 0x29, 0x80,
+        0xA3, 0x7A, 0x73, 0x23, 0x3D, 0x45, 0x71, 0x51, 0x7D, 0xED, 0x5E, 0xC5, 0x01, 0xE7, 0x68, 0x0F,
+        0xD8, 0xDD, 0xB6, 0xB8, 0x1D, 0x3A, 0x60, 0xC5, 0x64, 0xFA, 0x2B, 0xCA, 0x99, 0x90, 0xC0, 0x84,
+        0x37, 0x4E, 0x62, 0x49, 0xBE, 0x69, 0x4A, 0xBB, 0xDB, 0xE6, 0xF2, 0xBF, 0x6F, 0x05, 0x07, 0xC3,
+        0x33, 0x49, 0xFF, 0x2F, 0x04, 0x9D, 0x88, 0xCE, 0x4B, 0xE3, 0x4F, 0xAB, 0xB5, 0xE8, 0xED, 0x34,
+        0xFE, 0x46, 0x99, 0x52, 0x60, 0xF9, 0xD9, 0x89, 0xE0, 0x35, 0x17, 0x5C, 0x2D, 0x9F, 0xA1, 0xD9,
+        0xFC, 0xD3, 0x9A, 0x25, 0xBB, 0xE1, 0x71, 0x96, 0x88, 0x3E, 0xB0, 0x3E, 0xC8, 0x1E, 0x1B, 0x7C,
+        0xE3, 0x5B, 0xC4, 0xCE, 0x1A, 0x3C, 0x2A, 0xC3, 0xA3, 0xD3, 0xF0, 0x7A, 0x73, 0x86, 0x18, 0xD8,
+        0xA0, 0x5F, 0xE2, 0xB3, 0x0D, 0x04, 0x3D, 0x5C, 0x45, 0xC9, 0x9B, 0x01, 0x21, 0x56, 0xB5, 0xCA,
+        0xF4, 0xD4, 0x37, 0x44, 0x70, 0x74, 0x91, 0x39, 0xB0, 0x6C, 0x25, 0x12, 0x02, 0x08, 0x4E, 0x2E,
+        0xA3, 0x77, 0xAB, 0xD5, 0x33, 0x8E, 0xB4, 0xEB, 0xD6, 0x8C, 0x9E, 0xAF, 0x5D, 0xBD, 0x77, 0x72,
+        0x85, 0xDC, 0x46, 0xED, 0x26, 0x43, 0xA2, 0x64, 0x64, 0xB2, 0xD5, 0x50, 0x2C, 0xB9, 0xF9, 0xAB,
+        0x2F, 0x9D, 0x9E, 0x87, 0x99, 0x03, 0x04, 0x1D, 0x0E, 0x4C, 0xE1, 0x37, 0xFE, 0xE0, 0x4E, 0x82,
+        0xCB, 0xD5, 0xAE, 0xF9, 0xFC, 0x67, 0xB0, 0x92, 0xF6, 0x07, 0xD5, 0x29, 0x81, 0xE7, 0xC5, 0xF0,
+        0xB1, 0x34, 0x45, 0xDA, 0x0C, 0x9B, 0xDF, 0x59, 0x9E, 0x41, 0x3A, 0xD9, 0x83, 0x66, 0x64, 0xD8,
+        0x4E, 0x66, 0x25, 0x39, 0xC4, 0xF0, 0x0F, 0x24, 0x4C, 0x4A, 0x9B, 0x96, 0x53, 0x96, 0xE8, 0x9C,
+        0xB6, 0x0D, 0x3D, 0x46, 0x34, 0x3E, 0x84, 0x04, 0x13, 0x46, 0x4A, 0x57, 0xA7, 0x81, 0x02, 0xAA,
+        0x62, 0xB6, 0x97, 0x9A, 0xE8, 0x17, 0xF4, 0x63, 0x7F, 0xFC, 0xFE, 0xD3, 0xC4, 0xB1, 0xCE, 0x30,
+        0xBC, 0xD6, 0x30, 0x3F, 0x6C, 0xAF, 0x66, 0x6B, 0x69, 0xBE, 0x15, 0x90, 0x04, 0x61, 0x45, 0x80,
+        0xEF, 0x7E, 0x43, 0x34, 0x53, 0xCC, 0xB0, 0xCA, 0x48, 0xF3, 0x00, 0xA8, 0x1D, 0x09, 0x42, 0xE1,
+        0x3F, 0x49, 0x5A, 0x90, 0x7F, 0x6E, 0xCC, 0x27, 0x04, 0x5F, 0x82, 0xFC, 0x61, 0x8C, 0xC9, 0x14,
+        0x2F, 0x7B, 0x7B, 0x04, 0xF6, 0x28, 0x58, 0xDB, 0x50, 0x81, 0x8D, 0xFB, 0x77, 0x92, 0x7C, 0x1A,
+        0x9F, 0xF1, 0xD1, 0x90, 0x1B, 0x94, 0x15, 0xC3, 0xE3, 0x56, 0x34, 0xB3, 0x0D, 0xB4, 0x3F, 0x3C,
+        0x6D, 0x3B, 0xE8, 0x6C, 0x8D, 0x54, 0xA5, 0xCE, 0x89, 0xA4, 0x7B, 0x86, 0x17, 0xF4, 0x61, 0x2E,
+        0x55, 0xA7, 0xB4, 0xB7, 0x8F, 0xC2, 0x1D, 0x23, 0x39, 0x04, 0x82, 0x22, 0x40, 0xC2, 0x76, 0x2E,
+        0xC2, 0x49, 0x7A, 0x53, 0xD6, 0xBD, 0x70, 0x0E, 0xE9, 0x16, 0x62, 0xC8, 0x72, 0xC9, 0x9B, 0xEE,
+        0xC0, 0xBE, 0x3B, 0xF5, 0xA9, 0xC1, 0x99, 0x67, 0x7E, 0x7D, 0xA1, 0x56, 0xE1, 0x7D, 0x9C, 0x7D,
+        0x81, 0x64, 0x68, 0x0E, 0x1B, 0x86, 0x99, 0xB0, 0x0F, 0x6E, 0xCE, 0xEC, 0xDD, 0x99, 0x03, 0x83,
+        0xBF, 0x15, 0xAC, 0xF9, 0xA4, 0x92, 0xB9, 0xF9, 0xB9, 0x0B, 0x04, 0x37, 0xAB, 0x6D, 0x8B, 0x16,
+        0x13, 0x1D, 0x7C, 0xB0, 0xE9, 0x18, 0x8C, 0x47, 0x65, 0xDA, 0xE3, 0x51, 0xFD, 0x25, 0x19, 0xCC,
+        0x51, 0x37, 0x6B, 0x27, 0x20, 0xEF, 0x30, 0x3D, 0xC6, 0x8D, 0xE1, 0x0D, 0x3D, 0x37, 0x13, 0x05,
+        0xC9, 0xC2, 0x55, 0x81, 0x35, 0x39, 0x37, 0xF4, 0xAA, 0x1D, 0x61, 0x38, 0x90, 0xBA, 0xB8, 0x26,
+        0x15, 0x14, 0x12, 0xD5, 0xA8, 0xE1, 0x8E, 0xCD, 0x6E, 0x3A, 0xC9, 0x04, 0xF7, 0x2B, 0xF1, 0x34,
+        0xE0, 0x7A, 0x55, 0x13, 0x13, 0x34, 0x91, 0xDF, 0x65, 0x71, 0xE2, 0xA4, 0xC7, 0xB7, 0xEC, 0xE0,
+        0xB3, 0xCC, 0x1D, 0xA8, 0xBA, 0xB5, 0xC9, 0x14, 0xC3, 0x45, 0x6F, 0xF8, 0xF4, 0xA0, 0xC6, 0x42,
+        0xA2, 0x15, 0x61, 0x49, 0x6D, 0x25, 0x63, 0x06, 0xAD, 0x9B, 0x36, 0x37, 0x32, 0x60, 0x54, 0xEE,
+        0x2D, 0xFF, 0xC1, 0xC9, 0xE6, 0x18, 0x7E, 0x16, 0x12, 0x62, 0x27, 0x70, 0x04, 0xA0, 0x48, 0xA4,
+        0xD0, 0x71, 0xBF, 0x02, 0x0D, 0x5D, 0x36, 0xD6, 0x1F, 0xF5, 0x61, 0xD2, 0x7B, 0x0F, 0x0B, 0x0C,
+        0x30, 0x08, 0x66, 0xEA, 0xF0, 0xA8, 0x88, 0x94, 0x3E, 0xFA, 0x42, 0x48, 0xA5, 0x44, 0xBF, 0x74,
+        0x99, 0x46, 0x38, 0xFE, 0xA9, 0x2A, 0xEC, 0x57, 0x73, 0x04, 0x01, 0x6C, 0xC3, 0xAC, 0x1A, 0x26,
+        0x11, 0xB8, 0xDB, 0x89, 0x6F, 0x7E, 0x83, 0x38, 0xE6, 0x06, 0x9A, 0xE6, 0xFC, 0x04, 0xD5, 0xCE,
+        0x72, 0xFC, 0x5C, 0xF0, 0x85, 0x91, 0x4E, 0xE6, 0xAF, 0x3E, 0x51, 0xB9, 0xD4, 0x92, 0x0D, 0xE2,
+        0xAC, 0x30, 0x3E, 0xE1, 0xA3, 0xD1, 0xF2, 0x8F, 0x60, 0xAF, 0x53, 0x95, 0x8A, 0x79, 0xB1, 0xEC,
+        0xC6, 0x35, 0x81, 0x71, 0x65, 0x3A, 0x3F, 0x0D, 0x13, 0xBB, 0x49, 0xB9, 0x0E, 0xA6, 0xA7, 0x00,
+        0x58, 0x35, 0xDD, 0xD7, 0xFC, 0x45, 0x7B, 0x47, 0x7D, 0xDF, 0x97, 0xC7, 0x90, 0x8B, 0x04, 0x40,
+        0xFA, 0xD0, 0x5D, 0xAD, 0xF0, 0x9B, 0x00, 0xA2, 0xE7, 0x55, 0xB5, 0xA5, 0x60, 0x76, 0xC4, 0xCE,
+        0xE5, 0x1A, 0xB4, 0xA4, 0x73, 0x38, 0x15, 0x34, 0xE4, 0x4B, 0xED, 0x78, 0xD1, 0x46, 0xC6, 0x45,
+        0x33, 0x41, 0x21, 0x3C, 0x9D, 0xF7, 0xAB, 0x13, 0x4D, 0x9B, 0xFE, 0x66, 0x82, 0x52, 0xB2, 0xC9,
+        0x85, 0x9F, 0xFE, 0x4D, 0xF8, 0xD5, 0xBE, 0x04, 0xCF, 0xD7, 0xBB, 0x6E, 0x88, 0x2A, 0x85, 0x04,
+        0x91, 0x0C, 0x60, 0xF7, 0x46, 0xB7, 0x13, 0x18, 0x06, 0xEC, 0x4E, 0x62, 0x87, 0x1B, 0x66, 0x37,
+        0xE2, 0xFE, 0x95, 0x8E, 0x68, 0x10, 0x43, 0x3F, 0xD5, 0x86, 0x5F, 0x05, 0x0F, 0x9D, 0xA8, 0x51,
+        0x4C, 0x94, 0xA2, 0x58, 0xAD, 0x14, 0x1C, 0x8E, 0xE9, 0x8E, 0x00, 0xC0, 0x4C, 0xA5, 0x6E, 0x96,
+        0x81, 0xE6, 0x2A, 0x78, 0x98, 0xFF, 0x84, 0x55, 0xE1, 0x5B, 0x77, 0xAB, 0xD0, 0x9F, 0x49, 0x71,
+        0x04, 0x27, 0xC8, 0x8F, 0xA7, 0x1C, 0xF1, 0xBE, 0x63, 0xCB, 0x71, 0x5C, 0xD5, 0xBC, 0x0B, 0xEA,
+        0x94, 0x55, 0x82, 0x20, 0xDD, 0x1A, 0x03, 0xF6, 0x16, 0x7A, 0x68, 0x12, 0x6C, 0x2E, 0x48, 0x44,
+        0xD8, 0x19, 0xFE, 0x80, 0xEA, 0x2B, 0xEA, 0x50, 0x2F, 0xB8, 0x4E, 0x29, 0x1E, 0x7A, 0x1C, 0x15,
+        0x42, 0x62, 0xDC, 0x0A, 0x90, 0xC5, 0xD7, 0x82, 0x14, 0x6A, 0xED, 0xA5, 0x14, 0x46, 0xC8, 0x51,
+        0xFA, 0x04, 0x12, 0xAF, 0x4D, 0x12, 0xF3, 0xA0, 0x0C, 0x85, 0x85, 0x72, 0xBE, 0x7C, 0x0C, 0x75,
+        0x78, 0x62, 0x48, 0xD1, 0x87, 0xE4, 0xFE, 0xA8, 0x1B, 0x78, 0xD1, 0xCC, 0x80, 0xB9, 0x27, 0x52,
+        0xC6, 0xD9, 0x06, 0x6E, 0x58, 0xE9, 0xA8, 0xEF, 0x40, 0xC9, 0xDF, 0x43, 0x31, 0x71, 0xA9, 0x0E,
+        0xF2, 0x01, 0x6E, 0x00, 0xB0, 0x21, 0xEA, 0x11, 0xC1, 0x6C, 0x33, 0x08, 0x11, 0xD2, 0xB7, 0xD7,
+        0x05, 0x16, 0x04, 0x12, 0x36, 0xA2, 0xE9, 0x97, 0xED, 0x81, 0x20, 0x17, 0xE2, 0xB8, 0xAF, 0x60,
+        0x4C, 0x70, 0x31, 0x79, 0xF0, 0x15, 0xD8, 0x43, 0x71, 0x19, 0x7C, 0xD9, 0x2F, 0x6F, 0x40, 0x9E,
+        0x7F, 0xCC, 0x1D, 0x02, 0xC7, 0xBA, 0xBA, 0x31, 0x02, 0xC3, 0x33, 0x7D, 0x4D, 0x5F, 0xC5, 0x8F,
+        0xB8, 0xC8, 0x36, 0xCC, 0x1C, 0x79, 0xC4, 0x5C, 0xF2, 0x61, 0x13, 0x55, 0xA1, 0x26, 0x6B, 0x63,
+        0x55, 0x81, 0x47, 0x04, 0xD2, 0xFF, 0xFE, 0x78, 0x2F, 0x6F, 0x51, 0xC3, 0x2B, 0x9F, 0x5E, 0x29,
+        0x19, 0xD4, 0xF5, 0x2F, 0x65, 0xF2, 0x02, 0xDE, 0x94, 0x76, 0x9D, 0xDF, 0x7C, 0x67, 0x7A, 0x5B,
+        0xD3, 0x7E, 0x9C, 0x27, 0xB5, 0xB0, 0x74, 0x2B, 0xCF, 0xCC, 0x24, 0x11, 0x67, 0x5D, 0x39, 0x5F,
+        0xC8, 0x6F, 0x93, 0xC3, 0xE3, 0x01, 0x5B, 0x37, 0x67, 0xE9, 0xA6, 0x68, 0x3B, 0x27, 0x5F, 0xF6,
+        0x1A, 0xD9, 0xB9, 0x36, 0x04, 0xCB, 0x1E, 0x55, 0x36, 0xD6, 0xC6, 0x58, 0x2F, 0xC6, 0x45, 0x68,
+        0x82, 0x71, 0x42, 0xA0, 0x58, 0x38, 0xF8, 0x9A, 0xB6, 0x10, 0xC9, 0xC4, 0x70, 0xD5, 0x4A, 0xCA,
+        0xFD, 0xAD, 0x69, 0x37, 0xEC, 0xD3, 0xCC, 0x51, 0xDA, 0xAC, 0x75, 0xFD, 0x3D, 0x6A, 0x22, 0x7E,
+        0x05, 0x89, 0x42, 0xE0, 0x7E, 0x10, 0xB9, 0x60, 0x54, 0xF1, 0xA1, 0xBE, 0x25, 0xC7, 0x51, 0xF9,
+        0xCC, 0x21, 0xE4, 0x83, 0xAB, 0x04, 0xE8, 0x03, 0x94, 0xFE, 0x84, 0xD8, 0x17, 0xA5, 0x1B, 0xD3,
+        0xB0, 0x01, 0x95, 0x4D, 0x93, 0xDE, 0x94, 0xDA, 0x51, 0xAA, 0x01, 0x43, 0xD4, 0xE5, 0x4E, 0x0B,
+        0x4D, 0x64, 0x57, 0x74, 0xC5, 0x57, 0x77, 0x73, 0x5E, 0xC8, 0x55, 0x98, 0x65, 0x65, 0x38, 0x7B,
+        0x64, 0xC5, 0x84, 0x27, 0x23, 0x86, 0xBE, 0x59, 0x8F, 0x76, 0x29, 0x91, 0x3A, 0x2A, 0xE5, 0xB4,
+        0xD3, 0x59, 0x83, 0x48, 0xA3, 0x98, 0x04, 0x18, 0xE5, 0x94, 0x61, 0xEC, 0x8C, 0xE9, 0x85, 0xCA,
+        0xF0, 0x1B, 0xF7, 0x15, 0x8F, 0x62, 0x3D, 0xCC, 0xF6, 0xFC, 0xCE, 0xFA, 0xDD, 0xFD, 0x7F, 0xAD,
+        0x96, 0xAA, 0xEB, 0xE2, 0xD4, 0x16, 0x98, 0x4B, 0xD2, 0xFE, 0xF4, 0x9C, 0x96, 0xDB, 0x2E, 0x63,
+        0x44, 0xEB, 0xAB, 0x34, 0xE2, 0x23, 0xBD, 0x72, 0x4B, 0x59, 0x89, 0x7B, 0x28, 0x5B, 0x49, 0xDD,
+        0x46, 0x59, 0x6B, 0xA3, 0xB5, 0x43, 0xBA, 0x04, 0xE1, 0x03, 0x1B, 0xE2, 0x62, 0xC7, 0xED, 0x1B,
+        0x1D, 0xC9, 0x22, 0x7A, 0x4A, 0x04, 0xC0, 0x17, 0xA7, 0x7F, 0x8D, 0x44, 0x64, 0xF3, 0xB3, 0x85,
+        0x2C, 0x8A, 0xCD, 0xE6, 0xE5, 0x34, 0xFD, 0x2D, 0x9D, 0x70, 0x61, 0x92, 0x89, 0x40, 0x40, 0x5E,
+        0x6B, 0xB6, 0xA4, 0x17, 0x65, 0x97, 0x53, 0x5A, 0xF2, 0x92, 0xDD, 0x41, 0x9E, 0x1C, 0xED, 0x79,
+        0xA4, 0x4F, 0x18, 0xF2, 0x94, 0x56, 0xA0, 0x0D, 0x04, 0x21, 0x3C, 0x7A, 0x71, 0x5C, 0xD5, 0xD4,
+        0x53, 0x58, 0xD0, 0xBB, 0xF9, 0xDC, 0x0C, 0xE0, 0x22, 0x04, 0xB1, 0x0B, 0xDD, 0xE2, 0xA3, 0xF5,
+        0x85, 0x40, 0xAD, 0x69, 0x08, 0xD0, 0x55, 0x97, 0x54, 0x4B, 0x6D, 0xAD, 0x0B, 0x5A, 0xE4, 0x62,
+        0x50, 0x70, 0x13, 0xAD, 0x06, 0x24, 0x5B, 0xA1, 0x90, 0xBB, 0x48, 0x50, 0xF5, 0xF3, 0x6A, 0x7E,
+        0xED, 0xDF, 0xF2, 0xC2, 0x75, 0x34, 0xB4, 0x58, 0xF2, 0x04, 0xC0, 0x94, 0x2D, 0x91, 0x4E, 0x7A,
+        0x2E, 0xC7, 0x3E, 0x16, 0x12, 0xBB, 0x25, 0x49, 0x8A, 0x49, 0xAA, 0xCD, 0x5C, 0x2D, 0x23, 0xD1,
+        0x54, 0x54, 0xA3, 0x58, 0x5F, 0x87, 0xB3, 0x33, 0x9A, 0xBC, 0x13, 0x01, 0xA1, 0x18, 0x9A, 0xE5,
+        0xCE, 0x3A, 0x29, 0xEE, 0x46, 0xA3, 0x12, 0x7D, 0xAE, 0x7F, 0xB1, 0x25, 0x8E, 0x50, 0xD1, 0x9B,
+        0x27, 0x81, 0xB5, 0xC2, 0x88, 0xE7, 0x79, 0x6D, 0x3F, 0xE3, 0x04, 0xE7, 0xA2, 0x6C, 0xE6, 0x9D,
+        0xD4, 0x82, 0x9F, 0x3E, 0x10, 0xCE, 0xC0, 0xA9, 0xE9, 0x8E, 0xD3, 0x14, 0x3D, 0x08, 0x4F, 0x30,
+        0x8B, 0x92, 0xC0, 0x99, 0x7F, 0xDD, 0xFC, 0x60, 0xCB, 0x3E, 0x41, 0x2A, 0x75, 0x8E, 0x30, 0x0F,
+        0xA7, 0x98, 0x4B, 0x47, 0x1B, 0x00, 0x6A, 0x1A, 0xAF, 0xBB, 0x18, 0xD0, 0xA6, 0xB2, 0xC0, 0x42,
+        0x0E, 0x83, 0xE2, 0x0E, 0x8A, 0x94, 0x21, 0xCF, 0x2C, 0xFD, 0x51, 0x04, 0xB6, 0x71, 0x4C, 0x6A,
+        0x4F, 0x4A, 0x24, 0xA8, 0x9B, 0x52, 0x26, 0xE8, 0xAC, 0xF5, 0xB1, 0xFD, 0xED, 0xE6, 0x66, 0x65,
+        0x67, 0x12, 0x3A, 0x1C, 0x95, 0x48, 0xA7, 0x98, 0xE2, 0xD1, 0x23, 0xF8, 0x9B, 0x35, 0x8D, 0x6B,
+        0x81, 0xE1, 0xB8, 0x94, 0x59, 0x82, 0xAD, 0x19, 0xD8, 0xA9, 0x76, 0x6B, 0x19, 0x6C, 0x30, 0xA7,
+        0x8F, 0x74, 0x55, 0xA3, 0x6A, 0x5C, 0x24, 0x4D, 0xBC, 0xAD, 0x9C, 0x6B, 0x04, 0x2C, 0x8B, 0xA3,
+        0x9D, 0xBF, 0xA6, 0xEC, 0x14, 0x1C, 0x06, 0xEF, 0x63, 0x5A, 0xFB, 0xF5, 0x81, 0x7D, 0x31, 0xCD,
+        0xE4, 0x4E, 0xF5, 0x26, 0xE5, 0x7D, 0x14, 0xE8, 0x19, 0x50, 0x15, 0xE6, 0xA3, 0x11, 0xF3, 0x48,
+        0x40, 0x23, 0x23, 0x4B, 0x07, 0xA0, 0x59, 0xE8, 0x1D, 0x05, 0xFC, 0x73, 0xB0, 0x84, 0xE0, 0xAA,
+        0x86, 0x44, 0x39, 0xAC, 0x11, 0xD8, 0xB7, 0xB5, 0xA2, 0xFD, 0x33, 0xA9, 0x1F, 0x04, 0x90, 0x83,
+        0xFA, 0x1E, 0x23, 0x5F, 0xF1, 0xF4, 0x08, 0xA9, 0x87, 0x0A, 0x3D, 0x5D, 0x2C, 0x35, 0xAA, 0x8F,
+        0x6B, 0x6C, 0xF7, 0x8A, 0x46, 0xD5, 0xB4, 0x34, 0xD9, 0xC2, 0x1C, 0xEF, 0xA6, 0xA0, 0x76, 0x62,
+        0x4F, 0x64, 0xB2, 0xBB, 0xE7, 0x58, 0x42, 0x5B, 0x60, 0x61, 0xEE, 0x40, 0x5F, 0x23, 0x76, 0x69,
+        0xED, 0x51, 0xFE, 0x74, 0x56, 0x3F, 0xE0, 0x1B, 0x11, 0x14, 0xF5, 0x7E, 0x2A, 0x90, 0x04, 0xEA,
+        0xA6, 0x49, 0xF2, 0x1F, 0x51, 0xBD, 0xBA, 0xE7, 0xBE, 0x4A, 0xE3, 0x4C, 0xE6, 0xE5, 0x21, 0x7A,
+        0x58, 0xFD, 0xCE, 0x7F, 0x47, 0xF9, 0xAA, 0x7F, 0x3B, 0x58, 0xFA, 0x21, 0x20, 0xE2, 0xB3, 0xBE,
+        0x32, 0x79, 0xED, 0x5B, 0xBB, 0xB0, 0x3A, 0xC6, 0x9A, 0x80, 0xF8, 0x98, 0x79, 0xAA, 0x5A, 0x01,
+        0xA6, 0xB9, 0x65, 0xF1, 0x3F, 0x7E, 0x59, 0xD4, 0x7A, 0x53, 0x05, 0xBA, 0x5A, 0xD9, 0x3D, 0x04,
+        0xCE, 0x70, 0xDF, 0x5C, 0xD0, 0x7D, 0x43, 0x07, 0xED, 0x43, 0xB5, 0xAC, 0xB0, 0x8D, 0xA0, 0xF3,
+        0xAD, 0x19, 0xE6, 0x1E, 0x57, 0x38, 0xAA, 0x06, 0xA9, 0xDE, 0x6A, 0x39, 0xBE, 0x08, 0xB7, 0xCA,
+        0xD1, 0x33, 0x82, 0x9E, 0x7C, 0x3C, 0xAA, 0xA9, 0x59, 0xF3, 0x8C, 0x67, 0x4C, 0x84, 0x4D, 0xB7,
+        0x12, 0xF0, 0xB2, 0x14, 0xFF, 0xA4, 0x5F, 0x15, 0x78, 0xE8, 0x0A, 0x24, 0x2A, 0x09, 0xB7, 0x5C,
+        0x04, 0xF1, 0x1D, 0xE6, 0x4C, 0x2B, 0x51, 0x02, 0xAF, 0x54, 0x05, 0x94, 0x3E, 0xD7, 0xCE, 0x3A,
+        0xF3, 0x0B, 0x17, 0x98, 0xE8, 0xF7, 0xBF, 0x4E, 0x9D, 0x70, 0x90, 0x9B, 0xD2, 0xB6, 0xC4, 0xEA,
+        0x17, 0xA5, 0x39, 0xCC, 0x0F, 0xE6, 0x90, 0x66, 0xBB, 0x44, 0x5C, 0x15, 0x59, 0x4A, 0x5A, 0x71,
+        0x33, 0xC4, 0x59, 0x7F, 0x22, 0x2E, 0x73, 0xC1, 0x0F, 0x5A, 0x93, 0x25, 0x06, 0x0E, 0x61, 0x57,
+        0x02, 0x04, 0x47, 0x25, 0x73, 0xA4, 0x64, 0x76, 0x21, 0x0C, 0x12, 0x02, 0x9F, 0xC2, 0xAC, 0xB6,
+        0x86, 0x0F, 0x49, 0xC4, 0x9A, 0x26, 0x42, 0xD8, 0x7D, 0xFD, 0x73, 0xF6, 0x03, 0x41, 0x55, 0xC1,
+        0x2D, 0x5D, 0xA2, 0xCA, 0x66, 0xEC, 0xF1, 0x66, 0x21, 0x3A, 0x3C, 0xEE, 0x02, 0xB7, 0x31, 0x73,
+        0x35, 0xB7, 0x26, 0xE4, 0xD7, 0xC4, 0x4A, 0xA1, 0x10, 0x5D, 0xE6, 0x6A, 0xBA, 0xAD, 0x8E, 0x95,
+        0x93, 0x82, 0x04, 0x7C, 0x02, 0x7D, 0x06, 0x24, 0x14, 0x02, 0x78, 0x0C, 0x1F, 0xF0, 0x5B, 0x03,
+        0x57, 0x4D, 0x33, 0x3E, 0x6D, 0x66, 0xEB, 0x18, 0xB4, 0x8A, 0xA5, 0xDB, 0xC7, 0xB1, 0xBF, 0x24,
+        0x95, 0xD2, 0x6A, 0x53, 0x3A, 0x33, 0x67, 0x4E, 0x65, 0xEC, 0x8E, 0x72, 0x1F, 0x22, 0x7B, 0x3E,
+        0xD9, 0x43, 0xB9, 0x29, 0x7B, 0xCA, 0x0C, 0xDF, 0x85, 0x94, 0x03, 0x0C, 0x6C, 0xF0, 0x5B, 0x8D,
+        0x6C, 0x0E, 0x64, 0x04, 0x51, 0x96, 0x24, 0xC6, 0x5B, 0x1A, 0xC2, 0x06, 0xBD, 0x8F, 0xCC, 0xAE,
+        0x5B, 0xDC, 0x3C, 0x2F, 0x6E, 0x0C, 0xD7, 0x9E, 0x46, 0x3A, 0x4D, 0xE0, 0xD4, 0xBA, 0xD7, 0x3D,
+        0x0B, 0x11, 0x91, 0x64, 0x45, 0xEE, 0xD5, 0xDA, 0x25, 0xF3, 0xF1, 0x85, 0x74, 0x91, 0xDB, 0x84,
+        0xB9, 0x7B, 0x4C, 0xE8, 0x8F, 0x7F, 0x72, 0x64, 0xB3, 0xB3, 0xEA, 0x1B, 0xA3, 0x64, 0x6B, 0x4F,
+        0x5E, 0x3C, 0x6B, 0xD6, 0x04, 0x00, 0xE2, 0xD0, 0x65, 0xA6, 0xFA, 0x11, 0xA9, 0x7F, 0xB1, 0xF1,
+        0x1B, 0x45, 0xD8, 0x79, 0x2D, 0x44, 0xAD, 0x93, 0x7D, 0x24, 0x1A, 0xC6, 0x42, 0x74, 0xF0, 0x9D,
+        0xDB, 0xB3, 0x73, 0x13, 0x7B, 0x0B, 0x9A, 0xA5, 0x50, 0x66, 0x35, 0x1B, 0x14, 0xB0, 0x3D, 0x48,
+        0xA4, 0xC3, 0xD1, 0xCD, 0xDA, 0x00, 0x0A, 0x2D, 0x05, 0x6C, 0x31, 0x64, 0xBC, 0xE5, 0x59, 0x7E,
+        0xE3, 0xF1, 0x09, 0xD9, 0x7E, 0x04, 0xDA, 0x1B, 0xE9, 0x1A, 0xFD, 0xA0, 0x51, 0x41, 0xC2, 0xF5,
+        0xF3, 0xB1, 0x63, 0xC5, 0x7F, 0x0E, 0x77, 0x4F, 0x1B, 0x46, 0xD6, 0x69, 0x95, 0x77, 0x21, 0xF5,
+        0x4E, 0x4D, 0xAF, 0x9E, 0x57, 0xE1, 0x22, 0xBB, 0x89, 0xDE, 0x13, 0xC4, 0xDA, 0x70, 0x19, 0xB6,
+        0x46, 0xDC, 0xBD, 0xE2, 0x1F, 0xBF, 0x7E, 0x44, 0xB0, 0xD7, 0x6A, 0x76, 0x6E, 0x2B, 0x9A, 0x11,
+        0xFC, 0x3D, 0x29, 0x1C, 0xAA, 0x1A, 0x04, 0xBC, 0x4A, 0x9D, 0xF5, 0xB7, 0x13, 0xFE, 0x2E, 0x9A,
+        0xEF, 0x43, 0x0B, 0xCC, 0x1D, 0xC9, 0x7A, 0x0C, 0xD9, 0xCC, 0xED, 0xE2, 0xF2, 0x85, 0x88, 0xCA,
+        0xDA, 0x3A, 0x0D, 0x2D, 0x83, 0xF3, 0x66, 0x0D, 0x3A, 0x81, 0xCA, 0x6E, 0x78, 0x5C, 0x06, 0x38,
+        0x39, 0x37, 0xAD, 0xF4, 0xB7, 0x98, 0xCA, 0xA6, 0xE8, 0xA9, 0xFB, 0xFA, 0x54, 0x7B, 0x16, 0xD7,
+        0x58, 0xD6, 0x66, 0x58, 0x1F, 0x33, 0xC1, 0x04, 0xE6, 0xBD, 0xB9, 0x4C, 0xE9, 0x2C, 0x3D, 0x4B,
+        0xD8, 0x6A, 0x7A, 0x88, 0xB2, 0x80, 0x1E, 0xF6, 0xE5, 0x44, 0x60, 0xE4, 0xC9, 0xCF, 0x40, 0xEE,
+        0xC9, 0x22, 0x07, 0x02, 0x19, 0x76, 0xAF, 0xDA, 0x26, 0x40, 0x79, 0xC9, 0x1B, 0x20, 0x7B, 0x9C,
+        0x71, 0xAB, 0x7F, 0x2E, 0x78, 0xB9, 0xCC, 0x58, 0x52, 0xB5, 0xD7, 0x00, 0x6F, 0x7D, 0xF6, 0x81,
+        0x0E, 0xCB, 0xBE, 0x60, 0x81, 0xD3, 0x76, 0x00, 0x04, 0x8D, 0x8E, 0xA9, 0x85, 0xDE, 0x07, 0x67,
+        0x48, 0x02, 0xBF, 0xB0, 0x90, 0x51, 0x6D, 0xB3, 0xBC, 0x35, 0x4E, 0xB0, 0x73, 0xB4, 0x5E, 0xF7,
+        0xB6, 0xE7, 0xC3, 0xD9, 0xB0, 0x3F, 0x5B, 0x51, 0x4A, 0xBD, 0x05, 0x64, 0x37, 0x10, 0x53, 0xE8,
+        0x20, 0x9D, 0x0E, 0x0E, 0xA9, 0x84, 0x21, 0x1B, 0x73, 0xE6, 0xAA, 0x8C, 0xF0, 0x1D, 0x34, 0xC9,
+        0x87, 0x21, 0xCA, 0xF3, 0x80, 0xF3, 0xD1, 0xB1, 0x3F, 0x04, 0xBB, 0x29, 0x9F, 0x7D, 0x08, 0xB0,
+        0xBA, 0x0F, 0x3E, 0x6B, 0xB4, 0x44, 0x08, 0xC9, 0x1E, 0xE3, 0x20, 0xC0, 0x74, 0xD9, 0x0F, 0x37,
+        0x1E, 0x82, 0x4B, 0x2A, 0x1A, 0x4B, 0xF2, 0x97, 0x4E, 0x6E, 0x82, 0x57, 0x81, 0xA7, 0x26, 0x6B,
+        0xDB, 0xE1, 0x83, 0x7C, 0x8D, 0xFA, 0x49, 0x8F, 0xEA, 0x7B, 0x80, 0xD1, 0xB9, 0x50, 0x78, 0xA2,
+        0xF2, 0xFB, 0x74, 0x97, 0x3A, 0x68, 0x24, 0x62, 0x9C, 0xC5, 0x04, 0x49, 0x7E, 0xEF, 0x84, 0x01,
+        0x04, 0x30, 0xD2, 0x0C, 0x4C, 0xC1, 0xE6, 0x46, 0x8C, 0xF0, 0x07, 0x7B, 0x16, 0xE4, 0x1B, 0x9C,
+        0xF0, 0x7B, 0xDE, 0xE8, 0xD4, 0x89, 0x78, 0x58, 0xC8, 0x13, 0x22, 0xA1, 0x36, 0xA9, 0x25, 0xE8,
+        0xB2, 0x60, 0xBC, 0x9E, 0xF9, 0x29, 0x37, 0x0F, 0xF3, 0xC9, 0x2A, 0xCD, 0x77, 0x36, 0x87, 0x7F,
+        0x94, 0x07, 0x9B, 0x96, 0x88, 0x0E, 0x9C, 0xA9, 0x30, 0x78, 0x98, 0x04, 0xFB, 0xF3, 0xF8, 0x7A,
+        0xC3, 0x96, 0xB8, 0x7B, 0x1C, 0xB9, 0x41, 0x24, 0xC6, 0x64, 0x8D, 0x25, 0xE0, 0x21, 0xA4, 0x10,
+        0xC4, 0x67, 0x45, 0x25, 0x11, 0x6B, 0x56, 0x9B, 0x79, 0xFF, 0x16, 0xF7, 0xC6, 0x58, 0x8D, 0xED,
+        0x54, 0x59, 0xE8, 0x52, 0x5C, 0xC8, 0xBF, 0xC0, 0xD1, 0xC0, 0xF5, 0x2E, 0xDA, 0xC6, 0x0C, 0xAA,
+        0xEB, 0x93, 0x18, 0xDF, 0x31, 0x9D, 0x37, 0x32, 0xA9, 0xB6, 0xDA, 0xF2, 0x04, 0x84, 0xC5, 0x9C,
+        0x4A, 0xDF, 0xA9, 0x60, 0x56, 0x15, 0x3B, 0xB5, 0xBD, 0x5E, 0xCE, 0xD1, 0x75, 0xE2, 0x75, 0xB4,
+        0x75, 0x4E, 0xA4, 0x79, 0xC8, 0x6D, 0x82, 0xAF, 0x1C, 0x2E, 0x28, 0x36, 0x1A, 0x5F, 0x84, 0xF7,
+        0x8A, 0x44, 0x70, 0x4F, 0x95, 0x3C, 0x3A, 0x6B, 0x04, 0xDD, 0xEF, 0x63, 0x59, 0x21, 0xD3, 0x9E,
+        0x35, 0xA5, 0xC0, 0xD6, 0x26, 0xA3, 0x6C, 0xAD, 0xAC, 0x65, 0x04, 0x4E, 0x1B, 0x04, 0x96, 0x33,
+        0x6B, 0x5F, 0xE0, 0xB4, 0xE2, 0xB0, 0x52, 0x0C, 0xB4, 0xB6, 0x1F, 0x9D, 0x3D, 0x4A, 0x36, 0x77,
+        0xB3, 0xAD, 0xF6, 0x89, 0xA0, 0x40, 0x20, 0x75, 0xC7, 0x41, 0xC2, 0x5E, 0x0E, 0x84, 0xF8, 0x09,
+        0xED, 0xA9, 0x09, 0xF0, 0xF1, 0x4B, 0x8E, 0x08, 0x0E, 0x97, 0x29, 0x3B, 0xDF, 0x52, 0x25, 0x03,
+        0xEF, 0x60, 0xB2, 0x9F, 0x86, 0x17, 0xBD, 0x24, 0x5A, 0x2E, 0x53, 0xD1, 0xB7, 0xE0, 0x04, 0x7F,
+        0x28, 0xB7, 0x3E, 0xDE, 0x63, 0x05, 0xFA, 0x1C, 0x38, 0x90, 0x9A, 0xA9, 0xE4, 0xBB, 0x18, 0xF8,
+        0xCC, 0x01, 0xDD, 0x8C, 0x74, 0x26, 0xE1, 0xF4, 0xF0, 0x1A, 0xEB, 0xAB, 0xD4, 0x4C, 0x40, 0x12,
+        0x6F, 0x20, 0xDC, 0x51, 0x47, 0x21, 0x76, 0x24, 0xC9, 0x53, 0x6D, 0xB6, 0x6F, 0x00, 0xF2, 0x43,
+        0xED, 0x67, 0x90, 0xC0, 0x07, 0xC1, 0x48, 0x47, 0xFE, 0x26, 0x44, 0xD0, 0x8F, 0xA8, 0x17, 0x04,
+        0x69, 0x52, 0xBD, 0xA4, 0xE1, 0xCA, 0xD2, 0x5E, 0x99, 0xC5, 0x62, 0x20, 0xD2, 0xD0, 0xC8, 0x2C,
+        0x05, 0xCE, 0x3C, 0xFA, 0xBA, 0x5D, 0x9C, 0x46, 0x97, 0x68, 0x7C, 0x52, 0x9D, 0xD6, 0xD3, 0xA8,
+        0x2F, 0xD2, 0x44, 0xF1, 0x36, 0xB8, 0x9B, 0xED, 0x7A, 0xA8, 0x6C, 0x53, 0xBD, 0xA9, 0x27, 0xF5,
+        0x06, 0x9D, 0xD4, 0x33, 0x2E, 0x14, 0x43, 0x79, 0x88, 0x15, 0x5C, 0x7B, 0xA8, 0x78, 0x82, 0x69,
+        0x04, 0xD1, 0x37, 0x34, 0xD0, 0xA1, 0x85, 0x54, 0x6D, 0x6A, 0x02, 0xB0, 0xAA, 0x87, 0xBB, 0xDB,
+        0x88, 0x0E, 0x31, 0xF7, 0xB9, 0x52, 0x08, 0x00, 0x85, 0x17, 0x11, 0xD2, 0xD5, 0x13, 0xD8, 0xA4,
+        0x86, 0x68, 0xAC, 0x4B, 0xCA, 0x1D, 0x55, 0x6D, 0x5D, 0xBB, 0x55, 0xD1, 0x53, 0x3F, 0x46, 0xC8,
+        0x75, 0xC1, 0x4C, 0x43, 0xFE, 0xA2, 0x19, 0xF1, 0x54, 0xF3, 0xD5, 0x9F, 0xFE, 0x0B, 0x6D, 0x63,
+        0x1E, 0x04, 0xE0, 0x48, 0xF2, 0x75, 0xE0, 0xB3, 0xDB, 0x10, 0x6B, 0x76, 0xEB, 0xDF, 0xA1, 0xB3,
+        0xE5, 0xBB, 0x4E, 0x9F, 0x57, 0x1B, 0xB5, 0x4B, 0xED, 0x6C, 0x9A, 0x11, 0x08, 0x8E, 0x3D, 0xCF,
+        0x16, 0x91, 0x9F, 0x67, 0x0E, 0xB8, 0x52, 0x50, 0xA4, 0x10, 0x1B, 0x16, 0xBC, 0x3E, 0xEB, 0xA2,
+        0xCE, 0xAE, 0x1B, 0x33, 0x8D, 0x1D, 0x15, 0x91, 0x9A, 0x31, 0x4C, 0x21, 0x7F, 0x91, 0x63, 0xD7,
+        0x34, 0x5E, 0x04, 0x72, 0x18, 0x1B, 0x9B, 0x3D, 0x27, 0xDE, 0x8B, 0x5E, 0xB1, 0x24, 0x55, 0xD4,
+        0x65, 0x9D, 0x7B, 0xAD, 0x02, 0xE7, 0x59, 0x2A, 0x18, 0xCC, 0x49, 0x98, 0x97, 0x3E, 0x13, 0xC8,
+        0x6F, 0x77, 0x07, 0x62, 0x24, 0x3A, 0x61, 0x82, 0xF0, 0x0D, 0xFC, 0xE2, 0x2D, 0xEE, 0x73, 0xA6,
+        0x8A, 0xF6, 0xD9, 0xE1, 0x22, 0x33, 0x26, 0xD6, 0xB0, 0x84, 0x91, 0x68, 0xFD, 0xFB, 0x6D, 0xC8,
+        0xE2, 0x88, 0xCA, 0x04, 0x3A, 0x59, 0x29, 0xCF, 0x84, 0x97, 0x55, 0xAD, 0x5D, 0x21, 0x9A, 0xFC,
+        0x86, 0xB3, 0x6C, 0x3E, 0xF4, 0x48, 0x5B, 0x0F, 0xDD, 0x59, 0xF9, 0xEC, 0x51, 0xED, 0xE9, 0xE6,
+        0x4A, 0x42, 0x9C, 0x95, 0xB2, 0x2E, 0x2E, 0x23, 0x51, 0x16, 0xCD, 0x34, 0x3A, 0x1A, 0x1E, 0x30,
+        0x90, 0x63, 0x92, 0x1B, 0xBF, 0x65, 0x06, 0xD4, 0x1E, 0x45, 0x30, 0xDF, 0xC5, 0x11, 0xB6, 0xCA,
+        0x00, 0xB0, 0x60, 0x5C, 0x04, 0x7A, 0xB2, 0x6F, 0xD3, 0x1C, 0x7C, 0x5F, 0x00, 0xD5, 0x20, 0xD3,
+        0x5B, 0x43, 0x84, 0xE7, 0xDB, 0x5E, 0xC2, 0xB9, 0x98, 0x06, 0x7B, 0x06, 0xC4, 0xE6, 0x84, 0x62,
+        0xB1, 0x40, 0x80, 0x6F, 0x96, 0xE5, 0xBF, 0xA0, 0x8A, 0x2B, 0x87, 0x4D, 0x45, 0x16, 0x6D, 0x14,
+        0x5A, 0x44, 0xEB, 0xDA, 0xCD, 0x4B, 0x61, 0xB0, 0xEB, 0xFE, 0x91, 0x8E, 0x89, 0x24, 0xDD, 0x5D,
+        0x98, 0x56, 0x1C, 0x5D, 0x6D, 0x04, 0xEB, 0x05, 0x48, 0xD9, 0x0D, 0x0A, 0xF4, 0xB0, 0xA0, 0x73,
+        0x68, 0xF0, 0x7C, 0x0D, 0x85, 0x3D, 0x38, 0x80, 0x2B, 0x44, 0x38, 0xF9, 0x40, 0x07, 0xCD, 0xA7,
+        0xF0, 0x8E, 0x7C, 0x05, 0x44, 0xFA, 0x81, 0x23, 0x78, 0x39, 0x2C, 0x45, 0xEE, 0x93, 0x1B, 0xB8,
+        0xAA, 0x5D, 0x1D, 0x7A, 0xE7, 0xF5, 0x73, 0x87, 0x18, 0xB0, 0xE7, 0x11, 0xB0, 0xD6, 0x21, 0x61,
+        0xE9, 0x35, 0x29, 0x81, 0xD4, 0xB3, 0x04, 0xFE, 0xEA, 0x6C, 0xAE, 0x46, 0xD5, 0x5B, 0x53, 0x0A,
+        0xC2, 0x83, 0x9F, 0x14, 0x3B, 0xD7, 0xEC, 0x5C, 0xF8, 0xB2, 0x66, 0xA4, 0x1D, 0x6A, 0xF5, 0x2D,
+        0x5E, 0x68, 0x8D, 0x90, 0x94, 0x69, 0x6D, 0xE5, 0x7C, 0x6B, 0x6C, 0x97, 0xDC, 0xE1, 0xBA, 0xB0,
+        0x6E, 0x4E, 0x12, 0xBF, 0x3E, 0xCD, 0x5C, 0x98, 0x1C, 0x89, 0x57, 0xCC, 0x41, 0x44, 0x2D, 0x31,
+        0x55, 0xDE, 0xBF, 0x18, 0x09, 0x00, 0x88, 0x04, 0x4E, 0x7C, 0x27, 0x2A, 0x7A, 0xF4, 0xB3, 0x4E,
+        0x8D, 0xBB, 0x93, 0x52, 0xA5, 0x41, 0x9A, 0x87, 0xE2, 0x83, 0x8C, 0x70, 0xAD, 0xC6, 0x2C, 0xDD,
+        0xF0, 0xCC, 0x3A, 0x3B, 0x08, 0xFB, 0xD5, 0x3C, 0x17, 0x74, 0x9C, 0x76, 0x6C, 0x9D, 0x0B, 0x18,
+        0xE1, 0x6F, 0xD0, 0x9F, 0x6D, 0xEF, 0x68, 0x1B, 0x53, 0x0B, 0x96, 0x14, 0xBF, 0xF7, 0xDD, 0x33,
+        0xE0, 0xB3, 0x94, 0x18, 0x17, 0xDC, 0xAA, 0xE6, 0x04, 0x52, 0xD3, 0x5F, 0xBF, 0xF1, 0xCB, 0xB5,
+        0x35, 0xFF, 0xAE, 0x8A, 0xB8, 0xDA, 0x47, 0x62, 0x4F, 0x98, 0x99, 0x07, 0x0A, 0xA1, 0x29, 0xF5,
+        0xE5, 0x9D, 0x3F, 0xD6, 0xD4, 0x4B, 0x65, 0x76, 0x4E, 0x59, 0x74, 0x86, 0xA0, 0xE2, 0xAA, 0x6A,
+        0x92, 0x69, 0x54, 0x06, 0x49, 0x5E, 0x4C, 0x20, 0xF8, 0x2F, 0x80, 0xFC, 0xCE, 0x24, 0xD5, 0xB9,
+        0xCB, 0x7E, 0xBA, 0x59, 0xF1, 0xC5, 0xC5, 0xD8, 0x45, 0x04, 0xB6, 0x45, 0x9E, 0x0E, 0xE3, 0x66,
+        0x2E, 0xC8, 0xD2, 0x35, 0x40, 0xC2, 0x23, 0xBC, 0xBD, 0xC5, 0x71, 0xCB, 0xCB, 0x96, 0x7D, 0x79,
+        0x42, 0x4F, 0x3C, 0xF2, 0x9E, 0xB3, 0xDE, 0x6B, 0x80, 0xEF, 0x06, 0x7C, 0x87, 0x6D, 0x06, 0xF3,
+        0xE0, 0x6D, 0xE1, 0xDA, 0xDF, 0x16, 0xE5, 0x66, 0x1D, 0xB3, 0xC4, 0xB3, 0xAE, 0x6D, 0x48, 0xE3,
+        0x5B, 0x2F, 0xF3, 0x0B, 0xF0, 0xB6, 0x1A, 0x71, 0xBA, 0x45, 0x04, 0xE7, 0x4A, 0x76, 0x9E, 0x58,
+        0x46, 0xED, 0x45, 0x03, 0x58, 0x64, 0x17, 0xA4, 0xA5, 0x12, 0x00, 0x13, 0x9B, 0xFA, 0xE8, 0x5D,
+        0x6A, 0x42, 0x3E, 0x32, 0xE7, 0xEE, 0x81, 0x02, 0xA1, 0xA1, 0x75, 0x03, 0xA3, 0x52, 0x12, 0x11,
+        0x38, 0xBA, 0x8F, 0x0F, 0xE4, 0xAC, 0x71, 0x24, 0x11, 0x37, 0xE2, 0xDF, 0xE8, 0x39, 0xB5, 0xCD,
+        0xC6, 0xFF, 0x07, 0x94, 0x30, 0xBC, 0xAF, 0xD3, 0xA0, 0x09, 0xA2, 0x04, 0xAC, 0x13, 0x39, 0x5B,
+        0x85, 0xA2, 0xC2, 0x5A, 0x0F, 0x5A, 0x30, 0x3B, 0x32, 0xD4, 0x13, 0xF1, 0xC0, 0xC1, 0x01, 0xE6,
+        0x81, 0xE1, 0x3F, 0xA3, 0x64, 0x57, 0xDA, 0x9F, 0x73, 0xB3, 0x17, 0x3D, 0x79, 0x10, 0x9E, 0x2F,
+        0x43, 0xDF, 0x0F, 0x78, 0xEE, 0x9A, 0xDE, 0x8E, 0x06, 0x5F, 0x8D, 0x65, 0x58, 0xFA, 0xB6, 0xFB,
+        0xEA, 0x2F, 0x5B, 0xB2, 0xE9, 0x90, 0x8A, 0x8B, 0xAD, 0x3C, 0x42, 0x1C, 0x04, 0xF7, 0xD5, 0x62,
+        0x52, 0x77, 0x69, 0xD6, 0x76, 0x05, 0xC7, 0xAA, 0x1C, 0x12, 0x7E, 0x66, 0x8A, 0x9B, 0x40, 0x9E,
+        0x1B, 0xE9, 0x61, 0x43, 0xE6, 0x83, 0x57, 0xE4, 0xBC, 0xBD, 0x66, 0x23, 0x0B, 0x71, 0x8C, 0xB3,
+        0xCB, 0x0B, 0x4B, 0xB2, 0x87, 0x5B, 0x41, 0x0A, 0x13, 0xA9, 0xD0, 0xF0, 0xDE, 0xC3, 0xA0, 0xC1,
+        0xA3, 0xA3, 0x3B, 0x35, 0x21, 0x1B, 0xA2, 0xAF, 0x46, 0x1F, 0xDA, 0x20, 0xC2, 0x04, 0xE4, 0xA4,
+        0x2D, 0x43, 0xC5, 0xCF, 0x16, 0x9D, 0x93, 0x91, 0xDF, 0x6D, 0xEC, 0xF4, 0x2E, 0xE5, 0x41, 0xB6,
+        0xD8, 0xF0, 0xC9, 0xA1, 0x37, 0x40, 0x1E, 0x23, 0x63, 0x2D, 0xDA, 0x34, 0xD2, 0x4F, 0x4D, 0x9F,
+        0x92, 0xE7, 0x16, 0xD1, 0xC7, 0x35, 0x26, 0xFC, 0x99, 0xCC, 0xFB, 0x8A, 0xD3, 0x4C, 0xE8, 0x86,
+        0xEE, 0xDF, 0xA8, 0xD8, 0xE4, 0xF1, 0x3A, 0x7F, 0x71, 0x31, 0xDE, 0xBA, 0x94, 0x14, 0x04, 0xCE,
+        0x33, 0xC1, 0x65, 0xC4, 0x07, 0x58, 0x46, 0x66, 0xAB, 0x8E, 0x0C, 0x6A, 0x51, 0xBE, 0x9B, 0x22,
+        0xD3, 0xB1, 0x0E, 0xFD, 0x8C, 0xE3, 0xA6, 0xCA, 0xA2, 0x35, 0xBF, 0x92, 0xFC, 0xE4, 0x55, 0xDF,
+        0x9C, 0xA9, 0x0E, 0xBC, 0xB6, 0xB8, 0xD2, 0x34, 0x3A, 0x91, 0xAD, 0x3E, 0xD9, 0x00, 0x9B, 0xCD,
+        0x29, 0xEF, 0xA8, 0xB7, 0xEC, 0xCA, 0xC8, 0x2A, 0x02, 0x7B, 0xAA, 0xD1, 0x16, 0x99, 0x11, 0x04,
+        0xF3, 0xD6, 0xD8, 0x0E, 0xBB, 0x08, 0xFC, 0xFA, 0xD0, 0x9A, 0x9D, 0x53, 0xE6, 0xDF, 0xF0, 0xBC,
+        0x1E, 0x5F, 0xC1, 0xAC, 0xF9, 0x3C, 0xCF, 0xF6, 0xBD, 0xF7, 0xB7, 0x3E, 0xF4, 0xA9, 0x6A, 0x0C,
+        0x35, 0xD2, 0x40, 0x9D, 0xF1, 0xA7, 0x3E, 0xD1, 0x85, 0x85, 0x03, 0x56, 0x8E, 0x7E, 0x77, 0xDB,
+        0x06, 0x84, 0x7A, 0xD8, 0x21, 0xFF, 0x69, 0x18, 0xFB, 0xAF, 0x0C, 0xFC, 0x40, 0x02, 0xA4, 0xB8,
+        0x04, 0xA2, 0xAF, 0xB8, 0xEE, 0x11, 0x37, 0xF0, 0x31, 0x55, 0xFD, 0x20, 0xC8, 0xE6, 0xEA, 0xC0,
+        0x1D, 0x1D, 0x0B, 0xDB, 0x27, 0x8B, 0x79, 0x55, 0xDE, 0xBA, 0xA2, 0x03, 0x13, 0xC3, 0x61, 0x4D,
+        0x80, 0x92, 0xAE, 0xC1, 0xA8, 0xF2, 0x9B, 0x70, 0xB6, 0x73, 0x91, 0xA9, 0x08, 0x55, 0x4D, 0x6A,
+        0xFD, 0x93, 0x3D, 0x48, 0x6D, 0x7F, 0xD8, 0x16, 0x1D, 0x7F, 0xCD, 0x98, 0xE6, 0xC3, 0x72, 0x29,
+        0x41, 0x04, 0xDD, 0xF6, 0x69, 0x03, 0x0A, 0x59, 0xD2, 0x16, 0x9B, 0x9A, 0xC5, 0x7C, 0xF6, 0x18,
+        0x20, 0x04, 0x97, 0x72, 0x22, 0x25, 0xEE, 0xAF, 0xBF, 0xDE, 0xC2, 0x98, 0x3F, 0x48, 0x8B, 0x8F,
+        0xD9, 0x2B, 0x0A, 0x0C, 0xFA, 0xFF, 0x80, 0x2D, 0x3D, 0x20, 0x8A, 0xCF, 0x36, 0xCB, 0x50, 0xEB,
+        0x3C, 0xDD, 0x03, 0xB5, 0x5F, 0x77, 0x5C, 0x24, 0x89, 0xF3, 0x5C, 0x46, 0x6F, 0xC6, 0x52, 0x57,
+        0x3B, 0x37, 0x04, 0xB4, 0x51, 0xFE, 0x94, 0xED, 0x63, 0x67, 0x1D, 0x95, 0x26, 0xA5, 0x60, 0x99,
+        0xF9, 0x4D, 0x41, 0x8D, 0x7A, 0x21, 0x2D, 0x98, 0x49, 0xD4, 0xC1, 0x26, 0x52, 0xAF, 0xA1, 0xBC,
+        0x89, 0xBD, 0xEB, 0x23, 0x43, 0xDA, 0xD4, 0x0D, 0x0F, 0x3A, 0xE8, 0x00, 0xE9, 0x6B, 0xC8, 0x15,
+        0x32, 0xF1, 0xE8, 0x53, 0x2F, 0x8B, 0x92, 0x37, 0xBE, 0x2C, 0xC2, 0x20, 0x45, 0x9E, 0xDC, 0x37,
+        0x0A, 0xA5, 0x26, 0x04, 0x46, 0x1D, 0x3F, 0x3A, 0x36, 0x2D, 0xD8, 0x15, 0x7A, 0xE5, 0xDF, 0x66,
+        0x30, 0x71, 0xC0, 0x85, 0x8E, 0x20, 0x7A, 0x2B, 0x25, 0x9B, 0x37, 0x57, 0x42, 0xC2, 0xD3, 0x08,
+        0xE0, 0xC0, 0x38, 0xC5, 0x53, 0x98, 0xAF, 0x28, 0x0C, 0xB0, 0x2F, 0xF2, 0x42, 0x97, 0xDC, 0x08,
+        0x75, 0x5B, 0x88, 0xBD, 0x40, 0xE4, 0x68, 0xAF, 0xD4, 0xE7, 0xFB, 0x8E, 0x0E, 0xC7, 0xF1, 0x75,
+        0x03, 0x61, 0x1C, 0x4C, 0x04, 0xFB, 0x9A, 0x87, 0xEB, 0x30, 0x6C, 0xB5, 0xE2, 0x75, 0x56, 0xBE,
+        0xE5, 0x8C, 0x61, 0x76, 0xF8, 0x97, 0xD2, 0xD6, 0x39, 0xDC, 0xD2, 0xBC, 0x65, 0x0F, 0x8A, 0xFE,
+        0x3A, 0x94, 0xAD, 0x44, 0x62, 0x37, 0x72, 0x2F, 0xEB, 0x1B, 0x1F, 0x13, 0xE1, 0xA5, 0x07, 0xA8,
+        0x14, 0x2D, 0x94, 0xEA, 0x83, 0xAC, 0x3A, 0xC6, 0x79, 0x96, 0x5B, 0x21, 0xD7, 0xAF, 0xA6, 0xBC,
+        0x9D, 0x1B, 0x78, 0x7F, 0xCD, 0x04, 0x8C, 0x28, 0xA9, 0x7B, 0xF8, 0x29, 0x8B, 0xC0, 0xD2, 0x3D,
+        0x8C, 0x74, 0x94, 0x52, 0xA3, 0x2E, 0x69, 0x4B, 0x65, 0xE3, 0x0A, 0x94, 0x72, 0xA3, 0x95, 0x4A,
+        0xB3, 0x0F, 0xE5, 0x32, 0x4C, 0xAA, 0x40, 0xA3, 0x04, 0x63, 0xA3, 0x30, 0x51, 0x93, 0x37, 0x8F,
+        0xED, 0xF3, 0x1F, 0x7C, 0xC0, 0xEB, 0x7A, 0xE7, 0x84, 0xF0, 0x45, 0x1C, 0xB9, 0x45, 0x9E, 0x71,
+        0xDC, 0x73, 0xCB, 0xEF, 0x94, 0x82, 0x04, 0xE5, 0x82, 0x0D, 0x98, 0x77, 0x2D, 0x25, 0x42, 0xDE,
+        0x67, 0x70, 0x3F, 0x1D, 0xBD, 0x47, 0x3F, 0x21, 0x8B, 0xF9, 0x9C, 0x13, 0xA5, 0x1E, 0xE8, 0x9A,
+        0x77, 0xDA, 0x0A, 0xEE, 0x25, 0xDE, 0xAF, 0xFD, 0x86, 0xD3, 0xE8, 0xCF, 0x7F, 0xCE, 0xF6, 0x72,
+        0x2D, 0x1B, 0xE9, 0xA7, 0xB1, 0x3F, 0x75, 0x32, 0x72, 0x68, 0xCB, 0x6B, 0x22, 0x61, 0x35, 0xA2,
+        0xAC, 0xB8, 0x88, 0x24, 0x92, 0xC4, 0xC1, 0x04, 0x37, 0x43, 0x8B, 0xFB, 0xBA, 0x8F, 0xCF, 0xD1,
+        0x82, 0x3F, 0x8E, 0x01, 0x39, 0x11, 0x12, 0xFA, 0x7A, 0x2E, 0x95, 0x38, 0x75, 0xF0, 0xEB, 0xD4,
+        0x6E, 0x09, 0x4C, 0x68, 0xB3, 0xBF, 0xD2, 0x2E, 0x18, 0x71, 0xA0, 0x07, 0xEC, 0x0A, 0x6B, 0xE0,
+        0x78, 0x8C, 0x27, 0xC0, 0x17, 0x46, 0x69, 0x0B, 0x02, 0xAD, 0x09, 0xD5, 0xED, 0x8D, 0xF1, 0xE1,
+        0xB6, 0xA2, 0x4D, 0xD7, 0xBF, 0x7A, 0x38, 0xDB, 0x04, 0x3E, 0xB0, 0x0D, 0x5F, 0x88, 0xF4, 0xBC,
+        0xFC, 0x13, 0x93, 0xBA, 0x94, 0x68, 0x6A, 0xE7, 0xB5, 0x6E, 0x50, 0x56, 0x22, 0xEE, 0xE4, 0xE6,
+        0x88, 0x79, 0x8B, 0x7E, 0x18, 0xFD, 0x47, 0xEC, 0x4F, 0xBA, 0x87, 0x45, 0x76, 0x47, 0x36, 0xD5,
+        0x59, 0x9E, 0x49, 0x09, 0x70, 0x20, 0xAF, 0xEB, 0x1D, 0xB4, 0x87, 0x22, 0xA6, 0xBF, 0x8F, 0x66,
+        0xA9, 0xBB, 0x87, 0x73, 0x88, 0xE1, 0xB7, 0xCD, 0x18, 0x04, 0x61, 0x07, 0x9F, 0xF4, 0x93, 0x3A,
+        0x5B, 0x98, 0xE2, 0x2D, 0x7C, 0xCF, 0x12, 0xFE, 0xCA, 0x8C, 0x1D, 0x6F, 0xC5, 0x5E, 0xB7, 0x33,
+        0xED, 0x01, 0x44, 0x8C, 0x31, 0x36, 0xF5, 0x35, 0x80, 0x60, 0xF7, 0xFD, 0x2F, 0xC4, 0xAB, 0x74,
+        0x1D, 0xE2, 0xC1, 0xA5, 0xEE, 0x77, 0xB7, 0x84, 0x05, 0x3A, 0x0D, 0x35, 0xB6, 0xA5, 0xFE, 0x6F,
+        0xC9, 0x62, 0x22, 0xE6, 0x1E, 0x1C, 0x14, 0x98, 0x4C, 0x06, 0x04, 0x24, 0xCF, 0x5F, 0x14, 0xFE,
+        0xBB, 0x24, 0x58, 0x84, 0xB8, 0x47, 0xC0, 0x0C, 0x7F, 0xF3, 0x1E, 0xBA, 0xE5, 0x81, 0xAE, 0xE7,
+        0x04, 0x41, 0xFA, 0xED, 0x60, 0xA0, 0x36, 0xAD, 0xC3, 0x68, 0x26, 0x62, 0x96, 0x8E, 0xB2, 0xEA,
+        0x7F, 0xB4, 0xA9, 0x3D, 0xE5, 0xCB, 0xFE, 0x55, 0x7D, 0xBB, 0x60, 0x4F, 0x8F, 0x80, 0x8A, 0x3F,
+        0x18, 0xC6, 0x38, 0x2E, 0xE8, 0x94, 0x42, 0x0A, 0xB5, 0x56, 0x7C, 0x04, 0x92, 0x7B, 0x3F, 0xBA,
+        0x7E, 0x81, 0x53, 0x5B, 0x80, 0xB2, 0xE9, 0x5D, 0xE0, 0xDE, 0x4A, 0x63, 0xD7, 0x43, 0x03, 0x4B,
+        0x7C, 0x5C, 0x36, 0xFB, 0xB3, 0x8A, 0x74, 0x4D, 0x32, 0x74, 0x15, 0x6E, 0xFB, 0x79, 0x61, 0x1F,
+        0x01, 0x6C, 0x50, 0xAA, 0x51, 0xDF, 0xC5, 0x70, 0xFF, 0x84, 0x5F, 0x2B, 0x8A, 0xE3, 0x67, 0x85,
+        0x97, 0xA5, 0x1F, 0xBA, 0xE6, 0xE8, 0x0F, 0xC4, 0x83, 0x34, 0x13, 0xF7, 0x04, 0x82, 0xAB, 0x3A,
+        0x84, 0x7A, 0xD3, 0x4E, 0x59, 0x98, 0x1D, 0xC8, 0xB0, 0x80, 0x4F, 0x77, 0x09, 0x09, 0x77, 0xEF,
+        0xA5, 0x24, 0x01, 0xD1, 0x36, 0xC2, 0x64, 0x86, 0x82, 0x32, 0xE7, 0x0C, 0xF1, 0xB1, 0x1C, 0x7D,
+        0xF6, 0x93, 0xEF, 0xD7, 0x61, 0xD5, 0x3E, 0x45, 0x0E, 0x6A, 0x4E, 0x97, 0x69, 0x53, 0x19, 0x4B,
+        0x4D, 0xC8, 0xE0, 0x6F, 0x17, 0x2E, 0xEA, 0x56, 0xF5, 0x77, 0x4D, 0x29, 0x68, 0x04, 0x4B, 0x46,
+        0xED, 0x10, 0x69, 0x04, 0x10, 0xF3, 0x2E, 0xA0, 0x22, 0x6D, 0x1C, 0xE3, 0x9D, 0xF7, 0x52, 0x03,
+        0x94, 0x64, 0x1A, 0x09, 0xA4, 0xB2, 0xEA, 0x88, 0x36, 0x30, 0x8E, 0x21, 0xB0, 0xFE, 0x04, 0xF6,
+        0x9B, 0xCF, 0x89, 0x2D, 0x34, 0x88, 0x1D, 0x65, 0x3B, 0x36, 0x98, 0xAB, 0x33, 0x99, 0xF1, 0xB6,
+        0x6D, 0xFA, 0x85, 0x1E, 0x7D, 0x2A, 0x4F, 0x9D, 0x57, 0x2F, 0xB4, 0x2D, 0x15, 0x84, 0x04, 0x12,
+        0x28, 0x76, 0xDF, 0x45, 0x5E, 0x8D, 0x72, 0x53, 0xEC, 0x07, 0x4D, 0x27, 0xD1, 0xDA, 0xB1, 0xAB,
+        0x93, 0x6A, 0x27, 0x4E, 0x00, 0xDF, 0x3D, 0x95, 0x9C, 0x0E, 0x7A, 0xAE, 0xA0, 0x46, 0x0B, 0x07,
+        0xE9, 0x19, 0x74, 0x20, 0x69, 0xD0, 0xEF, 0x45, 0x96, 0x48, 0x30, 0x42, 0x5F, 0x41, 0xE9, 0x98,
+        0xE8, 0xEC, 0x27, 0x94, 0xD0, 0x38, 0x20, 0x23, 0x01, 0x85, 0xB5, 0x2C, 0x30, 0xB4, 0x8B, 0x04,
+        0xE9, 0xA1, 0xC7, 0x6D, 0x71, 0x34, 0xA7, 0x48, 0xFF, 0x25, 0x8E, 0x24, 0x41, 0xEE, 0x35, 0x59,
+        0x34, 0xAB, 0xF2, 0xCF, 0xE6, 0xF0, 0xA3, 0xAB, 0xBA, 0xF1, 0xE8, 0xBD, 0xAC, 0x1F, 0xD8, 0xC0,
+        0x6B, 0x11, 0x83, 0xE0, 0x83, 0x1C, 0x71, 0x92, 0xCE, 0x6F, 0x17, 0x3F, 0x0C, 0xCE, 0x60, 0x32,
+        0x7A, 0x9D, 0xBF, 0x44, 0x2E, 0x8F, 0x1D, 0xAC, 0x68, 0x1B, 0x81, 0x7D, 0x60, 0xB1, 0xB8, 0x4E,
+        0x04, 0x18, 0xB6, 0x34, 0xD2, 0x67, 0x2C, 0x6B, 0x65, 0xAA, 0x24, 0x2D, 0x1C, 0xFC, 0x86, 0x68,
+        0x98, 0x11, 0x74, 0xB9, 0x40, 0x6D, 0x73, 0xEF, 0x98, 0x7A, 0x49, 0x9D, 0x34, 0x49, 0xD4, 0x1A,
+        0x53, 0x2E, 0x8D, 0xA0, 0x48, 0x4A, 0x7D, 0x49, 0x84, 0x0E, 0xC7, 0x16, 0x98, 0xCB, 0xD5, 0x6F,
+        0x21, 0x52, 0x18, 0x6C, 0x0C, 0xCE, 0xC6, 0x06, 0xD0, 0x1D, 0x2D, 0xF8, 0x92, 0xD6, 0x9B, 0xAC,
+        0xF0, 0x04, 0x2F, 0x1E, 0x09, 0x5C, 0xD7, 0xEC, 0x13, 0x82, 0xCB, 0x39, 0xA3, 0x85, 0x12, 0xB3,
+        0x91, 0x47, 0xFD, 0x5B, 0x2A, 0x67, 0xF0, 0x8A, 0x7A, 0xE2, 0x13, 0xDC, 0x77, 0x40, 0xDD, 0x84,
+        0x6E, 0x9B, 0x3F, 0x93, 0x6A, 0x88, 0xA1, 0x03, 0xAD, 0x73, 0x07, 0xB7, 0x40, 0x5A, 0x6B, 0x60,
+        0xD3, 0xD8, 0x8F, 0xFB, 0x38, 0x6B, 0x35, 0x7F, 0x98, 0x6A, 0xE0, 0xC8, 0x5D, 0xAD, 0x73, 0x2B,
+        0x6D, 0x00, 0x04, 0x50, 0x12, 0x37, 0xD0, 0x7F, 0xAD, 0xA5, 0x59, 0x18, 0xBA, 0x36, 0x43, 0xCB,
+        0x86, 0xDD, 0x4D, 0x19, 0xE3, 0xC9, 0xAA, 0x88, 0x52, 0xE2, 0xBF, 0xD8, 0x11, 0xEF, 0x30, 0x95,
+        0xC2, 0x5E, 0x5E, 0x2D, 0xE7, 0x7D, 0xDF, 0xB9, 0x93, 0xB2, 0x2C, 0xE0, 0x6D, 0x04, 0x79, 0xB2,
+        0x30, 0xAC, 0x6E, 0xF4, 0x10, 0x9B, 0xEF, 0x19, 0x42, 0x76, 0xA9, 0x89, 0x22, 0xCB, 0x3F, 0xFD,
+        0xC8, 0xFD, 0x06, 0x04, 0x0A, 0xF9, 0x56, 0x1A, 0xE9, 0x37, 0x49, 0x02, 0x44, 0x57, 0x91, 0xF5,
+        0x09, 0x5A, 0x6E, 0x99, 0xA1, 0x65, 0xC1, 0x14, 0x56, 0x5F, 0x41, 0xE1, 0xDC, 0x62, 0xCD, 0xFF,
+        0x8F, 0xD2, 0xC2, 0xED, 0x34, 0x33, 0xF8, 0x4C, 0x7F, 0xEA, 0x54, 0x9E, 0x13, 0xD3, 0x52, 0xC8,
+        0x6D, 0x85, 0x7C, 0x05, 0x3B, 0x26, 0xF0, 0xE5, 0xAC, 0x3C, 0x10, 0x12, 0x56, 0xF0, 0x25, 0xB0,
+        0x32, 0x93, 0xB2, 0x09, 0x04, 0x25, 0xE1, 0x35, 0xFC, 0xB3, 0x9C, 0xC0, 0x80, 0x00, 0x5C, 0x08,
+        0xA2, 0x70, 0xB8, 0x89, 0x0A, 0x0E, 0x66, 0xA2, 0x24, 0xC1, 0x4B, 0x37, 0xD1, 0xF0, 0x32, 0x5E,
+        0xCD, 0x0B, 0x8C, 0x50, 0x60, 0x40, 0xA7, 0x10, 0x28, 0x76, 0xD8, 0xE3, 0xAA, 0x35, 0x09, 0x8B,
+        0xE1, 0x5A, 0x5A, 0x57, 0xC9, 0x66, 0x96, 0x5A, 0xEE, 0x74, 0xD9, 0x46, 0x17, 0x11, 0x43, 0x14,
+        0x81, 0x24, 0x4C, 0xE0, 0xF9, 0x04, 0xDA, 0x67, 0xA9, 0x1D, 0x91, 0x04, 0x9C, 0xDC, 0xB3, 0x67,
+        0xBE, 0x4B, 0xE6, 0xFF, 0xCA, 0x3C, 0xFE, 0xED, 0x65, 0x7D, 0x80, 0x85, 0x83, 0xDE, 0x33, 0xFA,
+        0x97, 0x8B, 0xC1, 0xEC, 0x6C, 0xB1, 0x9B, 0xAC, 0xAA, 0x35, 0x48, 0x16, 0x42, 0xBC, 0x41, 0xF4,
+        0x63, 0xF7, 0xEC, 0x97, 0x80, 0xE5, 0xDE, 0xC7, 0xAD, 0xC5, 0x08, 0xF7, 0x40, 0xA1, 0x7E, 0x9E,
+        0xA8, 0xE2, 0x7A, 0x68, 0xBE, 0x1D, 0x04, 0xFE, 0xA7, 0x4E, 0x3D, 0xBE, 0x77, 0x8B, 0x1B, 0x10,
+        0xF2, 0x38, 0xAD, 0x61, 0x68, 0x6A, 0xA5, 0xC7, 0x6E, 0x3D, 0xB2, 0xBE, 0x43, 0x05, 0x76, 0x32,
+        0x42, 0x7E, 0x28, 0x40, 0xFB, 0x27, 0xB6, 0x6E, 0x05, 0x68, 0xDB, 0x9B, 0x0B, 0x13, 0x29, 0x7C,
+        0xF6, 0x74, 0xDE, 0xCC, 0xB6, 0xAF, 0x93, 0x12, 0x6B, 0x59, 0x6B, 0x97, 0x3F, 0x7B, 0x77, 0x70,
+        0x1D, 0x3D, 0xB7, 0xF2, 0x3C, 0xB9, 0x6F, 0x04, 0xDB, 0x91, 0x1D, 0x12, 0x63, 0x60, 0xF9, 0xD4,
+        0x62, 0x3C, 0x71, 0x3A, 0x48, 0x62, 0x22, 0xA7, 0x79, 0x48, 0xE4, 0x6F, 0x85, 0xA6, 0x81, 0x4A,
+        0xF6, 0x0D, 0x17, 0x2E, 0x62, 0xE1, 0x7F, 0x1D, 0xBD, 0x85, 0x75, 0xF7, 0xEF, 0x2E, 0x1A, 0x70,
+        0x0D, 0x59, 0xF4, 0x56, 0xCC, 0x14, 0xA1, 0x83, 0xA3, 0x08, 0xDC, 0x66, 0xF3, 0x49, 0xB4, 0xBE,
+        0xEC, 0xC8, 0xCB, 0x4C, 0x4F, 0x5A, 0x9F, 0x94, 0x04, 0xD6, 0x8A, 0x80, 0xC8, 0x28, 0x0B, 0xB8,
+        0x40, 0x79, 0x32, 0x34, 0xAA, 0x11, 0x8F, 0x06, 0x23, 0x1D, 0x6F, 0x1F, 0xC6, 0x7E, 0x73, 0xC5,
+        0xA5, 0xDE, 0xDA, 0x0F, 0x5B, 0x49, 0x69, 0x43, 0xE8, 0xDB, 0x8B, 0xA9, 0xFF, 0xF4, 0xB5, 0x86,
+        0xD0, 0x0C, 0x4B, 0x1F, 0x91, 0x77, 0xB0, 0xE2, 0x8B, 0x5B, 0x0E, 0x7B, 0x8F, 0x78, 0x45, 0x29,
+        0x5A, 0x29, 0x4C, 0x84, 0x26, 0x6B, 0x13, 0x31, 0x20, 0x04, 0xEF, 0xA1, 0x8B, 0x5B, 0x4E, 0xCD,
+        0x23, 0x15, 0x64, 0x0C, 0xD6, 0x35, 0x44, 0x8D, 0xF7, 0x43, 0x6C, 0x6F, 0xB8, 0x1C, 0xBE, 0xE0,
+        0x1E, 0x76, 0x5D, 0x76, 0x20, 0xAC, 0xDC, 0x9E, 0x39, 0x70, 0xA9, 0xBE, 0x6E, 0x19, 0xC7, 0xAD,
+        0xF6, 0x0B, 0x3D, 0x9C, 0xD8, 0x9F, 0xD6, 0x68, 0xCA, 0x67, 0x48, 0x8A, 0xA9, 0xF3, 0x9A, 0x87,
+        0x50, 0x49, 0xAA, 0xA0, 0x5E, 0xDD, 0xE6, 0x50, 0xDF, 0xFB, 0x04, 0x8D, 0x6B, 0x39, 0xAF, 0xC2,
+        0x53, 0xC1, 0x62, 0x0B, 0xF5, 0x1D, 0xC2, 0x14, 0x01, 0xA7, 0x3E, 0x6A, 0xEA, 0x74, 0x1E, 0xE3,
+        0x90, 0xC9, 0x38, 0x92, 0x2A, 0xE4, 0x08, 0xB6, 0x7B, 0xD2, 0xFD, 0x38, 0xDA, 0xF1, 0x7C, 0x58,
+        0x2B, 0xA2, 0x6C, 0xCF, 0x88, 0x6D, 0xA9, 0xB6, 0x2D, 0xBF, 0x30, 0x18, 0x7C, 0x34, 0xBD, 0xD9,
+        0x63, 0x95, 0x8B, 0xA5, 0xE0, 0xDF, 0xDE, 0xBA, 0xDF, 0x0C, 0xEB, 0x04, 0x87, 0x69, 0x12, 0xE6,
+        0xFD, 0x72, 0x6F, 0x1C, 0xD2, 0x80, 0x9E, 0x1E, 0x10, 0x8D, 0xCB, 0x60, 0x43, 0xE2, 0x9F, 0x0B,
+        0x3D, 0xC4, 0x48, 0xC3, 0x67, 0xF9, 0x02, 0x0C, 0x5E, 0xD0, 0x5B, 0xD6, 0x4E, 0x4F, 0xC1, 0xB3,
+        0xF3, 0x7A, 0xEB, 0x7B, 0x7E, 0x14, 0xAA, 0x25, 0xAC, 0x5E, 0x7C, 0x81, 0xDD, 0x93, 0x0A, 0x46,
+        0xAF, 0x4F, 0x53, 0x2F, 0x51, 0xB7, 0xA0, 0xCF, 0xB8, 0x2C, 0xE2, 0x32, 0x04, 0x1E, 0xC8, 0x0F,
+        0xEF, 0x36, 0x0C, 0xBD, 0xD9, 0x54, 0x16, 0x0F, 0xAD, 0xAB, 0x35, 0x2B, 0x6B, 0x92, 0xB5, 0x35,
+        0x76, 0xA8, 0x8F, 0xEA, 0x49, 0x47, 0x17, 0x3B, 0x9D, 0x43, 0x00, 0xBF, 0x19, 0xAE, 0xEF, 0xE9,
+        0x37, 0x56, 0xB5, 0x34, 0x0D, 0x2F, 0x3A, 0x49, 0x58, 0xA7, 0xAB, 0xBF, 0x5E, 0x01, 0x46, 0xE7,
+        0x7F, 0x62, 0x95, 0xA0, 0x7B, 0x67, 0x1C, 0xDC, 0x1C, 0xC1, 0x07, 0xCE, 0xFD, 0x04, 0x14, 0x4D,
+        0x71, 0x54, 0x7A, 0x2A, 0x2C, 0x2A, 0x19, 0x41, 0x0B, 0x38, 0xBC, 0x72, 0x28, 0x50, 0xA6, 0x09,
+        0xF8, 0x93, 0xF7, 0xCE, 0xD5, 0x2F, 0x13, 0x22, 0x96, 0x6C, 0x36, 0xC0, 0xD0, 0x6B, 0xE6, 0x12,
+        0xA9, 0x55, 0x4C, 0x64, 0xDF, 0xE9, 0x90, 0x64, 0xE6, 0xE6, 0xC6, 0x77, 0x41, 0xF0, 0x74, 0x2E,
+        0x73, 0x3F, 0xC7, 0xE4, 0x09, 0x1C, 0xFC, 0x69, 0x25, 0xA0, 0x2E, 0xFB, 0x35, 0xB1, 0x04, 0x09,
+        0x2B, 0xCF, 0xA5, 0x75, 0x07, 0x41, 0x54, 0x6D, 0x01, 0xC9, 0xFF, 0xF3, 0xEE, 0x17, 0x67, 0x35,
+        0x92, 0x95, 0x54, 0xBB, 0xED, 0xC8, 0x96, 0x39, 0xF9, 0x39, 0xEF, 0x55, 0x6C, 0x0C, 0x58, 0x60,
+        0x45, 0xAA, 0x67, 0xBA, 0x14, 0xE6, 0x37, 0x23, 0x34, 0xBA, 0x69, 0x7A, 0x42, 0x7C, 0x05, 0xC9,
+        0xA8, 0x86, 0x5B, 0x0C, 0x27, 0x45, 0x08, 0xB3, 0x66, 0x6E, 0xAA, 0x28, 0x02, 0x79, 0x99, 0x04,
+        0x3E, 0xF7, 0xDF, 0x4E, 0xC3, 0x08, 0xC5, 0x93, 0x0A, 0x07, 0x13, 0xC2, 0xEB, 0x14, 0xF3, 0x4D,
+        0x4F, 0xB5, 0x5B, 0xED, 0x8B, 0x1E, 0x13, 0x67, 0x86, 0xCD, 0xA1, 0x8D, 0xEA, 0x23, 0x00, 0xAB,
+        0x5F, 0xD9, 0xF9, 0x33, 0xD4, 0xBD, 0x99, 0x08, 0x09, 0x17, 0xA4, 0x5E, 0x5D, 0xA2, 0x7F, 0x55,
+        0xDF, 0x32, 0xD5, 0x9F, 0x3B, 0xBB, 0xED, 0xDE, 0xCB, 0x70, 0x35, 0xC3, 0x1A, 0x55, 0x89, 0xEB,
+        0x04, 0x5D, 0x05, 0x50, 0x22, 0x80, 0xF8, 0xAB, 0x0D, 0x8E, 0x85, 0xBD, 0xDC, 0xAA, 0xE2, 0x1B,
+        0x7C, 0x43, 0x52, 0x4A, 0xE3, 0x81, 0xF3, 0x3B, 0x90, 0xC2, 0x2C, 0x1C, 0x0A, 0x82, 0x00, 0xA8,
+        0x2E, 0x40, 0xA9, 0xB2, 0x70, 0x4C, 0xD9, 0xDB, 0x16, 0x1C, 0xF9, 0x49, 0x00, 0xDE, 0xE0, 0x2C,
+        0x1E, 0x89, 0x26, 0x36, 0xE9, 0xB8, 0xF1, 0x39, 0x84, 0x20, 0xBD, 0x81, 0x36, 0xC5, 0x6B, 0xCB,
+        0x0E, 0x04, 0x59, 0xB8, 0x5F, 0xFA, 0x78, 0x63, 0xAB, 0xC7, 0x23, 0xA7, 0x67, 0xCA, 0x0E, 0x6D,
+        0x90, 0xA6, 0x1F, 0x68, 0xEE, 0x48, 0x72, 0xA6, 0x85, 0xC8, 0xD2, 0x81, 0x2E, 0x68, 0xCC, 0x91,
+        0xC1, 0x97, 0xCC, 0xE2, 0x38, 0x3A, 0x77, 0xEF, 0xE6, 0x3B, 0x56, 0x29, 0x08, 0x0D, 0xA5, 0xBC,
+        0x51, 0x46, 0x00, 0xC0, 0xC7, 0xF0, 0xFB, 0x38, 0x32, 0xCE, 0x86, 0xE3, 0xAA, 0xE9, 0xFD, 0x8C,
+        0x82, 0xDC, 0x04, 0xD1, 0xAA, 0x48, 0x0D, 0xD9, 0xE5, 0xE3, 0x4C, 0x50, 0x4D, 0x04, 0xA5, 0xC3,
+        0x69, 0xD5, 0xF5, 0xA5, 0xE0, 0x21, 0x22, 0xC2, 0x16, 0xB3, 0x4A, 0x5C, 0x2D, 0x29, 0x66, 0x9E,
+        0x41, 0x7B, 0x99, 0xAD, 0x9F, 0x02, 0x88, 0xB5, 0x35, 0x04, 0x56, 0xB3, 0x5F, 0xD2, 0x60, 0xA6,
+        0xDB, 0xE6, 0xFF, 0x28, 0x04, 0xFF, 0x37, 0x7D, 0xDB, 0xEC, 0xF8, 0x09, 0xED, 0x54, 0xAA, 0x58,
+        0x36, 0x2D, 0xC4, 0x04, 0xEF, 0xB2, 0x77, 0x65, 0x72, 0x08, 0xCE, 0x17, 0x8E, 0x79, 0x09, 0x4C,
+        0x54, 0x0F, 0x99, 0x21, 0x83, 0x33, 0x64, 0x85, 0xF3, 0x75, 0xDF, 0xAE, 0x2F, 0x0E, 0x63, 0x89,
+        0x97, 0x87, 0xBC, 0x25, 0xBC, 0x0E, 0x0A, 0x05, 0x8A, 0xEB, 0x8E, 0x08, 0x38, 0xE4, 0xB8, 0x00,
+        0x8A, 0xE9, 0xE3, 0x20, 0xD0, 0xBE, 0x82, 0xF9, 0x6A, 0x4F, 0x26, 0x91, 0xAD, 0x66, 0x0C, 0x76,
+        0xFF, 0x52, 0x90, 0x1E, 0x04, 0x08, 0xEA, 0x96, 0x66, 0x13, 0x95, 0x27, 0xA8, 0xC1, 0xDD, 0x94,
+        0xCE, 0x4F, 0x07, 0x1F, 0xD2, 0x3C, 0x8B, 0x35, 0x0C, 0x5A, 0x4B, 0xB3, 0x37, 0x48, 0xC4, 0xBA,
+        0x11, 0x1F, 0xAC, 0xCA, 0xE0, 0x62, 0x0E, 0xFA, 0xBB, 0xC8, 0xEE, 0x27, 0x82, 0xE2, 0x4E, 0x7C,
+        0x0C, 0xFB, 0x95, 0xC5, 0xD7, 0x35, 0xB7, 0x83, 0xBE, 0x9C, 0xF0, 0xF8, 0xE9, 0x55, 0xAF, 0x34,
+        0xA3, 0x0E, 0x62, 0xB9, 0x45, 0x04, 0xD7, 0xF4, 0x28, 0x0F, 0xB3, 0x83, 0xFB, 0xDE, 0xC9, 0xAA,
+        0xF5, 0x76, 0x51, 0x0E, 0xBF, 0xCD, 0xB1, 0xBC, 0xD8, 0xD3, 0x1E, 0x39, 0x04, 0x7C, 0xDF, 0x64,
+        0x13, 0xEC, 0x46, 0x71, 0x6C, 0x69, 0x79, 0xC3, 0xB3, 0xC5, 0xCD, 0xA5, 0x73, 0x67, 0x61, 0xD2,
+        0x16, 0xC4, 0x6C, 0xEC, 0x61, 0x34, 0xBE, 0xA8, 0x4B, 0xF9, 0xF8, 0xA5, 0x85, 0xB6, 0x12, 0x15,
+        0x9D, 0xDA, 0xFF, 0x69, 0x27, 0x3C, 0x04, 0x55, 0x02, 0x63, 0x1A, 0x28, 0xB9, 0xA5, 0x04, 0x3B,
+        0x35, 0x31, 0x2C, 0x73, 0xC2, 0x85, 0x74, 0xED, 0x62, 0x29, 0x67, 0x50, 0x44, 0x39, 0xDD, 0xDF,
+        0x41, 0xB1, 0xB4, 0x1F, 0xC5, 0x95, 0x1B, 0xFB, 0x97, 0xCF, 0x63, 0xD5, 0x84, 0x86, 0xF0, 0xD5,
+        0xAE, 0x7B, 0xD1, 0x5D, 0xFC, 0x79, 0x0D, 0xD3, 0x1A, 0xD5, 0xD5, 0x5B, 0x1B, 0x1A, 0x97, 0xF4,
+        0xD6, 0x04, 0x14, 0x1B, 0x30, 0x03, 0x0E, 0x04, 0x5F, 0x66, 0x6A, 0x7E, 0xCA, 0xAC, 0x95, 0x03,
+        0x73, 0xAB, 0xEC, 0xA6, 0x3F, 0x9A, 0x7D, 0x85, 0x22, 0xE9, 0xE5, 0x75, 0x64, 0x8A, 0x2D, 0x2C,
+        0xFC, 0xFA, 0x0B, 0x32, 0xF9, 0xB8, 0x55, 0x7B, 0x9C, 0x4B, 0xB1, 0x77, 0xE3, 0xCE, 0xA1, 0x6D,
+        0xC8, 0xCB, 0x46, 0xF8, 0x8F, 0xE3, 0x91, 0x59, 0x30, 0xBE, 0xE5, 0x96, 0xEB, 0xDE, 0xE9, 0x13,
+        0xE6, 0xF4, 0x06, 0x58, 0x99, 0x98, 0x5B, 0x75, 0x04, 0x47, 0x1F, 0x74, 0x7F, 0xDC, 0x64, 0x1F,
+        0x8F, 0x62, 0x09, 0x58, 0x81, 0x84, 0x99, 0x65, 0xDD, 0x95, 0xA3, 0x96, 0x16, 0x9E, 0x76, 0x3B,
+        0xD6, 0x0F, 0xA0, 0x0B, 0xC8, 0xA0, 0xF6, 0xB4, 0xB3, 0x23, 0x47, 0xFA, 0x38, 0x4D, 0x72, 0xF9,
+        0xBD, 0xC7, 0x8E, 0xEE, 0x41, 0xCB, 0x2C, 0x26, 0xAF, 0x5F, 0xA6, 0xFA, 0xB5, 0xB2, 0x76, 0x92,
+        0x52, 0x80, 0x84, 0xA6, 0xEE, 0x8E, 0xEE, 0x75, 0xE9, 0x04, 0x44, 0xA2, 0x76, 0x25, 0x46, 0x8F,
+        0x2D, 0x10, 0xBF, 0xB1, 0x5E, 0xC8, 0x2F, 0xD2, 0xFD, 0xCA, 0x9B, 0xDE, 0xBB, 0x90, 0xEA, 0xDB,
+        0x3B, 0x4F, 0x79, 0xE3, 0xC6, 0xC4, 0x8E, 0xB5, 0x4E, 0x85, 0x3A, 0x0A, 0xD1, 0xA4, 0x9F, 0x7F,
+        0xEF, 0xC9, 0x15, 0xB6, 0xC4, 0x84, 0x7A, 0x4C, 0x26, 0xFA, 0x26, 0x72, 0x19, 0x3C, 0xE1, 0x5B,
+        0x35, 0x3F, 0x8A, 0x16, 0x05, 0xBE, 0x24, 0xBF, 0x83, 0xDF, 0x04, 0x96, 0x89, 0x1B, 0xA7, 0x59,
+        0xEB, 0x87, 0x28, 0x45, 0x47, 0x6A, 0xBF, 0x41, 0xC4, 0xBA, 0x8A, 0x48, 0x30, 0x6A, 0xF8, 0xF1,
+        0x69, 0x65, 0x37, 0xDD, 0x42, 0xBD, 0x01, 0x29, 0x21, 0xBA, 0x8D, 0xB2, 0x51, 0x34, 0x52, 0xBA,
+        0x41, 0xD4, 0xA6, 0xFC, 0xEC, 0x94, 0xAF, 0xAD, 0xBA, 0xB6, 0xC0, 0xCD, 0xF8, 0x97, 0xD1, 0xAF,
+        0x2F, 0x9A, 0x17, 0xA7, 0x54, 0xC2, 0xC7, 0xE0, 0x2B, 0xEE, 0xF9, 0x04, 0x17, 0x8F, 0xB8, 0x02,
+        0x72, 0x51, 0x59, 0xBE, 0x4D, 0x56, 0x1E, 0x72, 0x3C, 0x3B, 0x5D, 0xEF, 0x3A, 0x43, 0xEA, 0x26,
+        0x5B, 0x52, 0xAD, 0xA0, 0x58, 0x72, 0x93, 0x20, 0x19, 0x19, 0x1F, 0x3C, 0xD9, 0xE1, 0x11, 0xCD,
+        0x52, 0xF9, 0xE8, 0xA6, 0x29, 0x84, 0x64, 0x1A, 0x03, 0x6A, 0x2B, 0x1C, 0x0D, 0x53, 0x53, 0xA7,
+        0x72, 0x02, 0x7C, 0x34, 0x20, 0xD9, 0x7B, 0x5F, 0xE1, 0x14, 0x3E, 0x41, 0x04, 0xEA, 0x2F, 0xD3,
+        0x15, 0xD0, 0x5F, 0xB0, 0x26, 0x6D, 0xA5, 0x13, 0x1F, 0x32, 0x04, 0x3F, 0x03, 0x02, 0x9E, 0x68,
+        0xA5, 0x29, 0xA0, 0x5E, 0xAF, 0xF1, 0x9C, 0xF9, 0x3E, 0xE3, 0xCB, 0x5A, 0x39, 0xBA, 0x2F, 0x85,
+        0x71, 0x69, 0x6B, 0x6B, 0x50, 0xA9, 0x44, 0x60, 0x33, 0xD3, 0xC7, 0x84, 0x57, 0x94, 0x2F, 0xD8,
+        0x49, 0x06, 0x15, 0x7C, 0x40, 0x71, 0x0A, 0xF1, 0xE1, 0xF1, 0xD4, 0xF3, 0x32, 0x04, 0xC7, 0xA7,
+        0xD2, 0x47, 0x7A, 0xC5, 0x62, 0xBF, 0xCB, 0x21, 0x66, 0x58, 0x6E, 0x9C, 0x5F, 0x3C, 0xB0, 0xBD,
+        0x06, 0x6F, 0x4D, 0x28, 0xB2, 0xCA, 0x15, 0xA1, 0x8D, 0x92, 0x92, 0xA5, 0x0A, 0xEE, 0x7D, 0x57,
+        0xC6, 0xFE, 0x7B, 0x80, 0xFD, 0xDE, 0x4B, 0x02, 0xED, 0x4A, 0x0D, 0xEE, 0x8D, 0x17, 0x05, 0x90,
+        0xE3, 0x96, 0x3B, 0x79, 0x83, 0xFC, 0x5B, 0xB7, 0x94, 0x46, 0xD7, 0x8C, 0x24, 0xE9, 0x04, 0x77,
+        0xF6, 0xD6, 0x01, 0x5E, 0x00, 0xB3, 0xE1, 0x61, 0x9D, 0x4D, 0xB5, 0x13, 0x1D, 0x78, 0x47, 0x85,
+        0x07, 0x9E, 0x76, 0x27, 0xE3, 0x95, 0x3B, 0x3E, 0x86, 0x1C, 0x70, 0xE1, 0x78, 0x2F, 0x3E, 0xAC,
+        0x07, 0xAD, 0x93, 0xCC, 0x5D, 0xC5, 0x41, 0x07, 0x8A, 0xA4, 0xDC, 0x72, 0xC3, 0xF5, 0xD8, 0xB3,
+        0x1F, 0xB1, 0xC7, 0x16, 0xBF, 0xDE, 0xDC, 0x3A, 0x15, 0x15, 0xF2, 0x49, 0x43, 0xCC, 0xBB, 0x04,
+        0x05, 0x65, 0x7B, 0x03, 0xE9, 0x1F, 0x13, 0x32, 0xFF, 0xF0, 0x7C, 0xA3, 0x68, 0x7C, 0x2F, 0x81,
+        0xBD, 0x7C, 0x53, 0x7D, 0x83, 0x09, 0x4C, 0x6C, 0x9F, 0x14, 0x7B, 0xA7, 0x27, 0x53, 0x5F, 0x5B,
+        0xCA, 0x24, 0xB3, 0x5F, 0xE1, 0xEE, 0xB4, 0x41, 0x89, 0xD0, 0x3C, 0x66, 0xF1, 0xB3, 0xAE, 0xCA,
+        0x5A, 0xB9, 0x7E, 0x64, 0x96, 0x39, 0x0D, 0x27, 0xFC, 0x32, 0x34, 0x9F, 0x12, 0x17, 0x16, 0x8D,
+        0x04, 0x44, 0x44, 0xFF, 0x2F, 0x4B, 0xC7, 0x55, 0x14, 0x64, 0x81, 0x22, 0xD8, 0xFC, 0x45, 0x7C,
+        0x84, 0x00, 0x4A, 0x0C, 0x78, 0x93, 0x9D, 0x7D, 0xD9, 0xD8, 0xB3, 0xA6, 0x21, 0x90, 0x7A, 0x89,
+        0x25, 0x94, 0x08, 0x52, 0x75, 0x7E, 0x38, 0xD5, 0x63, 0x9A, 0x80, 0x47, 0x21, 0x8B, 0x6E, 0x90,
+        0x3F, 0x7B, 0x0F, 0x85, 0xD3, 0xB3, 0x83, 0x1C, 0x7A, 0xCE, 0x27, 0x34, 0xE8, 0x55, 0xBF, 0x75,
+        0x26, 0x04, 0xCB, 0xC2, 0x9E, 0x53, 0x4E, 0xC9, 0x6B, 0xAE, 0xBF, 0x9F, 0xC9, 0x93, 0x04, 0x78,
+        0x0E, 0x58, 0x2D, 0xB4, 0x17, 0x80, 0x60, 0xC6, 0x89, 0x73, 0x4B, 0xB4, 0x95, 0xF5, 0x20, 0x83,
+        0x33, 0x5F, 0xBA, 0x7F, 0xF3, 0xE1, 0xF7, 0x26, 0x4A, 0x4C, 0xED, 0xCF, 0xAE, 0x49, 0xD5, 0x8E,
+        0xEC, 0x29, 0x17, 0xC3, 0x88, 0x6D, 0x71, 0xF7, 0x25, 0x18, 0x0C, 0x98, 0x29, 0x86, 0x2D, 0xF4,
+        0xBC, 0x31, 0x04, 0x96, 0xED, 0xAD, 0xD2, 0x22, 0x8B, 0xC0, 0xB3, 0xB1, 0x88, 0x61, 0x65, 0x38,
+        0x0A, 0x10, 0xBA, 0xDD, 0xD8, 0x3E, 0x5E, 0x76, 0xC7, 0x43, 0x65, 0xEC, 0x74, 0x18, 0xC5, 0x6E,
+        0x32, 0xCE, 0xC1, 0x5D, 0x55, 0x39, 0x41, 0xB1, 0x74, 0xC4, 0x2D, 0x10, 0x67, 0x6E, 0x30, 0xC0,
+        0x6C, 0x9A, 0x76, 0x47, 0x33, 0x78, 0x49, 0x16, 0x52, 0xD0, 0xFB, 0x8F, 0xAE, 0xE7, 0x29, 0x10,
+        0x13, 0x7C, 0x33, 0x04, 0xF7, 0x82, 0x74, 0xCA, 0x28, 0x6F, 0xCA, 0xBA, 0x81, 0xC1, 0xD4, 0x36,
+        0x42, 0x0B, 0x11, 0x3B, 0x0D, 0x81, 0xA1, 0x72, 0x13, 0xEF, 0x19, 0x11, 0x1F, 0xF9, 0x59, 0x79,
+        0xF4, 0x9F, 0x92, 0x25, 0xF0, 0x9C, 0xFB, 0x98, 0x94, 0xD3, 0x4D, 0xBE, 0xCA, 0xA2, 0x46, 0x3E,
+        0x7D, 0x2D, 0x6A, 0xA4, 0xA6, 0x1F, 0x2D, 0x70, 0xAA, 0x59, 0xAD, 0x30, 0x1A, 0xE7, 0xD4, 0xB3,
+        0x55, 0xBE, 0x52, 0x74, 0x04, 0x53, 0x90, 0x4F, 0xAA, 0x0B, 0x33, 0x4C, 0xDD, 0xA6, 0xE0, 0x00,
+        0x93, 0x5E, 0xF2, 0x21, 0x51, 0xEC, 0x08, 0xD0, 0xF7, 0xBB, 0x11, 0x06, 0x9F, 0x57, 0x54, 0x5C,
+        0xCC, 0x1A, 0x37, 0xB7, 0xC0, 0x5B, 0xC0, 0x87, 0xD0, 0xBC, 0x80, 0x10, 0x6D, 0x88, 0xC9, 0xEC,
+        0xCA, 0xC2, 0x0D, 0x3C, 0x1C, 0x13, 0x99, 0x99, 0x81, 0xE1, 0x44, 0x34, 0x69, 0x9D, 0xCB, 0x09,
+        0x6B, 0x02, 0x27, 0x71, 0xC8, 0x04, 0x76, 0xE6, 0x41, 0x13, 0xF6, 0x77, 0xCF, 0x0E, 0x10, 0xA2,
+        0x57, 0x0D, 0x59, 0x99, 0x68, 0xD3, 0x15, 0x44, 0xE1, 0x79, 0xB7, 0x60, 0x43, 0x29, 0x52, 0xC0,
+        0x2A, 0x44, 0x17, 0xBD, 0xDE, 0x39, 0xC9, 0x0D, 0xDF, 0x8D, 0xEE, 0x4E, 0x95, 0xCF, 0x57, 0x70,
+        0x66, 0xD7, 0x06, 0x81, 0xF0, 0xD3, 0x5E, 0x2A, 0x33, 0xD2, 0xB5, 0x6D, 0x20, 0x32, 0xB4, 0xB1,
+        0x75, 0x2D, 0x19, 0x01, 0xAC, 0x01, 0x04, 0x66, 0xF5, 0x9A, 0x56, 0x09, 0x2C, 0x9E, 0x1B, 0xC0,
+        0x5D, 0xCB, 0x34, 0x14, 0xA5, 0xA2, 0x63, 0x7C, 0x0F, 0x2F, 0xFC, 0x15, 0xDC, 0x97, 0x02, 0x28,
+        0x6E, 0xC2, 0xED, 0xCC, 0xCE, 0x4C, 0x87, 0x36, 0x7D, 0x7A, 0x9F, 0x8A, 0x4A, 0xEF, 0xCB, 0x56,
+        0xFC, 0xE0, 0x5E, 0x10, 0x35, 0x1A, 0x73, 0x99, 0xB6, 0x2D, 0xC0, 0x3B, 0xCE, 0x2B, 0xCE, 0x69,
+        0xC3, 0xAC, 0x0D, 0x46, 0x64, 0xF5, 0x78, 0x04, 0x32, 0x4A, 0xED, 0x7D, 0xF6, 0x5C, 0x80, 0x42,
+        0x52, 0xDC, 0x02, 0x70, 0x90, 0x7A, 0x30, 0xB0, 0x96, 0x12, 0xAE, 0xB9, 0x73, 0x44, 0x9C, 0xEA,
+        0x40, 0x95, 0x98, 0x0F, 0xC2, 0x8D, 0x3D, 0x5D, 0x64, 0x8A, 0x36, 0x57, 0x74, 0xB6, 0x1F, 0x2F,
+        0xF1, 0x30, 0xC0, 0xC3, 0x5A, 0xEC, 0x1F, 0x4F, 0x19, 0x21, 0x3B, 0x0C, 0x7E, 0x33, 0x28, 0x43,
+        0x96, 0x72, 0x24, 0xAF, 0x96, 0xAB, 0x7C, 0x84, 0x04, 0xAC, 0x0D, 0x73, 0x73, 0x5E, 0x87, 0x5B,
+        0xDB, 0xBB, 0x6C, 0x75, 0xF1, 0x17, 0xC8, 0xDF, 0xE8, 0xB8, 0xB2, 0xDF, 0x56, 0x37, 0xED, 0xA2,
+        0x1B, 0x84, 0xFE, 0x1B, 0x0F, 0x6A, 0x74, 0x91, 0x6E, 0x3A, 0xB3, 0xB3, 0xEE, 0xB6, 0x30, 0xD6,
+        0x90, 0xDE, 0xE4, 0x55, 0x3B, 0xC8, 0x44, 0x91, 0x9C, 0x80, 0x96, 0x94, 0x7F, 0xDA, 0xC0, 0xB4,
+        0xDF, 0x5F, 0xE3, 0x25, 0xFE, 0xC0, 0x82, 0x6D, 0x16, 0x04, 0x9E, 0x13, 0xA3, 0xAE, 0x2B, 0x5A,
+        0x3B, 0x56, 0x3E, 0x16, 0x26, 0x67, 0x53, 0x53, 0xD4, 0x9C, 0x72, 0xF5, 0x1F, 0xB7, 0x7B, 0xCF,
+        0x81, 0x69, 0x9A, 0x2D, 0x77, 0x09, 0x6D, 0x09, 0x6F, 0xB5, 0x5B, 0x57, 0x77, 0x16, 0xE5, 0x54,
+        0x60, 0xE8, 0x88, 0x4C, 0xFD, 0xE3, 0x58, 0x18, 0x57, 0xC2, 0x99, 0x92, 0x3C, 0x3B, 0x9D, 0xB7,
+        0x0E, 0x98, 0xB0, 0x57, 0x32, 0x98, 0xCC, 0xA4, 0x24, 0xBB, 0x04, 0xAB, 0x11, 0x7B, 0x6D, 0x38,
+        0x2B, 0xF0, 0xD3, 0xDD, 0x1C, 0xB6, 0x1E, 0xD3, 0xFA, 0x2F, 0x4D, 0xBE, 0x2E, 0x67, 0xC1, 0x4E,
+        0x39, 0x07, 0x65, 0x1E, 0x9E, 0x02, 0xF5, 0xF9, 0x14, 0xBC, 0x49, 0x2B, 0x4A, 0xC9, 0x69, 0xE9,
+        0x3A, 0x11, 0x90, 0x07, 0x7A, 0xD1, 0xBA, 0x39, 0x54, 0x65, 0x28, 0x53, 0xCA, 0xA3, 0x15, 0x8C,
+        0x1A, 0x73, 0x85, 0xA6, 0x77, 0x5A, 0x04, 0x36, 0xC2, 0x40, 0xB2, 0x04, 0x14, 0x6A, 0x77, 0x8C,
+        0x04, 0x67, 0x0C, 0x2F, 0x91, 0xB0, 0x0A, 0xF4, 0x68, 0x0D, 0xFA, 0x8B, 0xCE, 0x34, 0x90, 0x71,
+        0x7D, 0x58, 0xBA, 0x88, 0x9D, 0xDB, 0x59, 0x28, 0x36, 0x66, 0x42, 0xBE, 0xB3, 0x18, 0xE0, 0xEC,
+        0x33, 0x54, 0x02, 0x8A, 0xDD, 0x66, 0x98, 0x27, 0xF9, 0xD4, 0xB2, 0x87, 0x0A, 0xAA, 0x97, 0x1D,
+        0x2F, 0x7E, 0x5E, 0xD1, 0xD0, 0xB2, 0x97, 0x48, 0x3D, 0x83, 0xEF, 0xD0, 0x04, 0x53, 0xDA, 0x6E,
+        0x07, 0x26, 0x72, 0x1B, 0x42, 0x10, 0xE0, 0x55, 0x66, 0x21, 0x88, 0xE9, 0xE6, 0x61, 0xD7, 0xCF,
+        0x2D, 0x7F, 0x5A, 0xA9, 0x29, 0x7D, 0xB3, 0xD7, 0x68, 0x6F, 0x2F, 0xBF, 0x68, 0x29, 0x08, 0x99,
+        0x1D, 0xA0, 0xB5, 0xA2, 0xCC, 0x97, 0x26, 0xB6, 0xE6, 0xF7, 0xCF, 0xB6, 0x13, 0x9F, 0x25, 0xCF,
+        0xF6, 0x71, 0xF4, 0xB1, 0xB8, 0x6C, 0xD3, 0xA4, 0xBA, 0x81, 0x52, 0x47, 0xFC, 0x04, 0x80, 0x0B,
+        0x1C, 0x0A, 0x46, 0x6B, 0xDB, 0xEF, 0x18, 0x16, 0xE9, 0x76, 0x54, 0x7E, 0x83, 0xBD, 0xB9, 0x37,
+        0xC9, 0xE1, 0xE7, 0x49, 0x7B, 0x51, 0xC9, 0xAB, 0xDE, 0x99, 0x1F, 0x53, 0xF2, 0xC6, 0x32, 0xD1,
+        0x28, 0xC6, 0xC7, 0x77, 0x47, 0xBB, 0xBB, 0xAC, 0x53, 0xF4, 0x33, 0x36, 0xA5, 0xD6, 0xCA, 0xA8,
+        0x4A, 0xCD, 0x35, 0xB0, 0x6C, 0x49, 0x40, 0x62, 0xC2, 0x87, 0x33, 0x19, 0xBB, 0x92, 0x04, 0x56,
+        0xC8, 0x04, 0x8B, 0x31, 0xF3, 0x37, 0xC6, 0xC4, 0xA3, 0x65, 0x20, 0x17, 0x54, 0x69, 0xDB, 0x80,
+        0x75, 0xA5, 0xB7, 0xAC, 0x47, 0xCF, 0x85, 0x0E, 0xAC, 0x2F, 0xFF, 0x2E, 0xBA, 0x9D, 0xE4, 0x36,
+        0x59, 0x5F, 0x1D, 0x24, 0x35, 0x73, 0xC9, 0x19, 0x39, 0x97, 0x2B, 0xC4, 0xFF, 0xBC, 0x63, 0x7D,
+        0x3E, 0xA7, 0xB9, 0x3F, 0x82, 0xD9, 0xB5, 0x0D, 0x97, 0xED, 0x52, 0x07, 0x57, 0x14, 0xFC, 0x04,
+        0x8C, 0x67, 0xA1, 0x70, 0x68, 0x6F, 0x6E, 0x06, 0x36, 0x35, 0xF7, 0x88, 0xCC, 0x10, 0xB9, 0x08,
+        0x8C, 0xEA, 0x02, 0x10, 0x24, 0xA3, 0x9A, 0x3B, 0xFD, 0xE9, 0xFE, 0xA5, 0x68, 0x4F, 0xC8, 0x5D,
+        0xE0, 0xD0, 0x6B, 0x2C, 0x77, 0x30, 0x4B, 0x2C, 0x5A, 0x80, 0xF5, 0xDA, 0xB6, 0x5C, 0x28, 0xBE,
+        0x0D, 0xAC, 0xBF, 0x88, 0x2E, 0xEF, 0xBC, 0xB6, 0xB5, 0xB8, 0xF8, 0x1D, 0xCA, 0x62, 0x6B, 0xAF,
+        0x04, 0x89, 0x1F, 0x78, 0x91, 0xF6, 0xDF, 0xFD, 0xAE, 0x22, 0x2E, 0x38, 0x4C, 0xD5, 0x5A, 0x4E,
+        0xA7, 0xAC, 0x08, 0xE4, 0xE2, 0xD5, 0x8D, 0xB8, 0xEB, 0x19, 0xFA, 0x29, 0x1A, 0xB4, 0xBE, 0x7A,
+        0x2C, 0xDA, 0x45, 0x4B, 0xE4, 0xB0, 0xC3, 0xD4, 0xC6, 0x11, 0x19, 0x06, 0x90, 0x78, 0xC6, 0xEB,
+        0xCE, 0x32, 0x0A, 0x40, 0x87, 0xD8, 0x25, 0xF6, 0x29, 0x4C, 0x03, 0x52, 0xB2, 0x86, 0x97, 0xFE,
+        0x40, 0x04, 0x7A, 0xA5, 0xF4, 0x05, 0x89, 0xAB, 0x8B, 0xB3, 0x8B, 0xD4, 0xEB, 0x2E, 0x33, 0x53,
+        0xAD, 0xAB, 0x75, 0x9C, 0x6C, 0x1F, 0xC9, 0xAA, 0x7D, 0x3D, 0x33, 0xE0, 0x6C, 0x74, 0xDE, 0x7E,
+        0x94, 0xDC, 0xDA, 0x8F, 0x8B, 0xCC, 0x34, 0x92, 0xFC, 0x40, 0x42, 0x97, 0xA9, 0xE0, 0x03, 0x16,
+        0x44, 0x8A, 0xE0, 0x0C, 0xFB, 0xB7, 0x47, 0xC9, 0x4A, 0xCB, 0xCC, 0x90, 0xE3, 0x10, 0xA2, 0x94,
+        0xB6, 0x8B, 0x04, 0x79, 0xCC, 0x2E, 0x45, 0x48, 0x07, 0x16, 0x57, 0x11, 0xBC, 0x03, 0xDD, 0xDF,
+        0x0C, 0x41, 0x04, 0x19, 0x18, 0x4F, 0x54, 0x00, 0xC3, 0xEF, 0x8C, 0x65, 0xDA, 0x69, 0x75, 0x13,
+        0x22, 0xBB, 0x31, 0xB6, 0xF2, 0xF5, 0x4F, 0xE2, 0x24, 0x2A, 0x07, 0x47, 0xFC, 0x4C, 0x51, 0x20,
+        0x8B, 0xE1, 0x2B, 0xC3, 0xC8, 0x9A, 0x96, 0x1F, 0x8A, 0x8F, 0x1F, 0xD2, 0x6D, 0x5F, 0x8D, 0xED,
+        0x8C, 0x4C, 0x0F, 0x04, 0xDD, 0x36, 0x25, 0xFA, 0xEF, 0x5B, 0xA0, 0x60, 0x74, 0x66, 0x97, 0x16,
+        0xBB, 0xD3, 0x78, 0x8D, 0x89, 0xBD, 0xDE, 0x81, 0x59, 0x59, 0x96, 0x80, 0x92, 0xF7, 0x6C, 0xC4,
+        0xEB, 0x9A, 0x97, 0x87, 0x7A, 0x18, 0x8F, 0xA3, 0x52, 0x0E, 0x30, 0xD4, 0x61, 0xDA, 0x25, 0x01,
+        0x04, 0x57, 0x31, 0xCA, 0x94, 0x14, 0x61, 0x98, 0x28, 0x83, 0x39, 0x59, 0x37, 0xF6, 0x8D, 0x00,
+        0xC6, 0x44, 0xA5, 0x73, 0x04, 0xE4, 0xB7, 0x23, 0x90, 0x4C, 0xD4, 0x6B, 0x14, 0x8B, 0xD7, 0xB4,
+        0x83, 0xC1, 0xEA, 0x72, 0x57, 0x5C, 0x7B, 0x38, 0x82, 0x91, 0xFA, 0xA8, 0xF8, 0x62, 0xB0, 0x61,
+        0x83, 0xAB, 0xB4, 0x37, 0x6C, 0xC1, 0x44, 0xE0, 0xDE, 0x57, 0x38, 0x2A, 0x05, 0x99, 0x5E, 0x27,
+        0x27, 0x4A, 0x99, 0x55, 0x5F, 0x43, 0x9A, 0x16, 0x5D, 0xF1, 0x64, 0x45, 0x6A, 0xFF, 0x9C, 0x40,
+        0x68, 0x83, 0x94, 0xDF, 0x07, 0x04, 0x06, 0x4D, 0xE6, 0x85, 0xBE, 0xEA, 0xB5, 0xB2, 0x5C, 0xF5,
+        0x3F, 0x0A, 0x4E, 0x3E, 0x02, 0x83, 0x6F, 0xD9, 0xA9, 0x7E, 0x2E, 0x09, 0x06, 0x89, 0x7A, 0x42,
+        0x8E, 0x10, 0xD6, 0x7D, 0x1E, 0x5B, 0x5D, 0xBA, 0xDE, 0x65, 0xB4, 0xBB, 0xD3, 0x54, 0xFF, 0x00,
+        0xCE, 0xDC, 0xAD, 0x85, 0xEA, 0x46, 0xCB, 0x9B, 0xDC, 0xD1, 0xA6, 0xE2, 0x3A, 0xC4, 0xB4, 0x2F,
+        0xEA, 0xF8, 0x8E, 0xBF, 0x86, 0x54, 0x04, 0xC4, 0xEB, 0x0B, 0xB6, 0xA2, 0xA1, 0x22, 0x3A, 0xCF,
+        0x4E, 0xEB, 0x80, 0x47, 0x40, 0x36, 0x98, 0x24, 0xCF, 0x4E, 0x5F, 0x7A, 0x6C, 0xF7, 0x15, 0x77,
+        0x47, 0xF6, 0x40, 0x79, 0xB4, 0x1E, 0xEE, 0x5E, 0xA2, 0x4E, 0x71, 0xEC, 0x2D, 0x4F, 0x99, 0x24,
+        0x28, 0x0F, 0x3F, 0x86, 0xEB, 0x2D, 0xBA, 0x7F, 0x24, 0x60, 0x8C, 0x7B, 0x2F, 0xE6, 0xB8, 0x46,
+        0x28, 0x9D, 0x54, 0xAE, 0x05, 0xFB, 0x2C, 0x04, 0x82, 0x08, 0xDC, 0x01, 0x50, 0xAF, 0xB3, 0x12,
+        0xD0, 0x8A, 0xA6, 0xA1, 0x58, 0xF6, 0xCA, 0x0E, 0xC7, 0xFC, 0x5E, 0x11, 0x97, 0x37, 0xE2, 0xF1,
+        0xF7, 0xDB, 0xB5, 0x03, 0x6A, 0x8F, 0x34, 0x76, 0x6A, 0x75, 0x25, 0x9B, 0x57, 0x09, 0xBB, 0x86,
+        0xC8, 0xAD, 0xB2, 0x9D, 0xCD, 0x69, 0x06, 0xBE, 0x2F, 0x71, 0x4C, 0x2C, 0x50, 0x6A, 0xD2, 0x51,
+        0x64, 0x8D, 0x26, 0xE0, 0xE3, 0x02, 0xE3, 0xFD, 0x04, 0x9D, 0xEA, 0xE0, 0x8B, 0x2F, 0x7C, 0x51,
+        0xFC, 0x63, 0x66, 0x3D, 0xEF, 0xBE, 0xE5, 0xD5, 0xDE, 0x69, 0xBB, 0x3F, 0xF4, 0x36, 0x4D, 0xE8,
+        0xE7, 0xEE, 0x41, 0x18, 0xC7, 0xE2, 0xB9, 0xC4, 0xCC, 0xD2, 0xB2, 0xB8, 0xA4, 0x1F, 0x3E, 0xD4,
+        0xC2, 0x0B, 0x08, 0x2A, 0x48, 0x2E, 0x10, 0x27, 0xBB, 0xFB, 0xCC, 0x60, 0xA4, 0xC3, 0x6E, 0xBA,
+        0xFC, 0x80, 0xED, 0x22, 0xBA, 0x3F, 0x3F, 0x24, 0xA4, 0x04, 0x78, 0x2F, 0x4C, 0x03, 0x17, 0x15,
+        0x7E, 0x26, 0x1E, 0x94, 0x4D, 0x48, 0x90, 0x2F, 0xC3, 0x9B, 0x70, 0x76, 0xAD, 0x09, 0x21, 0x1A,
+        0xF2, 0x20, 0x70, 0xE1, 0x8C, 0x57, 0xB7, 0x88, 0x7A, 0x26, 0x30, 0x0A, 0x22, 0x0E, 0x4C, 0xAD,
+        0x3E, 0x7E, 0x50, 0x3F, 0x78, 0x47, 0x12, 0x07, 0x8E, 0x81, 0x13, 0x6F, 0xE7, 0xEC, 0x37, 0xFD,
+        0x97, 0x15, 0xD8, 0x75, 0x89, 0x09, 0xB2, 0xF5, 0x63, 0xEB, 0x04, 0xCA, 0xDC, 0xB1, 0x1F, 0xC3,
+        0x79, 0x2F, 0x42, 0xD2, 0xEC, 0xBD, 0x99, 0xFB, 0x3A, 0x12, 0xB2, 0xB6, 0x37, 0xC1, 0x5E, 0xD5,
+        0x8D, 0x83, 0x52, 0x23, 0xE7, 0x52, 0x5E, 0x28, 0xB3, 0xB9, 0x2E, 0x82, 0x91, 0x48, 0xCB, 0xBA,
+        0x04, 0xF5, 0x2B, 0x5B, 0x41, 0xE0, 0x98, 0x5C, 0xA9, 0x8F, 0xC4, 0x45, 0xC0, 0xA9, 0x4C, 0xAA,
+        0xCF, 0xCA, 0x78, 0xA2, 0x59, 0x87, 0xA5, 0x50, 0x82, 0xA3, 0x2C, 0x04, 0x77, 0xFB, 0x42, 0xE1,
+        0xB9, 0x2C, 0xAE, 0x89, 0x98, 0x05, 0x5D, 0xA1, 0xD8, 0x2F, 0xDC, 0xFD, 0x00, 0xA9, 0xE6, 0x17,
+        0xF5, 0x1C, 0xAA, 0x80, 0x7A, 0x54, 0x45, 0xDC, 0x35, 0xA0, 0x36, 0x3A, 0x25, 0x42, 0xF7, 0xDC,
+        0xD5, 0x4C, 0x6F, 0xC9, 0x71, 0x10, 0xAE, 0x4A, 0x56, 0xAA, 0x7F, 0x1D, 0x51, 0x4A, 0xB5, 0x65,
+        0xAE, 0xD5, 0x11, 0x6C, 0x97, 0x66, 0xBF, 0x02, 0x36, 0xB5, 0x1B, 0xDF, 0x04, 0xE0, 0x68, 0x33,
+        0xAD, 0xA7, 0xCA, 0xA8, 0x81, 0x38, 0x52, 0x8A, 0xD7, 0x84, 0x7F, 0x26, 0xE1, 0x1A, 0x53, 0x18,
+        0xEA, 0x8B, 0x09, 0xDE, 0xC8, 0x93, 0x5B, 0x97, 0x0E, 0x1B, 0xD6, 0xF7, 0xC2, 0x20, 0xC5, 0x6A,
+        0x37, 0xF3, 0x48, 0x0F, 0x8E, 0xC8, 0x97, 0xAE, 0x5C, 0x38, 0xAF, 0xC4, 0xF5, 0x9E, 0x18, 0xCD,
+        0xFF, 0x00, 0xC4, 0xC3, 0xA9, 0xD8, 0x46, 0x6E, 0xF3, 0x44, 0x61, 0x53, 0x7F, 0x04, 0x34, 0x5D,
+        0xEB, 0x51, 0x38, 0x87, 0xBE, 0xF8, 0x30, 0xCC, 0xD1, 0x7F, 0xB5, 0xC1, 0x5E, 0x46, 0xCF, 0xB5,
+        0x15, 0xB1, 0x4D, 0xA6, 0x05, 0x73, 0x21, 0xDF, 0xBB, 0x16, 0x84, 0x57, 0xB7, 0x5B, 0xAE, 0xA8,
+        0x94, 0x52, 0x71, 0x02, 0x98, 0xCA, 0x9F, 0xB4, 0x45, 0x86, 0x9E, 0x21, 0x1C, 0x2B, 0x57, 0x2A,
+        0x6F, 0x95, 0xE2, 0x47, 0xEB, 0xDB, 0x56, 0x68, 0xC7, 0x51, 0xC7, 0x79, 0xF5, 0x54, 0x04, 0x8F,
+        0x0A, 0xC5, 0x16, 0xAC, 0xE7, 0x3B, 0x5E, 0x6B, 0x1B, 0x52, 0x9A, 0xDE, 0x53, 0xDD, 0x8D, 0xE6,
+        0x76, 0xE9, 0x9A, 0xD8, 0xB8, 0x47, 0x91, 0x0C, 0xAD, 0xE6, 0x93, 0xDB, 0x32, 0x0B, 0x04, 0xDD,
+        0xB1, 0xFA, 0x0F, 0x8C, 0x51, 0x78, 0xD5, 0xDD, 0x95, 0x10, 0x89, 0xFA, 0xCD, 0x38, 0xF3, 0xCB,
+        0x24, 0xBF, 0x84, 0x3B, 0xA9, 0x01, 0x86, 0x88, 0xE1, 0xC2, 0x14, 0xEE, 0x22, 0x1A, 0x4E, 0x04,
+        0x3B, 0xC4, 0xE1, 0xA6, 0x5D, 0x69, 0xBF, 0x98, 0x3D, 0xD2, 0x76, 0x9F, 0x41, 0xAB, 0x71, 0x6E,
+        0xBA, 0xA8, 0xD0, 0x82, 0x80, 0xF9, 0x78, 0x06, 0x30, 0xAA, 0x8E, 0xF2, 0xA0, 0x42, 0x48, 0xA8,
+        0x3A, 0x7A, 0xAD, 0x20, 0xDC, 0xAA, 0x17, 0x32, 0x37, 0xE7, 0x09, 0xE3, 0x6F, 0x88, 0x79, 0x9B,
+        0xE7, 0x4D, 0xD8, 0x14, 0x8E, 0xFF, 0x3B, 0x69, 0x1C, 0xD4, 0x37, 0x8B, 0xC1, 0x48, 0x07, 0x74,
+        0x04, 0x1D, 0xAD, 0x62, 0xA3, 0x85, 0x9D, 0xA4, 0x2C, 0xF3, 0x34, 0x06, 0x44, 0xF5, 0xEC, 0x0C,
+        0xDC, 0xC7, 0x86, 0xCC, 0x25, 0x4A, 0x01, 0xA1, 0x4E, 0x34, 0xDB, 0x4A, 0xC9, 0xC7, 0x0E, 0x07,
+        0xD7, 0x0A, 0xC0, 0x3C, 0xFD, 0x4E, 0x29, 0xB0, 0xD9, 0xB2, 0x98, 0xBD, 0xB7, 0x41, 0x18, 0xCE,
+        0xAD, 0x7F, 0x45, 0xBA, 0xF9, 0xBB, 0xD0, 0x28, 0xF0, 0x7A, 0xA9, 0x36, 0x62, 0x2A, 0x38, 0xBB,
+        0xA4, 0x04, 0xFC, 0xCE, 0x7D, 0x78, 0xF4, 0x0F, 0xC4, 0xBE, 0x00, 0xD2, 0xE0, 0x9D, 0xF4, 0x3B,
+        0xDF, 0x01, 0x4F, 0x12, 0x50, 0x5D, 0x84, 0x83, 0x0D, 0xEF, 0x62, 0x77, 0x0E, 0xE8, 0x30, 0x5B,
+        0x17, 0xA3, 0x2D, 0x11, 0x65, 0x47, 0xA1, 0x5C, 0x98, 0xD7, 0x61, 0xDF, 0x8A, 0xBC, 0x84, 0x84,
+        0xF1, 0xCB, 0x60, 0xE7, 0x49, 0xA0, 0xB8, 0x84, 0x77, 0xF6, 0x06, 0xF6, 0xC8, 0x0C, 0xBB, 0x3B,
+        0xB1, 0x47, 0x04, 0x44, 0x0C, 0x56, 0x05, 0xAC, 0xE7, 0xAA, 0xE0, 0x76, 0xE1, 0x07, 0x19, 0xF3,
+        0x8A, 0x6B, 0xD7, 0x83, 0xD3, 0x75, 0x88, 0xDA, 0x84, 0x22, 0xCF, 0xB6, 0x06, 0x77, 0x2F, 0xD5,
+        0x31, 0x6A, 0x53, 0x87, 0x60, 0x16, 0x66, 0xCC, 0xEE, 0xB6, 0x76, 0xF5, 0xB0, 0x14, 0x68, 0x3C,
+        0xA1, 0x5C, 0xBE, 0xD9, 0xB3, 0x26, 0xA4, 0x73, 0xB9, 0x50, 0x49, 0xCF, 0x0F, 0xFA, 0x7D, 0x68,
+        0xA5, 0x55, 0x03
+    };
+    
+    const EmbeddedTable EMBEDDED_TABLES[] = {
+        { "secp112r1", { 5, 4 }, SECP112R1_BASE_POINT_TABLE, sizeof(SECP112R1_BASE_POINT_TABLE) },
+        { "secp256k1", { 5, 4 }, SECP256K1_BASE_POINT_TABLE, sizeof(SECP256K1_BASE_POINT_TABLE) }
+    };
+}
+
+const EmbeddedTable* ecc::FindEmbeddedBasePointTable(const string& curveName)
+{
+    for(const EmbeddedTable& table : EMBEDDED_TABLES)
+    {
+        if(curveName == table.curveName)
+            return &table;
+    }
+    
+    return nullptr;
+}
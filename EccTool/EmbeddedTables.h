@@ -0,0 +1,47 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__EmbeddedTables__
+#define __EccTool__EmbeddedTables__
+
+#include <string>
+#include <stdint.h>
+#include "EllipticCurve.h"
+
+namespace ecc
+{
+    // A base point comb table compiled into the binary, serialized as by
+    //  EllipticCurve::SerializeFixedPointTable(). The data is generated by tools/GenerateEmbeddedTables.cpp.
+    struct EmbeddedTable
+    {
+        const char* curveName;
+        CombParameters parameters;
+        const uint8_t* serializedPoints;
+        size_t size;
+    };
+    
+    // Returns the embedded base point table of the named curve, or nullptr if there is none.
+    const EmbeddedTable* FindEmbeddedBasePointTable(const std::string& curveName);
+}
+
+#endif /* defined(__EccTool__EmbeddedTables__) */
@@ -0,0 +1,207 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <algorithm>
+#include <stdexcept>
+#include "EphemeralKeyPool.h"
+#include "ChaCha20Drbg.h"
+#include "FieldElement.h"
+#include "Utilities.h"
+
+using namespace std;
+
+const size_t EphemeralKeyPool::DEFAULT_DEPTH = 256;
+const size_t EphemeralKeyPool::REFILL_BATCH_SIZE = 32;
+
+EphemeralKeyPool::EphemeralKeyPool(shared_ptr<const CurveContext> curveContext, size_t depth)
+    : _curveContext(move(curveContext)), _depth(depth), _isStopping(false), _processId(utilities::GetCurrentProcessId())
+{
+    if(!_curveContext)
+        throw invalid_argument("Curve context must not be null.");
+    if(_depth == 0)
+        throw invalid_argument("Depth must be at least 1.");
+    
+    // Throws for Curve25519 and edwards25519.
+    _curveContext->GetCurve();
+    
+    _statistics.hits = 0;
+    _statistics.misses = 0;
+    _statistics.refills = 0;
+    
+    _refillThread = thread(&EphemeralKeyPool::RunRefillThread, this);
+}
+
+EphemeralKeyPool::~EphemeralKeyPool()
+{
+    {
+        lock_guard<mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    
+    _refillNeeded.notify_all();
+    
+    // A child created by fork() which never restarted the refill thread only has the parent's handle of it.
+    if(_processId != utilities::GetCurrentProcessId())
+        _refillThread.detach();
+    else
+        _refillThread.join();
+}
+
+EphemeralKeyPool::EphemeralKey EphemeralKeyPool::Take()
+{
+    {
+        lock_guard<mutex> lock(_mutex);
+        DiscardKeysAfterFork();
+        if(!_keys.empty())
+        {
+            EphemeralKey key = move(_keys.front());
+            _keys.pop_front();
+            _statistics.hits++;
+            _refillNeeded.notify_one();
+            return key;
+        }
+        
+        _statistics.misses++;
+    }
+    
+    return move(ComputeKeys(1)[0]);
+}
+
+void EphemeralKeyPool::Fill()
+{
+    while(true)
+    {
+        size_t count;
+        {
+            lock_guard<mutex> lock(_mutex);
+            DiscardKeysAfterFork();
+            if(_keys.size() >= _depth)
+                return;
+            
+            count = min(REFILL_BATCH_SIZE, _depth - _keys.size());
+        }
+        
+        vector<EphemeralKey> keys = ComputeKeys(count);
+        
+        lock_guard<mutex> lock(_mutex);
+        AddKeys(keys);
+    }
+}
+
+const EllipticCurve& EphemeralKeyPool::GetCurve() const
+{
+    return _curveContext->GetCurve();
+}
+
+size_t EphemeralKeyPool::GetDepth() const
+{
+    return _depth;
+}
+
+size_t EphemeralKeyPool::GetSize() const
+{
+    lock_guard<mutex> lock(_mutex);
+    return _keys.size();
+}
+
+EphemeralKeyPool::Statistics EphemeralKeyPool::GetStatistics() const
+{
+    lock_guard<mutex> lock(_mutex);
+    return _statistics;
+}
+
+vector<EphemeralKeyPool::EphemeralKey> EphemeralKeyPool::ComputeKeys(size_t count) const
+{
+    const EllipticCurve& curve = GetCurve();
+    auto n = make_shared<const BigInteger>(curve.GetBasePointOrder());
+    
+    vector<BigInteger> scalars;
+    scalars.reserve(count);
+    for(size_t i = 0; i < count; i++)
+        scalars.push_back(ChaCha20Drbg::GetThreadInstance().GenerateIntegerBelow(*n));
+    
+    vector<Point> points = curve.MultiplyBasePointWithScalars(scalars);
+    
+    vector<FieldElement> inverses;
+    inverses.reserve(count);
+    for(const BigInteger& scalar : scalars)
+        inverses.push_back(FieldElement(scalar, n));
+    FieldElement::InvertBatch(inverses);
+    
+    vector<EphemeralKey> keys(count);
+    for(size_t i = 0; i < count; i++)
+    {
+        keys[i].k = move(scalars[i]);
+        keys[i].inverseK = inverses[i].GetRawInteger();
+        keys[i].R = move(points[i]);
+    }
+    
+    return keys;
+}
+
+void EphemeralKeyPool::AddKeys(vector<EphemeralKey>& keys)
+{
+    // Keys computed beyond the depth (if Fill() and the refill thread raced) are discarded.
+    for(EphemeralKey& key : keys)
+    {
+        if(_keys.size() >= _depth)
+            break;
+        
+        _keys.push_back(move(key));
+        _statistics.refills++;
+    }
+}
+
+void EphemeralKeyPool::DiscardKeysAfterFork()
+{
+    // A child created by fork() inherits a copy of the keys, which the parent hands out as well. Signing
+    //  with the same k as the parent would reveal the private key, so the child drops them all. It does
+    //  not inherit the refill thread either, so it starts its own.
+    long processId = utilities::GetCurrentProcessId();
+    if(processId == _processId)
+        return;
+    
+    _keys.clear();
+    _processId = processId;
+    _refillThread.detach();
+    _refillThread = thread(&EphemeralKeyPool::RunRefillThread, this);
+}
+
+void EphemeralKeyPool::RunRefillThread()
+{
+    unique_lock<mutex> lock(_mutex);
+    while(true)
+    {
+        _refillNeeded.wait(lock, [this]() { return _isStopping || (_keys.size() < _depth); });
+        if(_isStopping)
+            return;
+        
+        // The keys are computed without holding the lock, so Take() is never blocked by a refill.
+        size_t count = min(REFILL_BATCH_SIZE, _depth - _keys.size());
+        lock.unlock();
+        vector<EphemeralKey> keys = ComputeKeys(count);
+        lock.lock();
+        
+        AddKeys(keys);
+    }
+}
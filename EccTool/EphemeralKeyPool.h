@@ -0,0 +1,135 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__EphemeralKeyPool__
+#define __EccTool__EphemeralKeyPool__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "BigInteger.h"
+#include "CurveContext.h"
+#include "Point.h"
+
+using namespace std;
+
+// A thread-safe pool of precomputed ephemeral keys (k, k^-1 mod n, R = G * k) for one curve, which moves
+//  the scalar multiplication and inversion of EccAlg::Sign() (and the multiplication of G in
+//  EccAlg::Encrypt()) off the critical path: with a key from the pool, signing only takes a few
+//  multiplications mod n.
+//
+// A refill thread keeps the pool at its depth, computing keys in batches whose points share a single
+//  field inversion (see EllipticCurve::MultiplyBasePointWithScalars()) and whose inverses mod n share
+//  another. Each key is handed out exactly once, so a pool may be shared by any number of algs on its
+//  curve, whatever their private keys. When the pool runs dry, keys are computed on the calling thread.
+//  A child process created by fork() discards the keys it inherited before it takes any.
+class EphemeralKeyPool
+{
+public:
+    // A precomputed ephemeral key.
+    struct EphemeralKey
+    {
+        BigInteger k;
+        BigInteger inverseK;
+        Point R;
+    };
+    
+    // Counters of the pool activity since it was created.
+    struct Statistics
+    {
+        // Keys taken from the pool, and keys computed by Take() because the pool was empty.
+        uint64_t hits;
+        uint64_t misses;
+        
+        // Keys computed by the refill thread (or Fill()).
+        uint64_t refills;
+    };
+    
+    // The default depth, and the number of keys the refill thread computes at once.
+    static const size_t DEFAULT_DEPTH;
+    static const size_t REFILL_BATCH_SIZE;
+    
+    // Creates a pool of up to depth keys (at least 1) for the curve of the given context (which must not be
+    //  Curve25519 or edwards25519), and starts its refill thread, which fills the pool right away.
+    explicit EphemeralKeyPool(shared_ptr<const CurveContext> curveContext, size_t depth = DEFAULT_DEPTH);
+    
+    // Stops the refill thread. Keys left in the pool are discarded.
+    ~EphemeralKeyPool();
+    
+    // Removes a key from the pool and returns it, or computes one if the pool is empty.
+    EphemeralKey Take();
+    
+    // Fills the pool up to its depth on the calling thread (for example to warm it up before traffic).
+    void Fill();
+    
+    // Returns the curve the keys are for.
+    const EllipticCurve& GetCurve() const;
+    
+    size_t GetDepth() const;
+    
+    // Returns the number of keys currently in the pool.
+    size_t GetSize() const;
+    
+    Statistics GetStatistics() const;
+    
+private:
+    shared_ptr<const CurveContext> _curveContext;
+    size_t _depth;
+    
+    deque<EphemeralKey> _keys;
+    Statistics _statistics;
+    bool _isStopping;
+    
+    // The process the keys and the refill thread belong to.
+    long _processId;
+    
+    mutable mutex _mutex;
+    
+    // Signaled when keys are taken or the pool is stopping.
+    condition_variable _refillNeeded;
+    
+    thread _refillThread;
+    
+    // Pools own a thread, so they are not copyable.
+    EphemeralKeyPool(const EphemeralKeyPool&);
+    EphemeralKeyPool& operator=(const EphemeralKeyPool&);
+    
+    // Computes the given number of keys, with one field inversion for all points and one inversion mod n
+    //  for all k. Does not touch the pool.
+    vector<EphemeralKey> ComputeKeys(size_t count) const;
+    
+    // Adds computed keys to the pool, up to its depth. The mutex must be held.
+    void AddKeys(vector<EphemeralKey>& keys);
+    
+    // Discards the keys and restarts the refill thread if this is a child process created by fork() since
+    //  the keys were added. The mutex must be held.
+    void DiscardKeysAfterFork();
+    
+    // Runs the refill thread until the pool is stopped.
+    void RunRefillThread();
+};
+
+#endif /* defined(__EccTool__EphemeralKeyPool__) */
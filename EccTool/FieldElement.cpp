@@ -41,7 +41,7 @@ FieldElement FieldElement::MakeElement(const FieldElement& fieldNumber, shared_p
 }
 
 FieldElement::FieldElement(BigInteger number, shared_ptr<const BigInteger> p)
-    : _number(number), _p(p)
+    : _number(number), _p(p), _reduction(ecc::FindFastReduction(*p))
 {
     // Number must be within the finite field. This test is done as a debug
     //  assert since numbers are not selected by users and the issue will appear
@@ -50,7 +50,7 @@ FieldElement::FieldElement(BigInteger number, shared_ptr<const BigInteger> p)
 }
 
 FieldElement::FieldElement(BigInteger number, BigInteger p)
-: _number(number), _p(make_shared<const BigInteger>(p))
+: _number(number), _p(make_shared<const BigInteger>(p)), _reduction(ecc::FindFastReduction(p))
 {
     // Number must be within the finite field. This test is done as a debug
     //  assert since numbers are not selected by users and the issue will appear
@@ -58,6 +58,16 @@ FieldElement::FieldElement(BigInteger number, BigInteger p)
     assert(_number >= 0 && _number < *_p);
 }
 
+FieldElement::FieldElement(BigInteger number, shared_ptr<const BigInteger> p, ecc::FieldReduction reduction)
+    : _number(number), _p(p), _reduction(reduction)
+{
+    // Number must be within the finite field. This test is done as a debug
+    //  assert since numbers are not selected by users and the issue will appear
+    //  with any code issues.
+    assert(_number >= 0 && _number < *_p);
+    assert(_reduction == ecc::FindFastReduction(*_p));
+}
+
 FieldElement& FieldElement::operator+=(const FieldElement& other)
 {
     // Let p define the max of the finite field Fp such that all elemnets of Fp are in the range
@@ -95,9 +105,13 @@ FieldElement& FieldElement::operator*=(const FieldElement& other)
     // Let p define the max of the finite field Fp such that all elements of Fp are in the range
     //  [0, p-1].
     // To ensure that the result of the multiplication operation is an element of Fp, take the quotient
-    //  mod p, which will place the result in the range [0, p-1]
+    //  mod p, which will place the result in the range [0, p-1]. Primes with a special form are reduced
+    //  without the division (see FieldReduction.h).
     _number *= other._number;
-    _number %= *_p;
+    if(_reduction)
+        _reduction(_number);
+    else
+        _number %= *_p;
     
     return *this;
 }
@@ -183,9 +197,138 @@ FieldElement& FieldElement::Invert()
     return *this;
 }
 
+void FieldElement::InvertBatch(vector<FieldElement>& elements)
+{
+    // Inverts with Montgomery's trick (found here: Guide to Elliptic Curve Cryptography, Hankerson,
+    //  Menezes, Vanstone, Algorithm 2.26):
+    //  c[i] = a[0] * a[1] * ... * a[i]
+    //  u = c[n-1]^-1
+    //  Iterate i from n-1 to 1 {
+    //      a[i]^-1 = u * c[i-1]
+    //      u = u * a[i]
+    //  }
+    //  a[0]^-1 = u
+    //
+    // Which replaces n inversions with one inversion and 3(n - 1) multiplications.
+    if(elements.empty())
+        return;
+    
+    vector<FieldElement> products;
+    products.reserve(elements.size());
+    products.push_back(elements[0]);
+    for(size_t i = 1; i < elements.size(); i++)
+        products.push_back(products[i - 1] * elements[i]);
+    
+    FieldElement inverse = products.back().GetInverse();
+    for(size_t i = elements.size() - 1; i > 0; i--)
+    {
+        FieldElement elementInverse = inverse * products[i - 1];
+        inverse *= elements[i];
+        elements[i] = move(elementInverse);
+    }
+    elements[0] = move(inverse);
+}
+
+FieldElement FieldElement::Pow(const BigInteger& exponent) const
+{
+    // Left-to-right square and multiply.
+    FieldElement result(1, _p, _reduction);
+    for(size_t i = exponent.GetBitSize(); i > 0; i--)
+    {
+        result *= result;
+        if(exponent.GetBitAt(i - 1))
+            result *= *this;
+    }
+    
+    return result;
+}
+
+bool FieldElement::TryGetSquareRoot(FieldElement& root) const
+{
+    // Computes the square root with the Tonelli-Shanks algorithm (found here:
+    //  http://en.wikipedia.org/wiki/Tonelli%E2%80%93Shanks_algorithm):
+    //  Write p - 1 = q * 2^s with q odd, and find a non-square z.
+    //  m = s, c = z^q, t = a^q, r = a^((q + 1) / 2)
+    //  while t != 1 {
+    //      find the least i (0 < i < m) with t^(2^i) = 1
+    //      b = c^(2^(m - i - 1))
+    //      m = i, c = b^2, t = t * b^2, r = r * b
+    //  }
+    //  output r
+    //
+    // When p = 3 (mod 4) (s = 1) this reduces to r = a^((p + 1) / 4).
+    if(_number == 0)
+    {
+        root = *this;
+        return true;
+    }
+    
+    BigInteger pMinusOne = *_p - 1;
+    BigInteger q = pMinusOne;
+    unsigned int s = 0;
+    while(!q.GetBitAt(0))
+    {
+        q >>= 1;
+        s++;
+    }
+    
+    // For p = 3 (mod 4) the candidate is checked directly, saving the exponentiation for Euler's criterion.
+    if(s == 1)
+    {
+        BigInteger exponent = *_p + 1;
+        exponent >>= 2;
+        FieldElement candidate = Pow(exponent);
+        if((candidate * candidate) != *this)
+            return false;
+        
+        root = move(candidate);
+        return true;
+    }
+    
+    // Euler's criterion: a is a square if and only if a^((p - 1) / 2) == 1.
+    BigInteger halfOrder = pMinusOne;
+    halfOrder >>= 1;
+    if(Pow(halfOrder) != FieldElement(1, _p, _reduction))
+        return false;
+    
+    FieldElement minusOne(pMinusOne, _p, _reduction);
+    FieldElement z(2, _p, _reduction);
+    while(z.Pow(halfOrder) != minusOne)
+        z += FieldElement(1, _p, _reduction);
+    
+    BigInteger rootExponent = q + 1;
+    rootExponent >>= 1;
+    unsigned int m = s;
+    FieldElement c = z.Pow(q);
+    FieldElement t = Pow(q);
+    FieldElement r = Pow(rootExponent);
+    while(t != FieldElement(1, _p, _reduction))
+    {
+        unsigned int i = 0;
+        FieldElement tSquared = t;
+        while(tSquared != FieldElement(1, _p, _reduction))
+        {
+            tSquared *= tSquared;
+            i++;
+        }
+        
+        FieldElement b = c;
+        for(unsigned int j = 0; j < m - i - 1; j++)
+            b *= b;
+        
+        m = i;
+        c = b * b;
+        t *= c;
+        r *= b;
+    }
+    
+    root = move(r);
+    return true;
+}
+
 FieldElement FieldElement::operator-() const
 {
-    FieldElement result(0, _p);
+    FieldElement result(0, _p, _reduction);
     result -= *this;
     
     return result;
@@ -28,6 +28,7 @@
 #include <memory>
 
 #include "BigInteger.h"
+#include "FieldReduction.h"
 
 using namespace std;
 
@@ -39,6 +40,9 @@ private:
     BigInteger _number;
     shared_ptr<const BigInteger> _p;
     
+    // The fast reduction routine for p, or nullptr if products are reduced by division.
+    ecc::FieldReduction _reduction;
+    
 public:
     // Creates a field element from a big integer and a field p. If the number is not
     // already within p, the number is taken modulo p. Number must be >= 0.
@@ -54,6 +58,11 @@ public:
     // Constructor taking an number in the field and the field itself (by value).
     FieldElement(BigInteger number, const BigInteger p);
     
+    // Constructor taking an number in the field, the field itself and the field's fast reduction routine
+    //  as returned by ecc::FindFastReduction(*p). Code creating many elements of one field (e.g. the curve
+    //  arithmetic) resolves the routine once and passes it here instead of looking it up per element.
+    FieldElement(BigInteger number, shared_ptr<const BigInteger> p, ecc::FieldReduction reduction);
+    
     // Mathematical operations mod _p.
     // Definitions of the below modulo operations were found here: http://tools.ietf.org/search/rfc6090
     FieldElement& operator+=(const FieldElement& other);
@@ -68,6 +77,17 @@ public:
     FieldElement& Invert();
     FieldElement GetInverse() const;
     
+    // Inverts all of the given (non-zero) elements, which must share the same field, with a single
+    //  field inversion.
+    static void InvertBatch(vector<FieldElement>& elements);
+    
+    // Raises this element to the given non-negative power.
+    FieldElement Pow(const BigInteger& exponent) const;
+    
+    // Computes a square root of this element if it has one (the field must be an odd prime).
+    //  Returns false if this element is not a square.
+    bool TryGetSquareRoot(FieldElement& root) const;
+    
     // Comparison Operators specialized for other FieldElements and BigIntegers.
     bool operator==(const FieldElement& other) const;
     bool operator!=(const FieldElement& other) const;
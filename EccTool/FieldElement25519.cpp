@@ -0,0 +1,446 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <stdexcept>
+#include "FieldElement25519.h"
+
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    const uint64_t LIMB_MASK = (uint64_t(1) << 51) - 1;
+    
+    // The sums of limb products need 128 bits. GCC and Clang provide a 128-bit integer type on 64-bit
+    //  targets, elsewhere the two halves are kept separately.
+#if defined(__SIZEOF_INT128__)
+    typedef unsigned __int128 Wide;
+    
+    inline Wide MultiplyWide(uint64_t a, uint64_t b)
+    {
+        return static_cast<Wide>(a) * b;
+    }
+    
+    inline void AddWide(Wide& sum, Wide value)
+    {
+        sum += value;
+    }
+    
+    inline Wide ToWide(uint64_t value)
+    {
+        return value;
+    }
+    
+    inline uint64_t GetLimb(Wide value)
+    {
+        return static_cast<uint64_t>(value) & LIMB_MASK;
+    }
+    
+    inline uint64_t GetCarry(Wide value)
+    {
+        return static_cast<uint64_t>(value >> 51);
+    }
+#else
+    struct Wide
+    {
+        uint64_t low;
+        uint64_t high;
+    };
+    
+    inline Wide MultiplyWide(uint64_t a, uint64_t b)
+    {
+        Wide product;
+#if defined(_MSC_VER) && defined(_M_X64)
+        product.low = _umul128(a, b, &product.high);
+#else
+        uint64_t lowLow = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+        uint64_t lowHigh = (a & 0xFFFFFFFF) * (b >> 32);
+        uint64_t highLow = (a >> 32) * (b & 0xFFFFFFFF);
+        uint64_t highHigh = (a >> 32) * (b >> 32);
+        uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+        product.low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+        product.high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+        return product;
+    }
+    
+    inline void AddWide(Wide& sum, Wide value)
+    {
+        sum.low += value.low;
+        sum.high += value.high + ((sum.low < value.low) ? 1 : 0);
+    }
+    
+    inline Wide ToWide(uint64_t value)
+    {
+        Wide wide = { value, 0 };
+        return wide;
+    }
+    
+    inline uint64_t GetLimb(Wide value)
+    {
+        return value.low & LIMB_MASK;
+    }
+    
+    inline uint64_t GetCarry(Wide value)
+    {
+        return (value.low >> 51) | (value.high << 13);
+    }
+#endif
+    
+    // Reduces the five 128-bit column sums of a product into limbs. The sums are below 2^115 for limbs
+    //  below 2^54, so the final carry times 19 still fits in a word.
+    void ReduceColumns(Wide columns[5], uint64_t limbs[5])
+    {
+        for(int i = 0; i < 4; i++)
+        {
+            limbs[i] = GetLimb(columns[i]);
+            AddWide(columns[i + 1], ToWide(GetCarry(columns[i])));
+        }
+        
+        limbs[4] = GetLimb(columns[4]);
+        limbs[0] += GetCarry(columns[4]) * 19;
+        limbs[1] += limbs[0] >> 51;
+        limbs[0] &= LIMB_MASK;
+    }
+    
+    // Raises element to the power 2^count and multiplies it by factor.
+    FieldElement25519 SquareThenMultiply(FieldElement25519 element, int count, const FieldElement25519& factor)
+    {
+        for(int i = 0; i < count; i++)
+            element.Square();
+        
+        return element *= factor;
+    }
+}
+
+FieldElement25519 FieldElement25519::FromBytes(const vector<uint8_t>& bytes)
+{
+    if(bytes.size() != BYTE_SIZE)
+        throw invalid_argument("A Curve25519 field element must be 32 bytes.");
+    
+    uint64_t words[4];
+    for(int i = 0; i < 4; i++)
+    {
+        words[i] = 0;
+        for(int j = 7; j >= 0; --j)
+            words[i] = (words[i] << 8) | bytes[(8 * i) + j];
+    }
+    
+    // Split the 255 low bits into 51-bit limbs (the top bit is dropped by the mask of the last limb).
+    FieldElement25519 element;
+    element._limbs[0] = words[0] & LIMB_MASK;
+    element._limbs[1] = ((words[0] >> 51) | (words[1] << 13)) & LIMB_MASK;
+    element._limbs[2] = ((words[1] >> 38) | (words[2] << 26)) & LIMB_MASK;
+    element._limbs[3] = ((words[2] >> 25) | (words[3] << 39)) & LIMB_MASK;
+    element._limbs[4] = (words[3] >> 12) & LIMB_MASK;
+    
+    return element;
+}
+
+FieldElement25519::FieldElement25519(uint32_t value)
+{
+    _limbs[0] = value;
+    _limbs[1] = 0;
+    _limbs[2] = 0;
+    _limbs[3] = 0;
+    _limbs[4] = 0;
+}
+
+void FieldElement25519::Carry()
+{
+    for(int i = 0; i < 4; i++)
+    {
+        _limbs[i + 1] += _limbs[i] >> 51;
+        _limbs[i] &= LIMB_MASK;
+    }
+    
+    _limbs[0] += (_limbs[4] >> 51) * 19;
+    _limbs[4] &= LIMB_MASK;
+}
+
+FieldElement25519& FieldElement25519::operator+=(const FieldElement25519& other)
+{
+    for(int i = 0; i < 5; i++)
+        _limbs[i] += other._limbs[i];
+    
+    Carry();
+    return *this;
+}
+
+FieldElement25519& FieldElement25519::operator-=(const FieldElement25519& other)
+{
+    // Add 4p first so that no limb goes negative (the limbs of other are below 2^52).
+    static const uint64_t FOUR_P_LOW_LIMB = (uint64_t(1) << 53) - 76;
+    static const uint64_t FOUR_P_LIMB = (uint64_t(1) << 53) - 4;
+    
+    _limbs[0] += FOUR_P_LOW_LIMB - other._limbs[0];
+    for(int i = 1; i < 5; i++)
+        _limbs[i] += FOUR_P_LIMB - other._limbs[i];
+    
+    Carry();
+    return *this;
+}
+
+FieldElement25519& FieldElement25519::operator*=(const FieldElement25519& other)
+{
+    const uint64_t* a = _limbs;
+    const uint64_t* b = other._limbs;
+    
+    // The products of limbs i and j with i + j >= 5 are worth 2^255 = 19 times less (mod p).
+    uint64_t b1 = b[1] * 19;
+    uint64_t b2 = b[2] * 19;
+    uint64_t b3 = b[3] * 19;
+    uint64_t b4 = b[4] * 19;
+    
+    Wide columns[5];
+    columns[0] = MultiplyWide(a[0], b[0]);
+    AddWide(columns[0], MultiplyWide(a[1], b4));
+    AddWide(columns[0], MultiplyWide(a[2], b3));
+    AddWide(columns[0], MultiplyWide(a[3], b2));
+    AddWide(columns[0], MultiplyWide(a[4], b1));
+    
+    columns[1] = MultiplyWide(a[0], b[1]);
+    AddWide(columns[1], MultiplyWide(a[1], b[0]));
+    AddWide(columns[1], MultiplyWide(a[2], b4));
+    AddWide(columns[1], MultiplyWide(a[3], b3));
+    AddWide(columns[1], MultiplyWide(a[4], b2));
+    
+    columns[2] = MultiplyWide(a[0], b[2]);
+    AddWide(columns[2], MultiplyWide(a[1], b[1]));
+    AddWide(columns[2], MultiplyWide(a[2], b[0]));
+    AddWide(columns[2], MultiplyWide(a[3], b4));
+    AddWide(columns[2], MultiplyWide(a[4], b3));
+    
+    columns[3] = MultiplyWide(a[0], b[3]);
+    AddWide(columns[3], MultiplyWide(a[1], b[2]));
+    AddWide(columns[3], MultiplyWide(a[2], b[1]));
+    AddWide(columns[3], MultiplyWide(a[3], b[0]));
+    AddWide(columns[3], MultiplyWide(a[4], b4));
+    
+    columns[4] = MultiplyWide(a[0], b[4]);
+    AddWide(columns[4], MultiplyWide(a[1], b[3]));
+    AddWide(columns[4], MultiplyWide(a[2], b[2]));
+    AddWide(columns[4], MultiplyWide(a[3], b[1]));
+    AddWide(columns[4], MultiplyWide(a[4], b[0]));
+    
+    ReduceColumns(columns, _limbs);
+    return *this;
+}
+
+FieldElement25519& FieldElement25519::MultiplySmall(uint32_t value)
+{
+    Wide columns[5];
+    for(int i = 0; i < 5; i++)
+        columns[i] = MultiplyWide(_limbs[i], value);
+    
+    ReduceColumns(columns, _limbs);
+    return *this;
+}
+
+FieldElement25519& FieldElement25519::Square()
+{
+    const uint64_t* a = _limbs;
+    uint64_t a0Doubled = a[0] * 2;
+    uint64_t a1Doubled = a[1] * 2;
+    uint64_t a3Times19 = a[3] * 19;
+    uint64_t a3Times38 = a[3] * 38;
+    uint64_t a4Times19 = a[4] * 19;
+    uint64_t a4Times38 = a[4] * 38;
+    
+    Wide columns[5];
+    columns[0] = MultiplyWide(a[0], a[0]);
+    AddWide(columns[0], MultiplyWide(a[1], a4Times38));
+    AddWide(columns[0], MultiplyWide(a[2], a3Times38));
+    
+    columns[1] = MultiplyWide(a0Doubled, a[1]);
+    AddWide(columns[1], MultiplyWide(a[2], a4Times38));
+    AddWide(columns[1], MultiplyWide(a[3], a3Times19));
+    
+    columns[2] = MultiplyWide(a0Doubled, a[2]);
+    AddWide(columns[2], MultiplyWide(a[1], a[1]));
+    AddWide(columns[2], MultiplyWide(a[3], a4Times38));
+    
+    columns[3] = MultiplyWide(a0Doubled, a[3]);
+    AddWide(columns[3], MultiplyWide(a1Doubled, a[2]));
+    AddWide(columns[3], MultiplyWide(a[4], a4Times19));
+    
+    columns[4] = MultiplyWide(a0Doubled, a[4]);
+    AddWide(columns[4], MultiplyWide(a1Doubled, a[3]));
+    AddWide(columns[4], MultiplyWide(a[2], a[2]));
+    
+    ReduceColumns(columns, _limbs);
+    return *this;
+}
+
+void FieldElement25519::RaiseToPower2_250Minus1(FieldElement25519& z2_250_0, FieldElement25519& z11) const
+{
+    // Uses the addition chain of the Curve25519 reference implementation. Each step is named after the
+    //  exponent it reaches, e.g. z2_50_0 = z^(2^50 - 2^0).
+    const FieldElement25519& z = *this;
+    
+    FieldElement25519 z2 = z;
+    z2.Square();
+    
+    FieldElement25519 z9 = z2;
+    z9.Square().Square();
+    z9 *= z;
+    
+    z11 = z9 * z2;
+    
+    FieldElement25519 z2_5_0 = z11;
+    z2_5_0.Square();
+    z2_5_0 *= z9;
+    
+    FieldElement25519 z2_10_0 = SquareThenMultiply(z2_5_0, 5, z2_5_0);
+    FieldElement25519 z2_20_0 = SquareThenMultiply(z2_10_0, 10, z2_10_0);
+    FieldElement25519 z2_40_0 = SquareThenMultiply(z2_20_0, 20, z2_20_0);
+    FieldElement25519 z2_50_0 = SquareThenMultiply(z2_40_0, 10, z2_10_0);
+    FieldElement25519 z2_100_0 = SquareThenMultiply(z2_50_0, 50, z2_50_0);
+    FieldElement25519 z2_200_0 = SquareThenMultiply(z2_100_0, 100, z2_100_0);
+    z2_250_0 = SquareThenMultiply(z2_200_0, 50, z2_50_0);
+}
+
+FieldElement25519 FieldElement25519::GetInverse() const
+{
+    // Computes this^(p - 2) = this^(2^255 - 21) with 254 squarings and 11 multiplications.
+    FieldElement25519 z2_250_0, z11;
+    RaiseToPower2_250Minus1(z2_250_0, z11);
+    
+    return SquareThenMultiply(z2_250_0, 5, z11);
+}
+
+FieldElement25519 FieldElement25519::GetPowerPMinus5Over8() const
+{
+    // (p - 5) / 8 = 2^252 - 3 = (2^250 - 1) * 4 + 1.
+    FieldElement25519 z2_250_0, z11;
+    RaiseToPower2_250Minus1(z2_250_0, z11);
+    
+    return SquareThenMultiply(z2_250_0, 2, *this);
+}
+
+void FieldElement25519::ConditionalSwap(FieldElement25519& a, FieldElement25519& b, uint64_t swap)
+{
+    uint64_t mask = 0 - swap;
+    for(int i = 0; i < 5; i++)
+    {
+        uint64_t difference = mask & (a._limbs[i] ^ b._limbs[i]);
+        a._limbs[i] ^= difference;
+        b._limbs[i] ^= difference;
+    }
+}
+
+void FieldElement25519::ConditionalMove(const FieldElement25519& source, uint64_t move)
+{
+    uint64_t mask = 0 - move;
+    for(int i = 0; i < 5; i++)
+        _limbs[i] ^= mask & (_limbs[i] ^ source._limbs[i]);
+}
+
+vector<uint8_t> FieldElement25519::GetBytes() const
+{
+    // Carry twice so that every limb is below 2^51 and the number is below 2^255 (but possibly >= p).
+    FieldElement25519 reduced = *this;
+    reduced.Carry();
+    reduced.Carry();
+    uint64_t* h = reduced._limbs;
+    
+    // The number is >= p exactly if adding 19 carries out of bit 255. Subtract p by adding 19 times that
+    //  carry and dropping bit 255.
+    uint64_t q = (h[0] + 19) >> 51;
+    for(int i = 1; i < 5; i++)
+        q = (h[i] + q) >> 51;
+    
+    h[0] += 19 * q;
+    for(int i = 0; i < 4; i++)
+    {
+        h[i + 1] += h[i] >> 51;
+        h[i] &= LIMB_MASK;
+    }
+    h[4] &= LIMB_MASK;
+    
+    uint64_t words[4] = {
+        h[0] | (h[1] << 51),
+        (h[1] >> 13) | (h[2] << 38),
+        (h[2] >> 26) | (h[3] << 25),
+        (h[3] >> 39) | (h[4] << 12)
+    };
+    
+    vector<uint8_t> bytes(BYTE_SIZE);
+    for(size_t i = 0; i < BYTE_SIZE; i++)
+        bytes[i] = static_cast<uint8_t>(words[i / 8] >> (8 * (i % 8)));
+    
+    return bytes;
+}
+
+bool FieldElement25519::IsZero() const
+{
+    vector<uint8_t> bytes = GetBytes();
+    uint8_t bits = 0;
+    for(size_t i = 0; i < BYTE_SIZE; i++)
+        bits |= bytes[i];
+    
+    return (bits == 0);
+}
+
+bool FieldElement25519::IsNegative() const
+{
+    return ((GetBytes()[0] & 1) != 0);
+}
+
+FieldElement25519 FieldElement25519::operator-() const
+{
+    FieldElement25519 negated;
+    negated -= *this;
+    return negated;
+}
+
+bool FieldElement25519::operator==(const FieldElement25519& other) const
+{
+    return (GetBytes() == other.GetBytes());
+}
+
+bool FieldElement25519::operator!=(const FieldElement25519& other) const
+{
+    return !(*this == other);
+}
+
+FieldElement25519 operator+(FieldElement25519 lhs, const FieldElement25519& rhs)
+{
+    lhs += rhs;
+    return lhs;
+}
+
+FieldElement25519 operator-(FieldElement25519 lhs, const FieldElement25519& rhs)
+{
+    lhs -= rhs;
+    return lhs;
+}
+
+FieldElement25519 operator*(FieldElement25519 lhs, const FieldElement25519& rhs)
+{
+    lhs *= rhs;
+    return lhs;
+}
@@ -0,0 +1,111 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__FieldElement25519__
+#define __EccTool__FieldElement25519__
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// FieldElement25519 represents a number in the field of the prime p = 2^255 - 19 of Curve25519.
+//
+// Unlike FieldElement, which works for any prime through BigInteger, the number is kept in radix 2^51 as
+//  five 64-bit limbs (least significant first), so that a product needs 25 word multiplications and its
+//  reduction only multiplies the carries by 19 (since 2^255 = 19 mod p). Limbs may be a few bits longer
+//  than 51 between operations. GetBytes() returns the fully reduced number.
+class FieldElement25519
+{
+private:
+    uint64_t _limbs[5];
+    
+    // Propagates the carries of the limbs, leaving each below 2^51 (plus a small carry in the lowest).
+    void Carry();
+    
+    // Computes this^(2^250 - 1), the common part of the exponents used for inversion and square roots,
+    //  along with this^11 which both of them need too.
+    void RaiseToPower2_250Minus1(FieldElement25519& z2_250_0, FieldElement25519& z11) const;
+    
+public:
+    // The size of a serialized element.
+    static const size_t BYTE_SIZE = 32;
+    
+    // Creates an element from 32 little-endian bytes. The top bit is ignored, and numbers from p to
+    //  2^255 - 1 are accepted and reduced (as required for X25519 by RFC 7748, Section 5).
+    static FieldElement25519 FromBytes(const vector<uint8_t>& bytes);
+    
+    // Creates an element with a small value.
+    explicit FieldElement25519(uint32_t value = 0);
+    
+    // Mathematical operations mod p.
+    FieldElement25519& operator+=(const FieldElement25519& other);
+    FieldElement25519& operator-=(const FieldElement25519& other);
+    FieldElement25519& operator*=(const FieldElement25519& other);
+    
+    // Multiplies by a small constant.
+    FieldElement25519& MultiplySmall(uint32_t value);
+    
+    // Squares this element, which takes 15 word multiplications instead of 25.
+    FieldElement25519& Square();
+    
+    // Returns the multiplicative inverse of this element (zero for zero), computed as this^(p - 2).
+    FieldElement25519 GetInverse() const;
+    
+    // Returns this^((p - 5) / 8), from which square roots are computed since p = 5 mod 8 (RFC 8032,
+    //  Section 5.1.3).
+    FieldElement25519 GetPowerPMinus5Over8() const;
+    
+    // Swaps the two elements if swap is 1 and leaves them if it is 0, in constant time.
+    static void ConditionalSwap(FieldElement25519& a, FieldElement25519& b, uint64_t swap);
+    
+    // Replaces this element by source if move is 1 and leaves it if it is 0, in constant time.
+    void ConditionalMove(const FieldElement25519& source, uint64_t move);
+    
+    // Returns the fully reduced element as 32 little-endian bytes.
+    vector<uint8_t> GetBytes() const;
+    
+    // Returns true if the reduced element is zero.
+    bool IsZero() const;
+    
+    // Returns true if the reduced element is odd, which is how Ed25519 encodes the sign of x.
+    bool IsNegative() const;
+    
+    // Returns p minus this element.
+    FieldElement25519 operator-() const;
+    
+    // Comparison operators (of the reduced numbers).
+    bool operator==(const FieldElement25519& other) const;
+    bool operator!=(const FieldElement25519& other) const;
+};
+
+// Binary '+' operator implemented as a free function by convention.
+FieldElement25519 operator+(FieldElement25519 lhs, const FieldElement25519& rhs);
+
+// Binary '-' operator implemented as a free function by convention.
+FieldElement25519 operator-(FieldElement25519 lhs, const FieldElement25519& rhs);
+
+// Binary '*' operator implemented as a free function by convention.
+FieldElement25519 operator*(FieldElement25519 lhs, const FieldElement25519& rhs);
+
+#endif /* defined(__EccTool__FieldElement25519__) */
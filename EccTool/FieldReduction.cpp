@@ -0,0 +1,216 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "FieldReduction.h"
+
+using namespace std;
+using namespace ecc;
+
+// The primes of the NIST curves are generalized Mersenne numbers (Solinas primes), which allows
+//  reducing a product without any division (found here: FIPS 186-4, Appendix D.2, and Guide to
+//  Elliptic Curve Cryptography, Hankerson, Menezes, Vanstone, Section 2.2.6).
+//
+// For P-224, P-256 and P-384 the product c is split into 32-bit words c[0] (least significant) to
+//  c[2k-1], and c mod p is congruent to a small signed sum of k-word numbers whose words are picked
+//  from c. Each such number is described below as a row of word indexes, most significant first,
+//  where -1 is a zero word.
+namespace
+{
+    const size_t MAX_WORD_COUNT = 12;
+    
+    struct ReductionRow
+    {
+        int coefficient;
+        int words[MAX_WORD_COUNT];
+    };
+    
+    struct WordReduction
+    {
+        size_t wordCount;
+        size_t rowCount;
+        const ReductionRow* rows;
+    };
+    
+    // p = 2^224 - 2^96 + 1
+    //  r = T + S1 + S2 - D1 - D2
+    const ReductionRow P224_ROWS[] = {
+        { 1, { 6, 5, 4, 3, 2, 1, 0 } },
+        { 1, { 10, 9, 8, 7, -1, -1, -1 } },
+        { 1, { -1, 13, 12, 11, -1, -1, -1 } },
+        { -1, { 13, 12, 11, 10, 9, 8, 7 } },
+        { -1, { -1, -1, -1, -1, 13, 12, 11 } }
+    };
+    
+    // p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+    //  r = T + 2 * S1 + 2 * S2 + S3 + S4 - D1 - D2 - D3 - D4
+    const ReductionRow P256_ROWS[] = {
+        { 1, { 7, 6, 5, 4, 3, 2, 1, 0 } },
+        { 2, { 15, 14, 13, 12, 11, -1, -1, -1 } },
+        { 2, { -1, 15, 14, 13, 12, -1, -1, -1 } },
+        { 1, { 15, 14, -1, -1, -1, 10, 9, 8 } },
+        { 1, { 8, 13, 15, 14, 13, 11, 10, 9 } },
+        { -1, { 10, 8, -1, -1, -1, 13, 12, 11 } },
+        { -1, { 11, 9, -1, -1, 15, 14, 13, 12 } },
+        { -1, { 12, -1, 10, 9, 8, 15, 14, 13 } },
+        { -1, { 13, -1, 11, 10, 9, -1, 15, 14 } }
+    };
+    
+    // p = 2^384 - 2^128 - 2^96 + 2^32 - 1
+    //  r = T + 2 * S1 + S2 + S3 + S4 + S5 + S6 - D1 - D2 - D3
+    const ReductionRow P384_ROWS[] = {
+        { 1, { 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 } },
+        { 2, { -1, -1, -1, -1, -1, 23, 22, 21, -1, -1, -1, -1 } },
+        { 1, { 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12 } },
+        { 1, { 20, 19, 18, 17, 16, 15, 14, 13, 12, 23, 22, 21 } },
+        { 1, { 19, 18, 17, 16, 15, 14, 13, 12, 20, -1, 23, -1 } },
+        { 1, { -1, -1, -1, -1, 23, 22, 21, 20, -1, -1, -1, -1 } },
+        { 1, { -1, -1, -1, -1, -1, -1, 23, 22, 21, -1, -1, 20 } },
+        { -1, { 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 23 } },
+        { -1, { -1, -1, -1, -1, -1, -1, -1, 23, 22, 21, 20, -1 } },
+        { -1, { -1, -1, -1, -1, -1, -1, -1, 23, 23, -1, -1, -1 } }
+    };
+    
+    const WordReduction P224_REDUCTION = { 7, sizeof(P224_ROWS) / sizeof(P224_ROWS[0]), P224_ROWS };
+    const WordReduction P256_REDUCTION = { 8, sizeof(P256_ROWS) / sizeof(P256_ROWS[0]), P256_ROWS };
+    const WordReduction P384_REDUCTION = { 12, sizeof(P384_ROWS) / sizeof(P384_ROWS[0]), P384_ROWS };
+    
+    const BigInteger P224("FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF 00000000 00000000 00000001");
+    const BigInteger P256("FFFFFFFF 00000001 00000000 00000000 00000000 FFFFFFFF FFFFFFFF FFFFFFFF");
+    const BigInteger P384("FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE FFFFFFFF 00000000 00000000 FFFFFFFF");
+    const BigInteger P521("01FF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF");
+    
+    void ReduceWithWordTable(BigInteger& number, const WordReduction& reduction, const BigInteger& p)
+    {
+        // Read the 32-bit words of the number from its big endian bytes.
+        const vector<uint8_t>& bytes = number.GetMagnitudeBytes();
+        uint32_t c[2 * MAX_WORD_COUNT] = {};
+        for(size_t i = 0; (i < bytes.size()) && (i < 8 * reduction.wordCount); i++)
+            c[i / 4] |= static_cast<uint32_t>(bytes[bytes.size() - 1 - i]) << (8 * (i % 4));
+        
+        // Sum up the rows word by word, then propagate the (signed) carries. Every column is a sum of
+        //  at most ten 32-bit words, which comfortably fits in 64 bits.
+        int64_t columns[MAX_WORD_COUNT] = {};
+        for(size_t r = 0; r < reduction.rowCount; r++)
+        {
+            const ReductionRow& row = reduction.rows[r];
+            for(size_t w = 0; w < reduction.wordCount; w++)
+            {
+                int index = row.words[reduction.wordCount - 1 - w];
+                if(index >= 0)
+                    columns[w] += row.coefficient * static_cast<int64_t>(c[index]);
+            }
+        }
+        
+        int64_t carry = 0;
+        vector<uint8_t> resultBytes(4 * reduction.wordCount);
+        for(size_t w = 0; w < reduction.wordCount; w++)
+        {
+            int64_t column = columns[w] + carry;
+            uint32_t word = static_cast<uint32_t>(column);
+            carry = (column - word) / (static_cast<int64_t>(1) << 32);
+            
+            for(size_t b = 0; b < 4; b++)
+                resultBytes[resultBytes.size() - 1 - (4 * w) - b] = static_cast<uint8_t>(word >> (8 * b));
+        }
+        
+        // The remaining carry is small, so only a few additions or subtractions of p are needed.
+        BigInteger result(move(resultBytes));
+        if(carry != 0)
+        {
+            BigInteger high(carry);
+            high <<= static_cast<int>(32 * reduction.wordCount);
+            result += high;
+        }
+        
+        while(result < 0)
+            result += p;
+        while(result >= p)
+            result -= p;
+        
+        swap(number, result);
+    }
+    
+    void ReduceP224(BigInteger& number)
+    {
+        ReduceWithWordTable(number, P224_REDUCTION, P224);
+    }
+    
+    void ReduceP256(BigInteger& number)
+    {
+        ReduceWithWordTable(number, P256_REDUCTION, P256);
+    }
+    
+    void ReduceP384(BigInteger& number)
+    {
+        ReduceWithWordTable(number, P384_REDUCTION, P384);
+    }
+    
+    void ReduceP521(BigInteger& number)
+    {
+        // p = 2^521 - 1, so c = c1 * 2^521 + c0 is congruent to c1 + c0.
+        const size_t lowByteCount = 66;
+        const vector<uint8_t>& bytes = number.GetMagnitudeBytes();
+        if(bytes.size() < lowByteCount)
+            return;
+        
+        vector<uint8_t> lowBytes(bytes.end() - lowByteCount, bytes.end());
+        lowBytes[0] &= 0x01;
+        
+        BigInteger result(move(lowBytes));
+        number >>= 521;
+        result += number;
+        
+        while(result >= P521)
+            result -= P521;
+        
+        swap(number, result);
+    }
+    
+    // The byte sizes are kept as constants so that lookups for other primes never touch the BigIntegers
+    //  (FieldElements are also created during static initialization).
+    struct FastReductionEntry
+    {
+        size_t byteSize;
+        const BigInteger* p;
+        FieldReduction reduction;
+    };
+    
+    const FastReductionEntry FAST_REDUCTIONS[] = {
+        { 28, &P224, ReduceP224 },
+        { 32, &P256, ReduceP256 },
+        { 48, &P384, ReduceP384 },
+        { 66, &P521, ReduceP521 }
+    };
+}
+
+FieldReduction ecc::FindFastReduction(const BigInteger& p)
+{
+    // Compare the (cheap) byte sizes first, most lookups are for other primes.
+    for(const FastReductionEntry& entry : FAST_REDUCTIONS)
+    {
+        if(entry.byteSize == p.GetMagnitudeByteSize() && *entry.p == p)
+            return entry.reduction;
+    }
+    
+    return nullptr;
+}
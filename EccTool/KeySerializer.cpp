@@ -24,7 +24,7 @@
 #include "KeySerializer.h"
 #include "Utilities.h"
 #include "EccAlg.h"
-#include "DefinedCurveDomainParameters.h"
+#include "CurveContext.h"
 #include "EllipticCurve.h"
 
 #include <sstream>
@@ -66,8 +66,8 @@ EccAlg KeySerializer::ParseKeys(const string& keys) const
     string curveName = keys.substr(startingIndex, elementDelimiter);
     startingIndex = elementDelimiter + 1;
 
-    EllipticCurve curve(ecc::GetCurveByName(curveName));
-    EccAlg createdAlg(curve);
+    // The curve is shared with every other key on it, so it is only built and validated once.
+    EccAlg createdAlg(CurveContext::GetByName(curveName));
     
     // Formate of keys: [<private>:<publicX>:<publicY>]
     if(keys[startingIndex] != '[' || keys[keys.size() - 1] != ']')
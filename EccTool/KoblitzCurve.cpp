@@ -0,0 +1,504 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <stdexcept>
+#include "KoblitzCurve.h"
+
+using namespace std;
+using namespace ecc;
+
+namespace
+{
+    shared_ptr<const BinaryField> MakeField(const string& polynomial)
+    {
+        return make_shared<const BinaryField>(BigInteger(polynomial));
+    }
+    
+    // Parses an uncompressed point 04 || x || y with coordinates of the byte size of the field.
+    BinaryPoint ParseUncompressedPoint(const string& serializedPoint, shared_ptr<const BinaryField> field)
+    {
+        vector<uint8_t> bytes = BigInteger(serializedPoint).GetMagnitudeBytes();
+        size_t coordinateSize = (field->GetDegree() + 7) / 8;
+        if((bytes.size() != (2 * coordinateSize) + 1) || (bytes[0] != 0x04))
+            throw invalid_argument("Invalid uncompressed binary curve point.");
+        
+        BigInteger x(vector<uint8_t>(bytes.begin() + 1, bytes.begin() + 1 + coordinateSize));
+        BigInteger y(vector<uint8_t>(bytes.begin() + 1 + coordinateSize, bytes.end()));
+        
+        return BinaryPoint(BinaryFieldElement(x, field), BinaryFieldElement(y, field));
+    }
+    
+    // Returns floor(numerator / divisor) for a positive divisor (BigInteger division truncates).
+    BigInteger FloorDivide(const BigInteger& numerator, const BigInteger& divisor)
+    {
+        if(numerator >= 0)
+            return numerator / divisor;
+        
+        return -((-numerator + divisor - 1) / divisor);
+    }
+    
+    // Returns the number modulo 4 in the range [0, 3].
+    int Mod4(const BigInteger& number)
+    {
+        int lowBits = (number.GetBitAt(1) ? 2 : 0) + (number.GetBitAt(0) ? 1 : 0);
+        if(number < 0)
+            lowBits = (4 - lowBits) % 4;
+        
+        return lowBits;
+    }
+}
+
+// BinaryPoint
+
+BinaryPoint BinaryPoint::MakePointAtInfinity(shared_ptr<const BinaryField> field)
+{
+    BinaryPoint point(BinaryFieldElement::MakeZero(field), BinaryFieldElement::MakeZero(field));
+    point._isPointAtInfinity = true;
+    
+    return point;
+}
+
+BinaryPoint::BinaryPoint(BinaryFieldElement x, BinaryFieldElement y)
+    : _isPointAtInfinity(false), x(move(x)), y(move(y))
+{
+}
+
+bool BinaryPoint::operator==(const BinaryPoint& other) const
+{
+    if(_isPointAtInfinity || other._isPointAtInfinity)
+        return (_isPointAtInfinity == other._isPointAtInfinity);
+    
+    return (x == other.x) && (y == other.y);
+}
+
+bool BinaryPoint::operator!=(const BinaryPoint& other) const
+{
+    return !(*this == other);
+}
+
+bool BinaryPoint::IsPointAtInfinity() const
+{
+    return _isPointAtInfinity;
+}
+
+vector<uint8_t> BinaryPoint::Serialize() const
+{
+    if(_isPointAtInfinity)
+        throw invalid_argument("The point at infinity can't be serialized.");
+    
+    vector<uint8_t> serialized(1, 0x04);
+    vector<uint8_t> xBytes = x.GetBytes();
+    vector<uint8_t> yBytes = y.GetBytes();
+    serialized.insert(serialized.end(), xBytes.begin(), xBytes.end());
+    serialized.insert(serialized.end(), yBytes.begin(), yBytes.end());
+    
+    return serialized;
+}
+
+// KoblitzCurve
+
+KoblitzCurve::KoblitzCurve(const BinaryDomainParameters& params)
+    : _name(params.name),
+      _field(MakeField(params.f)),
+      _a(BigInteger(params.a), _field),
+      _b(BigInteger(params.b), _field),
+      _G(ParseUncompressedPoint(params.G, _field)),
+      _n(params.n),
+      _h(params.h),
+      _mu(1)
+{
+    bool aIsZero = _a.IsZero();
+    if((!aIsZero && (_a != BinaryFieldElement::MakeOne(_field))) || (_b != BinaryFieldElement::MakeOne(_field)))
+        throw invalid_argument("The curve is not a Koblitz curve.");
+    
+    if(!IsPointOnCurve(_G))
+        throw invalid_argument("The base point is not on the curve.");
+    
+    _mu = aIsZero ? -1 : 1;
+    
+    // Sum delta = 1 + tau + ... + tau^(m-1) in Z[tau], using tau * (u + v * tau) = -2v + (u + mu * v) * tau.
+    BigInteger u(1);
+    BigInteger v(0);
+    for(size_t i = 0; i < _field->GetDegree(); i++)
+    {
+        _d0 += u;
+        _d1 += v;
+        
+        BigInteger nextU = BigInteger(-2) * v;
+        v = (_mu == 1) ? (u + v) : (u - v);
+        u = move(nextU);
+    }
+    
+    // The conjugate of tau is mu - tau, so the conjugate of delta is (d0 + mu * d1) - d1 * tau.
+    _s0 = (_mu == 1) ? (_d0 + _d1) : (_d0 - _d1);
+    _s1 = -_d1;
+    
+    // delta * conjugate(delta) = N(delta) = d0^2 + mu * d0 * d1 + 2 * d1^2 must be the order of G, as
+    //  #E = N(tau^m - 1) = N(tau - 1) * N(delta) and N(tau - 1) = 3 - mu is the cofactor.
+    BigInteger norm = (_d0 * _s0) - (BigInteger(2) * _d1 * _s1);
+    if((norm != _n) || (_h != BigInteger(3 - _mu)))
+        throw invalid_argument("The order of the base point doesn't match the curve.");
+}
+
+const string& KoblitzCurve::GetName() const
+{
+    return _name;
+}
+
+const shared_ptr<const BinaryField>& KoblitzCurve::GetField() const
+{
+    return _field;
+}
+
+const BinaryPoint& KoblitzCurve::GetBasePoint() const
+{
+    return _G;
+}
+
+const BigInteger& KoblitzCurve::GetOrder() const
+{
+    return _n;
+}
+
+BinaryPoint KoblitzCurve::MakePoint(const BigInteger& x, const BigInteger& y) const
+{
+    BinaryPoint point(BinaryFieldElement(x, _field), BinaryFieldElement(y, _field));
+    if(!IsPointOnCurve(point))
+        throw invalid_argument("The point is not on the curve.");
+    
+    return point;
+}
+
+BinaryPoint KoblitzCurve::ParsePoint(const vector<uint8_t>& serialized) const
+{
+    // 04 || x || y
+    size_t coordinateSize = BinaryFieldElement::MakeZero(_field).GetByteSize();
+    if((serialized.size() != 1 + (2 * coordinateSize)) || (serialized[0] != 0x04))
+        throw invalid_argument("Malformed binary curve point.");
+    
+    BigInteger x(vector<uint8_t>(serialized.begin() + 1, serialized.begin() + 1 + coordinateSize));
+    BigInteger y(vector<uint8_t>(serialized.begin() + 1 + coordinateSize, serialized.end()));
+    if((x.GetBitSize() > _field->GetDegree()) || (y.GetBitSize() > _field->GetDegree()))
+        throw invalid_argument("Malformed binary curve point.");
+    
+    return MakePoint(x, y);
+}
+
+bool KoblitzCurve::IsPointOnCurve(const BinaryPoint& point) const
+{
+    if(point.IsPointAtInfinity())
+        return true;
+    
+    // y^2 + xy = x^3 + ax^2 + b
+    const BinaryFieldElement& x = point.x;
+    const BinaryFieldElement& y = point.y;
+    BinaryFieldElement xSquared = x.GetSquare();
+    
+    return ((y.GetSquare() + (x * y)) == ((xSquared * x) + (_a * xSquared) + _b));
+}
+
+bool KoblitzCurve::IsInSubgroup(const BinaryPoint& point) const
+{
+    return MultiplyWithDoubleAndAdd(_n, point).IsPointAtInfinity();
+}
+
+BinaryPoint KoblitzCurve::Add(const BinaryPoint& p, const BinaryPoint& q) const
+{
+    if(p.IsPointAtInfinity())
+        return q;
+    
+    if(q.IsPointAtInfinity())
+        return p;
+    
+    // -(x, y) = (x, x + y), so equal x-coordinates mean either q = p or q = -p.
+    if(p.x == q.x)
+        return (p.y == q.y) ? Double(p) : BinaryPoint::MakePointAtInfinity(_field);
+    
+    // lambda = (y1 + y2) / (x1 + x2)
+    // x3 = lambda^2 + lambda + x1 + x2 + a
+    // y3 = lambda * (x1 + x3) + x3 + y1
+    BinaryFieldElement lambda = (p.y + q.y) / (p.x + q.x);
+    BinaryFieldElement x3 = lambda.GetSquare() + lambda + p.x + q.x + _a;
+    BinaryFieldElement y3 = (lambda * (p.x + x3)) + x3 + p.y;
+    
+    return BinaryPoint(move(x3), move(y3));
+}
+
+BinaryPoint KoblitzCurve::Double(const BinaryPoint& point) const
+{
+    // Points with x = 0 have order 2.
+    if(point.IsPointAtInfinity() || point.x.IsZero())
+        return BinaryPoint::MakePointAtInfinity(_field);
+    
+    // lambda = x1 + y1 / x1
+    // x3 = lambda^2 + lambda + a
+    // y3 = x1^2 + (lambda + 1) * x3
+    BinaryFieldElement lambda = point.x + (point.y / point.x);
+    BinaryFieldElement x3 = lambda.GetSquare() + lambda + _a;
+    BinaryFieldElement y3 = point.x.GetSquare() + ((lambda + BinaryFieldElement::MakeOne(_field)) * x3);
+    
+    return BinaryPoint(move(x3), move(y3));
+}
+
+BinaryPoint KoblitzCurve::Negate(const BinaryPoint& point) const
+{
+    if(point.IsPointAtInfinity())
+        return point;
+    
+    return BinaryPoint(point.x, point.x + point.y);
+}
+
+BinaryPoint KoblitzCurve::ApplyFrobenius(const BinaryPoint& point) const
+{
+    if(point.IsPointAtInfinity())
+        return point;
+    
+    return BinaryPoint(point.x.GetSquare(), point.y.GetSquare());
+}
+
+LopezDahabPoint KoblitzCurve::ToProjective(const BinaryPoint& point) const
+{
+    if(point.IsPointAtInfinity())
+    {
+        LopezDahabPoint infinity = { BinaryFieldElement::MakeOne(_field), BinaryFieldElement::MakeZero(_field),
+                                     BinaryFieldElement::MakeZero(_field) };
+        return infinity;
+    }
+    
+    LopezDahabPoint projective = { point.x, point.y, BinaryFieldElement::MakeOne(_field) };
+    return projective;
+}
+
+BinaryPoint KoblitzCurve::ToAffine(const LopezDahabPoint& point) const
+{
+    if(point.Z.IsZero())
+        return BinaryPoint::MakePointAtInfinity(_field);
+    
+    // (x, y) = (X / Z, Y / Z^2)
+    BinaryFieldElement zInverse = point.Z.GetInverse();
+    BinaryFieldElement x = point.X * zInverse;
+    BinaryFieldElement y = point.Y * zInverse.Square();
+    
+    return BinaryPoint(move(x), move(y));
+}
+
+LopezDahabPoint KoblitzCurve::DoubleProjective(const LopezDahabPoint& point) const
+{
+    // (found here: Guide to Elliptic Curve Cryptography, Hankerson, Menezes, Vanstone, Section 3.2.3)
+    //  Z3 = X1^2 * Z1^2
+    //  X3 = X1^4 + b * Z1^4
+    //  Y3 = b * Z1^4 * Z3 + X3 * (a * Z3 + Y1^2 + b * Z1^4)
+    // with b = 1. A point with X1 = 0 has order 2 and doubles to infinity (Z3 = 0).
+    BinaryFieldElement xSquared = point.X.GetSquare();
+    BinaryFieldElement zSquared = point.Z.GetSquare();
+    BinaryFieldElement zFourth = zSquared.GetSquare();
+    
+    LopezDahabPoint result = { xSquared.GetSquare() + zFourth, point.Y.GetSquare() + zFourth, xSquared * zSquared };
+    if(!_a.IsZero())
+        result.Y += result.Z;
+    
+    result.Y *= result.X;
+    result.Y += zFourth * result.Z;
+    
+    return result;
+}
+
+LopezDahabPoint KoblitzCurve::AddMixed(const LopezDahabPoint& p, const BinaryPoint& q) const
+{
+    if(q.IsPointAtInfinity())
+        return p;
+    
+    if(p.Z.IsZero())
+        return ToProjective(q);
+    
+    // (found here: Guide to Elliptic Curve Cryptography, Hankerson, Menezes, Vanstone, Section 3.2.3)
+    //  A = Y1 + y2 * Z1^2, B = X1 + x2 * Z1, C = Z1 * B, D = B^2 * (C + a * Z1^2)
+    //  Z3 = C^2, E = A * C, X3 = A^2 + D + E
+    //  F = X3 + x2 * Z3, G = (x2 + y2) * Z3^2, Y3 = (E + Z3) * F + G
+    BinaryFieldElement zSquared = p.Z.GetSquare();
+    BinaryFieldElement A = p.Y + (q.y * zSquared);
+    BinaryFieldElement B = p.X + (q.x * p.Z);
+    
+    // B = 0 means both points have the same x-coordinate, so q is either p or -p.
+    if(B.IsZero())
+        return A.IsZero() ? DoubleProjective(p) : ToProjective(BinaryPoint::MakePointAtInfinity(_field));
+    
+    BinaryFieldElement C = p.Z * B;
+    BinaryFieldElement D = C;
+    if(!_a.IsZero())
+        D += zSquared;
+    
+    D *= B.GetSquare();
+    
+    LopezDahabPoint result = { A.GetSquare() + D, p.Y, C.GetSquare() };
+    BinaryFieldElement E = A * C;
+    result.X += E;
+    
+    BinaryFieldElement F = result.X + (q.x * result.Z);
+    BinaryFieldElement G = (q.x + q.y) * result.Z.GetSquare();
+    result.Y = ((E + result.Z) * F) + G;
+    
+    return result;
+}
+
+void KoblitzCurve::ApplyFrobenius(LopezDahabPoint& point) const
+{
+    point.X.Square();
+    point.Y.Square();
+    point.Z.Square();
+}
+
+void KoblitzCurve::ReduceModDelta(const BigInteger& k, BigInteger& r0, BigInteger& r1) const
+{
+    // Partial reduction modulo delta (found here: Guide to Elliptic Curve Cryptography, Hankerson, Menezes,
+    //  Vanstone, Algorithms 3.57 and 3.62). k / delta = k * conjugate(delta) / n = lambda0 + lambda1 * tau is
+    //  rounded to the element q = q0 + q1 * tau of Z[tau] nearest to it, and rho = k - q * delta.
+    //
+    // All of the comparisons of the rounding are made on integers scaled by n: lambda(i) = N(i) / n, the
+    //  rounded f(i) = floor(lambda(i) + 1/2), and eta(i) = lambda(i) - f(i) = e(i) / n.
+    BigInteger twoN = BigInteger(2) * _n;
+    BigInteger numerators[2] = { _s0 * k, _s1 * k };
+    BigInteger f[2];
+    BigInteger e[2];
+    for(int i = 0; i < 2; i++)
+    {
+        f[i] = FloorDivide((BigInteger(2) * numerators[i]) + _n, twoN);
+        e[i] = numerators[i] - (f[i] * _n);
+    }
+    
+    BigInteger muE1 = (_mu == 1) ? e[1] : -e[1];
+    BigInteger eta = (BigInteger(2) * e[0]) + muE1;
+    BigInteger e0Minus3MuE1 = e[0] - (BigInteger(3) * muE1);
+    BigInteger e0Plus4MuE1 = e[0] + (BigInteger(4) * muE1);
+    
+    int h0 = 0;
+    int h1 = 0;
+    if(eta >= _n)
+    {
+        if(e0Minus3MuE1 < -_n)
+            h1 = _mu;
+        else
+            h0 = 1;
+    }
+    else if(e0Plus4MuE1 >= twoN)
+    {
+        h1 = _mu;
+    }
+    
+    if(eta < -_n)
+    {
+        if(e0Minus3MuE1 >= _n)
+            h1 = -_mu;
+        else
+            h0 = -1;
+    }
+    else if(e0Plus4MuE1 < -twoN)
+    {
+        h1 = -_mu;
+    }
+    
+    BigInteger q0 = f[0] + BigInteger(h0);
+    BigInteger q1 = f[1] + BigInteger(h1);
+    
+    // q * delta = (q0 * d0 - 2 * q1 * d1) + (q0 * d1 + q1 * d0 + mu * q1 * d1) * tau
+    BigInteger q1d1 = q1 * _d1;
+    r0 = k - (q0 * _d0) + (BigInteger(2) * q1d1);
+    r1 = (_mu == 1) ? -((q0 * _d1) + (q1 * _d0) + q1d1) : -((q0 * _d1) + (q1 * _d0) - q1d1);
+}
+
+vector<int8_t> KoblitzCurve::GetReducedTnaf(const BigInteger& k) const
+{
+    BigInteger r0;
+    BigInteger r1;
+    ReduceModDelta(k % _n, r0, r1);
+    
+    // Computes the TNAF of r0 + r1 * tau (found here: Guide to Elliptic Curve Cryptography, Hankerson,
+    //  Menezes, Vanstone, Algorithm 3.61). An odd element gets the digit u = +-1 which makes
+    //  (r0 - u) + r1 * tau divisible by tau^2, and the element is then divided by tau using
+    //  (r0 + r1 * tau) / tau = (r1 + mu * r0 / 2) - (r0 / 2) * tau for even r0.
+    vector<int8_t> digits;
+    BigInteger two(2);
+    while((r0 != 0) || (r1 != 0))
+    {
+        int8_t digit = 0;
+        if(r0.GetBitAt(0))
+        {
+            digit = static_cast<int8_t>(2 - Mod4(r0 - (two * r1)));
+            r0 -= BigInteger(digit);
+        }
+        
+        digits.push_back(digit);
+        
+        BigInteger halfR0 = r0 / two;
+        r0 = (_mu == 1) ? (r1 + halfR0) : (r1 - halfR0);
+        r1 = -halfR0;
+    }
+    
+    return digits;
+}
+
+BinaryPoint KoblitzCurve::Multiply(const BigInteger& k, const BinaryPoint& point) const
+{
+    if(point.IsPointAtInfinity())
+        return point;
+    
+    // Since delta annihilates the subgroup of order n, multiplying by rho = k (mod delta) gives k * point.
+    //  The TNAF is evaluated from its most significant digit with one Frobenius map (three squarings) per
+    //  digit and a mixed addition per non-zero digit, about a third of the digits.
+    vector<int8_t> digits = GetReducedTnaf(k);
+    BinaryPoint negated = Negate(point);
+    
+    LopezDahabPoint result = ToProjective(BinaryPoint::MakePointAtInfinity(_field));
+    for(auto digit = digits.rbegin(); digit != digits.rend(); digit++)
+    {
+        ApplyFrobenius(result);
+        
+        if(*digit == 1)
+            result = AddMixed(result, point);
+        else if(*digit == -1)
+            result = AddMixed(result, negated);
+    }
+    
+    return ToAffine(result);
+}
+
+BinaryPoint KoblitzCurve::MultiplyBasePoint(const BigInteger& k) const
+{
+    return Multiply(k, _G);
+}
+
+BinaryPoint KoblitzCurve::MultiplyWithDoubleAndAdd(const BigInteger& k, const BinaryPoint& point) const
+{
+    BinaryPoint result = BinaryPoint::MakePointAtInfinity(_field);
+    if(k <= 0)
+        return result;
+    
+    for(int i = static_cast<int>(k.GetMostSignificantBitIndex()); i >= 0; --i)
+    {
+        result = Double(result);
+        if(k.GetBitAt(i))
+            result = Add(result, point);
+    }
+    
+    return result;
+}
@@ -0,0 +1,166 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__KoblitzCurve__
+#define __EccTool__KoblitzCurve__
+
+#include <memory>
+#include <vector>
+
+#include "BigInteger.h"
+#include "BinaryFieldElement.h"
+#include "EccDefs.h"
+
+using namespace std;
+
+// Defines the x and y coordinates of a point on a binary curve.
+class BinaryPoint
+{
+private:
+    bool _isPointAtInfinity;
+    
+public:
+    // The x-coordinate of the point.
+    BinaryFieldElement x;
+    // The y-coordinate of the point.
+    BinaryFieldElement y;
+    
+    // Creates a point at infinity.
+    static BinaryPoint MakePointAtInfinity(shared_ptr<const BinaryField> field);
+    
+    // Creates a point with the given x and y coordinates (not at infinity).
+    BinaryPoint(BinaryFieldElement x, BinaryFieldElement y);
+    
+    // Two points are equal if they are both the point at infinity, or neither is and they have the
+    //  same x and y coordinates.
+    bool operator==(const BinaryPoint& other) const;
+    bool operator!=(const BinaryPoint& other) const;
+    
+    // Returns whether this is the point at infinity.
+    bool IsPointAtInfinity() const;
+    
+    // Serializes the point uncompressed: 04 || x || y.
+    vector<uint8_t> Serialize() const;
+};
+
+// A point in Lopez-Dahab projective coordinates (X, Y, Z), which represents the affine point
+//  (X / Z, Y / Z^2). The point at infinity has Z = 0.
+struct LopezDahabPoint
+{
+    BinaryFieldElement X;
+    BinaryFieldElement Y;
+    BinaryFieldElement Z;
+};
+
+// KoblitzCurve defines the operations on a Koblitz (anomalous binary) curve
+//  y^2 + xy = x^3 + ax^2 + 1 over GF(2^m) with a = 0 or 1.
+//
+// Koblitz curves have the Frobenius endomorphism tau(x, y) = (x^2, y^2), which satisfies
+//  tau^2 - mu * tau + 2 = 0 with mu = (-1)^(1 - a). A scalar written in base tau therefore needs no point
+//  doublings at all, only squarings of the coordinates, which is where these curves get their speed.
+class KoblitzCurve
+{
+private:
+    string _name;
+    shared_ptr<const BinaryField> _field;
+    BinaryFieldElement _a;
+    BinaryFieldElement _b;
+    BinaryPoint _G;
+    BigInteger _n;
+    BigInteger _h;
+    
+    // +1 if a = 1, -1 if a = 0.
+    int _mu;
+    
+    // delta = (tau^m - 1) / (tau - 1) = d0 + d1 * tau, which has norm n and annihilates the subgroup of
+    //  order n, and its conjugate s0 + s1 * tau.
+    BigInteger _d0;
+    BigInteger _d1;
+    BigInteger _s0;
+    BigInteger _s1;
+    
+    // Projective point operations. Additions take an affine second point (mixed coordinates).
+    LopezDahabPoint ToProjective(const BinaryPoint& point) const;
+    BinaryPoint ToAffine(const LopezDahabPoint& point) const;
+    LopezDahabPoint DoubleProjective(const LopezDahabPoint& point) const;
+    LopezDahabPoint AddMixed(const LopezDahabPoint& p, const BinaryPoint& q) const;
+    void ApplyFrobenius(LopezDahabPoint& point) const;
+    
+    // Finds an element rho = r0 + r1 * tau congruent to k modulo delta, which has about m bits of norm
+    //  instead of the 2m bits of k itself.
+    void ReduceModDelta(const BigInteger& k, BigInteger& r0, BigInteger& r1) const;
+    
+public:
+    // Constructs the curve from its domain parameters. Throws invalid_argument if they are not those
+    //  of a Koblitz curve.
+    explicit KoblitzCurve(const ecc::BinaryDomainParameters& params);
+    
+    // Returns the name of the curve.
+    const string& GetName() const;
+    
+    // Returns the field of the curve.
+    const shared_ptr<const BinaryField>& GetField() const;
+    
+    // Returns the base point G.
+    const BinaryPoint& GetBasePoint() const;
+    
+    // Returns the order n of the base point.
+    const BigInteger& GetOrder() const;
+    
+    // Creates a point from its coordinates. Throws invalid_argument if it is not on the curve.
+    BinaryPoint MakePoint(const BigInteger& x, const BigInteger& y) const;
+    
+    // Parses a point serialized by BinaryPoint::Serialize(). Throws invalid_argument if the encoding is
+    //  malformed or the point is not on the curve.
+    BinaryPoint ParsePoint(const vector<uint8_t>& serialized) const;
+    
+    // Determines if the given point is on the curve.
+    bool IsPointOnCurve(const BinaryPoint& point) const;
+    
+    // Determines if n * point is the point at infinity, that is if the point is in the subgroup generated by
+    //  G, which Multiply requires. Uses double-and-add, so it costs about as much as 30 calls to Multiply.
+    bool IsInSubgroup(const BinaryPoint& point) const;
+    
+    // Affine point operations.
+    BinaryPoint Add(const BinaryPoint& p, const BinaryPoint& q) const;
+    BinaryPoint Double(const BinaryPoint& point) const;
+    BinaryPoint Negate(const BinaryPoint& point) const;
+    BinaryPoint ApplyFrobenius(const BinaryPoint& point) const;
+    
+    // Returns the tau-adic non-adjacent form of k reduced modulo delta, least significant digit first.
+    //  Each digit is -1, 0 or 1 and no two adjacent digits are non-zero.
+    vector<int8_t> GetReducedTnaf(const BigInteger& k) const;
+    
+    // Multiplies a point in the subgroup of order n by the scalar k using the reduced tau-adic NAF of k
+    //  (found here: Guide to Elliptic Curve Cryptography, Hankerson, Menezes, Vanstone, Section 3.4).
+    BinaryPoint Multiply(const BigInteger& k, const BinaryPoint& point) const;
+    
+    // Multiplies the base point by the scalar k.
+    BinaryPoint MultiplyBasePoint(const BigInteger& k) const;
+    
+    // Multiplies any point by the scalar k using plain double-and-add. Much slower than Multiply, and kept
+    //  as a reference.
+    BinaryPoint MultiplyWithDoubleAndAdd(const BigInteger& k, const BinaryPoint& point) const;
+};
+
+#endif /* defined(__EccTool__KoblitzCurve__) */
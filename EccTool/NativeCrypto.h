@@ -39,5 +39,12 @@ public:
 
     // Hash the provided data with the SHA 256 hash algorithm.
 	static std::vector<uint8_t> HashData(const std::vector<uint8_t>& data);
+
+    // Hash the provided data with the SHA 512 hash algorithm (required by Ed25519).
+	static std::vector<uint8_t> HashDataWithSha512(const std::vector<uint8_t>& data);
+
+    // Returns size bytes from the cryptographically secure random number generator of the operating system
+    //  (used to seed ChaCha20Drbg).
+	static std::vector<uint8_t> GenerateRandomBytes(size_t size);
 };
 #endif /* defined(__EccTool__NativeCrypto__) */
@@ -112,6 +112,11 @@ bool Point::operator!=(const Point& other) const
     return !(*this == other);
 }
 
+bool Point::IsPointAtInfinity() const
+{
+    return isPointAtInfinity;
+}
+
 // Serialzes the point to a binary representation.
 vector<uint8_t> Point::Serialize() const
 {
@@ -150,6 +155,15 @@ std::ostream& operator<<(std::ostream& os, const Point& point)
     return os;
 }
 
+JacobianPoint::JacobianPoint(FieldElement x, FieldElement y, FieldElement z) : x(move(x)), y(move(y)), z(move(z))
+{
+}
+
+bool JacobianPoint::IsPointAtInfinity() const
+{
+    return (z == 0);
+}
+
 
 
 
@@ -61,6 +61,9 @@ public:
     // Not Equal implemented as the inverse of Equal.
     bool operator!=(const Point& other) const;
     
+    // Returns whether this is the point at infinity.
+    bool IsPointAtInfinity() const;
+    
     // Serialzes the point to a string representation.
     vector<uint8_t> Serialize() const;
     
@@ -93,4 +96,22 @@ private:
 // Stream writing operator for Point.
 std::ostream& operator<<(std::ostream& os, const Point& point);
 
+// A point in Jacobian projective coordinates (X, Y, Z) which represents the affine point
+//  (X/Z^2, Y/Z^3). Points in this form can be added and doubled without a field inversion,
+//  one inversion is only needed when converting back to an affine Point.
+class JacobianPoint
+{
+public:
+    FieldElement x;
+    FieldElement y;
+    FieldElement z;
+    
+    // Creates a point with the given projective coordinates. A z-coordinate of zero
+    //  denotes the point at infinity.
+    JacobianPoint(FieldElement x, FieldElement y, FieldElement z);
+    
+    // Returns whether this is the point at infinity (z == 0).
+    bool IsPointAtInfinity() const;
+};
+
 #endif /* defined(__EccTool__Point__) */
@@ -0,0 +1,179 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "PrecomputedTableFile.h"
+#include "ChaCha20Drbg.h"
+#include "NativeCrypto.h"
+#include "Utilities.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+using namespace std;
+
+const uint32_t PrecomputedTableFile::FORMAT_VERSION = 1;
+
+namespace
+{
+    const char FILE_MAGIC[] = { 'E', 'C', 'C', 'T', 'A', 'B', 'L', 'E' };
+    const size_t CHECKSUM_SIZE = 32;
+    
+    void AppendUInt32(vector<uint8_t>& buffer, uint32_t value)
+    {
+        for(size_t i = 0; i < 4; i++)
+            buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+    
+    void AppendBytes(vector<uint8_t>& buffer, const vector<uint8_t>& bytes)
+    {
+        buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+    }
+    
+    // The header is everything before the table points. It identifies the table, so a file is only
+    //  used if its header matches the expected header exactly.
+    vector<uint8_t> MakeHeader(const EllipticCurve& curve, const Point& point, CombParameters parameters, uint32_t pointCount)
+    {
+        vector<uint8_t> header(FILE_MAGIC, FILE_MAGIC + sizeof(FILE_MAGIC));
+        AppendUInt32(header, PrecomputedTableFile::FORMAT_VERSION);
+        
+        string curveName = curve.GetCurveName();
+        AppendUInt32(header, static_cast<uint32_t>(curveName.size()));
+        header.insert(header.end(), curveName.begin(), curveName.end());
+        
+        AppendUInt32(header, parameters.teeth);
+        AppendUInt32(header, parameters.spacing);
+        AppendUInt32(header, pointCount);
+        AppendBytes(header, point.Serialize());
+        
+        return header;
+    }
+}
+
+void PrecomputedTableFile::Write(const string& path, const EllipticCurve& curve, const Point& point, const FixedPointTable& table)
+{
+    vector<uint8_t> contents = MakeHeader(curve, point, table.parameters, static_cast<uint32_t>(table.points.size()));
+    AppendBytes(contents, curve.SerializeFixedPointTable(table));
+    AppendBytes(contents, NativeCrypto::HashData(contents));
+    
+    // The table is written to a uniquely named file next to the destination, which then replaces the
+    //  destination. Readers (possibly in other processes) never see a partially written file.
+    string temporaryPath = path + "." + utilities::BytesToHexString(ChaCha20Drbg::GetThreadInstance().GenerateBytes(8)) + ".tmp";
+    {
+        ofstream file(temporaryPath.c_str(), ios::out | ios::binary | ios::trunc);
+        file.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+        file.close();
+        if(!file)
+        {
+            remove(temporaryPath.c_str());
+            throw runtime_error("Unable to write precomputed table file: " + path);
+        }
+    }
+    
+    // rename() replaces an existing destination atomically on POSIX systems. On Windows it fails if the
+    //  destination exists, so the old file is removed first there.
+    if(rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        remove(path.c_str());
+        if(rename(temporaryPath.c_str(), path.c_str()) != 0)
+        {
+            remove(temporaryPath.c_str());
+            throw runtime_error("Unable to write precomputed table file: " + path);
+        }
+    }
+}
+
+shared_ptr<const FixedPointTable> PrecomputedTableFile::Read(const string& path, const EllipticCurve& curve, const Point& point, CombParameters parameters)
+{
+    // The points are parsed into a table anyway, so the file is simply read into memory.
+    ifstream file(path.c_str(), ios::in | ios::binary);
+    if(!file)
+        return nullptr;
+    
+    vector<uint8_t> contents((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+    if(file.bad())
+        return nullptr;
+    
+    // The point count is read from the file to build the expected header, which must then match the
+    //  file exactly (and so checks the version, curve, point and parameters).
+    vector<uint8_t> header = MakeHeader(curve, point, parameters, 0);
+    const size_t pointCountOffset = header.size() - point.Serialize().size() - 4;
+    if(contents.size() < header.size() + CHECKSUM_SIZE)
+        return nullptr;
+    
+    uint32_t pointCount = 0;
+    for(size_t i = 0; i < 4; i++)
+        pointCount |= static_cast<uint32_t>(contents[pointCountOffset + i]) << (8 * i);
+    
+    header = MakeHeader(curve, point, parameters, pointCount);
+    if(!equal(header.begin(), header.end(), contents.begin()))
+        return nullptr;
+    
+    // The checksum only detects damaged files, anyone can compute it for a forged one. Forged tables are
+    //  caught by MakeFixedPointTable(), which checks that the points are the multiples of the first one,
+    //  and by the check of the first point below.
+    const size_t checksumOffset = contents.size() - CHECKSUM_SIZE;
+    vector<uint8_t> checksum = NativeCrypto::HashData(vector<uint8_t>(contents.begin(), contents.begin() + checksumOffset));
+    if(checksum.size() != CHECKSUM_SIZE || !equal(checksum.begin(), checksum.end(), contents.begin() + checksumOffset))
+        return nullptr;
+    
+    try
+    {
+        auto table = curve.MakeFixedPointTable(parameters, vector<uint8_t>(contents.begin() + header.size(), contents.begin() + checksumOffset));
+        if(table->points.size() != pointCount || table->points[0] != point)
+            return nullptr;
+        
+        return table;
+    }
+    catch(const invalid_argument&)
+    {
+        return nullptr;
+    }
+}
+
+shared_ptr<const FixedPointTable> PrecomputedTableFile::ReadOrBuild(const string& path, const EllipticCurve& curve, const Point& point, CombParameters parameters)
+{
+    auto table = Read(path, curve, point, parameters);
+    if(table)
+        return table;
+    
+    table = curve.PrecomputeFixedPointTable(point, parameters);
+    try
+    {
+        Write(path, curve, point, *table);
+    }
+    catch(const runtime_error&)
+    {
+        // The table is rebuilt by the next process instead.
+    }
+    
+    return table;
+}
+
+void PrecomputedTableFile::LoadBasePointTable(const string& directory, EllipticCurve& curve)
+{
+    string path = directory + "/" + curve.GetCurveName() + ".ecctable";
+    auto table = ReadOrBuild(path, curve, curve.GetBasePoint(), EllipticCurve::DEFAULT_COMB_PARAMETERS);
+    curve.SetBasePointCombTable(*table);
+}
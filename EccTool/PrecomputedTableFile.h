@@ -0,0 +1,66 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__PrecomputedTableFile__
+#define __EccTool__PrecomputedTableFile__
+
+#include <memory>
+#include <string>
+#include <stdint.h>
+#include "EllipticCurve.h"
+#include "Point.h"
+
+using namespace std;
+
+// Stores precomputed comb tables (of the base point or of frequently used public keys) in files, so that
+//  they are built once rather than by every process.
+//
+// File format (integers are 32-bit little endian):
+//  "ECCTABLE" | version | curve name size | curve name | teeth | spacing | point count | serialized point |
+//  table points (see EllipticCurve::SerializeFixedPointTable()) | SHA-256 of all previous bytes
+class PrecomputedTableFile
+{
+public:
+    // The version of the file format written.
+    static const uint32_t FORMAT_VERSION;
+    
+    // Writes the table for the given point on the given curve to a file, by writing a temporary file in
+    //  the same directory and renaming it. Throws runtime_error if the file cannot be written.
+    static void Write(const string& path, const EllipticCurve& curve, const Point& point, const FixedPointTable& table);
+    
+    // Reads the table for the given point on the given curve with the given parameters from a file.
+    //  Returns null if the file does not exist, or is of another version, curve, point or parameters, or
+    //  fails its checksum, or its points are not those of a comb table of the point (see
+    //  EllipticCurve::MakeFixedPointTable()).
+    static shared_ptr<const FixedPointTable> Read(const string& path, const EllipticCurve& curve, const Point& point, CombParameters parameters);
+    
+    // Reads the table as above, or builds it if the file cannot be used and (re)writes the file. Failing
+    //  to write the file is not an error, the built table is returned regardless.
+    static shared_ptr<const FixedPointTable> ReadOrBuild(const string& path, const EllipticCurve& curve, const Point& point, CombParameters parameters = EllipticCurve::DEFAULT_COMB_PARAMETERS);
+    
+    // Loads (or builds and writes) the base point comb table of the given curve from a file in the given
+    //  directory, named after the curve.
+    static void LoadBasePointTable(const string& directory, EllipticCurve& curve);
+};
+
+#endif /* defined(__EccTool__PrecomputedTableFile__) */
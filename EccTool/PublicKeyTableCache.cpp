@@ -0,0 +1,171 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "PublicKeyTableCache.h"
+#include <stdexcept>
+
+using namespace std;
+
+const size_t PublicKeyTableCache::DEFAULT_CAPACITY = 64;
+const unsigned int PublicKeyTableCache::DEFAULT_BUILD_THRESHOLD = 8;
+const shared_ptr<PublicKeyTableCache> PublicKeyTableCache::_sharedInstance = make_shared<PublicKeyTableCache>();
+
+PublicKeyTableCache::PublicKeyTableCache(size_t capacity, unsigned int buildThreshold)
+    : _capacity(capacity), _buildThreshold(buildThreshold)
+{
+    if(capacity < 1)
+        throw invalid_argument("Cache capacity must be at least 1.");
+    
+    _statistics.hits = 0;
+    _statistics.misses = 0;
+    _statistics.builds = 0;
+    _statistics.evictions = 0;
+}
+
+shared_ptr<const FixedPointTable> PublicKeyTableCache::Lookup(const EllipticCurve& curve, const Point& publicKey)
+{
+    string key = MakeKey(curve, publicKey);
+    {
+        lock_guard<mutex> lock(_mutex);
+        
+        list<Entry>::iterator entry = FindOrAddEntry(key);
+        if(entry->table)
+        {
+            _statistics.hits++;
+            return entry->table;
+        }
+        
+        _statistics.misses++;
+        if(entry->isBuilding || ++entry->useCount < _buildThreshold)
+            return nullptr;
+        
+        entry->isBuilding = true;
+    }
+    
+    // Build the table without holding the lock, so other keys can be looked up meanwhile. If the build
+    //  fails, the entry is released so that a later lookup can try again.
+    shared_ptr<const FixedPointTable> table;
+    try
+    {
+        table = curve.PrecomputeFixedPointTable(publicKey);
+    }
+    catch(...)
+    {
+        lock_guard<mutex> lock(_mutex);
+        auto found = _index.find(key);
+        if(found != _index.end())
+            found->second->isBuilding = false;
+        
+        throw;
+    }
+    
+    {
+        lock_guard<mutex> lock(_mutex);
+        _statistics.builds++;
+        
+        // The entry may have been evicted (or the cache cleared) while the table was built.
+        auto found = _index.find(key);
+        if(found != _index.end())
+        {
+            found->second->table = table;
+            found->second->isBuilding = false;
+        }
+    }
+    
+    return table;
+}
+
+void PublicKeyTableCache::Insert(const EllipticCurve& curve, const Point& publicKey, shared_ptr<const FixedPointTable> table)
+{
+    if(!table)
+        throw invalid_argument("Table must not be null.");
+    
+    string key = MakeKey(curve, publicKey);
+    lock_guard<mutex> lock(_mutex);
+    
+    list<Entry>::iterator entry = FindOrAddEntry(key);
+    entry->table = move(table);
+}
+
+list<PublicKeyTableCache::Entry>::iterator PublicKeyTableCache::FindOrAddEntry(const string& key)
+{
+    auto found = _index.find(key);
+    if(found != _index.end())
+    {
+        // Move the key to the front of the list as the most recently used.
+        _entries.splice(_entries.begin(), _entries, found->second);
+        return found->second;
+    }
+    
+    if(_entries.size() >= _capacity)
+    {
+        _index.erase(_entries.back().key);
+        _entries.pop_back();
+        _statistics.evictions++;
+    }
+    
+    Entry newEntry;
+    newEntry.key = key;
+    newEntry.useCount = 0;
+    newEntry.isBuilding = false;
+    _entries.push_front(move(newEntry));
+    _index[key] = _entries.begin();
+    
+    return _entries.begin();
+}
+
+void PublicKeyTableCache::Clear()
+{
+    lock_guard<mutex> lock(_mutex);
+    _index.clear();
+    _entries.clear();
+}
+
+size_t PublicKeyTableCache::GetSize() const
+{
+    lock_guard<mutex> lock(_mutex);
+    return _entries.size();
+}
+
+PublicKeyTableCache::Statistics PublicKeyTableCache::GetStatistics() const
+{
+    lock_guard<mutex> lock(_mutex);
+    return _statistics;
+}
+
+const shared_ptr<PublicKeyTableCache>& PublicKeyTableCache::GetSharedInstance()
+{
+    return _sharedInstance;
+}
+
+string PublicKeyTableCache::MakeKey(const EllipticCurve& curve, const Point& publicKey)
+{
+    // The domain parameters encode their own length, so the point can follow them directly.
+    vector<uint8_t> serializedParameters = curve.SerializeDomainParameters();
+    vector<uint8_t> serializedPoint = publicKey.Serialize();
+    
+    string key(serializedParameters.begin(), serializedParameters.end());
+    key.append(serializedPoint.begin(), serializedPoint.end());
+    
+    return key;
+}
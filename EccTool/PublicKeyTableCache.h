@@ -0,0 +1,115 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__PublicKeyTableCache__
+#define __EccTool__PublicKeyTableCache__
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "EllipticCurve.h"
+#include "Point.h"
+
+using namespace std;
+
+// A bounded, thread-safe cache of precomputed comb tables for public keys. A table is built for a
+//  key once it has been looked up a given number of times, after which multiplications of that key
+//  run at close to the speed of multiplications of the base point G. The least recently used key
+//  is evicted when the cache is full.
+class PublicKeyTableCache
+{
+public:
+    // Counters of the cache activity since it was created.
+    struct Statistics
+    {
+        // Lookups which returned a table, and lookups which did not.
+        uint64_t hits;
+        uint64_t misses;
+        
+        // The number of tables built, and the number of keys evicted from the cache.
+        uint64_t builds;
+        uint64_t evictions;
+    };
+    
+    // The default capacity and build threshold.
+    static const size_t DEFAULT_CAPACITY;
+    static const unsigned int DEFAULT_BUILD_THRESHOLD;
+    
+    // Creates a cache which holds at most capacity keys, building a table for a key on its
+    //  buildThreshold-th lookup. Capacity must be at least 1.
+    PublicKeyTableCache(size_t capacity = DEFAULT_CAPACITY, unsigned int buildThreshold = DEFAULT_BUILD_THRESHOLD);
+    
+    // Returns the table for the given public key on the given curve, or null if the key has not been
+    //  used often enough yet. The table is built by the calling thread once the threshold is reached
+    //  (other threads looking up the same key meanwhile get null rather than waiting).
+    shared_ptr<const FixedPointTable> Lookup(const EllipticCurve& curve, const Point& publicKey);
+    
+    // Adds a table built before (such as one loaded from a file, see PrecomputedTableFile) for the given
+    //  public key, so that lookups of the key return it right away.
+    void Insert(const EllipticCurve& curve, const Point& publicKey, shared_ptr<const FixedPointTable> table);
+    
+    // Removes all keys from the cache. The statistics are kept.
+    void Clear();
+    
+    // Returns the number of keys currently in the cache (with or without a table).
+    size_t GetSize() const;
+    
+    Statistics GetStatistics() const;
+    
+    // The cache shared by all algs unless they are given another one.
+    static const shared_ptr<PublicKeyTableCache>& GetSharedInstance();
+    
+private:
+    struct Entry
+    {
+        string key;
+        unsigned int useCount;
+        bool isBuilding;
+        shared_ptr<const FixedPointTable> table;
+    };
+    
+    // The entries, most recently used first, and their index by key.
+    list<Entry> _entries;
+    unordered_map<string, list<Entry>::iterator> _index;
+    
+    // Returns the entry for the key, moved to the front, or a new entry at the front (evicting the least
+    //  recently used one if the cache is full). The mutex must be held.
+    list<Entry>::iterator FindOrAddEntry(const string& key);
+    
+    static const shared_ptr<PublicKeyTableCache> _sharedInstance;
+    
+    size_t _capacity;
+    unsigned int _buildThreshold;
+    Statistics _statistics;
+    
+    mutable mutex _mutex;
+    
+    // Builds the key under which a public key is stored: the domain parameters of the curve (rather than
+    //  its name, which custom curves may share with others) and the serialized point.
+    static string MakeKey(const EllipticCurve& curve, const Point& publicKey);
+};
+
+#endif /* defined(__EccTool__PublicKeyTableCache__) */
@@ -0,0 +1,225 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <stdexcept>
+#include "Schnorr.h"
+#include "BatchVerification.h"
+#include "NativeCrypto.h"
+
+using namespace std;
+
+const char* const Schnorr::CURVE_NAME = "secp256k1";
+
+namespace
+{
+    // Returns the non-negative number (below 2^256) as 32 big-endian bytes.
+    vector<uint8_t> ToBytes(const BigInteger& value)
+    {
+        vector<uint8_t> magnitude = value.GetMagnitudeBytes();
+        vector<uint8_t> bytes(32 - min<size_t>(magnitude.size(), 32), 0);
+        bytes.insert(bytes.end(), magnitude.end() - (32 - bytes.size()), magnitude.end());
+        
+        return bytes;
+    }
+    
+    bool HasEvenY(const Point& point)
+    {
+        return (point.y == 0) || !point.y.GetRawInteger().GetBitAt(0);
+    }
+    
+    vector<uint8_t> Concatenate(const vector<uint8_t>& a, const vector<uint8_t>& b, const vector<uint8_t>& c)
+    {
+        vector<uint8_t> result(a);
+        result.insert(result.end(), b.begin(), b.end());
+        result.insert(result.end(), c.begin(), c.end());
+        return result;
+    }
+}
+
+void Schnorr::EnsureCurveSupported(const EllipticCurve& curve)
+{
+    if(curve.GetCurveName() != CURVE_NAME)
+        throw invalid_argument("Schnorr signatures are only supported on secp256k1.");
+}
+
+vector<uint8_t> Schnorr::TaggedHash(const string& tag, const vector<uint8_t>& data)
+{
+    vector<uint8_t> tagHash = NativeCrypto::HashData(vector<uint8_t>(tag.begin(), tag.end()));
+    return NativeCrypto::HashData(Concatenate(tagHash, tagHash, data));
+}
+
+vector<uint8_t> Schnorr::GetPublicKey(const EllipticCurve& curve, const BigInteger& privateKey)
+{
+    EnsureCurveSupported(curve);
+    if(privateKey <= 0 || privateKey >= curve.GetBasePointOrder())
+        throw invalid_argument("Private key out of range.");
+    
+    return curve.MultiplyBasePointWithScalar(privateKey).x.GetBytes();
+}
+
+vector<uint8_t> Schnorr::Sign(const EllipticCurve& curve, const BigInteger& privateKey, const vector<uint8_t>& message,
+    const vector<uint8_t>& auxRandom)
+{
+    EnsureCurveSupported(curve);
+    const BigInteger& n = curve.GetBasePointOrder();
+    if(privateKey <= 0 || privateKey >= n)
+        throw invalid_argument("Private key out of range.");
+    if(auxRandom.size() != AUX_RANDOM_SIZE)
+        throw invalid_argument("Auxiliary random data must be 32 bytes.");
+    
+    // Use the private key d for which d * G has an even y (the point the x-only public key stands for).
+    Point P = curve.MultiplyBasePointWithScalar(privateKey);
+    BigInteger d = HasEvenY(P) ? privateKey : n - privateKey;
+    vector<uint8_t> publicKey = P.x.GetBytes();
+    
+    // k = hash(d xor hash(auxRandom) || P || message) mod n, negated if k * G has an odd y.
+    vector<uint8_t> t = ToBytes(d);
+    vector<uint8_t> auxHash = TaggedHash("BIP0340/aux", auxRandom);
+    for(size_t i = 0; i < t.size(); i++)
+        t[i] ^= auxHash[i];
+    
+    BigInteger k = BigInteger(TaggedHash("BIP0340/nonce", Concatenate(t, publicKey, message))) % n;
+    if(k == 0)
+        throw runtime_error("Unable to derive a nonce.");
+    
+    Point R = curve.MultiplyBasePointWithScalar(k);
+    if(!HasEvenY(R))
+        k = n - k;
+    
+    // s = k + e * d mod n.
+    vector<uint8_t> signature = R.x.GetBytes();
+    BigInteger e = BigInteger(TaggedHash("BIP0340/challenge", Concatenate(signature, publicKey, message))) % n;
+    vector<uint8_t> s = ToBytes((k + e * d) % n);
+    signature.insert(signature.end(), s.begin(), s.end());
+    
+    return signature;
+}
+
+bool Schnorr::TryPrepareSignature(const EllipticCurve& curve, const vector<uint8_t>& publicKey, const vector<uint8_t>& message,
+    const vector<uint8_t>& signature, PreparedSignature& prepared)
+{
+    if(publicKey.size() != PUBLIC_KEY_SIZE || signature.size() != SIGNATURE_SIZE)
+        return false;
+    
+    if(!curve.TryMakePointFromX(BigInteger(publicKey), false, prepared.publicKey))
+        return false;
+    
+    const BigInteger& n = curve.GetBasePointOrder();
+    vector<uint8_t> r(signature.begin(), signature.begin() + 32);
+    prepared.s = BigInteger(vector<uint8_t>(signature.begin() + 32, signature.end()));
+    if(prepared.s >= n)
+        return false;
+    
+    prepared.e = BigInteger(TaggedHash("BIP0340/challenge", Concatenate(r, publicKey, message))) % n;
+    prepared.transcript = Concatenate(signature, publicKey, ToBytes(prepared.e));
+    return true;
+}
+
+bool Schnorr::Verify(const EllipticCurve& curve, const vector<uint8_t>& publicKey, const vector<uint8_t>& message,
+    const vector<uint8_t>& signature)
+{
+    EnsureCurveSupported(curve);
+    
+    PreparedSignature prepared;
+    if(!TryPrepareSignature(curve, publicKey, message, signature, prepared))
+        return false;
+    
+    // R = s * G - e * P must have an even y and the x-coordinate r (which also rejects r >= p).
+    const BigInteger& n = curve.GetBasePointOrder();
+    Point R = curve.MultiplyDoubleScalar(prepared.s, curve.GetBasePoint(), (n - prepared.e) % n, prepared.publicKey);
+    if(R.IsPointAtInfinity() || !HasEvenY(R))
+        return false;
+    
+    return (R.x.GetBytes() == vector<uint8_t>(signature.begin(), signature.begin() + 32));
+}
+
+bool Schnorr::CheckBatchGroup(const EllipticCurve& curve, const vector<const PreparedSignature*>& group)
+{
+    vector<uint8_t> transcript;
+    for(auto signature : group)
+        transcript.insert(transcript.end(), signature->transcript.begin(), signature->transcript.end());
+    ecc::BatchWeights weights(transcript, [](const vector<uint8_t>& data) { return TaggedHash("BIP0340/batch", data); });
+    
+    // sum(a_i * R_i) + sum(a_i * e_i * P_i) + (n - sum(a_i * s_i)) * G. The first signature needs no weight,
+    //  which saves a multiplication.
+    const BigInteger& n = curve.GetBasePointOrder();
+    vector<BigInteger> scalars;
+    vector<Point> points;
+    BigInteger sSum(0);
+    for(size_t i = 0; i < group.size(); i++)
+    {
+        BigInteger a(1);
+        if(i > 0)
+        {
+            a = BigInteger(weights.Get(i));
+            if(a == 0)
+                a = 1;
+        }
+        
+        sSum = (sSum + a * group[i]->s) % n;
+        
+        scalars.push_back(a);
+        points.push_back(group[i]->R);
+        scalars.push_back((a * group[i]->e) % n);
+        points.push_back(group[i]->publicKey);
+    }
+    scalars.push_back((n - sSum) % n);
+    points.push_back(curve.GetBasePoint());
+    
+    return curve.MultiScalarMultiply(scalars, points).IsPointAtInfinity();
+}
+
+vector<bool> Schnorr::VerifyBatch(const EllipticCurve& curve, const vector<SignedMessage>& signedMessages)
+{
+    EnsureCurveSupported(curve);
+    vector<bool> results(signedMessages.size(), false);
+    
+    // Unlike Verify(), the batch check needs R itself, which is the point with the x-coordinate r and an
+    //  even y (if there is one).
+    vector<PreparedSignature> prepared;
+    prepared.reserve(signedMessages.size());
+    for(size_t i = 0; i < signedMessages.size(); i++)
+    {
+        const SignedMessage& signedMessage = signedMessages[i];
+        PreparedSignature signature;
+        signature.index = i;
+        if(!TryPrepareSignature(curve, signedMessage.publicKey, signedMessage.message, signedMessage.signature, signature))
+            continue;
+        
+        BigInteger r(vector<uint8_t>(signedMessage.signature.begin(), signedMessage.signature.begin() + 32));
+        if(!curve.TryMakePointFromX(r, false, signature.R))
+            continue;
+        
+        prepared.push_back(move(signature));
+    }
+    
+    vector<const PreparedSignature*> group;
+    for(const auto& signature : prepared)
+        group.push_back(&signature);
+    
+    ecc::VerifyBatchGroup<PreparedSignature>(group, [&curve](const vector<const PreparedSignature*>& checkedGroup)
+    {
+        return CheckBatchGroup(curve, checkedGroup);
+    }, results);
+    return results;
+}
@@ -0,0 +1,102 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__Schnorr__
+#define __EccTool__Schnorr__
+
+#include <string>
+#include <vector>
+#include "BigInteger.h"
+#include "EllipticCurve.h"
+#include "SignedMessage.h"
+
+using namespace std;
+
+// Schnorr implements the Schnorr signatures of BIP340 on secp256k1.
+//
+// Public keys are the 32-byte x-coordinate of the key point, which stands for the point with that x and an
+//  even y (a private key whose point has an odd y is negated when signing). A signature is the x-coordinate
+//  of the nonce point R followed by the scalar s, 32 bytes each, and is valid if s * G - e * P = R for the
+//  challenge e = hash(R || P || message). Unlike ECDSA, neither signing nor verification needs a modular
+//  inversion, and the equation is linear so that many signatures can be checked together. All hashes are
+//  tagged SHA-256 hashes (see TaggedHash()).
+class Schnorr
+{
+private:
+    // A signature decoded for verification.
+    struct PreparedSignature
+    {
+        size_t index;
+        Point publicKey;
+        Point R;
+        BigInteger s;
+        BigInteger e;
+        vector<uint8_t> transcript;
+    };
+    
+    // Throws invalid_argument if the curve is not secp256k1.
+    static void EnsureCurveSupported(const EllipticCurve& curve);
+    
+    // Decodes the public key and s, and computes the challenge e. Returns false if the public key is not the
+    //  x-coordinate of a point, or s is not below n. R is left to the caller.
+    static bool TryPrepareSignature(const EllipticCurve& curve, const vector<uint8_t>& publicKey, const vector<uint8_t>& message,
+        const vector<uint8_t>& signature, PreparedSignature& prepared);
+    
+    // Returns whether sum(a_i * (s_i * G - e_i * P_i - R_i)) is the point at infinity, with a_1 = 1 and the
+    //  other weights from BatchWeights, computed with a single multi-scalar multiplication.
+    static bool CheckBatchGroup(const EllipticCurve& curve, const vector<const PreparedSignature*>& group);
+    
+public:
+    // The name of the only curve supported.
+    static const char* const CURVE_NAME;
+    
+    // The size of public keys, signatures, and the auxiliary random data mixed into nonces.
+    static const size_t PUBLIC_KEY_SIZE = 32;
+    static const size_t SIGNATURE_SIZE = 64;
+    static const size_t AUX_RANDOM_SIZE = 32;
+    
+    // Returns SHA-256(SHA-256(tag) || SHA-256(tag) || data), which keeps hashes used for different purposes
+    //  (such as "BIP0340/challenge") apart.
+    static vector<uint8_t> TaggedHash(const string& tag, const vector<uint8_t>& data);
+    
+    // Returns the x-only public key of a private key in the range (0, n).
+    static vector<uint8_t> GetPublicKey(const EllipticCurve& curve, const BigInteger& privateKey);
+    
+    // Signs the message with the private key. The nonce is derived from the private key, the message and
+    //  32 bytes of fresh randomness (which only protect against side channels, so signing stays safe if they
+    //  repeat). Throws invalid_argument if the private key is not in the range (0, n).
+    static vector<uint8_t> Sign(const EllipticCurve& curve, const BigInteger& privateKey, const vector<uint8_t>& message,
+        const vector<uint8_t>& auxRandom);
+    
+    // Verifies the signature of the message with the x-only public key.
+    static bool Verify(const EllipticCurve& curve, const vector<uint8_t>& publicKey, const vector<uint8_t>& message,
+        const vector<uint8_t>& signature);
+    
+    // Verifies each of the given signed messages with the x-only public key given along with it, returning
+    //  whether each signature is valid. All signatures are checked together through one random linear
+    //  combination of their verification equations (as described in BIP340), which costs one multi-scalar
+    //  multiplication rather than one double multiplication per signature.
+    static vector<bool> VerifyBatch(const EllipticCurve& curve, const vector<SignedMessage>& signedMessages);
+};
+
+#endif /* defined(__EccTool__Schnorr__) */
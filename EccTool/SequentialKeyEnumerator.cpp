@@ -0,0 +1,281 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include "SequentialKeyEnumerator.h"
+#include "FieldElement.h"
+#include "WorkerPool.h"
+
+using namespace std;
+
+const size_t SequentialKeyEnumerator::DEFAULT_BLOCK_SIZE = 4097;
+
+namespace
+{
+    // Returns P + Q, where Q = (x, y), given the inverse of x - x(P).
+    Point AddWithInverse(const Point& P, const FieldElement& x, const FieldElement& y, const FieldElement& inverse)
+    {
+        FieldElement slope = (y - P.y) * inverse;
+        FieldElement sumX = (slope * slope) - P.x - x;
+        FieldElement sumY = (slope * (P.x - sumX)) - P.y;
+        return Point(move(sumX), move(sumY));
+    }
+}
+
+SequentialKeyEnumerator::SequentialKeyEnumerator(const EllipticCurve& curve, size_t blockSize, unsigned int threadCount)
+    : _curve(curve), _halfWidth((blockSize - 1) / 2), _threadCount(threadCount)
+{
+    if(blockSize < 3)
+        throw invalid_argument("Block size must be at least 3.");
+    
+    // Neither jG nor C + jG may be the point at infinity for the small multiples of a block.
+    uint64_t blockKeys = (2 * static_cast<uint64_t>(_halfWidth)) + 1;
+    if(curve.GetBasePointOrder() <= BigInteger(2 * blockKeys))
+        throw invalid_argument("Block size too large for the curve.");
+    
+    if(_threadCount == 0)
+        _threadCount = max(thread::hardware_concurrency(), 1u);
+    
+    // The multiples are computed in rounds which double their number: (m + i)G = iG + mG for i in [1, m],
+    //  with a single field inversion per round. The last of these is a doubling, which is done on its own.
+    const Point& G = curve.GetBasePoint();
+    _multiples.reserve(_halfWidth);
+    _multiples.push_back(G);
+    while(_multiples.size() < _halfWidth)
+    {
+        size_t m = _multiples.size();
+        size_t newCount = min(m, _halfWidth - m);
+        size_t addCount = (newCount == m) ? (m - 1) : newCount;
+        
+        vector<FieldElement> inverses;
+        inverses.reserve(addCount);
+        for(size_t i = 1; i <= addCount; i++)
+            inverses.push_back(_multiples[i - 1].x - _multiples[m - 1].x);
+        FieldElement::InvertBatch(inverses);
+        
+        for(size_t i = 1; i <= addCount; i++)
+            _multiples.push_back(AddWithInverse(_multiples[m - 1], _multiples[i - 1].x, _multiples[i - 1].y, inverses[i - 1]));
+        if(addCount < newCount)
+            _multiples.push_back(curve.AddPointsOnCurve(_multiples[m - 1], _multiples[m - 1]));
+    }
+    
+    _blockStep = curve.MultiplyBasePointWithScalar(BigInteger(blockKeys));
+}
+
+void SequentialKeyEnumerator::Enumerate(const BigInteger& first, uint64_t count, const Visitor& visitor) const
+{
+    if(count == 0)
+        return;
+    
+    // Every thread walks a contiguous part of whole blocks, except for the last part which may end early.
+    uint64_t blockKeys = (2 * static_cast<uint64_t>(_halfWidth)) + 1;
+    uint64_t blockCount = (count + blockKeys - 1) / blockKeys;
+    unsigned int threadCount = static_cast<unsigned int>(min(static_cast<uint64_t>(_threadCount), blockCount));
+    uint64_t partKeys = ((blockCount + threadCount - 1) / threadCount) * blockKeys;
+    
+    atomic<bool> isStopped(false);
+    Visitor stoppableVisitor = [&isStopped, &visitor](uint64_t offset, const Point& publicKey) -> bool
+    {
+        if(isStopped || !visitor(offset, publicKey))
+        {
+            isStopped = true;
+            return false;
+        }
+        
+        return true;
+    };
+    
+    // A part whose visitor throws stops the other parts, and the pool rethrows the exception.
+    auto enumeratePart = [&](unsigned int part)
+    {
+        uint64_t begin = part * partKeys;
+        if(begin >= count)
+            return;
+        
+        try
+        {
+            EnumeratePart(first, begin, min(partKeys, count - begin), stoppableVisitor);
+        }
+        catch(...)
+        {
+            isStopped = true;
+            throw;
+        }
+    };
+    
+    WorkerPool::GetSharedInstance().Run(threadCount, enumeratePart);
+}
+
+bool SequentialKeyEnumerator::EnumeratePart(const BigInteger& first, uint64_t offset, uint64_t count, const Visitor& visitor) const
+{
+    // Each block has the key in the middle, whose public key C is carried over from the previous block, and
+    //  _halfWidth keys on either side: C - jG and C + jG, both of which need the inverse of x(jG) - x(C).
+    const BigInteger& n = _curve.GetBasePointOrder();
+    const uint64_t blockKeys = (2 * static_cast<uint64_t>(_halfWidth)) + 1;
+    
+    // None of the sums are exceptional unless the middle key is within blockKeys of a multiple of n.
+    const BigInteger lowestSafeMiddle(blockKeys + 1);
+    const BigInteger highestSafeMiddle = n - lowestSafeMiddle;
+    
+    BigInteger middleKey = first + BigInteger(offset + _halfWidth);
+    Point middle = _curve.MultiplyBasePointWithScalar(middleKey);
+    vector<FieldElement> inverses;
+    inverses.reserve(_halfWidth + 1);
+    for(uint64_t begin = 0; begin < count; begin += blockKeys)
+    {
+        uint64_t keyCount = min(blockKeys, count - begin);
+        bool isLastBlock = (begin + keyCount == count);
+        
+        BigInteger reducedMiddle = middleKey % n;
+        if(reducedMiddle < lowestSafeMiddle || reducedMiddle > highestSafeMiddle)
+        {
+            if(!EnumerateBlockSlowly(first + BigInteger(offset + begin), offset + begin, keyCount, visitor))
+                return false;
+            
+            middleKey += BigInteger(blockKeys);
+            if(!isLastBlock)
+                middle = _curve.MultiplyBasePointWithScalar(middleKey);
+            continue;
+        }
+        
+        inverses.clear();
+        for(const Point& multiple : _multiples)
+            inverses.push_back(multiple.x - middle.x);
+        if(!isLastBlock)
+            inverses.push_back(_blockStep.x - middle.x);
+        FieldElement::InvertBatch(inverses);
+        
+        // The keys are visited in order: C - _halfWidth * G, ..., C - G, C, C + G, ..., C + _halfWidth * G.
+        for(size_t j = _halfWidth; j >= 1; j--)
+        {
+            uint64_t index = _halfWidth - j;
+            if(index >= keyCount)
+                return true;
+            
+            const Point& multiple = _multiples[j - 1];
+            if(!visitor(offset + begin + index, AddWithInverse(middle, multiple.x, -multiple.y, inverses[j - 1])))
+                return false;
+        }
+        
+        if(_halfWidth >= keyCount)
+            return true;
+        if(!visitor(offset + begin + _halfWidth, middle))
+            return false;
+        
+        for(size_t j = 1; j <= _halfWidth; j++)
+        {
+            uint64_t index = _halfWidth + j;
+            if(index >= keyCount)
+                return true;
+            
+            const Point& multiple = _multiples[j - 1];
+            if(!visitor(offset + begin + index, AddWithInverse(middle, multiple.x, multiple.y, inverses[j - 1])))
+                return false;
+        }
+        
+        if(!isLastBlock)
+        {
+            middle = AddWithInverse(middle, _blockStep.x, _blockStep.y, inverses[_halfWidth]);
+            middleKey += BigInteger(blockKeys);
+        }
+    }
+    
+    return true;
+}
+
+bool SequentialKeyEnumerator::EnumerateBlockSlowly(const BigInteger& firstKey, uint64_t offset, uint64_t keyCount, const Visitor& visitor) const
+{
+    BigInteger key = firstKey;
+    for(uint64_t i = 0; i < keyCount; i++)
+    {
+        if(!visitor(offset + i, _curve.MultiplyBasePointWithScalar(key)))
+            return false;
+        
+        key += BigInteger(1);
+    }
+    
+    return true;
+}
+
+vector<Point> SequentialKeyEnumerator::DerivePublicKeys(const BigInteger& first, size_t count) const
+{
+    // Every key is written to its own slot, so the threads need no synchronization.
+    vector<Point> publicKeys(count);
+    Enumerate(first, count, [&publicKeys](uint64_t offset, const Point& publicKey) -> bool
+    {
+        publicKeys[static_cast<size_t>(offset)] = publicKey;
+        return true;
+    });
+    
+    return publicKeys;
+}
+
+uint64_t SequentialKeyEnumerator::FindKeysWithPrefix(const BigInteger& first, uint64_t count, const vector<uint8_t>& prefix, const MatchHandler& handler) const
+{
+    // Prefixes within the compression flag and x-coordinate are compared without serializing y.
+    vector<uint8_t> flag = _curve.GetBasePoint().Serialize();
+    flag.resize(1);
+    if(!prefix.empty() && prefix[0] != flag[0])
+        return 0;
+    
+    // No serialized point is longer than the flag and both coordinates.
+    size_t coordinateSize = _curve.GetBasePoint().x.GetByteSize();
+    if(prefix.size() > 1 + (2 * coordinateSize))
+        return 0;
+    
+    bool comparesXOnly = (prefix.size() <= 1 + coordinateSize);
+    
+    mutex handlerMutex;
+    uint64_t matchCount = 0;
+    Enumerate(first, count, [&](uint64_t offset, const Point& publicKey) -> bool
+    {
+        if(publicKey.IsPointAtInfinity())
+            return true;
+        
+        if(comparesXOnly)
+        {
+            if(prefix.size() > 1)
+            {
+                vector<uint8_t> x = publicKey.x.GetBytes();
+                if(!equal(prefix.begin() + 1, prefix.end(), x.begin()))
+                    return true;
+            }
+        }
+        else
+        {
+            vector<uint8_t> serializedPoint = publicKey.Serialize();
+            if(!equal(prefix.begin(), prefix.end(), serializedPoint.begin()))
+                return true;
+        }
+        
+        lock_guard<mutex> lock(handlerMutex);
+        matchCount++;
+        return handler(first + BigInteger(offset), publicKey);
+    });
+    
+    return matchCount;
+}
@@ -0,0 +1,102 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__SequentialKeyEnumerator__
+#define __EccTool__SequentialKeyEnumerator__
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "BigInteger.h"
+#include "EllipticCurve.h"
+#include "Point.h"
+
+using namespace std;
+
+// Computes the public keys of consecutive private keys k, k + 1, k + 2, ... in bulk, for deriving key
+//  ranges and for searching them for public keys with a given serialized prefix.
+//
+// Rather than multiplying G with every key, keys are walked in blocks: the public key C of the key in the
+//  middle of a block is known, and the others are C + jG and C - jG for small j, whose multiples jG are
+//  computed once. Every affine addition needs the inverse of x(jG) - x(C), the same one for C + jG and
+//  C - jG, and the inverses of a whole block are computed with a single field inversion (see
+//  FieldElement::InvertBatch()). A key then costs about five field multiplications, against a full
+//  scalar multiplication and field inversion for each call of MultiplyBasePointWithScalar().
+//
+// Ranges are split into contiguous parts which are walked on the workers of WorkerPool::GetSharedInstance().
+class SequentialKeyEnumerator
+{
+public:
+    // Called with the offset of each key from the first key of the range and its public key. Returning false
+    //  stops the enumeration (keys already being computed on other threads may still be visited).
+    typedef function<bool(uint64_t offset, const Point& publicKey)> Visitor;
+    
+    // Called with each private key whose public key matches, and the public key. Returning false stops
+    //  the search.
+    typedef function<bool(const BigInteger& privateKey, const Point& publicKey)> MatchHandler;
+    
+    // The default number of keys which share a field inversion.
+    static const size_t DEFAULT_BLOCK_SIZE;
+    
+    // Creates an enumerator for the given curve, which must outlive it. Each block covers about blockSize
+    //  keys (at least 3), for which the multiples of G are computed up front. Ranges are split across up to
+    //  threadCount threads (0 uses one thread per hardware thread).
+    SequentialKeyEnumerator(const EllipticCurve& curve, size_t blockSize = DEFAULT_BLOCK_SIZE, unsigned int threadCount = 0);
+    
+    // Calls the visitor with the public key of each of the count private keys starting at first (reduced
+    //  mod n, so a multiple of n gives the point at infinity). The keys of each part of the range are
+    //  visited in order, but the parts are visited concurrently, so the visitor must be thread-safe. If the
+    //  visitor throws, the enumeration stops and the first exception is rethrown.
+    void Enumerate(const BigInteger& first, uint64_t count, const Visitor& visitor) const;
+    
+    // Returns the public keys of the count private keys starting at first.
+    vector<Point> DerivePublicKeys(const BigInteger& first, size_t count) const;
+    
+    // Calls the handler (from one thread at a time) for each of the count private keys starting at first
+    //  whose serialized public key (see Point::Serialize()) starts with the given prefix. Returns the
+    //  number of matches (0 for a prefix longer than a serialized point). An exception thrown by the
+    //  handler stops the search and is rethrown.
+    uint64_t FindKeysWithPrefix(const BigInteger& first, uint64_t count, const vector<uint8_t>& prefix, const MatchHandler& handler) const;
+    
+private:
+    const EllipticCurve& _curve;
+    
+    // The number of keys on either side of the middle of a block, so a block covers 2 * _halfWidth + 1 keys.
+    size_t _halfWidth;
+    
+    unsigned int _threadCount;
+    
+    // _multiples[j - 1] = jG for j in [1, _halfWidth], and the distance between the middles of blocks.
+    vector<Point> _multiples;
+    Point _blockStep;
+    
+    // Visits the keys first + offset, ..., first + offset + count - 1 on the calling thread. Returns false if
+    //  the visitor stopped the enumeration.
+    bool EnumeratePart(const BigInteger& first, uint64_t offset, uint64_t count, const Visitor& visitor) const;
+    
+    // Computes the public keys of the keyCount keys starting at firstKey (at the given offset) one at a time,
+    //  for the blocks in which some C + jG or C - jG is the point at infinity or doubles a point.
+    bool EnumerateBlockSlowly(const BigInteger& firstKey, uint64_t offset, uint64_t keyCount, const Visitor& visitor) const;
+};
+
+#endif /* defined(__EccTool__SequentialKeyEnumerator__) */
@@ -0,0 +1,152 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "SharedSecretCache.h"
+#include <stdexcept>
+
+using namespace std;
+
+const size_t SharedSecretCache::DEFAULT_CAPACITY = 1024;
+
+double SharedSecretCache::Statistics::GetHitRate() const
+{
+    uint64_t lookups = hits + misses;
+    return (lookups == 0) ? 0.0 : (static_cast<double>(hits) / static_cast<double>(lookups));
+}
+
+SharedSecretCache::SharedSecretCache(size_t capacity) : _capacity(capacity)
+{
+    if(capacity < 1)
+        throw invalid_argument("Cache capacity must be at least 1.");
+    
+    _statistics.hits = 0;
+    _statistics.misses = 0;
+    _statistics.evictions = 0;
+    _statistics.invalidations = 0;
+}
+
+bool SharedSecretCache::Lookup(const string& curveName, const vector<uint8_t>& ownPublicKey, const vector<uint8_t>& peerPublicKey, vector<uint8_t>& secret)
+{
+    string key = MakeKey(MakeOwnKey(curveName, ownPublicKey), peerPublicKey);
+    lock_guard<mutex> lock(_mutex);
+    
+    auto found = _index.find(key);
+    if(found == _index.end())
+    {
+        _statistics.misses++;
+        return false;
+    }
+    
+    // Move the secret to the front of the list as the most recently used.
+    _entries.splice(_entries.begin(), _entries, found->second);
+    _statistics.hits++;
+    secret = found->second->secret;
+    
+    return true;
+}
+
+void SharedSecretCache::Insert(const string& curveName, const vector<uint8_t>& ownPublicKey, const vector<uint8_t>& peerPublicKey, const vector<uint8_t>& secret)
+{
+    string ownKey = MakeOwnKey(curveName, ownPublicKey);
+    string key = MakeKey(ownKey, peerPublicKey);
+    lock_guard<mutex> lock(_mutex);
+    
+    auto found = _index.find(key);
+    if(found != _index.end())
+    {
+        found->second->secret = secret;
+        _entries.splice(_entries.begin(), _entries, found->second);
+        return;
+    }
+    
+    if(_entries.size() >= _capacity)
+    {
+        _index.erase(_entries.back().key);
+        _entries.pop_back();
+        _statistics.evictions++;
+    }
+    
+    Entry newEntry;
+    newEntry.ownKey = move(ownKey);
+    newEntry.key = key;
+    newEntry.secret = secret;
+    _entries.push_front(move(newEntry));
+    _index[key] = _entries.begin();
+}
+
+void SharedSecretCache::Invalidate(const string& curveName, const vector<uint8_t>& ownPublicKey)
+{
+    string ownKey = MakeOwnKey(curveName, ownPublicKey);
+    lock_guard<mutex> lock(_mutex);
+    
+    for(auto entry = _entries.begin(); entry != _entries.end();)
+    {
+        if(entry->ownKey != ownKey)
+        {
+            ++entry;
+            continue;
+        }
+        
+        _index.erase(entry->key);
+        entry = _entries.erase(entry);
+        _statistics.invalidations++;
+    }
+}
+
+void SharedSecretCache::Clear()
+{
+    lock_guard<mutex> lock(_mutex);
+    _index.clear();
+    _entries.clear();
+}
+
+size_t SharedSecretCache::GetSize() const
+{
+    lock_guard<mutex> lock(_mutex);
+    return _entries.size();
+}
+
+SharedSecretCache::Statistics SharedSecretCache::GetStatistics() const
+{
+    lock_guard<mutex> lock(_mutex);
+    return _statistics;
+}
+
+string SharedSecretCache::MakeOwnKey(const string& curveName, const vector<uint8_t>& ownPublicKey)
+{
+    string key = curveName;
+    key.push_back(':');
+    key.append(ownPublicKey.begin(), ownPublicKey.end());
+    
+    return key;
+}
+
+string SharedSecretCache::MakeKey(const string& ownKey, const vector<uint8_t>& peerPublicKey)
+{
+    // The own public keys of a curve all have the same size, so the peer's key starts at a fixed offset.
+    string key = ownKey;
+    key.push_back(':');
+    key.append(peerPublicKey.begin(), peerPublicKey.end());
+    
+    return key;
+}
@@ -0,0 +1,104 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__SharedSecretCache__
+#define __EccTool__SharedSecretCache__
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// A bounded, thread-safe cache of the shared secrets derived by EccAlg::ComputeSharedSecret(), keyed by the
+//  curve, the alg's own public key and the peer's public key, so that repeated agreements with the same
+//  peer skip the scalar multiplication (and the validation of the peer's key). The least recently used
+//  secret is evicted when the cache is full, and all secrets of an own key are removed when it is rotated.
+class SharedSecretCache
+{
+public:
+    // Counters of the cache activity since it was created.
+    struct Statistics
+    {
+        // Lookups which returned a secret, and lookups which did not.
+        uint64_t hits;
+        uint64_t misses;
+        
+        // Secrets evicted because the cache was full, and secrets removed by Invalidate().
+        uint64_t evictions;
+        uint64_t invalidations;
+        
+        // Returns the share of lookups which were hits (0 before the first lookup).
+        double GetHitRate() const;
+    };
+    
+    // The default capacity.
+    static const size_t DEFAULT_CAPACITY;
+    
+    // Creates a cache which holds at most capacity secrets. Capacity must be at least 1.
+    explicit SharedSecretCache(size_t capacity = DEFAULT_CAPACITY);
+    
+    // Returns whether the secret of the given keys is cached, and sets it if so.
+    bool Lookup(const string& curveName, const vector<uint8_t>& ownPublicKey, const vector<uint8_t>& peerPublicKey, vector<uint8_t>& secret);
+    
+    // Adds (or replaces) the secret of the given keys.
+    void Insert(const string& curveName, const vector<uint8_t>& ownPublicKey, const vector<uint8_t>& peerPublicKey, const vector<uint8_t>& secret);
+    
+    // Removes all secrets derived with the given own key, such as when its private key is replaced.
+    void Invalidate(const string& curveName, const vector<uint8_t>& ownPublicKey);
+    
+    // Removes all secrets from the cache. The statistics are kept.
+    void Clear();
+    
+    // Returns the number of secrets currently in the cache.
+    size_t GetSize() const;
+    
+    Statistics GetStatistics() const;
+    
+private:
+    struct Entry
+    {
+        string ownKey;
+        string key;
+        vector<uint8_t> secret;
+    };
+    
+    // The entries, most recently used first, and their index by key.
+    list<Entry> _entries;
+    unordered_map<string, list<Entry>::iterator> _index;
+    
+    size_t _capacity;
+    Statistics _statistics;
+    
+    mutable mutex _mutex;
+    
+    // Builds the key of an own key (the curve name and the public key), and the key of a secret (which
+    //  adds the peer's public key).
+    static string MakeOwnKey(const string& curveName, const vector<uint8_t>& ownPublicKey);
+    static string MakeKey(const string& ownKey, const vector<uint8_t>& peerPublicKey);
+};
+
+#endif /* defined(__EccTool__SharedSecretCache__) */
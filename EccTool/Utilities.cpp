@@ -28,6 +28,12 @@
 #include <math.h>
 #include <algorithm>
 
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
 // Converts a string character into the ehx byte it represents.
 uint8_t GetValidHexDigit(char digit)
 {
@@ -103,6 +109,15 @@ void utilities::DebugLog(const char* message)
 #endif
 }
 
+long utilities::GetCurrentProcessId()
+{
+#if defined(_WIN32)
+    return static_cast<long>(_getpid());
+#else
+    return static_cast<long>(getpid());
+#endif
+}
+
 std::ostream& operator<<(std::ostream& os, const std::vector<uint8_t>& bytes)
 {
     stringstream ss;
@@ -43,6 +43,9 @@ namespace utilities
     // Log the povided message to console when built in debug mode.
     void DebugLog(const string& message);
     void DebugLog(const char* message);
+    
+    // Returns the id of the current process, which changes in a child created by fork().
+    long GetCurrentProcessId();
 }
 
 // Operators go outside of the namespace.
@@ -0,0 +1,144 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include "WorkerPool.h"
+#include <algorithm>
+#include <exception>
+#include <system_error>
+
+WorkerPool WorkerPool::_sharedInstance(max(thread::hardware_concurrency(), 2u) - 1);
+
+WorkerPool& WorkerPool::GetSharedInstance()
+{
+    return _sharedInstance;
+}
+
+WorkerPool::WorkerPool(unsigned int maxWorkerCount) : _maxWorkerCount(maxWorkerCount), _isStopping(false)
+{
+    // Starting a worker can then only fail in the thread constructor, never after it.
+    _workers.reserve(maxWorkerCount);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        lock_guard<mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    
+    _hasWork.notify_all();
+    for(thread& worker : _workers)
+        worker.join();
+}
+
+void WorkerPool::Run(unsigned int taskCount, const function<void(unsigned int)>& task)
+{
+    if(taskCount == 0)
+        return;
+    
+    // Every task counts itself done under the lock, so no queued task refers to this frame once Run()
+    //  returns.
+    unsigned int remainingTaskCount = taskCount;
+    exception_ptr firstException;
+    auto runTask = [&](unsigned int index)
+    {
+        exception_ptr exception;
+        try
+        {
+            task(index);
+        }
+        catch(...)
+        {
+            exception = current_exception();
+        }
+        
+        lock_guard<mutex> lock(_mutex);
+        if(exception && !firstException)
+            firstException = exception;
+        if(--remainingTaskCount == 0)
+            _taskReturned.notify_all();
+    };
+    
+    if(taskCount > 1)
+    {
+        lock_guard<mutex> lock(_mutex);
+        for(unsigned int i = 1; i < taskCount; i++)
+            _queue.push_back([&runTask, i]() { runTask(i); });
+        
+        // If no more threads can be started, the calling thread runs the remaining tasks.
+        size_t workerCount = min(static_cast<size_t>(_maxWorkerCount), static_cast<size_t>(taskCount - 1));
+        try
+        {
+            while(_workers.size() < workerCount)
+                _workers.push_back(thread(&WorkerPool::RunWorker, this));
+        }
+        catch(const system_error&)
+        {
+        }
+    }
+    
+    _hasWork.notify_all();
+    runTask(0);
+    
+    unique_lock<mutex> lock(_mutex);
+    while(remainingTaskCount != 0)
+    {
+        if(_queue.empty())
+        {
+            _taskReturned.wait(lock);
+            continue;
+        }
+        
+        function<void()> queuedTask = move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        queuedTask();
+        lock.lock();
+    }
+    
+    if(firstException)
+        rethrow_exception(firstException);
+}
+
+unsigned int WorkerPool::GetMaxWorkerCount() const
+{
+    return _maxWorkerCount;
+}
+
+void WorkerPool::RunWorker()
+{
+    unique_lock<mutex> lock(_mutex);
+    for(;;)
+    {
+        while(_queue.empty() && !_isStopping)
+            _hasWork.wait(lock);
+        if(_queue.empty())
+            return;
+        
+        function<void()> queuedTask = move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        queuedTask();
+        lock.lock();
+    }
+}
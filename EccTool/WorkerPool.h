@@ -0,0 +1,85 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__WorkerPool__
+#define __EccTool__WorkerPool__
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// A small set of persistent threads on which a single operation runs its pieces in parallel, so that an
+//  operation using several threads does not pay for starting and joining them on every call. Workers are
+//  started on first use, up to the maximum count, and run until the pool is destroyed.
+class WorkerPool
+{
+public:
+    // Returns the pool shared by the whole process, which has up to one worker per hardware thread besides
+    //  the calling thread.
+    static WorkerPool& GetSharedInstance();
+    
+    // Creates a pool of up to maxWorkerCount workers. With none, Run() calls every task on the calling thread.
+    explicit WorkerPool(unsigned int maxWorkerCount);
+    
+    // Stops and joins the workers, once every queued task has run.
+    ~WorkerPool();
+    
+    // Calls task(0), ..., task(taskCount - 1) and returns once all of them have returned. Task 0 runs on the
+    //  calling thread and the others on the workers. While it waits, the calling thread runs queued tasks
+    //  itself, so a call completes even when every worker is busy (for example with a Run() from within a
+    //  task). If any task throws, the first exception is rethrown once all tasks have returned.
+    void Run(unsigned int taskCount, const function<void(unsigned int)>& task);
+    
+    // Returns the maximum number of workers.
+    unsigned int GetMaxWorkerCount() const;
+    
+private:
+    // Pools can't be copied.
+    WorkerPool(const WorkerPool&);
+    WorkerPool& operator=(const WorkerPool&);
+    
+    // Runs queued tasks until the pool is stopped.
+    void RunWorker();
+    
+    unsigned int _maxWorkerCount;
+    
+    // Guards everything below, and the progress of every Run().
+    mutex _mutex;
+    
+    // Signalled when tasks are queued or the pool is stopped, and when a task returns.
+    condition_variable _hasWork;
+    condition_variable _taskReturned;
+    
+    deque<function<void()>> _queue;
+    vector<thread> _workers;
+    bool _isStopping;
+    
+    static WorkerPool _sharedInstance;
+};
+
+#endif /* defined(__EccTool__WorkerPool__) */
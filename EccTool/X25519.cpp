@@ -0,0 +1,130 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#include <stdexcept>
+#include "X25519.h"
+#include "FieldElement25519.h"
+
+using namespace std;
+
+const char* const X25519::CURVE_NAME = "curve25519";
+const char* const X25519::CURVE_ALIAS = "X25519";
+
+namespace
+{
+    // (A - 2) / 4 for the curve coefficient A = 486662.
+    const uint32_t A24 = 121665;
+    
+    void EnsureKeySize(const vector<uint8_t>& key)
+    {
+        if(key.size() != X25519::KEY_SIZE)
+            throw invalid_argument("X25519 keys must be 32 bytes.");
+    }
+}
+
+vector<uint8_t> X25519::ClampScalar(vector<uint8_t> scalar)
+{
+    EnsureKeySize(scalar);
+    
+    scalar[0] &= 0xF8;
+    scalar[31] &= 0x7F;
+    scalar[31] |= 0x40;
+    
+    return scalar;
+}
+
+vector<uint8_t> X25519::ScalarMultiply(const vector<uint8_t>& scalar, const vector<uint8_t>& u)
+{
+    vector<uint8_t> k = ClampScalar(scalar);
+    FieldElement25519 x1 = FieldElement25519::FromBytes(u);
+    
+    // The Montgomery ladder (found here: RFC 7748, Section 5) keeps (x2 : z2) = k' * P and
+    //  (x3 : z3) = (k' + 1) * P for the bits k' of k processed so far. Each step adds the two points (whose
+    //  difference is always P, with u-coordinate x1) and doubles one of them, chosen by the next bit through
+    //  constant-time swaps rather than a branch.
+    FieldElement25519 x2(1);
+    FieldElement25519 z2(0);
+    FieldElement25519 x3 = x1;
+    FieldElement25519 z3(1);
+    uint64_t swap = 0;
+    
+    for(int t = 254; t >= 0; --t)
+    {
+        uint64_t bit = (k[t / 8] >> (t % 8)) & 1;
+        swap ^= bit;
+        FieldElement25519::ConditionalSwap(x2, x3, swap);
+        FieldElement25519::ConditionalSwap(z2, z3, swap);
+        swap = bit;
+        
+        FieldElement25519 A = x2 + z2;
+        FieldElement25519 AA = A;
+        AA.Square();
+        FieldElement25519 B = x2 - z2;
+        FieldElement25519 BB = B;
+        BB.Square();
+        FieldElement25519 E = AA - BB;
+        FieldElement25519 C = x3 + z3;
+        FieldElement25519 D = x3 - z3;
+        FieldElement25519 DA = D * A;
+        FieldElement25519 CB = C * B;
+        
+        x3 = DA + CB;
+        x3.Square();
+        z3 = DA - CB;
+        z3.Square();
+        z3 *= x1;
+        x2 = AA * BB;
+        z2 = E;
+        z2.MultiplySmall(A24);
+        z2 += AA;
+        z2 *= E;
+    }
+    
+    FieldElement25519::ConditionalSwap(x2, x3, swap);
+    FieldElement25519::ConditionalSwap(z2, z3, swap);
+    
+    // The point at infinity (z2 = 0) comes out as u = 0, since the inverse of zero is zero.
+    return (x2 * z2.GetInverse()).GetBytes();
+}
+
+vector<uint8_t> X25519::ScalarMultiplyBase(const vector<uint8_t>& scalar)
+{
+    vector<uint8_t> basePoint(KEY_SIZE, 0);
+    basePoint[0] = 9;
+    
+    return ScalarMultiply(scalar, basePoint);
+}
+
+vector<uint8_t> X25519::ComputeSharedSecret(const vector<uint8_t>& privateKey, const vector<uint8_t>& publicKey)
+{
+    vector<uint8_t> sharedSecret = ScalarMultiply(privateKey, publicKey);
+    
+    uint8_t allBits = 0;
+    for(uint8_t byte : sharedSecret)
+        allBits |= byte;
+    
+    if(allBits == 0)
+        throw invalid_argument("The public key is a point of small order.");
+    
+    return sharedSecret;
+}
@@ -0,0 +1,63 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+#ifndef __EccTool__X25519__
+#define __EccTool__X25519__
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// X25519 implements Diffie-Hellman on the Montgomery curve Curve25519: v^2 = u^3 + 486662u^2 + u over the
+//  field of p = 2^255 - 19 (as specified by RFC 7748).
+//
+// Points are given by their u-coordinate only and multiplied with the x-only Montgomery ladder, which does
+//  the same field operations for every scalar bit. Keys and u-coordinates are 32 little-endian bytes.
+class X25519
+{
+public:
+    // The name of the curve in key files and the curve list, and an alias for it.
+    static const char* const CURVE_NAME;
+    static const char* const CURVE_ALIAS;
+    
+    // The size of scalars (private keys) and u-coordinates (public keys and shared secrets).
+    static const size_t KEY_SIZE = 32;
+    
+    // Clamps a 32-byte scalar: clears its 3 low bits (making it a multiple of the cofactor 8) and its top
+    //  bit, and sets bit 254.
+    static vector<uint8_t> ClampScalar(vector<uint8_t> scalar);
+    
+    // The X25519 function: multiplies the point with the given u-coordinate by the clamped scalar and
+    //  returns the u-coordinate of the result.
+    static vector<uint8_t> ScalarMultiply(const vector<uint8_t>& scalar, const vector<uint8_t>& u);
+    
+    // Multiplies the base point (u = 9) by the clamped scalar, giving the public key of a private key.
+    static vector<uint8_t> ScalarMultiplyBase(const vector<uint8_t>& scalar);
+    
+    // Computes the shared secret of a private key and another party's public key. Throws invalid_argument
+    //  if the result is zero, which happens only for public keys of small order.
+    static vector<uint8_t> ComputeSharedSecret(const vector<uint8_t>& privateKey, const vector<uint8_t>& publicKey);
+};
+
+#endif /* defined(__EccTool__X25519__) */
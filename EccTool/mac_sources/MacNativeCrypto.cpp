@@ -33,6 +33,7 @@
 
 #include <vector>
 #include <stdint.h>
+#include <stdlib.h>
 
 #include "NativeCrypto.h"
 
@@ -56,4 +57,22 @@ vector<uint8_t> NativeCrypto::HashData(const vector<uint8_t>& data)
     CC_SHA256(data.data(), static_cast<CC_LONG>(data.size()), digest.data());
         
     return digest;
-}
\ No newline at end of file
+}
+
+vector<uint8_t> NativeCrypto::HashDataWithSha512(const vector<uint8_t>& data)
+{
+	// For Apple, use the CommonCrypto implementation of SHA 512.
+    vector<uint8_t> digest(CC_SHA512_DIGEST_LENGTH);
+    CC_SHA512(data.data(), static_cast<CC_LONG>(data.size()), digest.data());
+        
+    return digest;
+}
+
+vector<uint8_t> NativeCrypto::GenerateRandomBytes(size_t size)
+{
+	// For Apple, use arc4random_buf, which is seeded by the kernel random number generator and never fails.
+    vector<uint8_t> bytes(size);
+    arc4random_buf(bytes.data(), bytes.size());
+        
+    return bytes;
+}
@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <algorithm>
 #include <tuple>
+#include <cstdlib>
 #include "KeySerializer.h"
 
 using namespace std;
@@ -41,8 +42,8 @@ void GenerateKeys(int curveId, string keyName);
 void LoadKey(string keyname, bool printPrivate);
 void Encrypt(string keyName, string outFile, string msg);
 void Decrypt(string keyName, string inFile);
-void Sign(const string& keyname, const string& inFile, const string& outFile);
-void Verify(const string& keyname, const string& inFile);
+void Sign(const string& keyname, const string& inFile, const string& outFile, bool useSchnorr);
+void Verify(const string& keyname, const string& inFile, bool useSchnorr);
 
 void SaveToFile(const string& fileName, const string& data);
 string ReadFromFile(const string& fileName);
@@ -66,6 +67,11 @@ int main(int argc, const char * argv[])
 {
     try
     {
+        // Precomputed tables are kept in files (and built only once) if a directory is given for them.
+        const char* tableDirectory = getenv("ECCTOOL_TABLE_DIR");
+        if(tableDirectory != nullptr)
+            CurveContext::SetTableDirectory(tableDirectory);
+        
         // Display help if no args (except the always passed in name) were given.
         if(argc <= 1)
         {
@@ -152,7 +158,14 @@ int main(int argc, const char * argv[])
             string inFile(argv[3]);
             string outFile(argv[4]);
             
-            Sign(keyname, inFile, outFile);
+            bool useSchnorr = false;
+            if(argc > 5)
+            {
+                if(ToLower(argv[5]) == "-schnorr")
+                    useSchnorr = true;
+            }
+            
+            Sign(keyname, inFile, outFile, useSchnorr);
             cout << endl;
             return 0;
                 
@@ -165,7 +178,14 @@ int main(int argc, const char * argv[])
             string keyname(argv[2]);
             string inFile(argv[3]);
             
-            Verify(keyname, inFile);
+            bool useSchnorr = false;
+            if(argc > 4)
+            {
+                if(ToLower(argv[4]) == "-schnorr")
+                    useSchnorr = true;
+            }
+            
+            Verify(keyname, inFile, useSchnorr);
             cout << endl;
             return 0;
         }
@@ -196,17 +216,23 @@ void PrintHelpMessage()
     cout << "    -d <keyname> <in>             Decrypt the message in the indicated " << endl;
     cout << "                                  file with the indicated key." << endl;
     cout << "    -s <keyname> <in> <out>       Signs the message in the indicated " << endl;
-    cout << "                                  file with the indicated key. Saves the" << endl;
+    cout << "       [-schnorr]                 file with the indicated key. Saves the" << endl;
     cout << "                                  file with signature append to out file." << endl;
+    cout << "                                  Optionally sign with a BIP340 Schnorr" << endl;
+    cout << "                                  signature (secp256k1 keys only)." << endl;
     cout << "    -v <keyname> <in>             Verfies the signed message in the" << endl;
-    cout << "                                  indicated file. Prints \"Valid\"" << endl;
-    cout << "                                  or \"Invalid\"." << endl;
+    cout << "       [-schnorr]                 indicated file. Prints \"Valid\"" << endl;
+    cout << "                                  or \"Invalid\". Optionally verify a" << endl;
+    cout << "                                  BIP340 Schnorr signature." << endl;
     cout << "    -h                            Display this help message." << endl;
+    cout << endl;
+    cout << "Set ECCTOOL_TABLE_DIR to a directory to keep precomputed tables there, which" << endl;
+    cout << "speeds up later runs." << endl;
 }
 
 void ListCurves()
 {
-    auto curves = GetSupportedCurves();
+    auto curves = CurveContext::GetSupportedCurveNames();
     cout << "Supported curves:" << endl;
     for(size_t i = 0; i < curves.size(); i++)
     {
@@ -217,7 +243,7 @@ void ListCurves()
 // Generates a keypair and saves it to disk.
 void GenerateKeys(int curveId, string keyName)
 {
-    auto curves = GetSupportedCurves();
+    auto curves = CurveContext::GetSupportedCurveNames();
     
     // Check curveId.
     if((curveId <= 0) || (curveId > static_cast<int>(curves.size())))
@@ -237,9 +263,7 @@ void GenerateKeys(int curveId, string keyName)
     // Generate keys.
     string curveName = curves[curveId-1];
     cout << "Preparing ECC domain parameters for curve \'" << curveName << "\'..." << endl;
-    DomainParameters params = GetCurveByName(curveName);
-    EllipticCurve curve(params);
-    EccAlg alg(curve);
+    EccAlg alg(CurveContext::GetByName(curveName));
     
     cout << "Generating keys..." << endl;
     alg.GenerateKeys();
@@ -338,7 +362,7 @@ tuple<string, vector<uint8_t>> ReadSignatureBlock(const string& signatureBlock)
     return make_tuple(message, utilities::HexStringToBytes(signatureStr));
 }
 
-void Sign(const string& keyName, const string& inFile, const string& outFile)
+void Sign(const string& keyName, const string& inFile, const string& outFile, bool useSchnorr)
 {
     cout << "Loading key \"" << keyName << "\"..." << endl;
     EccAlg alg = ReadKeyFromFile(keyName);
@@ -351,7 +375,7 @@ void Sign(const string& keyName, const string& inFile, const string& outFile)
     vector<uint8_t> messageBytes(message.begin(), message.end());
     cout << "Message loaded." << endl;
     cout << "Signing..." << endl;
-    auto signature = alg.Sign(messageBytes);
+    auto signature = useSchnorr ? alg.SignSchnorr(messageBytes) : alg.Sign(messageBytes);
     
     cout << "Message successfully signed." << endl;
     
@@ -361,7 +385,7 @@ void Sign(const string& keyName, const string& inFile, const string& outFile)
     
 }
 
-void Verify(const string& keyName, const string& inFile)
+void Verify(const string& keyName, const string& inFile, bool useSchnorr)
 {
     cout << "Loading key \"" << keyName << "\"..." << endl;
     EccAlg alg = ReadKeyFromFile(keyName);
@@ -374,7 +398,7 @@ void Verify(const string& keyName, const string& inFile)
     vector<uint8_t> messageBytes(parsedMessage.begin(), parsedMessage.end());
     vector<uint8_t> parsedSignature = get<1>(signatureParts);
     cout << "Verifying..." << endl;
-    bool result = alg.Verify(messageBytes, parsedSignature);
+    bool result = useSchnorr ? alg.VerifySchnorr(messageBytes, parsedSignature) : alg.Verify(messageBytes, parsedSignature);
     
     cout << (result ? "Valid" : "Invalid") << endl;
 }
@@ -0,0 +1,140 @@
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2014 Joshua Strom
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in all
+//  copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//  SOFTWARE.
+//
+
+// Generates EmbeddedTables.cpp, the base point comb tables compiled into EccTool. It is built by the
+//  GenerateEmbeddedTables target of the Xcode and Visual Studio projects: the EccTool sources except
+//  main.cpp, with tools/NoEmbeddedTables.cpp in place of EmbeddedTables.cpp. Run it whenever the comb table
+//  layout or the default comb parameters change:
+//      GenerateEmbeddedTables > EmbeddedTables.cpp
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DefinedCurveDomainParameters.h"
+#include "EllipticCurve.h"
+
+using namespace std;
+using namespace ecc;
+
+namespace
+{
+    // The curves with embedded tables, and the names of their arrays.
+    const char* EMBEDDED_CURVES[][2] = {
+        { "secp112r1", "SECP112R1_BASE_POINT_TABLE" },
+        { "secp256k1", "SECP256K1_BASE_POINT_TABLE" }
+    };
+    
+    void PrintLicense()
+    {
+        cout << "//" << endl;
+        cout << "//  The MIT License (MIT)" << endl;
+        cout << "//" << endl;
+        cout << "//  Copyright (c) 2014 Joshua Strom" << endl;
+        cout << "//" << endl;
+        cout << "//  Permission is hereby granted, free of charge, to any person obtaining a copy" << endl;
+        cout << "//  of this software and associated documentation files (the \"Software\"), to deal" << endl;
+        cout << "//  in the Software without restriction, including without limitation the rights" << endl;
+        cout << "//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell" << endl;
+        cout << "//  copies of the Software, and to permit persons to whom the Software is" << endl;
+        cout << "//  furnished to do so, subject to the following conditions:" << endl;
+        cout << "//" << endl;
+        cout << "//  The above copyright notice and this permission notice shall be included in all" << endl;
+        cout << "//  copies or substantial portions of the Software." << endl;
+        cout << "//" << endl;
+        cout << "//  THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR" << endl;
+        cout << "//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY," << endl;
+        cout << "//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE" << endl;
+        cout << "//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER" << endl;
+        cout << "//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM," << endl;
+        cout << "//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE" << endl;
+        cout << "//  SOFTWARE." << endl;
+        cout << "//" << endl;
+    }
+    
+    void PrintTable(const char* arrayName, const vector<uint8_t>& serializedPoints)
+    {
+        cout << "    const uint8_t " << arrayName << "[] = {";
+        for(size_t i = 0; i < serializedPoints.size(); i++)
+        {
+            if((i % 16) == 0)
+                cout << endl << "        ";
+            else
+                cout << ' ';
+            
+            cout << "0x" << hex << uppercase << setw(2) << setfill('0') << static_cast<unsigned int>(serializedPoints[i]) << dec;
+            if(i + 1 < serializedPoints.size())
+                cout << ',';
+        }
+        cout << endl << "    };" << endl;
+    }
+}
+
+int main()
+{
+    const CombParameters parameters = EllipticCurve::DEFAULT_COMB_PARAMETERS;
+    
+    PrintLicense();
+    cout << endl;
+    cout << "// Generated by tools/GenerateEmbeddedTables.cpp, do not edit." << endl;
+    cout << endl;
+    cout << "#include \"EmbeddedTables.h\"" << endl;
+    cout << endl;
+    cout << "using namespace std;" << endl;
+    cout << "using namespace ecc;" << endl;
+    cout << endl;
+    cout << "namespace" << endl;
+    cout << "{" << endl;
+    
+    for(const auto& embeddedCurve : EMBEDDED_CURVES)
+    {
+        EllipticCurve curve(GetCurveByName(embeddedCurve[0]));
+        auto table = curve.PrecomputeFixedPointTable(curve.GetBasePoint(), parameters);
+        PrintTable(embeddedCurve[1], curve.SerializeFixedPointTable(*table));
+        cout << "    " << endl;
+    }
+    
+    cout << "    const EmbeddedTable EMBEDDED_TABLES[] = {" << endl;
+    for(size_t i = 0; i < sizeof(EMBEDDED_CURVES) / sizeof(EMBEDDED_CURVES[0]); i++)
+    {
+        cout << "        { \"" << EMBEDDED_CURVES[i][0] << "\", { " << parameters.teeth << ", " << parameters.spacing << " }, "
+             << EMBEDDED_CURVES[i][1] << ", sizeof(" << EMBEDDED_CURVES[i][1] << ") }";
+        cout << ((i + 1 < sizeof(EMBEDDED_CURVES) / sizeof(EMBEDDED_CURVES[0])) ? "," : "") << endl;
+    }
+    cout << "    };" << endl;
+    cout << "}" << endl;
+    cout << endl;
+    cout << "const EmbeddedTable* ecc::FindEmbeddedBasePointTable(const string& curveName)" << endl;
+    cout << "{" << endl;
+    cout << "    for(const EmbeddedTable& table : EMBEDDED_TABLES)" << endl;
+    cout << "    {" << endl;
+    cout << "        if(curveName == table.curveName)" << endl;
+    cout << "            return &table;" << endl;
+    cout << "    }" << endl;
+    cout << "    " << endl;
+    cout << "    return nullptr;" << endl;
+    cout << "}" << endl;
+    
+    return 0;
+}
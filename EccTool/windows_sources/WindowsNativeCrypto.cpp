@@ -125,4 +125,43 @@ vector<uint8_t> NativeCrypto::HashData(const vector<uint8_t>& data)
 		throw runtime_error("Unable to finish hash.");
 
 	return hash;
-}
\ No newline at end of file
+}
+
+vector<uint8_t> NativeCrypto::HashDataWithSha512(const vector<uint8_t>& data)
+{
+	// Same as HashData, with the SHA-512 algorithm provider.
+	AlgHandle hashAlgHandle(new BCRYPT_ALG_HANDLE());
+	NTSTATUS status = BCryptOpenAlgorithmProvider(hashAlgHandle.get(),
+		BCRYPT_SHA512_ALGORITHM,
+		MS_PRIMITIVE_PROVIDER,
+		0);
+	if (status != 0)
+		throw runtime_error("Unable to create hash alg.");
+
+	HashHandle hashHandle(new BCRYPT_HASH_HANDLE());
+	status = BCryptCreateHash(*hashAlgHandle, hashHandle.get(), NULL, 0, NULL, 0, 0);
+
+	vector<uint8_t> hash(64);
+	status = BCryptHashData(*hashHandle, const_cast<uint8_t*>(data.data()), data.size(), 0);
+	if (status != 0)
+		throw runtime_error("Unable to hash data.");
+	status = BCryptFinishHash(*hashHandle, const_cast<uint8_t*>(hash.data()), hash.size(), 0);
+	if (status != 0)
+		throw runtime_error("Unable to finish hash.");
+
+	return hash;
+}
+
+vector<uint8_t> NativeCrypto::GenerateRandomBytes(size_t size)
+{
+	// For Windows, use the system preferred random number generator of CNG, which needs no algorithm handle.
+	vector<uint8_t> bytes(size);
+	if (size == 0)
+		return bytes;
+
+	NTSTATUS status = BCryptGenRandom(NULL, bytes.data(), static_cast<ULONG>(bytes.size()), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+	if (status != 0)
+		throw runtime_error("Unable to generate random bytes.");
+
+	return bytes;
+}
@@ -33,6 +33,29 @@
 #include "Utilities.h"
 #include "KeySerializer.h"
 #include "NativeCrypto.h"
+#include "PublicKeyTableCache.h"
+#include "CurveContext.h"
+#include "PrecomputedTableFile.h"
+#include "EmbeddedTables.h"
+#include "KoblitzCurve.h"
+#include "X25519.h"
+#include "FieldElement25519.h"
+#include "EdwardsPoint.h"
+#include "Ed25519.h"
+#include "Schnorr.h"
+#include "BatchVerification.h"
+#include "SequentialKeyEnumerator.h"
+#include "ChaCha20Drbg.h"
+#include "EphemeralKeyPool.h"
+#include "SharedSecretCache.h"
+#include "WorkerPool.h"
+#include <thread>
+#include <chrono>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
 
 void StatisticalOperationTest(const BaseOperationTester& tester)
 {
@@ -1174,3 +1197,2081 @@ TEST_CASE("MultiplyBasePointWithOrder")
 
 
 
+
+TEST_CASE("WidthNafRecodingReconstructsScalar")
+{
+    BigInteger scalars[] = { BigInteger(0), BigInteger(1), BigInteger(7), BigInteger(255), BigInteger("DB7C2ABF62E35E7628DFAC6561C5"), BigInteger("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF") };
+    
+    for(unsigned int width = EllipticCurve::MIN_WNAF_WIDTH; width <= EllipticCurve::MAX_WNAF_WIDTH; width++)
+    {
+        for(auto& scalar : scalars)
+        {
+            auto naf = EllipticCurve::ComputeWidthNaf(scalar, width);
+            
+            // Rebuild the scalar from its digits, most significant first.
+            BigInteger rebuilt;
+            for(int i = static_cast<int>(naf.size()) - 1; i >= 0; i--)
+            {
+                rebuilt <<= 1;
+                rebuilt += naf[i];
+                
+                // Non-zero digits are odd and less than 2^(w-1) in absolute value.
+                if(naf[i] != 0)
+                {
+                    REQUIRE((naf[i] % 2) != 0);
+                    REQUIRE(abs(naf[i]) < (1 << (width - 1)));
+                }
+            }
+            REQUIRE(rebuilt == scalar);
+            
+            // At most one of any w consecutive digits is non-zero.
+            for(size_t i = 0; i < naf.size(); i++)
+            {
+                if(naf[i] == 0)
+                    continue;
+                for(size_t j = i + 1; j < naf.size() && j < i + width; j++)
+                    REQUIRE(naf[j] == 0);
+            }
+        }
+    }
+}
+
+TEST_CASE("MultiplyWithScalarAgreesAcrossWindowWidths")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    
+    BigInteger scalar("5A3C9B1E77D2C4A09F1B3E6D2C81");
+    Point expected = curve.MultiplyPointOnCurveWithScalar(G, scalar, EllipticCurve::MIN_WNAF_WIDTH);
+    REQUIRE(curve.CheckPointOnCurve(expected));
+    
+    for(unsigned int width = EllipticCurve::MIN_WNAF_WIDTH + 1; width <= 6; width++)
+        REQUIRE(curve.MultiplyPointOnCurveWithScalar(G, scalar, width) == expected);
+    
+    // Small multiples must match repeated addition.
+    Point sum = EllipticCurve::PointAtInfinity;
+    for(int i = 1; i <= 20; i++)
+    {
+        sum = curve.AddPointsOnCurve(sum, G);
+        REQUIRE(curve.MultiplyPointOnCurveWithScalar(G, i) == sum);
+    }
+    
+    // Multiplying by the order of G results in the point at infinity.
+    REQUIRE(curve.MultiplyPointOnCurveWithScalar(G, curve.GetBasePointOrder()) == EllipticCurve::PointAtInfinity);
+    REQUIRE_THROWS(curve.MultiplyPointOnCurveWithScalar(G, scalar, EllipticCurve::MAX_WNAF_WIDTH + 1));
+}
+
+TEST_CASE("BasePointCombMatchesGeneralMultiplication")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    auto& n = curve.GetBasePointOrder();
+    
+    BigInteger scalars[] = { BigInteger(1), BigInteger(2), BigInteger(0x1234), BigInteger("5A3C9B1E77D2C4A09F1B3E6D2C81"), n - 1 };
+    
+    CombParameters combs[] = { { 1, 1 }, { 3, 2 }, { 4, 8 }, { 5, 1 }, EllipticCurve::DEFAULT_COMB_PARAMETERS };
+    for(auto& comb : combs)
+    {
+        curve.SetBasePointCombParameters(comb);
+        for(auto& scalar : scalars)
+            REQUIRE(curve.MultiplyBasePointWithScalar(scalar) == curve.MultiplyPointOnCurveWithScalar(G, scalar, 4));
+        
+        REQUIRE(curve.MultiplyBasePointWithScalar(0) == EllipticCurve::PointAtInfinity);
+        REQUIRE(curve.MultiplyBasePointWithScalar(n) == EllipticCurve::PointAtInfinity);
+        REQUIRE(curve.MultiplyBasePointWithScalar(n + 1) == G);
+    }
+    
+    CombParameters invalidComb = { 9, 1 };
+    REQUIRE_THROWS(curve.SetBasePointCombParameters(invalidComb));
+}
+
+TEST_CASE("BasePointCombIsSharedBetweenCurveCopies")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    EllipticCurve copy = curve;
+    
+    BigInteger scalar("1F2E3D4C5B6A79881726354453");
+    REQUIRE(curve.MultiplyBasePointWithScalar(scalar) == copy.MultiplyBasePointWithScalar(scalar));
+}
+
+TEST_CASE("DoubleScalarMultiplicationMatchesSeparateMultiplications")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    
+    Point Q = curve.MultiplyBasePointWithScalar(BigInteger("0123456789ABCDEF0123456789"));
+    BigInteger u1("5A3C9B1E77D2C4A09F1B3E6D2C81");
+    BigInteger u2("3E6D2C815A3C9B1E77D2C4A09F1B");
+    
+    Point expected = curve.AddPointsOnCurve(curve.MultiplyPointOnCurveWithScalar(G, u1), curve.MultiplyPointOnCurveWithScalar(Q, u2));
+    REQUIRE(curve.MultiplyDoubleScalar(u1, G, u2, Q) == expected);
+    REQUIRE(curve.MultiplyDoubleScalar(u2, Q, u1, G) == expected);
+    
+    // Either scalar may be zero, or the sum may be the point at infinity.
+    REQUIRE(curve.MultiplyDoubleScalar(u1, G, 0, Q) == curve.MultiplyBasePointWithScalar(u1));
+    REQUIRE(curve.MultiplyDoubleScalar(0, G, u2, Q) == curve.MultiplyPointOnCurveWithScalar(Q, u2));
+    REQUIRE(curve.MultiplyDoubleScalar(u1, G, u1, curve.InvertPoint(G)) == EllipticCurve::PointAtInfinity);
+    
+    auto& n = curve.GetBasePointOrder();
+    REQUIRE(curve.DoubleScalarProductXEquals(u1, G, u2, Q, expected.x.GetRawInteger() % n));
+    REQUIRE(!curve.DoubleScalarProductXEquals(u1, G, u2, Q, (expected.x.GetRawInteger() + 1) % n));
+    REQUIRE(!curve.DoubleScalarProductXEquals(u1, G, u1, curve.InvertPoint(G), 0));
+}
+
+TEST_CASE("DoubleScalarProductXComparisonHandlesCoordinatesLargerThanOrder")
+{
+    // A small curve with cofactor 2 (so that n < p) where (u1 * G + u2 * Q):x = 0x48c1 >= n.
+    DomainParameters params = {
+        "toy", //name
+        "7FED", //p
+        "7FEA", //a
+        "0B", //b
+        "04 7FEB 7FEA", //G (uncompressed)
+        "4067", //n
+        "02" //h
+    };
+    
+    EllipticCurve curve(params);
+    auto& G = curve.GetBasePoint();
+    Point Q = curve.MultiplyPointOnCurveWithScalar(G, 1234);
+    REQUIRE(Q == curve.MakePointOnCurve(BigInteger("26FD"), BigInteger("0CFA")));
+    
+    REQUIRE(curve.MultiplyDoubleScalar(0x67, G, 0x1e61, Q).x == BigInteger("48C1"));
+    REQUIRE(curve.DoubleScalarProductXEquals(0x67, G, 0x1e61, Q, BigInteger("085A")));
+    REQUIRE(!curve.DoubleScalarProductXEquals(0x67, G, 0x1e61, Q, BigInteger("085B")));
+}
+
+TEST_CASE("EndomorphismScalarDecomposition")
+{
+    EllipticCurve curve(GetSecp256k1Curve());
+    REQUIRE(curve.HasEndomorphism());
+    REQUIRE(!EllipticCurve(GetSecp112r1Curve()).HasEndomorphism());
+    
+    auto& n = curve.GetBasePointOrder();
+    DomainParameters params = GetSecp256k1Curve();
+    BigInteger lambda(params.lambda);
+    
+    BigInteger scalars[] = { BigInteger(0), BigInteger(1), BigInteger("5A3C9B1E77D2C4A09F1B3E6D2C81"), lambda, n - 1,
+        BigInteger("C7D2A1B3E6F4091827364554637281900ABCDEF0123456789ABCDEF012345678") };
+    for(auto& scalar : scalars)
+    {
+        auto halves = curve.DecomposeScalar(scalar);
+        
+        // k1 + k2 * lambda == k (mod n), with both halves about half the size of n.
+        BigInteger sum = halves.first + (halves.second * lambda);
+        while(sum < 0)
+            sum += n;
+        REQUIRE((sum % n) == (scalar % n));
+        REQUIRE(halves.first.GetBitSize() <= 129);
+        REQUIRE(halves.second.GetBitSize() <= 129);
+    }
+    
+    // The endomorphism of G is lambda * G.
+    auto& G = curve.GetBasePoint();
+    FieldElement beta(BigInteger(params.beta), BigInteger(params.p));
+    REQUIRE(curve.MultiplyBasePointWithScalar(lambda) == Point(beta * G.x, G.y));
+}
+
+TEST_CASE("EndomorphismMultiplicationMatchesPlainMultiplication")
+{
+    // The same curve without the endomorphism constants.
+    DomainParameters glvParams = GetSecp256k1Curve();
+    DomainParameters plainParams = { glvParams.name, glvParams.p, glvParams.a, glvParams.b, glvParams.G, glvParams.n, glvParams.h };
+    EllipticCurve glvCurve(glvParams);
+    EllipticCurve plainCurve(plainParams);
+    REQUIRE(!plainCurve.HasEndomorphism());
+    
+    auto& G = glvCurve.GetBasePoint();
+    Point Q = glvCurve.MultiplyBasePointWithScalar(BigInteger("0123456789ABCDEF0123456789ABCDEF"));
+    BigInteger u1("C7D2A1B3E6F4091827364554637281900ABCDEF0123456789ABCDEF012345678");
+    BigInteger u2("3E6D2C815A3C9B1E77D2C4A09F1B");
+    
+    REQUIRE(glvCurve.MultiplyPointOnCurveWithScalar(Q, u1) == plainCurve.MultiplyPointOnCurveWithScalar(Q, u1));
+    REQUIRE(glvCurve.MultiplyPointOnCurveWithScalar(G, u2, 4) == plainCurve.MultiplyPointOnCurveWithScalar(G, u2, 4));
+    REQUIRE(glvCurve.MultiplyDoubleScalar(u1, G, u2, Q) == plainCurve.MultiplyDoubleScalar(u1, G, u2, Q));
+    REQUIRE(glvCurve.MultiplyDoubleScalar(u1, G, u1, glvCurve.InvertPoint(G)) == EllipticCurve::PointAtInfinity);
+    
+    // The endomorphism requires a = 0 and a cofactor of 1.
+    DomainParameters secp112r1 = GetSecp112r1Curve();
+    DomainParameters mismatched = { secp112r1.name, secp112r1.p, secp112r1.a, secp112r1.b, secp112r1.G, secp112r1.n, secp112r1.h,
+        glvParams.beta, glvParams.lambda, glvParams.a1, glvParams.b1, glvParams.a2, glvParams.b2 };
+    REQUIRE_THROWS(EllipticCurve curve(mismatched));
+}
+
+TEST_CASE("CoZLadderMatchesWidthNafMultiplication")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    auto& n = curve.GetBasePointOrder();
+    Point Q = curve.MultiplyBasePointWithScalar(BigInteger("0123456789ABCDEF0123456789"));
+    
+    BigInteger scalars[] = { BigInteger(2), BigInteger(3), BigInteger(0x1234), BigInteger("5A3C9B1E77D2C4A09F1B3E6D2C81"), n - 2, n - 1, n + 1, n * 3 + 5 };
+    for(auto& scalar : scalars)
+    {
+        REQUIRE(curve.MultiplyPointOnCurveWithScalar(Q, scalar, COZ_MONTGOMERY_LADDER) == curve.MultiplyPointOnCurveWithScalar(Q, scalar, WIDTH_NAF));
+        REQUIRE(curve.MultiplyPointOnCurveWithScalar(G, scalar, COZ_MONTGOMERY_LADDER) == curve.MultiplyBasePointWithScalar(scalar));
+    }
+    
+    // Small multiples must match repeated addition, and multiples of the order result in the point at infinity.
+    Point sum = EllipticCurve::PointAtInfinity;
+    for(int i = 0; i <= 20; i++)
+    {
+        REQUIRE(curve.MultiplyPointOnCurveWithScalar(Q, i, COZ_MONTGOMERY_LADDER) == sum);
+        sum = curve.AddPointsOnCurve(sum, Q);
+    }
+    REQUIRE(curve.MultiplyPointOnCurveWithScalar(Q, n, COZ_MONTGOMERY_LADDER) == EllipticCurve::PointAtInfinity);
+    REQUIRE(curve.MultiplyPointOnCurveWithScalar(EllipticCurve::PointAtInfinity, n - 1, COZ_MONTGOMERY_LADDER) == EllipticCurve::PointAtInfinity);
+    
+    EllipticCurve secp256k1(GetSecp256k1Curve());
+    BigInteger k("C7D2A1B3E6F4091827364554637281900ABCDEF0123456789ABCDEF012345678");
+    Point R = secp256k1.MultiplyBasePointWithScalar(BigInteger("0123456789ABCDEF0123456789ABCDEF"));
+    REQUIRE(secp256k1.MultiplyPointOnCurveWithScalar(R, k, COZ_MONTGOMERY_LADDER) == secp256k1.MultiplyPointOnCurveWithScalar(R, k));
+}
+
+TEST_CASE("FixedPointTableMatchesGeneralMultiplication")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    auto& n = curve.GetBasePointOrder();
+    Point Q = curve.MultiplyBasePointWithScalar(BigInteger("0123456789ABCDEF0123456789"));
+    
+    BigInteger u1("5A3C9B1E77D2C4A09F1B3E6D2C81");
+    BigInteger u2("3E6D2C815A3C9B1E77D2C4A09F1B");
+    Point expected = curve.MultiplyDoubleScalar(u1, G, u2, Q);
+    
+    CombParameters combs[] = { { 3, 2 }, { 6, 1 }, EllipticCurve::DEFAULT_COMB_PARAMETERS };
+    for(auto& comb : combs)
+    {
+        auto table = curve.PrecomputeFixedPointTable(Q, comb);
+        REQUIRE(curve.MultiplyFixedPointWithScalar(*table, u2) == curve.MultiplyPointOnCurveWithScalar(Q, u2));
+        REQUIRE(curve.MultiplyFixedPointWithScalar(*table, 0) == EllipticCurve::PointAtInfinity);
+        REQUIRE(curve.MultiplyFixedPointWithScalar(*table, n + 1) == Q);
+        
+        REQUIRE(curve.MultiplyDoubleScalar(u1, u2, *table) == expected);
+        REQUIRE(curve.DoubleScalarProductXEquals(u1, u2, *table, expected.x.GetRawInteger() % n));
+        REQUIRE(!curve.DoubleScalarProductXEquals(u1, u2, *table, (expected.x.GetRawInteger() + 1) % n));
+    }
+    
+    CombParameters invalidComb = { 0, 1 };
+    REQUIRE_THROWS(curve.PrecomputeFixedPointTable(Q, invalidComb));
+}
+
+TEST_CASE("PublicKeyTableCacheBuildsAfterThresholdAndEvictsLeastRecentlyUsed")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    Point keys[3];
+    for(int i = 0; i < 3; i++)
+        keys[i] = curve.MultiplyBasePointWithScalar(1000 + i);
+    
+    PublicKeyTableCache cache(2, 3);
+    REQUIRE(!cache.Lookup(curve, keys[0]));
+    REQUIRE(!cache.Lookup(curve, keys[0]));
+    auto table = cache.Lookup(curve, keys[0]);
+    REQUIRE(table);
+    REQUIRE(cache.Lookup(curve, keys[0]) == table);
+    REQUIRE(curve.MultiplyFixedPointWithScalar(*table, 5) == curve.MultiplyPointOnCurveWithScalar(keys[0], 5));
+    
+    auto statistics = cache.GetStatistics();
+    REQUIRE(statistics.hits == 1);
+    REQUIRE(statistics.misses == 3);
+    REQUIRE(statistics.builds == 1);
+    REQUIRE(statistics.evictions == 0);
+    
+    // keys[1] is now the least recently used, and is evicted (with its use count) by keys[2].
+    REQUIRE(!cache.Lookup(curve, keys[1]));
+    REQUIRE(cache.Lookup(curve, keys[0]) == table);
+    REQUIRE(!cache.Lookup(curve, keys[2]));
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE(cache.GetStatistics().evictions == 1);
+    REQUIRE(cache.Lookup(curve, keys[0]) == table);
+    
+    REQUIRE(!cache.Lookup(curve, keys[1]));
+    REQUIRE(!cache.Lookup(curve, keys[1]));
+    REQUIRE(cache.Lookup(curve, keys[1]));
+    
+    cache.Clear();
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(!cache.Lookup(curve, keys[0]));
+    REQUIRE_THROWS(PublicKeyTableCache(0, 1));
+    
+    // Keys are stored by the parameters of the curve, not its name: a renamed copy of the curve shares
+    //  the tables, while a curve of the same name with another base point does not.
+    DomainParameters params = GetSecp112r1Curve();
+    DomainParameters renamedParams = { "renamed", params.p, params.a, params.b, params.G, params.n, params.h, params.beta, params.lambda, params.a1, params.b1, params.a2, params.b2 };
+    string doubledG = utilities::BytesToHexString(curve.MultiplyBasePointWithScalar(2).Serialize());
+    DomainParameters otherParams = { params.name, params.p, params.a, params.b, doubledG, params.n, params.h, params.beta, params.lambda, params.a1, params.b1, params.a2, params.b2 };
+    EllipticCurve renamedCurve(renamedParams);
+    EllipticCurve otherCurve(otherParams);
+    
+    PublicKeyTableCache curveCache(4, 1);
+    auto curveTable = curveCache.Lookup(curve, keys[0]);
+    REQUIRE(curveTable);
+    REQUIRE(curveCache.Lookup(renamedCurve, keys[0]) == curveTable);
+    REQUIRE(curveCache.GetSize() == 1);
+    REQUIRE(curveCache.Lookup(otherCurve, keys[0]) != curveTable);
+    REQUIRE(curveCache.GetSize() == 2);
+}
+
+TEST_CASE("VerifyWithCachedPublicKeyTable")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    EccAlg alg(curve);
+    alg.GenerateKeys();
+    
+    auto cache = make_shared<PublicKeyTableCache>(4, 2);
+    alg.SetPublicKeyTableCache(cache);
+    
+    vector<uint8_t> message(32, 0x5A);
+    auto signature = alg.Sign(message);
+    vector<uint8_t> otherMessage(32, 0xA5);
+    for(int i = 0; i < 4; i++)
+    {
+        REQUIRE(alg.Verify(message, signature));
+        REQUIRE(!alg.Verify(otherMessage, signature));
+    }
+    
+    auto statistics = cache->GetStatistics();
+    REQUIRE(statistics.builds == 1);
+    REQUIRE(statistics.misses == 2);
+    REQUIRE(statistics.hits == 6);
+    
+    // Caching can be turned off.
+    alg.SetPublicKeyTableCache(nullptr);
+    REQUIRE(alg.Verify(message, signature));
+    REQUIRE(cache->GetStatistics().hits == 6);
+}
+
+TEST_CASE("MultiScalarMultiplyMatchesSumOfProducts")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    
+    // Covers both the interleaved (few points) and the bucket (many points) methods.
+    size_t counts[] = { 0, 1, 3, EllipticCurve::MIN_PIPPENGER_POINTS };
+    for(size_t count : counts)
+    {
+        vector<BigInteger> scalars;
+        vector<Point> points;
+        Point expected = EllipticCurve::PointAtInfinity;
+        BigInteger scalar("5A3C9B1E77D2C4A09F1B3E6D2C81");
+        for(size_t i = 0; i < count; i++)
+        {
+            points.push_back(curve.MultiplyBasePointWithScalar(BigInteger(static_cast<unsigned int>(1000 + (7 * i)))));
+            scalars.push_back(scalar);
+            expected = curve.AddPointsOnCurve(expected, curve.MultiplyPointOnCurveWithScalar(points[i], scalar));
+            
+            scalar = (scalar * BigInteger(0x1F3D)) % curve.GetBasePointOrder();
+            if((i % 5) == 2)
+                scalar = BigInteger(static_cast<unsigned int>(i));
+        }
+        
+        REQUIRE(curve.MultiScalarMultiply(scalars, points) == expected);
+        REQUIRE(curve.MultiScalarMultiply(scalars, points, 0) == expected);
+    }
+    
+    // Sums which cancel out, and zero scalars.
+    vector<BigInteger> scalars(EllipticCurve::MIN_PIPPENGER_POINTS, BigInteger(0x1234));
+    vector<Point> points(EllipticCurve::MIN_PIPPENGER_POINTS, G);
+    for(size_t i = 0; i < points.size(); i += 2)
+        points[i] = curve.InvertPoint(G);
+    REQUIRE(curve.MultiScalarMultiply(scalars, points) == EllipticCurve::PointAtInfinity);
+    REQUIRE(curve.MultiScalarMultiply(vector<BigInteger>(points.size(), BigInteger(0)), points) == EllipticCurve::PointAtInfinity);
+    
+    REQUIRE_THROWS(curve.MultiScalarMultiply(vector<BigInteger>(2, BigInteger(1)), vector<Point>(3, G)));
+}
+
+TEST_CASE("MultiScalarMultiplyWithEndomorphism")
+{
+    EllipticCurve curve(GetSecp256k1Curve());
+    
+    vector<BigInteger> scalars;
+    vector<Point> points;
+    BigInteger scalar("C7D2A1B3E6F4091827364554637281900ABCDEF0123456789ABCDEF012345678");
+    BigInteger sum(0);
+    Point point = EllipticCurve::PointAtInfinity;
+    for(size_t i = 0; i < EllipticCurve::MIN_PIPPENGER_POINTS; i++)
+    {
+        // k * (m * G) for multipliers m = 1, 2, 3, ... adds up to (sum of k * m) * G.
+        point = curve.AddPointsOnCurve(point, curve.GetBasePoint());
+        points.push_back(point);
+        scalars.push_back(scalar);
+        sum = (sum + (scalar * BigInteger(static_cast<unsigned int>(i + 1)))) % curve.GetBasePointOrder();
+        scalar = (scalar * BigInteger(0x1F3D5)) % curve.GetBasePointOrder();
+    }
+    
+    REQUIRE(curve.MultiScalarMultiply(scalars, points, 2) == curve.MultiplyBasePointWithScalar(sum));
+}
+
+TEST_CASE("FieldElementSquareRootAndBatchInversion")
+{
+    // p = 3 (mod 4), p = 5 (mod 8) and p = 1 (mod 8) use different branches of the square root.
+    BigInteger primes[] = { BigInteger("DB7C2ABF62E35E668076BEAD208B"), BigInteger("7FED"), BigInteger("FFF1"), BigInteger(97) };
+    for(auto& prime : primes)
+    {
+        auto p = make_shared<BigInteger>(prime);
+        unsigned int squares = 0;
+        for(unsigned int i = 0; i < 40; i++)
+        {
+            FieldElement element = FieldElement::MakeElement(BigInteger(i * 7919), p);
+            FieldElement root(0, p);
+            if(element.TryGetSquareRoot(root))
+            {
+                REQUIRE((root * root) == element);
+                squares++;
+            }
+            
+            // Every square must be found.
+            FieldElement square = element * element;
+            REQUIRE(square.TryGetSquareRoot(root));
+            REQUIRE((root * root) == square);
+        }
+        REQUIRE(squares > 0);
+        REQUIRE(squares < 40);
+        
+        vector<FieldElement> elements;
+        for(unsigned int i = 1; i <= 5; i++)
+            elements.push_back(FieldElement::MakeElement(BigInteger(i * 12345), p));
+        vector<FieldElement> inverses = elements;
+        FieldElement::InvertBatch(inverses);
+        for(size_t i = 0; i < elements.size(); i++)
+            REQUIRE(inverses[i] == elements[i].GetInverse());
+    }
+}
+
+TEST_CASE("TryMakePointFromX")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    auto& G = curve.GetBasePoint();
+    
+    Point point;
+    REQUIRE(curve.TryMakePointFromX(G.x.GetRawInteger(), G.y.GetRawInteger().GetBitAt(0), point));
+    REQUIRE(point == G);
+    REQUIRE(curve.TryMakePointFromX(G.x.GetRawInteger(), !G.y.GetRawInteger().GetBitAt(0), point));
+    REQUIRE(point == curve.InvertPoint(G));
+    REQUIRE(curve.CheckPointOnCurve(point));
+}
+
+TEST_CASE("VerifyBatchMatchesIndividualVerification")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    EccAlg signers[] = { EccAlg(curve), EccAlg(curve), EccAlg(curve) };
+    for(auto& signer : signers)
+        signer.GenerateKeys();
+    
+    vector<SignedMessage> signedMessages;
+    for(unsigned int i = 0; i < 11; i++)
+    {
+        EccAlg& signer = signers[i % 3];
+        SignedMessage signedMessage;
+        signedMessage.message = vector<uint8_t>(16, static_cast<uint8_t>(i));
+        signedMessage.signature = signer.Sign(signedMessage.message);
+        signedMessage.publicKey = signer.GetPublicKey();
+        signedMessages.push_back(signedMessage);
+    }
+    
+    EccAlg verifier(curve);
+    vector<bool> results = verifier.VerifyBatch(signedMessages);
+    REQUIRE(results == vector<bool>(signedMessages.size(), true));
+    
+    // Break some of the signatures in different ways.
+    signedMessages[1].message[0] ^= 1;
+    signedMessages[4].publicKey = signers[0].GetPublicKey();
+    signedMessages[5].signature = signedMessages[6].signature;
+    signedMessages[7].signature.resize(3);
+    signedMessages[10].publicKey[5] ^= 1;
+    
+    vector<bool> expected(signedMessages.size(), true);
+    expected[1] = expected[4] = expected[5] = expected[7] = expected[10] = false;
+    REQUIRE(verifier.VerifyBatch(signedMessages) == expected);
+    
+    for(size_t i = 0; i < signedMessages.size(); i++)
+    {
+        if(i == 10)
+            continue;
+        EccAlg individual(curve);
+        individual.SetKey(signedMessages[i].publicKey);
+        REQUIRE(individual.Verify(signedMessages[i].message, signedMessages[i].signature) == expected[i]);
+    }
+    
+    // The same results with comb tables for every key and with the items spread over several threads.
+    EccAlg tableVerifier(curve);
+    tableVerifier.SetPublicKeyTableCache(make_shared<PublicKeyTableCache>(4, 1));
+    tableVerifier.SetOperationThreadCount(3);
+    REQUIRE(tableVerifier.VerifyBatch(signedMessages) == expected);
+    REQUIRE(tableVerifier.VerifyBatch(signedMessages) == expected);
+    
+    REQUIRE(verifier.VerifyBatch(vector<SignedMessage>()).empty());
+}
+
+TEST_CASE("NormalizeBatchMatchesAffinePoints")
+{
+    DomainParameters curveParams = GetSecp112r1Curve();
+    EllipticCurve curve(curveParams);
+    const Point& G = curve.GetBasePoint();
+    BigInteger p(curveParams.p);
+    
+    // Represent multiples of G with different z-coordinates, (lambda^2 * x, lambda^3 * y, lambda).
+    vector<Point> expected;
+    vector<JacobianPoint> jacobianPoints;
+    for(unsigned int i = 1; i <= 6; i++)
+    {
+        Point point = curve.MultiplyPointOnCurveWithScalar(G, BigInteger(i * 1000 + 7));
+        FieldElement lambda(BigInteger(i * 31 + 2), p);
+        FieldElement lambdaSquared = lambda * lambda;
+        jacobianPoints.push_back(JacobianPoint(point.x * lambdaSquared, point.y * lambdaSquared * lambda, lambda));
+        expected.push_back(point);
+        
+        if(i == 3)
+        {
+            jacobianPoints.push_back(JacobianPoint(FieldElement(1, p), FieldElement(1, p), FieldElement(0, p)));
+            expected.push_back(EllipticCurve::PointAtInfinity);
+        }
+    }
+    
+    REQUIRE(curve.NormalizeBatch(jacobianPoints) == expected);
+    REQUIRE(curve.NormalizeBatch(vector<JacobianPoint>()).empty());
+}
+
+TEST_CASE("MultiplyBasePointWithScalarsAndGenerateKeyBatch")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    vector<BigInteger> scalars;
+    scalars.push_back(BigInteger(0));
+    scalars.push_back(BigInteger(1));
+    scalars.push_back(BigInteger("DB7C2ABF62E35E7628DFAC6561C5"));
+    scalars.push_back(curve.GetBasePointOrder());
+    scalars.push_back(BigInteger("123456789ABCDEF0123456789"));
+    
+    vector<Point> products = curve.MultiplyBasePointWithScalars(scalars);
+    REQUIRE(products.size() == scalars.size());
+    for(size_t i = 0; i < scalars.size(); i++)
+        REQUIRE(products[i] == curve.MultiplyBasePointWithScalar(scalars[i]));
+    
+    vector<EccAlg> algs = EccAlg::GenerateKeyBatch(curve, 5);
+    REQUIRE(algs.size() == 5);
+    vector<uint8_t> message(20, 0x5A);
+    for(EccAlg& alg : algs)
+    {
+        REQUIRE(alg.HasPrivateKey());
+        
+        EccAlg verifier(curve);
+        verifier.SetKey(alg.GetPublicKey());
+        REQUIRE(verifier.Verify(message, alg.Sign(message)));
+    }
+    REQUIRE(algs[0].GetPublicKey() != algs[1].GetPublicKey());
+}
+
+TEST_CASE("FastReductionMatchesDivision")
+{
+    const char* curveNames[] = { "P-224", "P-256", "P-384", "P-521" };
+    for(const char* curveName : curveNames)
+    {
+        BigInteger p(ecc::GetCurveByName(curveName).p);
+        ecc::FieldReduction reduction = ecc::FindFastReduction(p);
+        REQUIRE(reduction != nullptr);
+        
+        // Values near 0, near p and with pseudo-random bytes.
+        vector<BigInteger> values;
+        values.push_back(BigInteger(0));
+        values.push_back(BigInteger(1));
+        values.push_back(p - 1);
+        values.push_back(p - 2);
+        values.push_back(BigInteger(0xFFFFFFFFu));
+        uint32_t state = 12345;
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            vector<uint8_t> bytes(p.GetMagnitudeByteSize());
+            for(uint8_t& byte : bytes)
+            {
+                state = state * 1103515245 + 12345;
+                byte = static_cast<uint8_t>(state >> 16);
+            }
+            // Every few values use runs of 0xFF and 0x00 bytes, which stress the carries.
+            if(i % 3 == 0)
+                fill(bytes.begin() + bytes.size() / 2, bytes.end(), static_cast<uint8_t>((i % 2) ? 0x00 : 0xFF));
+            values.push_back(BigInteger(bytes) % p);
+        }
+        
+        for(const BigInteger& lhs : values)
+        {
+            for(const BigInteger& rhs : values)
+            {
+                BigInteger product = lhs * rhs;
+                BigInteger expected = product % p;
+                reduction(product);
+                REQUIRE(product == expected);
+            }
+        }
+    }
+    
+    REQUIRE(ecc::FindFastReduction(BigInteger(ecc::GetSecp256k1Curve().p)) == nullptr);
+    REQUIRE(ecc::FindFastReduction(BigInteger(7)) == nullptr);
+}
+
+TEST_CASE("GetCurveByNameFindsNistCurves")
+{
+    vector<string> curves = ecc::GetSupportedCurves();
+    for(const string& name : curves)
+        REQUIRE_NOTHROW(ecc::GetCurveByName(name));
+    
+    REQUIRE(ecc::GetCurveByName("P-256").name == "secp256r1");
+    REQUIRE(find(curves.begin(), curves.end(), "P-256") == curves.end());
+    REQUIRE(count(curves.begin(), curves.end(), "secp256r1") == 1);
+    REQUIRE(ecc::GetCurveByName("secp384r1").n == ecc::GetNistP384Curve().n);
+    REQUIRE_THROWS_AS(ecc::GetCurveByName("P-192"), invalid_argument);
+}
+
+TEST_CASE("NistCurvesSignAndVerify")
+{
+    const char* curveNames[] = { "P-224", "P-256", "P-384", "P-521" };
+    for(const char* curveName : curveNames)
+    {
+        DomainParameters params = ecc::GetCurveByName(curveName);
+        EllipticCurve curve(params);
+        const Point& G = curve.GetBasePoint();
+        REQUIRE(curve.MultiplyPointOnCurveWithScalar(G, curve.GetBasePointOrder(), WIDTH_NAF) == EllipticCurve::PointAtInfinity);
+        
+        EccAlg signer(curve);
+        signer.GenerateKeys();
+        vector<uint8_t> message(32, 0x42);
+        vector<uint8_t> signature = signer.Sign(message);
+        
+        EccAlg verifier(curve);
+        verifier.SetKey(signer.GetPublicKey());
+        REQUIRE(verifier.Verify(message, signature));
+        message[0] ^= 1;
+        REQUIRE(!verifier.Verify(message, signature));
+    }
+}
+
+TEST_CASE("CurveContextIsInternedOncePerCurve")
+{
+    shared_ptr<const CurveContext> context = CurveContext::GetByName("secp256r1");
+    REQUIRE(context == CurveContext::GetByName("secp256r1"));
+    REQUIRE(context == CurveContext::GetByName("P-256"));
+    REQUIRE(context != CurveContext::GetByName("secp256k1"));
+    REQUIRE(context->GetCurve().GetCurveName() == "secp256r1");
+    REQUIRE_THROWS_AS(CurveContext::GetByName("secp999r1"), invalid_argument);
+    
+    // Concurrent first uses all get the same context, whether by the curve's name or an alias.
+    vector<shared_ptr<const CurveContext>> contexts(4);
+    vector<thread> threads;
+    for(size_t i = 0; i < contexts.size(); i++)
+        threads.push_back(thread([&contexts, i]() { contexts[i] = CurveContext::GetByName(((i % 2) == 0) ? "P-384" : "secp384r1"); }));
+    for(thread& t : threads)
+        t.join();
+    for(const auto& threadContext : contexts)
+        REQUIRE(threadContext == contexts[0]);
+}
+
+TEST_CASE("EccAlgsShareTheCurveContext")
+{
+    auto context = CurveContext::GetByName("secp112r1");
+    EccAlg alg(context);
+    alg.GenerateKeys();
+    REQUIRE(&alg.GetCurve() == &context->GetCurve());
+    
+    // Keys loaded from storage share the interned curve.
+    KeySerializer serializer;
+    EccAlg loaded = serializer.ParseKeys(serializer.SerializePrivateKeys(alg));
+    EccAlg loadedAgain = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+    REQUIRE(&loaded.GetCurve() == &context->GetCurve());
+    REQUIRE(&loadedAgain.GetCurve() == &context->GetCurve());
+    
+    vector<uint8_t> message(8, 0x11);
+    REQUIRE(loadedAgain.Verify(message, loaded.Sign(message)));
+    
+    // Copies of an alg share its curve as well.
+    EccAlg copy = alg;
+    REQUIRE(&copy.GetCurve() == &alg.GetCurve());
+    
+    REQUIRE_THROWS_AS(EccAlg(shared_ptr<const CurveContext>()), invalid_argument);
+}
+
+TEST_CASE("PrecomputedTableFileRoundTrip")
+{
+    EllipticCurve curve(GetSecp112r1Curve());
+    Point point = curve.MultiplyBasePointWithScalar(BigInteger("0123456789ABCDEF"));
+    CombParameters parameters = { 4, 3 };
+    auto table = curve.PrecomputeFixedPointTable(point, parameters);
+    
+    const string path = "test_table.ecctable";
+    PrecomputedTableFile::Write(path, curve, point, *table);
+    
+    auto readTable = PrecomputedTableFile::Read(path, curve, point, parameters);
+    REQUIRE(readTable);
+    REQUIRE(readTable->points == table->points);
+    BigInteger scalar("DB7C2ABF62E35E7628DFAC6561");
+    REQUIRE(curve.MultiplyFixedPointWithScalar(*readTable, scalar) == curve.MultiplyPointOnCurveWithScalar(point, scalar));
+    
+    // Tables for other points or parameters, and missing files, are not used.
+    CombParameters otherParameters = { 4, 2 };
+    REQUIRE(!PrecomputedTableFile::Read(path, curve, point, otherParameters));
+    REQUIRE(!PrecomputedTableFile::Read(path, curve, curve.GetBasePoint(), parameters));
+    REQUIRE(!PrecomputedTableFile::Read("missing_table.ecctable", curve, point, parameters));
+    
+    // A corrupted file fails its checksum, and is rebuilt and rewritten.
+    {
+        fstream file(path.c_str(), ios::in | ios::out | ios::binary);
+        file.seekg(100);
+        char byte = static_cast<char>(file.get() ^ 0x01);
+        file.seekp(100);
+        file.put(byte);
+    }
+    REQUIRE(!PrecomputedTableFile::Read(path, curve, point, parameters));
+    auto rebuiltTable = PrecomputedTableFile::ReadOrBuild(path, curve, point, parameters);
+    REQUIRE(rebuiltTable->points == table->points);
+    REQUIRE(PrecomputedTableFile::Read(path, curve, point, parameters));
+    
+    // A forged table with a valid checksum is rejected, since its points are not on the curve.
+    {
+        ifstream input(path.c_str(), ios::in | ios::binary);
+        vector<uint8_t> contents((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+        input.close();
+        
+        contents[100] ^= 0x01;
+        contents.resize(contents.size() - 32);
+        vector<uint8_t> checksum = NativeCrypto::HashData(contents);
+        contents.insert(contents.end(), checksum.begin(), checksum.end());
+        
+        ofstream output(path.c_str(), ios::out | ios::binary | ios::trunc);
+        output.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+    }
+    REQUIRE(!PrecomputedTableFile::Read(path, curve, point, parameters));
+    REQUIRE_THROWS_AS(curve.MakeFixedPointTable(parameters, vector<uint8_t>(curve.SerializeFixedPointTable(*table).size(), 0x04)), invalid_argument);
+    
+    // So is a forged table of points which are all on the curve, but not the multiples of the point: two
+    //  entries swapped, or the entry of a single bit replaced by another point (and its sum with the point
+    //  changed to match).
+    vector<uint8_t> serializedPoints = curve.SerializeFixedPointTable(*table);
+    const size_t recordSize = serializedPoints.size() / table->points.size();
+    vector<uint8_t> swapped = serializedPoints;
+    swap_ranges(swapped.begin() + (4 * recordSize), swapped.begin() + (5 * recordSize), swapped.begin() + (5 * recordSize));
+    REQUIRE_THROWS_AS(curve.MakeFixedPointTable(parameters, swapped), invalid_argument);
+    
+    Point otherPoint = curve.MultiplyBasePointWithScalar(BigInteger("FEDCBA9876543210"));
+    auto otherTable = curve.PrecomputeFixedPointTable(otherPoint, parameters);
+    vector<Point> mixedPoints = table->points;
+    mixedPoints[1] = otherTable->points[1];
+    mixedPoints[2] = curve.AddPointsOnCurve(mixedPoints[0], mixedPoints[1]);
+    FixedPointTable mixedTable = *table;
+    mixedTable.points = mixedPoints;
+    REQUIRE(curve.CheckPointOnCurve(mixedPoints[2]));
+    REQUIRE_THROWS_AS(curve.MakeFixedPointTable(parameters, curve.SerializeFixedPointTable(mixedTable)), invalid_argument);
+    REQUIRE(curve.MakeFixedPointTable(parameters, serializedPoints)->points == table->points);
+    
+    {
+        PrecomputedTableFile::Write(path, curve, point, *table);
+        ifstream input(path.c_str(), ios::in | ios::binary);
+        vector<uint8_t> contents((istreambuf_iterator<char>(input)), istreambuf_iterator<char>());
+        input.close();
+        
+        contents.resize(contents.size() - 32);
+        copy(swapped.begin(), swapped.end(), contents.end() - swapped.size());
+        vector<uint8_t> checksum = NativeCrypto::HashData(contents);
+        contents.insert(contents.end(), checksum.begin(), checksum.end());
+        
+        ofstream output(path.c_str(), ios::out | ios::binary | ios::trunc);
+        output.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+    }
+    REQUIRE(!PrecomputedTableFile::Read(path, curve, point, parameters));
+    
+    // Tables read from files can seed the public key table cache.
+    PublicKeyTableCache cache;
+    cache.Insert(curve, point, readTable);
+    REQUIRE(cache.Lookup(curve, point) == readTable);
+    REQUIRE(cache.GetStatistics().hits == 1);
+    
+    remove(path.c_str());
+}
+
+TEST_CASE("BasePointTableLoadedFromFile")
+{
+    const string directory = ".";
+    const string path = "./secp112r1.ecctable";
+    remove(path.c_str());
+    
+    // The first load builds and writes the table, the second one reads it.
+    EllipticCurve builtCurve(GetSecp112r1Curve());
+    PrecomputedTableFile::LoadBasePointTable(directory, builtCurve);
+    EllipticCurve loadedCurve(GetSecp112r1Curve());
+    PrecomputedTableFile::LoadBasePointTable(directory, loadedCurve);
+    
+    REQUIRE(loadedCurve.GetBasePointCombTable().points == builtCurve.GetBasePointCombTable().points);
+    BigInteger scalar("0A1B2C3D4E5F60718293A4B5C6D7");
+    REQUIRE(loadedCurve.MultiplyBasePointWithScalar(scalar) == loadedCurve.MultiplyPointOnCurveWithScalar(loadedCurve.GetBasePoint(), scalar, WIDTH_NAF));
+    
+    // A table for another point cannot be used for G.
+    auto otherTable = loadedCurve.PrecomputeFixedPointTable(loadedCurve.AddPointsOnCurve(loadedCurve.GetBasePoint(), loadedCurve.GetBasePoint()));
+    REQUIRE_THROWS_AS(loadedCurve.SetBasePointCombTable(*otherTable), invalid_argument);
+    
+    remove(path.c_str());
+}
+
+TEST_CASE("EmbeddedBasePointTablesMatchBuiltTables")
+{
+    const char* curveNames[] = { "secp112r1", "secp256k1" };
+    for(const char* curveName : curveNames)
+    {
+        REQUIRE(ecc::FindEmbeddedBasePointTable(curveName) != nullptr);
+        
+        EllipticCurve curve(ecc::GetCurveByName(curveName));
+        auto builtTable = curve.PrecomputeFixedPointTable(curve.GetBasePoint());
+        REQUIRE(curve.GetBasePointCombTable().points == builtTable->points);
+    }
+    REQUIRE(ecc::FindEmbeddedBasePointTable("secp256r1") == nullptr);
+    
+    // Other comb parameters, or a custom curve reusing the name, build the table instead.
+    EllipticCurve otherParameters(GetSecp112r1Curve());
+    CombParameters parameters = { 3, 2 };
+    otherParameters.SetBasePointCombParameters(parameters);
+    BigInteger scalar("0123456789ABCDEF0123456789");
+    REQUIRE(otherParameters.MultiplyBasePointWithScalar(scalar) == otherParameters.MultiplyPointOnCurveWithScalar(otherParameters.GetBasePoint(), scalar, WIDTH_NAF));
+    
+    DomainParameters params = { "secp112r1", "7FED", "7FEA", "0B", "04 7FEB 7FEA", "4067", "02" };
+    EllipticCurve renamedCurve(params);
+    REQUIRE(renamedCurve.MultiplyBasePointWithScalar(BigInteger(5)) == renamedCurve.MultiplyPointOnCurveWithScalar(renamedCurve.GetBasePoint(), BigInteger(5), WIDTH_NAF));
+}
+
+TEST_CASE("BinaryFieldArithmetic")
+{
+    // z^233 + z^74 + 1
+    auto field = make_shared<const BinaryField>(BigInteger("0200 00000000 00000000 00000000 00000000 00000400 00000000 00000001"));
+    REQUIRE(field->GetDegree() == 233);
+    REQUIRE(field->GetWordCount() == 4);
+    
+    BinaryFieldElement a(BigInteger("0172 32BA853A 7E731AF1 29F22FF4 149563A4 19C26BF5 0A4C9D6E EFAD6126"), field);
+    BinaryFieldElement b(BigInteger("01DB 537DECE8 19B7F70F 555A67C4 27A8CD9B F18AEB9B 56E0C110 56FAE6A3"), field);
+    BinaryFieldElement c(BigInteger("0123456789ABCDEF0123456789ABCDEF"), field);
+    BinaryFieldElement one = BinaryFieldElement::MakeOne(field);
+    
+    REQUIRE((a * b).GetRawInteger() == BigInteger("0040 4C43AF73 958B8774 2FF9E35E C83A50FB 77C1D266 FA5B7E74 9DDD12CA"));
+    REQUIRE((a * b) == (b * a));
+    REQUIRE(((a * b) * c) == (a * (b * c)));
+    REQUIRE((a * (b + c)) == ((a * b) + (a * c)));
+    REQUIRE(a.GetSquare() == (a * a));
+    REQUIRE((a + a).IsZero());
+    
+    // z^232 * z = z^233 = z^74 + 1
+    BigInteger z232(1);
+    z232 <<= 232;
+    BinaryFieldElement product = BinaryFieldElement(z232, field) * BinaryFieldElement(BigInteger(2), field);
+    REQUIRE(product.GetRawInteger() == BigInteger("0400 00000000 00000001"));
+    
+    REQUIRE((a * a.GetInverse()) == one);
+    REQUIRE(((a / b) * b) == a);
+    REQUIRE(one.GetInverse() == one);
+    REQUIRE_THROWS_AS(BinaryFieldElement::MakeZero(field).GetInverse(), invalid_argument);
+    REQUIRE_THROWS_AS(BinaryFieldElement(z232 * BigInteger(2), field), invalid_argument);
+    
+    // z^283 + z^12 + z^7 + z^5 + 1 is a pentanomial.
+    auto field283 = make_shared<const BinaryField>(BigInteger("08000000 00000000 00000000 00000000 00000000 00000000 00000000 00000000 000010A1"));
+    BinaryFieldElement x(BigInteger("0503213F 78CA4488 3F1A3B81 62F188E5 53CD265F 23C1567A 16876913 B0C2AC24 58492836"), field283);
+    REQUIRE(x.GetSquare().GetRawInteger() == BigInteger("023E5DA7 9ACFD522 1DD36CA7 C69942FF B878734E 2CAA6D3E 3ADC35BD B579E53D C448471E"));
+    REQUIRE((x * x.GetInverse()) == BinaryFieldElement::MakeOne(field283));
+}
+
+TEST_CASE("KoblitzCurveMultiplicationMatchesKnownAnswers")
+{
+    struct KnownAnswer
+    {
+        const char* curveName;
+        const char* k;
+        const char* x;
+        const char* y;
+    };
+    
+    // Computed with OpenSSL.
+    const KnownAnswer answers[] = {
+        { "sect163k1", "1C0FFEE0DDBA11DEADBEEF0123456789ABCDEF01",
+            "02D717ADAE8A8B7C9E8B1B5305E534010A02570D15", "02780D0CFBAA1F46AA8C115C7084AA8B000914BF96" },
+        { "K-233", "0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789",
+            "01B1DBD74CBEF38D026361E33FB918891EE4945CA11C83C6487A1CDE10D2", "01DEC7AAA95A8E94FE0CF05D5B0D2E35D9AF11A341232E38B8634A3157AD" },
+        { "sect283k1", "03C1D2E3F40516273849ABCDEF00112233445566778899AABBCCDDEEFF0011223344",
+            "037473797183870658F2A96C1B2F0E00FFB08B362230C98B14AC793ADF946A1A691D1550", "06732AD4B450BC02F564B2D22EBCB9417B18F8C55D151A708090AB6142D65149EE29DB74" }
+    };
+    
+    for(const KnownAnswer& answer : answers)
+    {
+        KoblitzCurve curve(ecc::GetBinaryCurveByName(answer.curveName));
+        BinaryPoint expected = curve.MakePoint(BigInteger(answer.x), BigInteger(answer.y));
+        BigInteger k(answer.k);
+        
+        REQUIRE(curve.MultiplyBasePoint(k) == expected);
+        REQUIRE(curve.MultiplyWithDoubleAndAdd(k, curve.GetBasePoint()) == expected);
+    }
+    
+    REQUIRE_THROWS_AS(ecc::GetBinaryCurveByName("sect163r2"), invalid_argument);
+}
+
+TEST_CASE("KoblitzCurveTnafMultiplication")
+{
+    for(const string& curveName : { string("sect163k1"), string("sect233k1"), string("sect283k1") })
+    {
+        KoblitzCurve curve(ecc::GetBinaryCurveByName(curveName));
+        const BinaryPoint& G = curve.GetBasePoint();
+        const BigInteger& n = curve.GetOrder();
+        
+        REQUIRE(curve.IsPointOnCurve(G));
+        REQUIRE(curve.MultiplyWithDoubleAndAdd(n, G).IsPointAtInfinity());
+        REQUIRE(curve.Multiply(n, G).IsPointAtInfinity());
+        REQUIRE(curve.Multiply(BigInteger(1), G) == G);
+        REQUIRE(curve.Multiply(n - 1, G) == curve.Negate(G));
+        
+        // The Frobenius map acts on the subgroup as multiplication by a root of tau^2 - mu * tau + 2.
+        BinaryPoint tauG = curve.ApplyFrobenius(G);
+        REQUIRE(curve.IsPointOnCurve(tauG));
+        BinaryPoint muTauG = (curveName == "sect163k1") ? tauG : curve.Negate(tauG);
+        REQUIRE(curve.Add(curve.ApplyFrobenius(tauG), curve.Double(G)) == muTauG);
+        
+        for(int i = 0; i < 5; i++)
+        {
+            BigInteger k = BigInteger(NativeCrypto::HashData(vector<uint8_t>(1, static_cast<uint8_t>(i)))) % n;
+            vector<int8_t> tnaf = curve.GetReducedTnaf(k);
+            
+            // The reduced TNAF has about m digits and no two adjacent non-zero digits.
+            REQUIRE(tnaf.size() <= curve.GetField()->GetDegree() + 4);
+            for(size_t j = 1; j < tnaf.size(); j++)
+                REQUIRE(((tnaf[j] == 0) || (tnaf[j - 1] == 0)));
+            
+            BinaryPoint P = curve.MultiplyWithDoubleAndAdd(BigInteger(i + 2), G);
+            REQUIRE(curve.Multiply(k, P) == curve.MultiplyWithDoubleAndAdd(k, P));
+        }
+    }
+}
+
+TEST_CASE("EccAlgSignsWithKoblitzCurves")
+{
+    vector<string> curves = CurveContext::GetSupportedCurveNames();
+    for(const string& curveName : ecc::GetSupportedBinaryCurves())
+    {
+        REQUIRE(find(curves.begin(), curves.end(), curveName) != curves.end());
+        REQUIRE(CurveContext::GetByName(curveName)->IsBinary());
+        REQUIRE_THROWS_AS(CurveContext::GetByName(curveName)->GetCurve(), invalid_argument);
+        
+        EccAlg alg(CurveContext::GetByName(curveName));
+        alg.GenerateKeys();
+        REQUIRE(alg.GetCurveName() == curveName);
+        REQUIRE(ecc::IsBinaryCurveName(curveName));
+        
+        const KoblitzCurve& curve = CurveContext::GetByName(curveName)->GetBinaryCurve();
+        REQUIRE(curve.MultiplyBasePoint(BigInteger(alg.GetPrivateKey())).Serialize() == alg.GetPublicKey());
+        
+        uint8_t messageArr[] = { 'K', 'o', 'b', 'l', 'i', 't', 'z' };
+        vector<uint8_t> message(messageArr, messageArr + sizeof(messageArr));
+        vector<uint8_t> signature = alg.Sign(message);
+        REQUIRE(alg.Verify(message, signature));
+        REQUIRE(!alg.Verify(vector<uint8_t>(message.begin(), message.end() - 1), signature));
+        
+        vector<uint8_t> tampered = signature;
+        tampered.back() ^= 1;
+        REQUIRE(!alg.Verify(message, tampered));
+        
+        vector<vector<uint8_t>> signatures = alg.SignBatch(vector<vector<uint8_t>>(2, message));
+        REQUIRE(signatures.size() == 2);
+        REQUIRE(alg.Verify(message, signatures[1]));
+        
+        // Keys survive serialization, and a public key alone can verify.
+        KeySerializer serializer;
+        EccAlg loaded = serializer.ParseKeys(serializer.SerializePrivateKeys(alg));
+        REQUIRE(loaded.Verify(message, loaded.Sign(message)));
+        EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+        REQUIRE(publicOnly.Verify(message, signature));
+        REQUIRE_THROWS_AS(publicOnly.Sign(message), no_private_key);
+        
+        REQUIRE_THROWS_AS(alg.Encrypt(message), invalid_argument);
+        REQUIRE_THROWS_AS(alg.SignRecoverable(message), invalid_argument);
+        REQUIRE_THROWS_AS(alg.VerifyBatch(vector<SignedMessage>()), invalid_argument);
+        REQUIRE_THROWS_AS(alg.SetKey(alg.GetPublicKey(), vector<uint8_t>(1, 1)), invalid_argument);
+        
+        // (0, 1) is on the curve but has order 2.
+        vector<uint8_t> pointOfOrderTwo = curve.GetBasePoint().Serialize();
+        fill(pointOfOrderTwo.begin() + 1, pointOfOrderTwo.end(), 0);
+        pointOfOrderTwo.back() = 1;
+        REQUIRE(curve.IsPointOnCurve(curve.ParsePoint(pointOfOrderTwo)));
+        REQUIRE_THROWS_AS(publicOnly.SetKey(pointOfOrderTwo), invalid_argument);
+        REQUIRE_THROWS_AS(publicOnly.SetKey(vector<uint8_t>(pointOfOrderTwo.begin(), pointOfOrderTwo.end() - 1)), invalid_argument);
+    }
+    
+    // The NIST names share the contexts of the SEC 2 names, and are not listed separately.
+    REQUIRE(find(curves.begin(), curves.end(), "K-163") == curves.end());
+    REQUIRE(CurveContext::GetByName("K-163") == CurveContext::GetByName("sect163k1"));
+    REQUIRE(!ecc::IsBinaryCurveName("secp256k1"));
+}
+
+TEST_CASE("X25519MatchesRfc7748TestVectors")
+{
+    // RFC 7748, Section 5.2.
+    REQUIRE(X25519::ScalarMultiply(utilities::HexStringToBytes("a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4"),
+                                   utilities::HexStringToBytes("e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c"))
+            == utilities::HexStringToBytes("c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552"));
+    REQUIRE(X25519::ScalarMultiply(utilities::HexStringToBytes("4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d"),
+                                   utilities::HexStringToBytes("e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493"))
+            == utilities::HexStringToBytes("95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957"));
+    
+    // RFC 7748, Section 6.1.
+    vector<uint8_t> alicePrivate = utilities::HexStringToBytes("77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a");
+    vector<uint8_t> bobPrivate = utilities::HexStringToBytes("5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb");
+    vector<uint8_t> alicePublic = X25519::ScalarMultiplyBase(alicePrivate);
+    vector<uint8_t> bobPublic = X25519::ScalarMultiplyBase(bobPrivate);
+    REQUIRE(alicePublic == utilities::HexStringToBytes("8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a"));
+    REQUIRE(bobPublic == utilities::HexStringToBytes("de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f"));
+    
+    vector<uint8_t> sharedSecret = utilities::HexStringToBytes("4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742");
+    REQUIRE(X25519::ComputeSharedSecret(alicePrivate, bobPublic) == sharedSecret);
+    REQUIRE(X25519::ComputeSharedSecret(bobPrivate, alicePublic) == sharedSecret);
+    
+    // u = 0 has small order.
+    REQUIRE_THROWS_AS(X25519::ComputeSharedSecret(alicePrivate, vector<uint8_t>(32, 0)), invalid_argument);
+    REQUIRE_THROWS_AS(X25519::ScalarMultiplyBase(vector<uint8_t>(31, 1)), invalid_argument);
+}
+
+TEST_CASE("FieldElement25519Arithmetic")
+{
+    // p - 1 and a number above p which is accepted and reduced.
+    vector<uint8_t> pMinusOne = utilities::HexStringToBytes("ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f");
+    FieldElement25519 minusOne = FieldElement25519::FromBytes(pMinusOne);
+    REQUIRE((minusOne + FieldElement25519(1)) == FieldElement25519(0));
+    REQUIRE((FieldElement25519(0) - FieldElement25519(1)) == minusOne);
+    REQUIRE((minusOne * minusOne).GetBytes() == FieldElement25519(1).GetBytes());
+    REQUIRE(FieldElement25519::FromBytes(utilities::HexStringToBytes("eeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f")) == FieldElement25519(1));
+    
+    FieldElement25519 a = FieldElement25519::FromBytes(utilities::HexStringToBytes("a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4"));
+    FieldElement25519 b = FieldElement25519::FromBytes(utilities::HexStringToBytes("e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c"));
+    FieldElement25519 aSquared = a;
+    aSquared.Square();
+    REQUIRE(aSquared == (a * a));
+    REQUIRE(((a * b) * a.GetInverse()) == b);
+    REQUIRE(FieldElement25519(a).MultiplySmall(121665) == (a * FieldElement25519(121665)));
+    
+    // Compare against BigInteger arithmetic mod p.
+    BigInteger p("7FFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFED");
+    auto toBigInteger = [](vector<uint8_t> littleEndian) { reverse(littleEndian.begin(), littleEndian.end()); return BigInteger(littleEndian); };
+    REQUIRE(toBigInteger((a * b).GetBytes()) == (toBigInteger(a.GetBytes()) * toBigInteger(b.GetBytes())) % p);
+    REQUIRE(toBigInteger((a - b).GetBytes()) == ((toBigInteger(a.GetBytes()) + p) - toBigInteger(b.GetBytes())) % p);
+}
+
+TEST_CASE("EccAlgEncryptsWithX25519")
+{
+    vector<string> curves = CurveContext::GetSupportedCurveNames();
+    REQUIRE(find(curves.begin(), curves.end(), "curve25519") != curves.end());
+    REQUIRE(CurveContext::GetByName("X25519") == CurveContext::GetByName("curve25519"));
+    
+    EccAlg alg(CurveContext::GetByName("curve25519"));
+    alg.GenerateKeys();
+    REQUIRE(alg.GetCurveName() == "curve25519");
+    REQUIRE(alg.GetPublicKey().size() == 32);
+    
+    uint8_t plaintextArr[] = { 'X', '2', '5', '5', '1', '9', ' ', 'E', 'C', 'I', 'E', 'S' };
+    vector<uint8_t> plaintext(plaintextArr, plaintextArr + sizeof(plaintextArr));
+    vector<uint8_t> ciphertext = alg.Encrypt(plaintext);
+    REQUIRE(ciphertext.size() == 32 + plaintext.size());
+    REQUIRE(alg.Decrypt(ciphertext) == plaintext);
+    
+    // Keys survive serialization, and a public key alone can only encrypt.
+    KeySerializer serializer;
+    EccAlg loaded = serializer.ParseKeys(serializer.SerializePrivateKeys(alg));
+    REQUIRE(loaded.Decrypt(ciphertext) == plaintext);
+    EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+    REQUIRE(alg.Decrypt(publicOnly.Encrypt(plaintext)) == plaintext);
+    REQUIRE_THROWS_AS(publicOnly.Decrypt(ciphertext), no_private_key);
+    
+    REQUIRE_THROWS_AS(alg.Sign(plaintext), invalid_argument);
+    REQUIRE_THROWS_AS(alg.SetKey(alg.GetPublicKey(), vector<uint8_t>(32, 1)), invalid_argument);
+}
+
+TEST_CASE("Ed25519MatchesRfc8032TestVectors")
+{
+    // RFC 8032, Section 7.1, tests 1 and 2.
+    vector<uint8_t> privateKey1 = utilities::HexStringToBytes("9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60");
+    vector<uint8_t> publicKey1 = utilities::HexStringToBytes("d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a");
+    vector<uint8_t> signature1 = utilities::HexStringToBytes("e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b");
+    REQUIRE(Ed25519::GetPublicKey(privateKey1) == publicKey1);
+    REQUIRE(Ed25519::Sign(privateKey1, vector<uint8_t>()) == signature1);
+    REQUIRE(Ed25519::Verify(publicKey1, vector<uint8_t>(), signature1));
+    
+    vector<uint8_t> privateKey2 = utilities::HexStringToBytes("4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb");
+    vector<uint8_t> publicKey2 = utilities::HexStringToBytes("3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c");
+    vector<uint8_t> message2(1, 0x72);
+    vector<uint8_t> signature2 = utilities::HexStringToBytes("92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00");
+    REQUIRE(Ed25519::GetPublicKey(privateKey2) == publicKey2);
+    REQUIRE(Ed25519::Sign(privateKey2, message2) == signature2);
+    REQUIRE(Ed25519::Verify(publicKey2, message2, signature2));
+    
+    // Wrong message, key or signature.
+    REQUIRE(!Ed25519::Verify(publicKey1, message2, signature2));
+    REQUIRE(!Ed25519::Verify(publicKey2, vector<uint8_t>(), signature2));
+    vector<uint8_t> tampered = signature2;
+    tampered[40] ^= 1;
+    REQUIRE(!Ed25519::Verify(publicKey2, message2, tampered));
+    REQUIRE(!Ed25519::Verify(publicKey2, message2, vector<uint8_t>(signature2.begin(), signature2.end() - 1)));
+    
+    // S + L satisfies the same equation but must be rejected as not reduced.
+    BigInteger order("1000000000000000000000000000000014def9dea2f79cd65812631a5cf5d3ed");
+    vector<uint8_t> S(signature2.rbegin(), signature2.rbegin() + 32);
+    vector<uint8_t> unreduced = (BigInteger(S) + order).GetMagnitudeBytes();
+    vector<uint8_t> malleated(signature2.begin(), signature2.begin() + 32);
+    malleated.insert(malleated.end(), unreduced.rbegin(), unreduced.rend());
+    malleated.resize(64);
+    REQUIRE(!Ed25519::Verify(publicKey2, message2, malleated));
+    
+    REQUIRE_THROWS_AS(Ed25519::Sign(vector<uint8_t>(31, 1), message2), invalid_argument);
+}
+
+TEST_CASE("EdwardsPointArithmetic")
+{
+    const EdwardsPoint& G = EdwardsPoint::GetBasePoint();
+    REQUIRE(G.Encode() == utilities::HexStringToBytes("5866666666666666666666666666666666666666666666666666666666666666"));
+    REQUIRE(EdwardsPoint().IsNeutralElement());
+    REQUIRE(!G.IsNeutralElement());
+    REQUIRE((G - G).IsNeutralElement());
+    REQUIRE((G + (-G)).IsNeutralElement());
+    REQUIRE((G + G) == EdwardsPoint(G).Double());
+    
+    // Small multiples through the table and through the multi-scalar multiplication.
+    vector<uint8_t> five(32, 0);
+    five[0] = 5;
+    EdwardsPoint fiveG = G + G + G + G + G;
+    REQUIRE(EdwardsPoint::MultiplyBasePoint(five) == fiveG);
+    REQUIRE(EdwardsPoint::MultiplyScalars(vector<vector<uint8_t>>(1, five), vector<EdwardsPoint>(1, G)) == fiveG);
+    
+    vector<uint8_t> scalar = NativeCrypto::HashData(vector<uint8_t>(1, 1));
+    scalar[31] &= 0x7F;
+    vector<uint8_t> other = NativeCrypto::HashData(vector<uint8_t>(1, 2));
+    other[31] &= 0x7F;
+    EdwardsPoint P = EdwardsPoint::MultiplyBasePoint(other);
+    EdwardsPoint expected = EdwardsPoint::MultiplyBasePoint(scalar) + EdwardsPoint::MultiplyScalars(vector<vector<uint8_t>>(1, scalar), vector<EdwardsPoint>(1, P));
+    vector<vector<uint8_t>> scalars;
+    scalars.push_back(scalar);
+    scalars.push_back(scalar);
+    vector<EdwardsPoint> points;
+    points.push_back(G);
+    points.push_back(P);
+    REQUIRE(EdwardsPoint::MultiplyScalars(scalars, points) == expected);
+    
+    // The base point has order L.
+    vector<uint8_t> order = utilities::HexStringToBytes("edd3f55c1a631258d69cf7a2def9de1400000000000000000000000000000010");
+    REQUIRE(EdwardsPoint::MultiplyBasePoint(order).IsNeutralElement());
+    REQUIRE(EdwardsPoint::MultiplyScalars(vector<vector<uint8_t>>(1, order), vector<EdwardsPoint>(1, P)).IsNeutralElement());
+    REQUIRE_THROWS_AS(EdwardsPoint::MultiplyBasePoint(vector<uint8_t>(32, 0xFF)), invalid_argument);
+    
+    // Encoding round trip, and rejection of y = p (not reduced) and of a y with no point (y = 2).
+    EdwardsPoint decoded;
+    REQUIRE(EdwardsPoint::TryDecode(P.Encode(), decoded));
+    REQUIRE(decoded == P);
+    REQUIRE(!EdwardsPoint::TryDecode(utilities::HexStringToBytes("edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f"), decoded));
+    REQUIRE(!EdwardsPoint::TryDecode(utilities::HexStringToBytes("0200000000000000000000000000000000000000000000000000000000000000"), decoded));
+}
+
+TEST_CASE("Ed25519BatchVerification")
+{
+    vector<SignedMessage> signedMessages;
+    for(uint8_t i = 0; i < 24; i++)
+    {
+        vector<uint8_t> privateKey(32, i);
+        SignedMessage signedMessage;
+        signedMessage.message = vector<uint8_t>(i, i);
+        signedMessage.publicKey = Ed25519::GetPublicKey(privateKey);
+        signedMessage.signature = Ed25519::Sign(privateKey, signedMessage.message);
+        signedMessages.push_back(signedMessage);
+    }
+    
+    vector<bool> results = Ed25519::VerifyBatch(signedMessages);
+    REQUIRE(count(results.begin(), results.end(), true) == 24);
+    REQUIRE(Ed25519::VerifyBatch(vector<SignedMessage>()).empty());
+    
+    // Invalid signatures are found among the valid ones.
+    signedMessages[3].message.push_back(0);
+    signedMessages[17].signature[10] ^= 0x40;
+    signedMessages[20].publicKey = signedMessages[21].publicKey;
+    signedMessages[22].signature.pop_back();
+    results = Ed25519::VerifyBatch(signedMessages);
+    for(size_t i = 0; i < signedMessages.size(); i++)
+        REQUIRE(results[i] == Ed25519::Verify(signedMessages[i].publicKey, signedMessages[i].message, signedMessages[i].signature));
+    REQUIRE(count(results.begin(), results.end(), true) == 20);
+}
+
+TEST_CASE("EccAlgSignsWithEd25519")
+{
+    vector<string> curves = CurveContext::GetSupportedCurveNames();
+    REQUIRE(find(curves.begin(), curves.end(), "ed25519") != curves.end());
+    REQUIRE(CurveContext::GetByName("Ed25519") == CurveContext::GetByName("ed25519"));
+    REQUIRE(CurveContext::GetByName("ed25519")->IsEd25519());
+    REQUIRE(!CurveContext::GetByName("ed25519")->IsX25519());
+    
+    EccAlg alg(CurveContext::GetByName("ed25519"));
+    alg.GenerateKeys();
+    REQUIRE(alg.GetCurveName() == "ed25519");
+    REQUIRE(alg.GetPublicKey() == Ed25519::GetPublicKey(alg.GetPrivateKey()));
+    
+    uint8_t messageArr[] = { 'E', 'd', '2', '5', '5', '1', '9' };
+    vector<uint8_t> message(messageArr, messageArr + sizeof(messageArr));
+    vector<uint8_t> signature = alg.Sign(message);
+    REQUIRE(signature.size() == 64);
+    REQUIRE(alg.Verify(message, signature));
+    REQUIRE(!alg.Verify(vector<uint8_t>(message.begin(), message.end() - 1), signature));
+    
+    // Keys survive serialization, and a public key alone can verify.
+    KeySerializer serializer;
+    EccAlg loaded = serializer.ParseKeys(serializer.SerializePrivateKeys(alg));
+    REQUIRE(loaded.Sign(message) == signature);
+    EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+    REQUIRE(publicOnly.Verify(message, signature));
+    REQUIRE_THROWS_AS(publicOnly.Sign(message), no_private_key);
+    
+    SignedMessage signedMessage = { message, signature, alg.GetPublicKey() };
+    REQUIRE(Ed25519::VerifyBatch(vector<SignedMessage>(3, signedMessage)) == vector<bool>(3, true));
+    REQUIRE(publicOnly.VerifyBatch(vector<SignedMessage>(3, signedMessage)) == vector<bool>(3, true));
+    
+    REQUIRE_THROWS_AS(alg.Encrypt(message), invalid_argument);
+    REQUIRE_THROWS_AS(alg.SetKey(alg.GetPublicKey(), vector<uint8_t>(32, 1)), invalid_argument);
+}
+
+TEST_CASE("BatchVerificationIsolatesInvalidSignatures")
+{
+    struct FakeSignature
+    {
+        size_t index;
+        bool isValid;
+    };
+    
+    vector<FakeSignature> signatures;
+    for(size_t i = 0; i < 13; i++)
+    {
+        FakeSignature signature = { i, (i != 2) && (i != 3) && (i != 11) };
+        signatures.push_back(signature);
+    }
+    vector<const FakeSignature*> group;
+    for(const auto& signature : signatures)
+        group.push_back(&signature);
+    
+    // A group passes its combined check only if all of its signatures are valid.
+    size_t checkCount = 0;
+    vector<bool> results(signatures.size(), false);
+    ecc::VerifyBatchGroup<FakeSignature>(group, [&checkCount](const vector<const FakeSignature*>& checkedGroup) -> bool
+    {
+        checkCount++;
+        for(auto signature : checkedGroup)
+        {
+            if(!signature->isValid)
+                return false;
+        }
+        return true;
+    }, results);
+    
+    for(const auto& signature : signatures)
+        REQUIRE(results[signature.index] == signature.isValid);
+    REQUIRE(checkCount < 2 * signatures.size());
+    
+    // Weights depend on the transcript and the position in the group.
+    ecc::BatchWeights weights(vector<uint8_t>(1, 1), NativeCrypto::HashDataWithSha512);
+    ecc::BatchWeights otherWeights(vector<uint8_t>(1, 2), NativeCrypto::HashDataWithSha512);
+    REQUIRE(weights.Get(0).size() == 16);
+    REQUIRE(weights.Get(0) == weights.Get(0));
+    REQUIRE(weights.Get(0) != weights.Get(1));
+    REQUIRE(weights.Get(0) != otherWeights.Get(0));
+}
+
+TEST_CASE("SchnorrMatchesBip340TestVectors")
+{
+    const EllipticCurve& curve = CurveContext::GetByName("secp256k1")->GetCurve();
+    
+    // BIP340 test vectors 0 and 1.
+    BigInteger privateKey("3");
+    vector<uint8_t> auxRandom(32, 0);
+    vector<uint8_t> message(32, 0);
+    vector<uint8_t> publicKey = utilities::HexStringToBytes("F9308A019258C31049344F85F89D5229B531C845836F99B08601F113BCE036F9");
+    vector<uint8_t> signature = utilities::HexStringToBytes("E907831F80848D1069A5371B402410364BDF1C5F8307B0084C55F1CE2DCA8215"
+        "25F66A4A85EA8B71E482A74F382D2CE5EBEEE8FDB2172F477DF4900D310536C0");
+    REQUIRE(Schnorr::GetPublicKey(curve, privateKey) == publicKey);
+    REQUIRE(Schnorr::Sign(curve, privateKey, message, auxRandom) == signature);
+    REQUIRE(Schnorr::Verify(curve, publicKey, message, signature));
+    
+    privateKey = BigInteger("B7E151628AED2A6ABF7158809CF4F3C762E7160F38B4DA56A784D9045190CFEF");
+    auxRandom[31] = 1;
+    message = utilities::HexStringToBytes("243F6A8885A308D313198A2E03707344A4093822299F31D0082EFA98EC4E6C89");
+    publicKey = utilities::HexStringToBytes("DFF1D77F2A671C5F36183726DB2341BE58FEAE1DA2DECED843240F7B502BA659");
+    signature = utilities::HexStringToBytes("6896BD60EEAE296DB48A229FF71DFE071BDE413E6D43F917DC8DCF8C78DE3341"
+        "8906D11AC976ABCCB20B091292BFF4EA897EFCB639EA871CFA95F6DE339E4B0A");
+    REQUIRE(Schnorr::GetPublicKey(curve, privateKey) == publicKey);
+    REQUIRE(Schnorr::Sign(curve, privateKey, message, auxRandom) == signature);
+    REQUIRE(Schnorr::Verify(curve, publicKey, message, signature));
+    
+    // Tampering with the message, r, s or the key is detected, as are s >= n and malformed input.
+    message[0] ^= 1;
+    REQUIRE(!Schnorr::Verify(curve, publicKey, message, signature));
+    message[0] ^= 1;
+    vector<uint8_t> tampered(signature);
+    tampered[5] ^= 0x10;
+    REQUIRE(!Schnorr::Verify(curve, publicKey, message, tampered));
+    tampered = signature;
+    tampered[60] ^= 0x10;
+    REQUIRE(!Schnorr::Verify(curve, publicKey, message, tampered));
+    REQUIRE(!Schnorr::Verify(curve, Schnorr::GetPublicKey(curve, BigInteger("3")), message, signature));
+    tampered = signature;
+    fill(tampered.begin() + 32, tampered.end(), 0xFF);
+    REQUIRE(!Schnorr::Verify(curve, publicKey, message, tampered));
+    REQUIRE(!Schnorr::Verify(curve, publicKey, message, vector<uint8_t>(signature.begin(), signature.end() - 1)));
+    REQUIRE(!Schnorr::Verify(curve, vector<uint8_t>(32, 0xFF), message, signature));
+    
+    REQUIRE(Schnorr::TaggedHash("BIP0340/challenge", vector<uint8_t>()).size() == 32);
+    REQUIRE_THROWS_AS(Schnorr::Sign(curve, privateKey, message, vector<uint8_t>(31, 0)), invalid_argument);
+    REQUIRE_THROWS_AS(Schnorr::Sign(curve, BigInteger(0), message, auxRandom), invalid_argument);
+    
+    const EllipticCurve& secp256r1 = CurveContext::GetByName("secp256r1")->GetCurve();
+    REQUIRE_THROWS_AS(Schnorr::Sign(secp256r1, privateKey, message, auxRandom), invalid_argument);
+}
+
+TEST_CASE("SchnorrBatchVerification")
+{
+    const EllipticCurve& curve = CurveContext::GetByName("secp256k1")->GetCurve();
+    
+    vector<SignedMessage> signedMessages;
+    for(uint8_t i = 1; i <= 12; i++)
+    {
+        BigInteger privateKey(vector<uint8_t>(32, i));
+        SignedMessage signedMessage;
+        signedMessage.message = vector<uint8_t>(i, i);
+        signedMessage.publicKey = Schnorr::GetPublicKey(curve, privateKey);
+        signedMessage.signature = Schnorr::Sign(curve, privateKey, signedMessage.message, vector<uint8_t>(32, i));
+        signedMessages.push_back(signedMessage);
+    }
+    
+    vector<bool> results = Schnorr::VerifyBatch(curve, signedMessages);
+    REQUIRE(count(results.begin(), results.end(), true) == 12);
+    REQUIRE(Schnorr::VerifyBatch(curve, vector<SignedMessage>()).empty());
+    
+    // Invalid signatures are found among the valid ones.
+    signedMessages[2].message.push_back(0);
+    signedMessages[7].signature[40] ^= 0x01;
+    signedMessages[9].publicKey = signedMessages[10].publicKey;
+    signedMessages[11].signature.pop_back();
+    results = Schnorr::VerifyBatch(curve, signedMessages);
+    for(size_t i = 0; i < signedMessages.size(); i++)
+        REQUIRE(results[i] == Schnorr::Verify(curve, signedMessages[i].publicKey, signedMessages[i].message, signedMessages[i].signature));
+    REQUIRE(count(results.begin(), results.end(), true) == 8);
+}
+
+TEST_CASE("EccAlgSignsWithSchnorr")
+{
+    EccAlg alg(CurveContext::GetByName("secp256k1"));
+    alg.GenerateKeys();
+    
+    uint8_t messageArr[] = { 'S', 'c', 'h', 'n', 'o', 'r', 'r' };
+    vector<uint8_t> message(messageArr, messageArr + sizeof(messageArr));
+    vector<uint8_t> signature = alg.SignSchnorr(message);
+    REQUIRE(signature.size() == 64);
+    REQUIRE(alg.VerifySchnorr(message, signature));
+    REQUIRE(!alg.VerifySchnorr(vector<uint8_t>(message.begin(), message.end() - 1), signature));
+    REQUIRE(!alg.Verify(message, signature));
+    
+    // The public key alone verifies, and the x-only key matches the one derived from the private key.
+    KeySerializer serializer;
+    EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+    REQUIRE(publicOnly.VerifySchnorr(message, signature));
+    REQUIRE(publicOnly.GetSchnorrPublicKey() == Schnorr::GetPublicKey(alg.GetCurve(), BigInteger(alg.GetPrivateKey())));
+    REQUIRE_THROWS_AS(publicOnly.SignSchnorr(message), no_private_key);
+    
+    SignedMessage signedMessage = { message, signature, alg.GetSchnorrPublicKey() };
+    REQUIRE(publicOnly.VerifySchnorrBatch(vector<SignedMessage>(3, signedMessage)) == vector<bool>(3, true));
+    
+    EccAlg other(CurveContext::GetByName("secp256r1"));
+    other.GenerateKeys();
+    REQUIRE_THROWS_AS(other.SignSchnorr(message), invalid_argument);
+    REQUIRE_THROWS_AS(other.GetSchnorrPublicKey(), invalid_argument);
+}
+
+TEST_CASE("ScalarMultiplicationAcrossThreads")
+{
+    // Curves with and without an endomorphism, with every split of the products across threads.
+    DomainParameters curves[] = { GetSecp256k1Curve(), GetNistP384Curve() };
+    for(const DomainParameters& params : curves)
+    {
+        EllipticCurve curve(params);
+        auto& G = curve.GetBasePoint();
+        BigInteger u1("C7D2A1B3E6F4091827364554637281900ABCDEF0123456789ABCDEF012345678");
+        BigInteger u2("5A3C9B1E77D2C4A09F1B3E6D2C8112345");
+        Point Q = curve.MultiplyBasePointWithScalar(BigInteger("123456789ABCDEF"));
+        Point R = curve.MultiplyBasePointWithScalar(BigInteger("FEDCBA987654321"));
+        
+        Point expectedBase = curve.MultiplyBasePointWithScalar(u1);
+        Point expectedWithG = curve.MultiplyDoubleScalar(u1, G, u2, Q);
+        Point expectedWithoutG = curve.MultiplyDoubleScalar(u1, R, u2, Q);
+        auto table = curve.PrecomputeFixedPointTable(Q);
+        
+        unsigned int threadCounts[] = { 0, 2, 3, 4, 64 };
+        for(unsigned int threadCount : threadCounts)
+        {
+            REQUIRE(curve.MultiplyBasePointWithScalar(u1, threadCount) == expectedBase);
+            REQUIRE(curve.MultiplyFixedPointWithScalar(*table, u2, threadCount) == curve.MultiplyPointOnCurveWithScalar(Q, u2));
+            REQUIRE(curve.MultiplyDoubleScalar(u1, G, u2, Q, threadCount) == expectedWithG);
+            REQUIRE(curve.MultiplyDoubleScalar(u1, R, u2, Q, threadCount) == expectedWithoutG);
+            REQUIRE(curve.MultiplyDoubleScalar(u1, u2, *table, threadCount) == expectedWithG);
+            REQUIRE(curve.DoubleScalarProductXEquals(u1, G, u2, Q, expectedWithG.x.GetRawInteger() % curve.GetBasePointOrder(), threadCount));
+            
+            // Products which cancel out.
+            REQUIRE(curve.MultiplyDoubleScalar(u1, Q, curve.GetBasePointOrder() - u1, Q, threadCount).IsPointAtInfinity());
+            REQUIRE(curve.MultiplyBasePointWithScalar(BigInteger(0), threadCount).IsPointAtInfinity());
+        }
+    }
+}
+
+TEST_CASE("WorkerPoolRunsEveryTask")
+{
+    WorkerPool& sharedPool = WorkerPool::GetSharedInstance();
+    REQUIRE(&sharedPool == &WorkerPool::GetSharedInstance());
+    REQUIRE(sharedPool.GetMaxWorkerCount() >= 1);
+    
+    // Pools with no workers, fewer workers than tasks, and the shared pool.
+    WorkerPool noWorkers(0);
+    WorkerPool twoWorkers(2);
+    WorkerPool* pools[] = { &noWorkers, &twoWorkers, &sharedPool };
+    for(WorkerPool* pool : pools)
+    {
+        for(unsigned int taskCount = 0; taskCount < 10; taskCount++)
+        {
+            vector<int> calls(taskCount, 0);
+            pool->Run(taskCount, [&calls](unsigned int index) { calls[index]++; });
+            REQUIRE(calls == vector<int>(taskCount, 1));
+        }
+        
+        // Runs from within tasks complete even when every worker is busy.
+        mutex callsMutex;
+        int nestedCalls = 0;
+        pool->Run(4, [&](unsigned int)
+        {
+            pool->Run(3, [&](unsigned int)
+            {
+                lock_guard<mutex> lock(callsMutex);
+                nestedCalls++;
+            });
+        });
+        REQUIRE(nestedCalls == 12);
+        
+        // An exception of a task is rethrown after all tasks have returned.
+        vector<int> calls(5, 0);
+        REQUIRE_THROWS_AS(pool->Run(5, [&calls](unsigned int index)
+        {
+            calls[index]++;
+            if(index == 3)
+                throw invalid_argument("Task failed.");
+        }), invalid_argument);
+        REQUIRE(calls == vector<int>(5, 1));
+    }
+}
+
+TEST_CASE("EccAlgVerifiesAcrossThreads")
+{
+    EccAlg alg(CurveContext::GetByName("secp256r1"));
+    REQUIRE(alg.GetOperationThreadCount() == 1);
+    alg.SetOperationThreadCount(2);
+    REQUIRE(alg.GetOperationThreadCount() == 2);
+    alg.GenerateKeys();
+    
+    uint8_t messageArr[] = { 'l', 'a', 't', 'e', 'n', 'c', 'y' };
+    vector<uint8_t> message(messageArr, messageArr + sizeof(messageArr));
+    vector<uint8_t> signature = alg.Sign(message);
+    REQUIRE(alg.Verify(message, signature));
+    REQUIRE(!alg.Verify(vector<uint8_t>(message.begin(), message.end() - 1), signature));
+    
+    // Signatures agree with algs which use a single thread, with and without cached public key tables.
+    KeySerializer serializer;
+    EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+    REQUIRE(publicOnly.Verify(message, signature));
+    publicOnly.SetOperationThreadCount(0);
+    publicOnly.SetPublicKeyTableCache(make_shared<PublicKeyTableCache>(1, 1));
+    for(int i = 0; i < 3; i++)
+        REQUIRE(publicOnly.Verify(message, signature));
+    REQUIRE(!publicOnly.Verify(message, alg.Sign(vector<uint8_t>(1, 'x'))));
+}
+
+TEST_CASE("MultiplyManyPointsSameScalar")
+{
+    DomainParameters curves[] = { GetSecp112r1Curve(), GetSecp256k1Curve(), GetNistP384Curve() };
+    for(const DomainParameters& params : curves)
+    {
+        EllipticCurve curve(params);
+        const BigInteger& n = curve.GetBasePointOrder();
+        
+        // Both the ladders (small batches) and the lockstep method, with odd and even scalars.
+        size_t counts[] = { 6, EllipticCurve::MIN_LOCKSTEP_POINTS + 2 };
+        BigInteger scalars[] = { n - BigInteger("123456789ABCDEF"), n - BigInteger("123456789ABCDE0") };
+        for(size_t count : counts)
+        {
+            vector<Point> points;
+            for(unsigned int i = 1; i < count - 1; i++)
+                points.push_back(curve.MultiplyBasePointWithScalar(BigInteger(i * 7919)));
+            points.push_back(EllipticCurve::PointAtInfinity);
+            points.push_back(curve.GetBasePoint());
+            
+            for(const BigInteger& scalar : scalars)
+            {
+                vector<Point> products = curve.MultiplyManyPointsSameScalar(points, scalar);
+                REQUIRE(products.size() == points.size());
+                REQUIRE(products[count - 2].IsPointAtInfinity());
+                for(size_t i = 0; i < points.size(); i++)
+                {
+                    if(i != count - 2)
+                        REQUIRE(products[i] == curve.MultiplyPointOnCurveWithScalar(points[i], scalar));
+                }
+            }
+            
+            // Tiny scalars, some of which hit the exceptional cases of the affine formulas.
+            for(unsigned int k = 0; k <= 18; k++)
+            {
+                vector<Point> products = curve.MultiplyManyPointsSameScalar(points, BigInteger(k));
+                REQUIRE(products[2] == curve.MultiplyPointOnCurveWithScalar(points[2], BigInteger(k), COZ_MONTGOMERY_LADDER));
+                REQUIRE(products[count - 2].IsPointAtInfinity());
+            }
+            REQUIRE(curve.MultiplyManyPointsSameScalar(points, n)[0].IsPointAtInfinity());
+            REQUIRE(curve.MultiplyManyPointsSameScalar(points, n - BigInteger(1))[0] == curve.InvertPoint(points[0]));
+        }
+        
+        REQUIRE(curve.MultiplyManyPointsSameScalar(vector<Point>(), n - BigInteger(1)).empty());
+    }
+}
+
+TEST_CASE("EccAlgDecryptsBatches")
+{
+    const char* curveNames[] = { "secp256r1", "curve25519" };
+    for(const char* curveName : curveNames)
+    {
+        EccAlg alg(CurveContext::GetByName(curveName));
+        alg.GenerateKeys();
+        
+        vector<vector<uint8_t>> plaintexts;
+        vector<vector<uint8_t>> ciphertexts;
+        for(uint8_t i = 0; i < 5; i++)
+        {
+            plaintexts.push_back(vector<uint8_t>(i * 9, i));
+            ciphertexts.push_back(alg.Encrypt(plaintexts.back()));
+        }
+        
+        REQUIRE(alg.DecryptBatch(ciphertexts) == plaintexts);
+        REQUIRE(alg.DecryptBatch(vector<vector<uint8_t>>()).empty());
+        
+        KeySerializer serializer;
+        EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+        REQUIRE_THROWS_AS(publicOnly.DecryptBatch(ciphertexts), no_private_key);
+    }
+}
+
+TEST_CASE("SequentialKeyEnumeratorDerivesPublicKeys")
+{
+    const char* curveNames[] = { "secp112r1", "secp256k1" };
+    for(const char* curveName : curveNames)
+    {
+        const EllipticCurve& curve = CurveContext::GetByName(curveName)->GetCurve();
+        const BigInteger& n = curve.GetBasePointOrder();
+        SequentialKeyEnumerator enumerator(curve, 7, 3);
+        
+        // Ranges starting mid-curve, at 1, and crossing n (whose multiple is the point at infinity).
+        BigInteger firsts[] = { BigInteger("123456789ABCDEF"), BigInteger(1), n - BigInteger(5) };
+        for(const BigInteger& first : firsts)
+        {
+            vector<Point> publicKeys = enumerator.DerivePublicKeys(first, 40);
+            REQUIRE(publicKeys.size() == 40);
+            for(size_t i = 0; i < publicKeys.size(); i++)
+                REQUIRE(publicKeys[i] == curve.MultiplyBasePointWithScalar(first + BigInteger(static_cast<unsigned int>(i))));
+        }
+        
+        REQUIRE(enumerator.DerivePublicKeys(BigInteger(1), 0).empty());
+        REQUIRE(enumerator.DerivePublicKeys(BigInteger(2), 2)[1] == curve.MultiplyBasePointWithScalar(BigInteger(3)));
+        
+        // Both the default block size and a single thread agree with small blocks across threads.
+        BigInteger first("FEDCBA987654321");
+        REQUIRE(SequentialKeyEnumerator(curve).DerivePublicKeys(first, 30) == enumerator.DerivePublicKeys(first, 30));
+        REQUIRE(SequentialKeyEnumerator(curve, 8, 1).DerivePublicKeys(first, 30) == enumerator.DerivePublicKeys(first, 30));
+    }
+    
+    const EllipticCurve& curve = CurveContext::GetByName("secp112r1")->GetCurve();
+    REQUIRE_THROWS_AS(SequentialKeyEnumerator(curve, 2), invalid_argument);
+}
+
+TEST_CASE("SequentialKeyEnumeratorFindsKeysWithPrefix")
+{
+    const EllipticCurve& curve = CurveContext::GetByName("secp112r1")->GetCurve();
+    SequentialKeyEnumerator enumerator(curve, 15, 3);
+    BigInteger first("ABCDEF");
+    
+    // Count the public keys whose x starts with the same byte as that of one key in the range the slow way.
+    vector<uint8_t> prefix = curve.MultiplyBasePointWithScalar(first + BigInteger(123)).Serialize();
+    prefix.resize(2);
+    uint64_t expectedCount = 0;
+    for(unsigned int i = 0; i < 500; i++)
+    {
+        if(curve.MultiplyBasePointWithScalar(first + BigInteger(i)).Serialize()[1] == prefix[1])
+            expectedCount++;
+    }
+    
+    // The handler runs on the enumeration threads, so the matches are checked after the search.
+    vector<BigInteger> found;
+    vector<Point> foundPublicKeys;
+    uint64_t matchCount = enumerator.FindKeysWithPrefix(first, 500, prefix, [&](const BigInteger& privateKey, const Point& publicKey) -> bool
+    {
+        found.push_back(privateKey);
+        foundPublicKeys.push_back(publicKey);
+        return true;
+    });
+    REQUIRE(matchCount >= 1);
+    REQUIRE(matchCount == expectedCount);
+    REQUIRE(found.size() == expectedCount);
+    for(size_t i = 0; i < found.size(); i++)
+        REQUIRE(curve.MultiplyBasePointWithScalar(found[i]) == foundPublicKeys[i]);
+    
+    // A prefix beyond x also compares y, and the key it came from must be found.
+    Point target = curve.MultiplyBasePointWithScalar(first + BigInteger(321));
+    vector<uint8_t> fullPrefix = target.Serialize();
+    fullPrefix.resize(fullPrefix.size() - 3);
+    found.clear();
+    REQUIRE(enumerator.FindKeysWithPrefix(first, 500, fullPrefix, [&](const BigInteger& privateKey, const Point&) -> bool
+    {
+        found.push_back(privateKey);
+        return true;
+    }) == 1);
+    REQUIRE(found.size() == 1);
+    REQUIRE(found[0] == first + BigInteger(321));
+    
+    // A prefix longer than a serialized point matches nothing.
+    vector<uint8_t> tooLongPrefix = target.Serialize();
+    tooLongPrefix.push_back(0);
+    found.clear();
+    REQUIRE(enumerator.FindKeysWithPrefix(first, 500, tooLongPrefix, [&](const BigInteger& privateKey, const Point&) -> bool
+    {
+        found.push_back(privateKey);
+        return true;
+    }) == 0);
+    REQUIRE(found.empty());
+    
+    // Returning false stops the search, and a wrong flag byte never matches.
+    uint64_t stoppedCount = enumerator.FindKeysWithPrefix(first, 500, vector<uint8_t>(1, prefix[0]), [](const BigInteger&, const Point&) -> bool
+    {
+        return false;
+    });
+    REQUIRE(stoppedCount >= 1);
+    REQUIRE(stoppedCount <= 3);
+    REQUIRE(enumerator.FindKeysWithPrefix(first, 500, vector<uint8_t>(1, 0x07), [](const BigInteger&, const Point&) -> bool
+    {
+        return true;
+    }) == 0);
+    
+    // A handler which throws stops the search on every thread, and the exception reaches the caller.
+    REQUIRE_THROWS_AS(enumerator.FindKeysWithPrefix(first, 500, vector<uint8_t>(1, prefix[0]), [](const BigInteger&, const Point&) -> bool
+    {
+        throw runtime_error("Handler failed.");
+    }), runtime_error);
+    REQUIRE(enumerator.FindKeysWithPrefix(first, 500, fullPrefix, [](const BigInteger&, const Point&) -> bool
+    {
+        return true;
+    }) == 1);
+}
+
+TEST_CASE("ChaCha20DrbgMatchesRfc8439KeyStream")
+{
+    // With a zero key, the first refill is the key stream of RFC 8439, Appendix A.1 (test vectors 1 and 2),
+    //  of which the first 32 bytes become the next key.
+    ChaCha20Drbg drbg(vector<uint8_t>(ChaCha20Drbg::KEY_SIZE, 0));
+    REQUIRE(drbg.GenerateBytes(64) == utilities::HexStringToBytes(
+        "da41597c5157488d7724e03fb8d84a376a43b8f41518a11cc387b669b2ee6586"
+        "9f07e7be5551387a98ba977c732d080dcb0f29a048e3656912c6533e32ee7aed"));
+    
+    vector<uint8_t> rest(ChaCha20Drbg::BLOCK_COUNT * 64 - 32 - 64);
+    drbg.Generate(rest.data(), rest.size());
+    REQUIRE(drbg.GenerateBytes(32) == utilities::HexStringToBytes("afbdad2845b93cdbb2fe6463d2fe162adae0f6e676f0494218f5ce0596e79f5c"));
+    
+    REQUIRE(drbg.GenerateBytes(0).empty());
+    REQUIRE_THROWS_AS(ChaCha20Drbg(vector<uint8_t>(31, 0)), invalid_argument);
+}
+
+TEST_CASE("ChaCha20DrbgGeneratesIntegersInRange")
+{
+    ChaCha20Drbg drbg(vector<uint8_t>(ChaCha20Drbg::KEY_SIZE, 7));
+    
+    // Small ranges hit every value, and never zero or the maximum.
+    vector<int> counts(7, 0);
+    for(int i = 0; i < 600; i++)
+    {
+        BigInteger value = drbg.GenerateIntegerBelow(BigInteger(7u));
+        for(unsigned int v = 0; v < 7; v++)
+        {
+            if(value == BigInteger(v))
+                counts[v]++;
+        }
+    }
+    REQUIRE(counts[0] == 0);
+    for(int v = 1; v < 7; v++)
+        REQUIRE(counts[v] > 50);
+    REQUIRE(drbg.GenerateIntegerBelow(BigInteger(2u)) == BigInteger(1u));
+    REQUIRE_THROWS_AS(drbg.GenerateIntegerBelow(BigInteger(1u)), invalid_argument);
+    
+    const BigInteger& n = CurveContext::GetByName("secp256r1")->GetCurve().GetBasePointOrder();
+    for(int i = 0; i < 50; i++)
+    {
+        BigInteger value = drbg.GenerateIntegerBelow(n);
+        REQUIRE(value > BigInteger());
+        REQUIRE(value < n);
+    }
+    
+    // Every thread has its own generator, seeded separately.
+    ChaCha20Drbg* otherInstance = nullptr;
+    vector<uint8_t> otherBytes;
+    thread other([&otherInstance, &otherBytes]()
+    {
+        otherInstance = &ChaCha20Drbg::GetThreadInstance();
+        otherBytes = otherInstance->GenerateBytes(32);
+    });
+    other.join();
+    
+    REQUIRE(&ChaCha20Drbg::GetThreadInstance() == &ChaCha20Drbg::GetThreadInstance());
+    REQUIRE(&ChaCha20Drbg::GetThreadInstance() != otherInstance);
+    REQUIRE(ChaCha20Drbg::GetThreadInstance().GenerateBytes(32) != otherBytes);
+}
+
+#if !defined(_WIN32)
+TEST_CASE("ChaCha20DrbgReseedsAfterFork")
+{
+    // Leave buffered output behind, which a forked child must not hand out again.
+    ChaCha20Drbg& drbg = ChaCha20Drbg::GetThreadInstance();
+    drbg.GenerateBytes(1);
+    
+    int pipeDescriptors[2];
+    REQUIRE(pipe(pipeDescriptors) == 0);
+    
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if(child == 0)
+    {
+        vector<uint8_t> childBytes = ChaCha20Drbg::GetThreadInstance().GenerateBytes(32);
+        ssize_t written = write(pipeDescriptors[1], childBytes.data(), childBytes.size());
+        _exit(written == static_cast<ssize_t>(childBytes.size()) ? 0 : 1);
+    }
+    
+    vector<uint8_t> parentBytes = drbg.GenerateBytes(32);
+    vector<uint8_t> childBytes(32);
+    ssize_t readSize = read(pipeDescriptors[0], childBytes.data(), childBytes.size());
+    int status = 0;
+    waitpid(child, &status, 0);
+    close(pipeDescriptors[0]);
+    close(pipeDescriptors[1]);
+    
+    REQUIRE(readSize == 32);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(childBytes != parentBytes);
+}
+#endif
+
+TEST_CASE("EphemeralKeyPoolRefills")
+{
+    auto context = CurveContext::GetByName("secp112r1");
+    const EllipticCurve& curve = context->GetCurve();
+    auto n = make_shared<const BigInteger>(curve.GetBasePointOrder());
+    
+    EphemeralKeyPool pool(context, 40);
+    REQUIRE(pool.GetDepth() == 40);
+    pool.Fill();
+    REQUIRE(pool.GetSize() == 40);
+    
+    // Every key is valid and handed out once.
+    vector<BigInteger> taken;
+    for(int i = 0; i < 50; i++)
+    {
+        EphemeralKeyPool::EphemeralKey key = pool.Take();
+        REQUIRE(key.R == curve.MultiplyBasePointWithScalar(key.k));
+        FieldElement product = FieldElement(key.k, n) * FieldElement(key.inverseK, n);
+        REQUIRE(product == BigInteger(1u));
+        REQUIRE(find(taken.begin(), taken.end(), key.k) == taken.end());
+        taken.push_back(key.k);
+    }
+    
+    EphemeralKeyPool::Statistics statistics = pool.GetStatistics();
+    uint64_t takeCount = statistics.hits + statistics.misses;
+    REQUIRE(takeCount == 50);
+    REQUIRE(statistics.hits >= 40);
+    
+    // The refill thread brings the pool back to its depth.
+    for(int i = 0; (i < 1000) && (pool.GetSize() < 40); i++)
+        this_thread::sleep_for(chrono::milliseconds(10));
+    REQUIRE(pool.GetSize() == 40);
+    REQUIRE(pool.GetStatistics().refills >= 80 - statistics.misses);
+    
+    REQUIRE_THROWS_AS(EphemeralKeyPool(context, 0), invalid_argument);
+    REQUIRE_THROWS_AS(EphemeralKeyPool(CurveContext::GetByName("curve25519")), invalid_argument);
+}
+
+#if !defined(_WIN32)
+TEST_CASE("EphemeralKeyPoolDiscardsKeysAfterFork")
+{
+    auto context = CurveContext::GetByName("secp112r1");
+    EphemeralKeyPool pool(context, 8);
+    pool.Fill();
+    
+    int pipeDescriptors[2];
+    REQUIRE(pipe(pipeDescriptors) == 0);
+    
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if(child == 0)
+    {
+        // The child must not take the key at the front of the parent's pool.
+        vector<uint8_t> childK = pool.Take().k.GetMagnitudeBytes();
+        childK.resize(32);
+        ssize_t written = write(pipeDescriptors[1], childK.data(), childK.size());
+        _exit(written == static_cast<ssize_t>(childK.size()) ? 0 : 1);
+    }
+    
+    vector<uint8_t> parentK = pool.Take().k.GetMagnitudeBytes();
+    parentK.resize(32);
+    vector<uint8_t> childK(32);
+    ssize_t readSize = read(pipeDescriptors[0], childK.data(), childK.size());
+    int status = 0;
+    waitpid(child, &status, 0);
+    close(pipeDescriptors[0]);
+    close(pipeDescriptors[1]);
+    
+    REQUIRE(readSize == 32);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(childK != parentK);
+    REQUIRE(pool.GetStatistics().hits == 1);
+}
+#endif
+
+TEST_CASE("EccAlgSignsWithEphemeralKeyPool")
+{
+    auto context = CurveContext::GetByName("secp256r1");
+    EccAlg alg(context);
+    alg.GenerateKeys();
+    
+    auto pool = make_shared<EphemeralKeyPool>(context, 8);
+    alg.SetEphemeralKeyPool(pool);
+    REQUIRE(alg.GetEphemeralKeyPool() == pool);
+    pool->Fill();
+    
+    for(uint8_t i = 0; i < 4; i++)
+    {
+        vector<uint8_t> message(i * 5 + 1, i);
+        REQUIRE(alg.Verify(message, alg.Sign(message)));
+        REQUIRE(alg.Decrypt(alg.Encrypt(message)) == message);
+    }
+    
+    EphemeralKeyPool::Statistics statistics = pool->GetStatistics();
+    uint64_t takeCount = statistics.hits + statistics.misses;
+    REQUIRE(takeCount == 8);
+    
+    // Without a pool, keys are computed inline again.
+    alg.SetEphemeralKeyPool(nullptr);
+    REQUIRE(alg.Verify(vector<uint8_t>(3, 1), alg.Sign(vector<uint8_t>(3, 1))));
+    statistics = pool->GetStatistics();
+    takeCount = statistics.hits + statistics.misses;
+    REQUIRE(takeCount == 8);
+    
+    REQUIRE_THROWS_AS(alg.SetEphemeralKeyPool(make_shared<EphemeralKeyPool>(CurveContext::GetByName("secp112r1"), 1)), invalid_argument);
+}
+
+TEST_CASE("EccAlgSignsBatches")
+{
+    const char* curveNames[] = { "secp256r1", "secp256k1", "ed25519" };
+    for(const char* curveName : curveNames)
+    {
+        EccAlg alg(CurveContext::GetByName(curveName));
+        alg.GenerateKeys();
+        
+        vector<vector<uint8_t>> messages;
+        for(uint8_t i = 0; i < 5; i++)
+            messages.push_back(vector<uint8_t>(i * 11, i));
+        messages.push_back(messages[1]);
+        
+        unsigned int threadCounts[] = { 1, 3 };
+        for(unsigned int threadCount : threadCounts)
+        {
+            alg.SetOperationThreadCount(threadCount);
+            vector<vector<uint8_t>> signatures = alg.SignBatch(messages);
+            REQUIRE(signatures.size() == messages.size());
+            for(size_t i = 0; i < messages.size(); i++)
+                REQUIRE(alg.Verify(messages[i], signatures[i]));
+            REQUIRE_FALSE(alg.Verify(messages[2], signatures[3]));
+            
+            // ECDSA draws a fresh k for every message, even a repeated one.
+            if(string(curveName) != "ed25519")
+                REQUIRE(signatures[1] != signatures[5]);
+        }
+        
+        REQUIRE(alg.SignBatch(vector<vector<uint8_t>>()).empty());
+        
+        KeySerializer serializer;
+        EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(alg));
+        REQUIRE_THROWS_AS(publicOnly.SignBatch(messages), no_private_key);
+    }
+    
+    // Products of the base point split across threads match those computed one at a time.
+    const EllipticCurve& curve = CurveContext::GetByName("secp112r1")->GetCurve();
+    vector<BigInteger> scalars;
+    for(unsigned int i = 1; i <= 7; i++)
+        scalars.push_back(BigInteger(i * 1000003u));
+    vector<Point> products = curve.MultiplyBasePointWithScalars(scalars, 3);
+    for(size_t i = 0; i < scalars.size(); i++)
+        REQUIRE(products[i] == curve.MultiplyBasePointWithScalar(scalars[i]));
+}
+
+TEST_CASE("MultiplyBasePointWithScalarsInLockstep")
+{
+    const char* curveNames[] = { "secp112r1", "secp256r1" };
+    for(const char* curveName : curveNames)
+    {
+        const EllipticCurve& curve = CurveContext::GetByName(curveName)->GetCurve();
+        const BigInteger& n = curve.GetBasePointOrder();
+        
+        // Enough scalars to walk the combs in lockstep, including zero, n, scalars beyond n, tiny scalars
+        //  (which hit exceptional cases) and random ones.
+        vector<BigInteger> scalars;
+        scalars.push_back(BigInteger());
+        scalars.push_back(n);
+        scalars.push_back(n + BigInteger(5u));
+        scalars.push_back(n - BigInteger(1u));
+        for(unsigned int i = 1; i <= 8; i++)
+            scalars.push_back(BigInteger(i));
+        ChaCha20Drbg drbg(vector<uint8_t>(ChaCha20Drbg::KEY_SIZE, 3));
+        while(scalars.size() < 2 * EllipticCurve::MIN_LOCKSTEP_POINTS + 3)
+            scalars.push_back(drbg.GenerateIntegerBelow(n));
+        
+        unsigned int threadCounts[] = { 1, 2 };
+        for(unsigned int threadCount : threadCounts)
+        {
+            vector<Point> products = curve.MultiplyBasePointWithScalars(scalars, threadCount);
+            REQUIRE(products.size() == scalars.size());
+            REQUIRE(products[0].IsPointAtInfinity());
+            REQUIRE(products[1].IsPointAtInfinity());
+            for(size_t i = 2; i < scalars.size(); i++)
+                REQUIRE(products[i] == curve.MultiplyBasePointWithScalar(scalars[i]));
+        }
+    }
+}
+
+TEST_CASE("EccAlgRecoversPublicKeys")
+{
+    const char* curveNames[] = { "secp112r1", "secp224r1", "secp256r1", "secp256k1" };
+    for(const char* curveName : curveNames)
+    {
+        EccAlg alg(CurveContext::GetByName(curveName));
+        alg.GenerateKeys();
+        EccAlg verifier(CurveContext::GetByName(curveName));
+        
+        for(uint8_t i = 0; i < 3; i++)
+        {
+            vector<uint8_t> message(i * 7 + 1, i);
+            vector<uint8_t> signature = alg.SignRecoverable(message);
+            REQUIRE(signature.back() < 4);
+            
+            // Without the recovery id it is a regular signature.
+            REQUIRE(alg.Verify(message, vector<uint8_t>(signature.begin(), signature.end() - 1)));
+            
+            // Any alg on the curve recovers the signer's key, and the wrong recovery id or message gives
+            //  another key.
+            REQUIRE(verifier.RecoverPublicKey(message, signature) == alg.GetPublicKey());
+            REQUIRE(alg.RecoverPublicKey(message, signature) == alg.GetPublicKey());
+            REQUIRE(verifier.RecoverPublicKey(vector<uint8_t>(3, 9), signature) != alg.GetPublicKey());
+            
+            vector<uint8_t> flipped = signature;
+            flipped.back() ^= 1;
+            REQUIRE(verifier.RecoverPublicKey(message, flipped) != alg.GetPublicKey());
+        }
+        
+        REQUIRE_THROWS_AS(verifier.RecoverPublicKey(vector<uint8_t>(1, 0), vector<uint8_t>()), invalid_argument);
+        REQUIRE_THROWS_AS(verifier.RecoverPublicKey(vector<uint8_t>(1, 0), vector<uint8_t>(5, 4)), invalid_argument);
+        REQUIRE_THROWS_AS(verifier.SignRecoverable(vector<uint8_t>(1, 0)), no_private_key);
+    }
+    
+    EccAlg ed25519(CurveContext::GetByName("ed25519"));
+    ed25519.GenerateKeys();
+    REQUIRE_THROWS_AS(ed25519.SignRecoverable(vector<uint8_t>(1, 0)), invalid_argument);
+}
+
+TEST_CASE("SharedSecretCacheEvictsAndInvalidates")
+{
+    SharedSecretCache cache(2);
+    vector<uint8_t> ownKey(5, 1);
+    vector<uint8_t> otherOwnKey(5, 2);
+    vector<uint8_t> secret;
+    REQUIRE_FALSE(cache.Lookup("secp256r1", ownKey, vector<uint8_t>(5, 7), secret));
+    REQUIRE(cache.GetStatistics().GetHitRate() == 0.0);
+    
+    cache.Insert("secp256r1", ownKey, vector<uint8_t>(5, 7), vector<uint8_t>(3, 7));
+    cache.Insert("secp256r1", otherOwnKey, vector<uint8_t>(5, 7), vector<uint8_t>(3, 8));
+    REQUIRE(cache.Lookup("secp256r1", ownKey, vector<uint8_t>(5, 7), secret));
+    REQUIRE(secret == vector<uint8_t>(3, 7));
+    REQUIRE_FALSE(cache.Lookup("secp384r1", ownKey, vector<uint8_t>(5, 7), secret));
+    
+    // The least recently used secret (of the other key) is evicted.
+    cache.Insert("secp256r1", ownKey, vector<uint8_t>(5, 9), vector<uint8_t>(3, 9));
+    REQUIRE(cache.GetSize() == 2);
+    REQUIRE_FALSE(cache.Lookup("secp256r1", otherOwnKey, vector<uint8_t>(5, 7), secret));
+    
+    SharedSecretCache::Statistics statistics = cache.GetStatistics();
+    REQUIRE(statistics.hits == 1);
+    REQUIRE(statistics.misses == 3);
+    REQUIRE(statistics.evictions == 1);
+    REQUIRE(statistics.GetHitRate() == 0.25);
+    
+    // Invalidating an own key removes all of its secrets.
+    cache.Invalidate("secp256r1", ownKey);
+    REQUIRE(cache.GetSize() == 0);
+    REQUIRE(cache.GetStatistics().invalidations == 2);
+    
+    REQUIRE_THROWS_AS(SharedSecretCache(0), invalid_argument);
+}
+
+TEST_CASE("EccAlgComputesSharedSecrets")
+{
+    const char* curveNames[] = { "secp256r1", "curve25519" };
+    for(const char* curveName : curveNames)
+    {
+        EccAlg alice(CurveContext::GetByName(curveName));
+        EccAlg bob(CurveContext::GetByName(curveName));
+        alice.GenerateKeys();
+        bob.GenerateKeys();
+        
+        vector<uint8_t> secret = alice.ComputeSharedSecret(bob.GetPublicKey());
+        REQUIRE(secret.size() == 32);
+        REQUIRE(bob.ComputeSharedSecret(alice.GetPublicKey()) == secret);
+        
+        // Repeated agreements with a peer come from the cache.
+        auto cache = make_shared<SharedSecretCache>();
+        alice.SetSharedSecretCache(cache);
+        REQUIRE(alice.GetSharedSecretCache() == cache);
+        REQUIRE(alice.ComputeSharedSecret(bob.GetPublicKey()) == secret);
+        REQUIRE(alice.ComputeSharedSecret(bob.GetPublicKey()) == secret);
+        REQUIRE(alice.ComputeSharedSecret(bob.GetPublicKey()) == secret);
+        REQUIRE(cache->GetStatistics().hits == 2);
+        REQUIRE(cache->GetStatistics().misses == 1);
+        REQUIRE(cache->GetSize() == 1);
+        
+        // Rotating the key removes its secrets.
+        alice.GenerateKeys();
+        REQUIRE(cache->GetSize() == 0);
+        REQUIRE(cache->GetStatistics().invalidations == 1);
+        vector<uint8_t> rotatedSecret = alice.ComputeSharedSecret(bob.GetPublicKey());
+        REQUIRE(rotatedSecret != secret);
+        REQUIRE(bob.ComputeSharedSecret(alice.GetPublicKey()) == rotatedSecret);
+        
+        KeySerializer serializer;
+        EccAlg publicOnly = serializer.ParseKeys(serializer.SerializePublicKeys(bob));
+        REQUIRE_THROWS_AS(publicOnly.ComputeSharedSecret(alice.GetPublicKey()), no_private_key);
+        REQUIRE_THROWS_AS(alice.ComputeSharedSecret(vector<uint8_t>(5, 4)), invalid_argument);
+    }
+    
+    // Peer keys which are not on the curve or of small order are rejected.
+    EccAlg alg(CurveContext::GetByName("secp256r1"));
+    alg.GenerateKeys();
+    vector<uint8_t> offCurve = alg.GetPublicKey();
+    offCurve.back() ^= 1;
+    REQUIRE_THROWS_AS(alg.ComputeSharedSecret(offCurve), invalid_argument);
+    
+    EccAlg x25519(CurveContext::GetByName("curve25519"));
+    x25519.GenerateKeys();
+    REQUIRE_THROWS_AS(x25519.ComputeSharedSecret(vector<uint8_t>(32, 0)), invalid_argument);
+    
+    EccAlg ed25519(CurveContext::GetByName("ed25519"));
+    ed25519.GenerateKeys();
+    REQUIRE_THROWS_AS(ed25519.ComputeSharedSecret(ed25519.GetPublicKey()), invalid_argument);
+}